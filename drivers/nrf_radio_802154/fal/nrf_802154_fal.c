@@ -37,10 +37,26 @@
 #include <stdint.h>
 
 #include "nrf_802154_fal.h"
+#include "fem/nrf_fem_protocol_api.h"
 
 int8_t nrf_802154_fal_tx_power_get(const uint8_t channel, const int8_t power)
 {
+    int8_t  pa_gain;
+    int32_t tx_power;
+
     (void)channel;
 
-    return power;
+    nrf_802154_fal_pa_is_configured(&pa_gain);
+    tx_power = (int32_t)power - pa_gain;
+
+    if (tx_power < INT8_MIN)
+    {
+        tx_power = INT8_MIN;
+    }
+    else if (tx_power > INT8_MAX)
+    {
+        tx_power = INT8_MAX;
+    }
+
+    return (int8_t)tx_power;
 }
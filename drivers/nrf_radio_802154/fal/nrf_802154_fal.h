@@ -43,14 +43,18 @@ extern "C" {
 #endif
 
 /**
- * @brief Returns 'power' value.
+ * @brief Converts the transmit power at the FEM output to the power at the RADIO output.
  *
- * @note This is a stub implementation used when MPSL is not linked.
+ * The gain of the Power Amplifier reported by @ref nrf_802154_fal_pa_is_configured is subtracted
+ * from @p power. This is the only place where the gain is compensated.
+ *
+ * @note This is a stub implementation used when MPSL is not linked. MPSL provides its own
+ *       implementation, which compensates the gain of the FEM it controls.
  *
  * @param[in]  channel  Ignored.
- * @param[in]  power    TX power in dbm.
+ * @param[in]  power    TX power at the FEM output in dBm.
  *
- * @returns Value of 'power' argument.
+ * @returns TX power at the RADIO output in dBm.
  */
 int8_t nrf_802154_fal_tx_power_get(const uint8_t channel, const int8_t power);
 
@@ -60,4 +60,5 @@ typedef struct
     uint8_t                      lna_gpiote_ch_id; /**< GPIOTE channel used for Low Noise Amplifier pin toggling. */
     uint8_t                      ppi_ch_id_set;    /**< PPI channel used for radio Power Amplifier and Low Noise Amplifier pins setting. */
     uint8_t                      ppi_ch_id_clr;    /**< PPI channel used for radio pin clearing. */
+    int8_t                       pa_fixed_gain_db; /**< Fixed gain of the Power Amplifier in dB. The driver subtracts it from the requested transmit power, so that the power is reached at the FEM output. */
 } nrf_fem_control_cfg_t;
@@ -60,6 +60,7 @@ typedef struct
         uint32_t lna_time_gap_us;               /* Time between the activation of the LNA pin and the start of the radio reception. */
         int8_t   pa_gain_db;                    /* Configurable PA gain. Ignored if the amplifier is not supporting this feature. */
         int8_t   lna_gain_db;                   /* Configurable LNA gain. Ignored if the amplifier is not supporting this feature. */
+        int8_t   pa_fixed_gain_db;              /* Fixed gain of the PA. Subtracted from the requested transmit power when it is converted to the RADIO setting. */
     }                           fem_config;
 
     nrf_fem_gpiote_pin_config_t pa_pin_config;  /* Power Amplifier pin configuration. */
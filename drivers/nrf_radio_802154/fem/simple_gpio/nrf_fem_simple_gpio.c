@@ -469,6 +469,12 @@ void nrf_802154_fal_cleanup(void)
     }
 }
 
+void nrf_802154_fal_pa_is_configured(int8_t * const p_gain)
+{
+    *p_gain = m_nrf_fem_interface_config.pa_pin_config.enable ?
+              m_nrf_fem_interface_config.fem_config.pa_fixed_gain_db : 0;
+}
+
 bool nrf_fem_prepare_powerdown(NRF_TIMER_Type  * p_instance,
                                uint32_t          compare_channel,
                                nrf_ppi_channel_t ppi_id)
@@ -41,6 +41,7 @@
 #include <string.h>
 
 #include "mac_features/nrf_802154_frame_parser.h"
+#include "mac_features/nrf_802154_indirect_tx.h"
 #include "nrf_802154_config.h"
 #include "nrf_802154_const.h"
 
@@ -581,6 +582,35 @@ static void ie_data_add(uint32_t location, bool extended, const uint8_t * p_data
     }
 }
 
+/**
+ * @brief Checks if the IE data to set is a well-formed list of Header IEs that fits in the buffer.
+ *
+ * @param[in]  p_data    Pointer to the IE data.
+ * @param[in]  data_len  Length of the IE data.
+ *
+ * @retval  true   The IE data can be inserted in ACK frames.
+ * @retval  false  The IE data is too long, or an IE does not fit in it or terminates the IEs.
+ */
+static bool ie_data_is_valid(const uint8_t * p_data, uint8_t data_len)
+{
+    nrf_802154_frame_parser_ie_iterator_t iterator;
+    nrf_802154_frame_parser_ie_t          ie;
+
+    if (data_len > NRF_802154_MAX_ACK_IE_SIZE)
+    {
+        return false;
+    }
+
+    nrf_802154_frame_parser_ie_iterator_data_init(p_data, data_len, &iterator);
+
+    while (nrf_802154_frame_parser_ie_iterator_next(&iterator, &ie))
+    {
+        // Intentionally empty: the IEs are only checked.
+    }
+
+    return nrf_802154_frame_parser_ie_iterator_end_reached(&iterator);
+}
+
 /***************************************************************************************************
  * @section Public API
  **************************************************************************************************/
@@ -607,6 +637,11 @@ bool nrf_802154_ack_data_for_addr_set(const uint8_t * p_addr,
 {
     uint32_t location = 0;
 
+    if ((data_type == NRF_802154_ACK_DATA_IE) && !ie_data_is_valid(p_data, data_len))
+    {
+        return false;
+    }
+
     if (addr_index_find(p_addr, &location, data_type, extended) ||
         addr_add(p_addr, location, data_type, extended))
     {
@@ -706,6 +741,13 @@ bool nrf_802154_ack_data_pending_bit_should_be_set(const uint8_t * p_frame)
             assert(false);
     }
 
+#if NRF_802154_INDIRECT_TX_ENABLED
+    if (!ret)
+    {
+        ret = nrf_802154_indirect_tx_pending_check(p_frame);
+    }
+#endif // NRF_802154_INDIRECT_TX_ENABLED
+
     return ret;
 }
 
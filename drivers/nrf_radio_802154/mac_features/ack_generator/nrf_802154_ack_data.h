@@ -68,7 +68,8 @@ void nrf_802154_ack_data_enable(bool enabled);
  * @param[in]  data_len  Length of the @p p_data buffer.
  *
  * @retval true   Address successfully added to the list.
- * @retval false  Address not added to the list (list is full).
+ * @retval false  Address not added to the list (list is full), or the IE data is longer than
+ *                @ref NRF_802154_MAX_ACK_IE_SIZE or is not a well-formed list of Header IEs.
  */
 bool nrf_802154_ack_data_for_addr_set(const uint8_t * p_addr,
                                       bool            extended,
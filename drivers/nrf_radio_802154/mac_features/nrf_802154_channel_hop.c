@@ -0,0 +1,202 @@
+/* Copyright (c) 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements the multi-channel listen feature of the 802.15.4 driver.
+ *
+ */
+
+#include "nrf_802154_channel_hop.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_core.h"
+#include "nrf_802154_request.h"
+#include "timer_scheduler/nrf_802154_timer_sched.h"
+
+#if NRF_802154_CHANNEL_HOP_ENABLED
+
+#define MIN_CHANNEL 11 ///< Lowest channel in the 2.4 GHz band.
+#define MAX_CHANNEL 26 ///< Highest channel in the 2.4 GHz band.
+
+static uint8_t                        m_channels[NRF_802154_CHANNEL_HOP_MAX_CHANNELS]; ///< Hopping sequence.
+static uint8_t                        m_count;                                         ///< Number of channels in the hopping sequence.
+static volatile uint8_t               m_index;                                         ///< Index of the current channel.
+static volatile bool                  m_active;                                        ///< If hopping is active.
+static volatile bool                  m_locked;                                        ///< If a frame is being received on the current channel.
+static uint32_t                       m_search_t0;                                     ///< Time when the search for a frame started [us].
+static nrf_802154_timer_t             m_dwell_timer;                                   ///< Timer that ends the dwell on a channel.
+static nrf_802154_channel_hop_stats_t m_stats;                                         ///< Multi-channel listen statistics.
+
+/**
+ * @brief Starts the dwell on the current channel.
+ *
+ * @param[in]  t0  Time when the dwell starts [us].
+ */
+static void dwell_timer_start(uint32_t t0)
+{
+    nrf_802154_timer_sched_remove(&m_dwell_timer, NULL);
+
+    m_dwell_timer.t0 = t0;
+    nrf_802154_timer_sched_add(&m_dwell_timer, false);
+}
+
+static void dwell_timer_fired(void * p_context)
+{
+    (void)p_context;
+
+    if (!m_active || m_locked)
+    {
+        // The timer is started again when the frame is handled.
+        return;
+    }
+
+    // Changing the frequency is only safe when no transmission is in progress.
+    if (nrf_802154_core_state_get() == RADIO_STATE_RX)
+    {
+        m_index = (m_index + 1 < m_count) ? (m_index + 1) : 0;
+        m_stats.hops++;
+
+        (void)nrf_802154_request_channel_update();
+    }
+
+    dwell_timer_start(m_dwell_timer.t0 + m_dwell_timer.dt);
+}
+
+void nrf_802154_channel_hop_init(void)
+{
+    m_active = false;
+    m_locked = false;
+    m_count  = 0;
+    m_index  = 0;
+
+    memset(&m_stats, 0, sizeof(m_stats));
+
+    m_dwell_timer.callback  = dwell_timer_fired;
+    m_dwell_timer.p_context = NULL;
+}
+
+bool nrf_802154_channel_hop_start(const uint8_t * p_channels, uint8_t count, uint32_t dwell)
+{
+    if ((count == 0) || (count > NRF_802154_CHANNEL_HOP_MAX_CHANNELS) || (dwell == 0))
+    {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        if ((p_channels[i] < MIN_CHANNEL) || (p_channels[i] > MAX_CHANNEL))
+        {
+            return false;
+        }
+    }
+
+    nrf_802154_timer_sched_remove(&m_dwell_timer, NULL);
+    m_active = false;
+
+    memcpy(m_channels, p_channels, count);
+    m_count          = count;
+    m_index          = 0;
+    m_locked         = false;
+    m_search_t0      = nrf_802154_timer_sched_time_get();
+    m_dwell_timer.dt = dwell;
+    m_active         = true;
+
+    (void)nrf_802154_request_channel_update();
+
+    dwell_timer_start(m_search_t0);
+
+    return true;
+}
+
+void nrf_802154_channel_hop_stop(void)
+{
+    m_active = false;
+    nrf_802154_timer_sched_remove(&m_dwell_timer, NULL);
+
+    (void)nrf_802154_request_channel_update();
+}
+
+bool nrf_802154_channel_hop_is_active(void)
+{
+    return m_active;
+}
+
+uint8_t nrf_802154_channel_hop_channel_get(void)
+{
+    return m_channels[m_index];
+}
+
+void nrf_802154_channel_hop_frame_started(void)
+{
+    uint32_t time_to_detect;
+
+    if (!m_active || m_locked)
+    {
+        return;
+    }
+
+    m_locked = true;
+    nrf_802154_timer_sched_remove(&m_dwell_timer, NULL);
+
+    time_to_detect = nrf_802154_timer_sched_time_get() - m_search_t0;
+
+    m_stats.detections++;
+    m_stats.time_to_detect_total += time_to_detect;
+
+    if (time_to_detect > m_stats.time_to_detect_max)
+    {
+        m_stats.time_to_detect_max = time_to_detect;
+    }
+}
+
+void nrf_802154_channel_hop_frame_ended(void)
+{
+    if (!m_active || !m_locked)
+    {
+        return;
+    }
+
+    m_locked    = false;
+    m_search_t0 = nrf_802154_timer_sched_time_get();
+
+    dwell_timer_start(m_search_t0);
+}
+
+void nrf_802154_channel_hop_stats_get(nrf_802154_channel_hop_stats_t * p_stats)
+{
+    *p_stats = m_stats;
+}
+
+#endif // NRF_802154_CHANNEL_HOP_ENABLED
@@ -0,0 +1,112 @@
+/* Copyright (c) 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef NRF_802154_CHANNEL_HOP_H__
+#define NRF_802154_CHANNEL_HOP_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_types.h"
+
+/**
+ * @defgroup nrf_802154_channel_hop 802.15.4 driver multi-channel listen
+ * @{
+ * @ingroup nrf_802154
+ * @brief Multi-channel listen feature.
+ *
+ * In the receive state, the driver cycles through a list of channels, staying on each channel for
+ * the configured dwell time. When a frame is detected, the driver stays on its channel until
+ * the frame is handled, including the transmission of the ACK frame, and then resumes hopping.
+ */
+
+/**
+ * @brief Initializes the multi-channel listen module.
+ */
+void nrf_802154_channel_hop_init(void);
+
+/**
+ * @brief Starts cycling through the given channels.
+ *
+ * @param[in]  p_channels  Pointer to the list of channels (11-26).
+ * @param[in]  count       Number of channels in the list.
+ * @param[in]  dwell       Time in microseconds (us) spent on each channel.
+ *
+ * @retval  true   Hopping has started.
+ * @retval  false  The channel list or the dwell time is invalid.
+ */
+bool nrf_802154_channel_hop_start(const uint8_t * p_channels, uint8_t count, uint32_t dwell);
+
+/**
+ * @brief Stops hopping and returns to the channel set in the PIB.
+ */
+void nrf_802154_channel_hop_stop(void);
+
+/**
+ * @brief Checks if hopping is active.
+ *
+ * @retval  true   Hopping is active.
+ * @retval  false  The driver listens on the channel set in the PIB.
+ */
+bool nrf_802154_channel_hop_is_active(void);
+
+/**
+ * @brief Gets the channel the driver currently listens on.
+ *
+ * @returns  Current channel of the hopping sequence.
+ */
+uint8_t nrf_802154_channel_hop_channel_get(void);
+
+/**
+ * @brief Locks the current channel when the reception of a frame starts.
+ *
+ * @note This function is intended to be called from the RADIO interrupt handler.
+ */
+void nrf_802154_channel_hop_frame_started(void);
+
+/**
+ * @brief Resumes hopping after a frame is handled.
+ *
+ * @note This function is intended to be called from the RADIO interrupt handler.
+ */
+void nrf_802154_channel_hop_frame_ended(void);
+
+/**
+ * @brief Gets the statistics of the multi-channel listen.
+ *
+ * @param[out]  p_stats  Pointer to the structure to be filled.
+ */
+void nrf_802154_channel_hop_stats_get(nrf_802154_channel_hop_stats_t * p_stats);
+
+/**
+ *@}
+ **/
+
+#endif // NRF_802154_CHANNEL_HOP_H__
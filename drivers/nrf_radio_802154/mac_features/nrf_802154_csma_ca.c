@@ -45,6 +45,7 @@
 #include "nrf_802154_const.h"
 #include "../nrf_802154_debug.h"
 #include "nrf_802154_notification.h"
+#include "nrf_802154_pib.h"
 #include "nrf_802154_request.h"
 #include "platform/random/nrf_802154_random.h"
 #include "timer_scheduler/nrf_802154_timer_sched.h"
@@ -123,6 +124,7 @@ static void frame_transmit(void * p_context)
                                          REQ_ORIG_CSMA_CA,
                                          mp_data,
                                          true,
+                                         NRF_802154_TX_POWER_FROM_PIB,
                                          NRF_802154_CSMA_CA_WAIT_FOR_TIMESLOT ? false : true,
                                          notify_busy_channel))
         {
@@ -43,11 +43,13 @@
 #include "../nrf_802154_debug.h"
 #include "nrf_802154_config.h"
 #include "nrf_802154_const.h"
+#include "nrf_802154_core.h"
 #include "nrf_802154_frame_parser.h"
 #include "nrf_802154_notification.h"
 #include "nrf_802154_pib.h"
 #include "nrf_802154_procedures_duration.h"
 #include "nrf_802154_request.h"
+#include "nrf_802154_wor.h"
 #include "rsch/nrf_802154_rsch.h"
 #include "timer_scheduler/nrf_802154_timer_sched.h"
 
@@ -336,6 +338,7 @@ static void tx_timeslot_started_callout(void)
                                           REQ_ORIG_DELAYED_TRX,
                                           mp_tx_data,
                                           m_tx_cca,
+                                          NRF_802154_TX_POWER_FROM_PIB,
                                           true,
                                           tx_timeslot_started_callback);
     }
@@ -456,6 +459,21 @@ static inline void timeslot_started_callout(rsch_dly_ts_id_t dly_ts_id)
 
 void nrf_802154_rsch_delayed_timeslot_started(rsch_dly_ts_id_t dly_ts_id)
 {
+#if NRF_802154_WOR_ENABLED
+    if (dly_ts_id == RSCH_DLY_WOR)
+    {
+        nrf_802154_wor_timeslot_started();
+        return;
+    }
+#endif // NRF_802154_WOR_ENABLED
+#if NRF_802154_PROCEDURES_DURATION_CALIBRATION_ENABLED
+    if (dly_ts_id == RSCH_DLY_CALIBRATION)
+    {
+        nrf_802154_core_procedures_duration_calibration_timeslot_started();
+        return;
+    }
+#endif // NRF_802154_PROCEDURES_DURATION_CALIBRATION_ENABLED
+
     switch (dly_op_state_get(dly_ts_id))
     {
         case DELAYED_TRX_OP_STATE_PENDING:
@@ -0,0 +1,205 @@
+/* Copyright (c) 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements the duplicate frame rejection for the 802.15.4 driver.
+ *
+ */
+
+#include "nrf_802154_dup_filter.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_frame_parser.h"
+#include "nrf_802154_pib.h"
+#include "timer_scheduler/nrf_802154_timer_sched.h"
+
+#if NRF_802154_DUP_FILTER_ENABLED
+
+#if (NRF_802154_DUP_FILTER_SIZE & (NRF_802154_DUP_FILTER_SIZE - 1)) != 0
+#error NRF_802154_DUP_FILTER_SIZE must be a power of two
+#endif
+
+/**
+ * @brief Structure that describes the most recent frame received from a source.
+ *
+ * A short address is only unique within its PAN, so the source of a frame with a short address is
+ * identified by the address followed by the source PAN ID. An extended address identifies
+ * the source alone. Both fit in the space of an extended address, so the structure fits in 16 bytes
+ * and the whole table occupies few cache lines.
+ */
+typedef struct
+{
+    uint8_t  addr[EXTENDED_ADDRESS_SIZE]; ///< Source address, followed by the PAN ID for a short address.
+    uint8_t  addr_size;                   ///< Size of @ref addr in use, or 0 if the entry is free.
+    uint8_t  dsn;                         ///< Sequence number of the frame.
+    uint8_t  frame_type;                  ///< Type of the frame.
+    uint32_t timestamp;                   ///< Time when the frame was received [us].
+} dup_filter_entry_t;
+
+static dup_filter_entry_t            m_table[NRF_802154_DUP_FILTER_SIZE]; ///< Table indexed by the hash of the source address.
+static nrf_802154_dup_filter_stats_t m_stats;                             ///< Duplicate frame rejection statistics.
+
+/**
+ * @brief Gets the source of a frame, as stored in the table.
+ *
+ * The source PAN ID of a frame with PAN ID compression is the destination PAN ID. If neither is
+ * present, the frame comes from the PAN of the device.
+ *
+ * @param[in]   p_frame  Pointer to a buffer that contains PHR and PSDU of the frame.
+ * @param[out]  p_addr   Buffer for the source address, followed by the PAN ID for a short address.
+ *
+ * @returns  Size of the source written to @p p_addr, or 0 if the frame has no source address.
+ */
+static uint8_t src_get(const uint8_t * p_frame, uint8_t p_addr[EXTENDED_ADDRESS_SIZE])
+{
+    bool            extended;
+    const uint8_t * p_src_addr = nrf_802154_frame_parser_src_addr_get(p_frame, &extended);
+    const uint8_t * p_panid;
+
+    if (p_src_addr == NULL)
+    {
+        return 0;
+    }
+
+    if (extended)
+    {
+        memcpy(p_addr, p_src_addr, EXTENDED_ADDRESS_SIZE);
+        return EXTENDED_ADDRESS_SIZE;
+    }
+
+    p_panid = nrf_802154_frame_parser_src_panid_get(p_frame);
+
+    if (p_panid == NULL)
+    {
+        p_panid = nrf_802154_frame_parser_dst_panid_get(p_frame);
+    }
+
+    if (p_panid == NULL)
+    {
+        p_panid = nrf_802154_pib_pan_id_get();
+    }
+
+    memcpy(p_addr, p_src_addr, SHORT_ADDRESS_SIZE);
+    memcpy(&p_addr[SHORT_ADDRESS_SIZE], p_panid, PAN_ID_SIZE);
+
+    return SHORT_ADDRESS_SIZE + PAN_ID_SIZE;
+}
+
+/**
+ * @brief Calculates the table index of a source.
+ *
+ * @param[in]  p_addr     Pointer to the source, see @ref src_get.
+ * @param[in]  addr_size  Size of the source.
+ *
+ * @returns  Index of the table entry for the given address.
+ */
+static uint32_t index_get(const uint8_t * p_addr, uint8_t addr_size)
+{
+    uint32_t hash = 0;
+
+    for (uint32_t i = 0; i < addr_size; i++)
+    {
+        hash = (hash * 31) + p_addr[i];
+    }
+
+    return (hash ^ (hash >> 8)) & (NRF_802154_DUP_FILTER_SIZE - 1);
+}
+
+void nrf_802154_dup_filter_init(void)
+{
+    memset(m_table, 0, sizeof(m_table));
+    memset(&m_stats, 0, sizeof(m_stats));
+}
+
+bool nrf_802154_dup_filter_check(const uint8_t * p_frame)
+{
+    bool                 duplicate;
+    uint8_t              addr[EXTENDED_ADDRESS_SIZE];
+    uint8_t              addr_size;
+    uint8_t              dsn;
+    uint8_t              frame_type;
+    uint32_t             now;
+    dup_filter_entry_t * p_entry;
+
+    if (nrf_802154_frame_parser_dsn_suppress_bit_is_set(p_frame))
+    {
+        return false;
+    }
+
+    addr_size = src_get(p_frame, addr);
+
+    if (addr_size == 0)
+    {
+        return false;
+    }
+
+    dsn        = p_frame[DSN_OFFSET];
+    frame_type = p_frame[FRAME_TYPE_OFFSET] & FRAME_TYPE_MASK;
+    now        = nrf_802154_timer_sched_time_get();
+    p_entry    = &m_table[index_get(addr, addr_size)];
+
+    duplicate = (p_entry->addr_size == addr_size) &&
+                (p_entry->dsn == dsn) &&
+                (p_entry->frame_type == frame_type) &&
+                ((now - p_entry->timestamp) < NRF_802154_DUP_FILTER_LIFETIME) &&
+                (0 == memcmp(p_entry->addr, addr, addr_size));
+
+    m_stats.checked++;
+
+    if (duplicate)
+    {
+        m_stats.hits++;
+    }
+    else
+    {
+        // The most recent frame replaces any other source that hashes to the same entry.
+        memcpy(p_entry->addr, addr, addr_size);
+        p_entry->addr_size  = addr_size;
+        p_entry->dsn        = dsn;
+        p_entry->frame_type = frame_type;
+    }
+
+    p_entry->timestamp = now;
+
+    return duplicate;
+}
+
+void nrf_802154_dup_filter_stats_get(nrf_802154_dup_filter_stats_t * p_stats)
+{
+    *p_stats = m_stats;
+}
+
+#endif // NRF_802154_DUP_FILTER_ENABLED
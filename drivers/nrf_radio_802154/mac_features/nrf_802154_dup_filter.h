@@ -0,0 +1,81 @@
+/* Copyright (c) 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef NRF_802154_DUP_FILTER_H__
+#define NRF_802154_DUP_FILTER_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_types.h"
+
+/**
+ * @defgroup nrf_802154_dup_filter 802.15.4 driver duplicate frame rejection
+ * @{
+ * @ingroup nrf_802154
+ * @brief Duplicate frame rejection feature.
+ *
+ * Retransmissions of frames whose ACK was lost are recognized by the source address, sequence
+ * number and frame type of the most recent frame received from each source. A short source address
+ * is qualified by the source PAN ID. Such frames are still acknowledged, but they are not passed to
+ * the MAC layer.
+ */
+
+/**
+ * @brief Initializes the duplicate frame rejection module.
+ */
+void nrf_802154_dup_filter_init(void);
+
+/**
+ * @brief Checks if a received frame is a duplicate of the most recent frame from its source.
+ *
+ * If the frame is not a duplicate, it becomes the most recent frame from its source.
+ *
+ * @note This function is intended to be called from the RADIO interrupt handler.
+ *
+ * @param[in]  p_frame  Pointer to a buffer that contains PHR and PSDU of the received frame.
+ *
+ * @retval  true   The frame is a duplicate.
+ * @retval  false  The frame is not a duplicate, or it has no source address or sequence number.
+ */
+bool nrf_802154_dup_filter_check(const uint8_t * p_frame);
+
+/**
+ * @brief Gets the statistics of the duplicate frame rejection.
+ *
+ * @param[out]  p_stats  Pointer to the structure to be filled.
+ */
+void nrf_802154_dup_filter_stats_get(nrf_802154_dup_filter_stats_t * p_stats);
+
+/**
+ *@}
+ **/
+
+#endif // NRF_802154_DUP_FILTER_H__
@@ -41,6 +41,7 @@
 #include "nrf_802154_frame_parser.h"
 
 #include <stdlib.h>
+#include <string.h>
 
 #include "nrf_802154_const.h"
 
@@ -680,3 +681,200 @@ const uint8_t * nrf_802154_frame_parser_ie_header_get(const uint8_t * p_frame)
 
     return &p_frame[ie_header_offset];
 }
+
+/***************************************************************************************************
+ * @section Information Elements
+ **************************************************************************************************/
+
+static bool ie_is_link_metrics(const nrf_802154_frame_parser_ie_t * p_ie)
+{
+    const uint8_t * p_content = p_ie->p_content;
+    uint32_t        oui;
+
+    if (p_ie->length < IE_VENDOR_OUI_SIZE + 1)
+    {
+        return false;
+    }
+
+    oui = p_content[0] | (p_content[1] << 8) | (p_content[2] << 16);
+
+    return (oui == IE_VENDOR_THREAD_OUI) &&
+           (p_content[IE_VENDOR_OUI_SIZE] == IE_VENDOR_THREAD_PROBING_ID);
+}
+
+static void ie_position_set(const uint8_t                         * p_frame,
+                            const nrf_802154_frame_parser_ie_t    * p_ie,
+                            nrf_802154_frame_parser_ie_position_t * p_position)
+{
+    // Only the first occurrence of each IE is recorded.
+    if (p_position->offset == 0)
+    {
+        p_position->offset = p_ie->p_content - p_frame;
+        p_position->length = p_ie->length;
+    }
+}
+
+/**
+ * Checks if the fields read to locate the Header IEs are within the frame.
+ *
+ * The offset of the IEs depends on the Frame Control field and, in secured frames, on
+ * the Security Control field.
+ */
+static bool ie_header_is_locatable(const uint8_t * p_frame)
+{
+    uint8_t psdu_end = PHR_SIZE + p_frame[PHR_OFFSET] - FCS_SIZE;
+    uint8_t sec_ctrl_offset;
+
+    if (p_frame[PHR_OFFSET] < FCF_SIZE + FCS_SIZE)
+    {
+        return false;
+    }
+
+    sec_ctrl_offset = nrf_802154_frame_parser_sec_ctrl_offset_get(p_frame);
+
+    return (sec_ctrl_offset == 0) ||
+           ((sec_ctrl_offset != NRF_802154_FRAME_PARSER_INVALID_OFFSET) &&
+            (sec_ctrl_offset < psdu_end));
+}
+
+bool nrf_802154_frame_parser_ie_iterator_init(const uint8_t                         * p_frame,
+                                              nrf_802154_frame_parser_ie_iterator_t * p_iterator)
+{
+    const uint8_t * p_ie_header = NULL;
+    const uint8_t * p_end       = &p_frame[PHR_SIZE + p_frame[PHR_OFFSET] - FCS_SIZE];
+
+    if (ie_header_is_locatable(p_frame))
+    {
+        p_ie_header = nrf_802154_frame_parser_ie_header_get(p_frame);
+    }
+
+    if ((p_ie_header == NULL) || (p_ie_header >= p_end))
+    {
+        p_iterator->p_next = NULL;
+        p_iterator->p_end  = NULL;
+        return false;
+    }
+
+    nrf_802154_frame_parser_ie_iterator_data_init(p_ie_header, p_end - p_ie_header, p_iterator);
+
+    return true;
+}
+
+void nrf_802154_frame_parser_ie_iterator_data_init(
+    const uint8_t                         * p_data,
+    uint8_t                                 length,
+    nrf_802154_frame_parser_ie_iterator_t * p_iterator)
+{
+    p_iterator->p_next = p_data;
+    p_iterator->p_end  = &p_data[length];
+}
+
+bool nrf_802154_frame_parser_ie_iterator_next(nrf_802154_frame_parser_ie_iterator_t * p_iterator,
+                                              nrf_802154_frame_parser_ie_t          * p_ie)
+{
+    const uint8_t * p_next = p_iterator->p_next;
+    uint16_t        descriptor;
+    uint8_t         id;
+    uint8_t         length;
+
+    if ((p_next == NULL) || (p_iterator->p_end - p_next < IE_DESCRIPTOR_SIZE))
+    {
+        return false;
+    }
+
+    descriptor = p_next[0] | (p_next[1] << 8);
+    id         = (descriptor & IE_HEADER_ELEMENT_ID_MASK) >> IE_HEADER_ELEMENT_ID_SHIFT;
+    length     = descriptor & IE_HEADER_LENGTH_MASK;
+
+    if ((descriptor & IE_TYPE_BIT) || (id == IE_HT1_ID) || (id == IE_HT2_ID) ||
+        (p_iterator->p_end - p_next < IE_DESCRIPTOR_SIZE + length))
+    {
+        // Header IEs end here, or the frame is malformed. Do not look past this point again.
+        p_iterator->p_next = NULL;
+        return false;
+    }
+
+    p_ie->p_content    = &p_next[IE_DESCRIPTOR_SIZE];
+    p_ie->id           = id;
+    p_ie->length       = length;
+    p_iterator->p_next = &p_next[IE_DESCRIPTOR_SIZE + length];
+
+    return true;
+}
+
+bool nrf_802154_frame_parser_ie_iterator_end_reached(
+    const nrf_802154_frame_parser_ie_iterator_t * p_iterator)
+{
+    return p_iterator->p_next == p_iterator->p_end;
+}
+
+bool nrf_802154_frame_parser_ie_find(const uint8_t                * p_frame,
+                                     uint8_t                        id,
+                                     nrf_802154_frame_parser_ie_t * p_ie)
+{
+    nrf_802154_frame_parser_ie_iterator_t iterator;
+
+    if (nrf_802154_frame_parser_ie_iterator_init(p_frame, &iterator))
+    {
+        while (nrf_802154_frame_parser_ie_iterator_next(&iterator, p_ie))
+        {
+            if (p_ie->id == id)
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+void nrf_802154_frame_parser_ie_index_build(const uint8_t                      * p_frame,
+                                            nrf_802154_frame_parser_ie_index_t * p_index)
+{
+    nrf_802154_frame_parser_ie_iterator_t   iterator;
+    nrf_802154_frame_parser_ie_t            ie;
+    nrf_802154_frame_parser_ie_position_t * p_entry;
+
+    memset(p_index, 0, sizeof(*p_index));
+
+    if (!nrf_802154_frame_parser_ie_iterator_init(p_frame, &iterator))
+    {
+        return;
+    }
+
+    while (nrf_802154_frame_parser_ie_iterator_next(&iterator, &ie))
+    {
+        switch (ie.id)
+        {
+            case IE_CSL_ID:
+                p_entry = &p_index->csl;
+                break;
+
+            case IE_RENDEZVOUS_TIME_ID:
+                p_entry = &p_index->rendezvous_time;
+                break;
+
+            case IE_TIME_CORRECTION_ID:
+                p_entry = &p_index->time_correction;
+                break;
+
+            case IE_VENDOR_ID:
+                if (ie_is_link_metrics(&ie))
+                {
+                    ie_position_set(p_frame, &ie, &p_index->link_metrics);
+                }
+
+                p_entry = &p_index->vendor;
+                break;
+
+            default:
+                p_entry = NULL;
+                break;
+        }
+
+        if (p_entry != NULL)
+        {
+            ie_position_set(p_frame, &ie, p_entry);
+        }
+    }
+}
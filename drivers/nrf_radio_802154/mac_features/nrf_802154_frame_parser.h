@@ -56,6 +56,50 @@ typedef struct
     uint8_t         addressing_end_offset; ///< Offset of the first byte following addressing fields.
 } nrf_802154_frame_parser_mhr_data_t;
 
+/**
+ * @brief Structure that describes a single Header IE.
+ */
+typedef struct
+{
+    const uint8_t * p_content; ///< Pointer to the content of the IE, or NULL if the IE is missing.
+    uint8_t         id;        ///< Element ID of the IE.
+    uint8_t         length;    ///< Length of the content of the IE.
+} nrf_802154_frame_parser_ie_t;
+
+/**
+ * @brief Structure that holds the position of the iteration over the Header IEs of a frame.
+ */
+typedef struct
+{
+    const uint8_t * p_next; ///< Pointer to the descriptor of the next IE.
+    const uint8_t * p_end;  ///< Pointer to the first byte following the MAC payload.
+} nrf_802154_frame_parser_ie_iterator_t;
+
+/**
+ * @brief Structure that describes the position of a Header IE in a frame.
+ */
+typedef struct
+{
+    uint8_t offset; ///< Offset of the content of the IE in the frame, or 0 if the IE is missing.
+    uint8_t length; ///< Length of the content of the IE.
+} nrf_802154_frame_parser_ie_position_t;
+
+/**
+ * @brief Structure that contains the Header IEs commonly used by the higher layers.
+ *
+ * The structure is filled in a single pass over the Header IEs of a frame, so it can be kept
+ * along with the frame instead of searching the frame for each IE separately. The IEs are stored
+ * as offsets, so the structure remains valid when the frame is copied to another buffer.
+ */
+typedef struct
+{
+    nrf_802154_frame_parser_ie_position_t csl;             ///< CSL IE.
+    nrf_802154_frame_parser_ie_position_t rendezvous_time; ///< Rendezvous Time IE.
+    nrf_802154_frame_parser_ie_position_t time_correction; ///< Time Correction IE.
+    nrf_802154_frame_parser_ie_position_t vendor;          ///< First Vendor Specific IE.
+    nrf_802154_frame_parser_ie_position_t link_metrics;    ///< Thread Enhanced-ACK Probing IE.
+} nrf_802154_frame_parser_ie_index_t;
+
 /**
  * @brief Determines if the destination address is extended.
  *
@@ -314,4 +358,81 @@ const uint8_t * nrf_802154_frame_parser_ie_header_get(const uint8_t * p_frame);
  */
 uint8_t nrf_802154_frame_parser_ie_header_offset_get(const uint8_t * p_frame);
 
+/**
+ * @brief Starts the iteration over the Header IEs of the provided frame.
+ *
+ * @param[in]   p_frame     Pointer to a frame.
+ * @param[out]  p_iterator  Pointer to the iterator to initialize.
+ *
+ * @retval  true   The frame contains Header IEs.
+ * @retval  false  The frame does not contain Header IEs.
+ */
+bool nrf_802154_frame_parser_ie_iterator_init(const uint8_t                         * p_frame,
+                                              nrf_802154_frame_parser_ie_iterator_t * p_iterator);
+
+/**
+ * @brief Starts the iteration over a list of Header IEs stored outside of a frame.
+ *
+ * @param[in]   p_data      Pointer to the descriptor of the first IE.
+ * @param[in]   length      Length of the list of IEs.
+ * @param[out]  p_iterator  Pointer to the iterator to initialize.
+ */
+void nrf_802154_frame_parser_ie_iterator_data_init(
+    const uint8_t                         * p_data,
+    uint8_t                                 length,
+    nrf_802154_frame_parser_ie_iterator_t * p_iterator);
+
+/**
+ * @brief Gets the next Header IE and advances the iterator.
+ *
+ * The iteration ends on a Header Termination IE, at the end of the frame, or on an IE that does
+ * not fit in the frame.
+ *
+ * @param[inout]  p_iterator  Pointer to the iterator.
+ * @param[out]    p_ie        Pointer to the structure that is filled with the IE.
+ *
+ * @retval  true   @p p_ie contains the next Header IE.
+ * @retval  false  There are no more Header IEs.
+ */
+bool nrf_802154_frame_parser_ie_iterator_next(nrf_802154_frame_parser_ie_iterator_t * p_iterator,
+                                              nrf_802154_frame_parser_ie_t          * p_ie);
+
+/**
+ * @brief Checks if the iteration ended exactly at the end of the IEs.
+ *
+ * @param[in]  p_iterator  Pointer to the iterator for which
+ *                         @ref nrf_802154_frame_parser_ie_iterator_next returned false.
+ *
+ * @retval  true   All the IEs up to the end of the frame or of the list were read.
+ * @retval  false  The iteration ended on a Header Termination IE, or on an IE that does not fit.
+ */
+bool nrf_802154_frame_parser_ie_iterator_end_reached(
+    const nrf_802154_frame_parser_ie_iterator_t * p_iterator);
+
+/**
+ * @brief Finds the first Header IE with the given Element ID in the provided frame.
+ *
+ * @param[in]   p_frame  Pointer to a frame.
+ * @param[in]   id       Element ID of the IE to find.
+ * @param[out]  p_ie     Pointer to the structure that is filled with the IE.
+ *
+ * @retval  true   The IE was found.
+ * @retval  false  The frame does not contain the IE.
+ */
+bool nrf_802154_frame_parser_ie_find(const uint8_t                * p_frame,
+                                     uint8_t                        id,
+                                     nrf_802154_frame_parser_ie_t * p_ie);
+
+/**
+ * @brief Extracts the commonly used Header IEs from the provided frame in a single pass.
+ *
+ * The IEs missing in the frame have the @c offset field set to 0. The content of an IE present in
+ * the frame starts at @c p_frame[offset].
+ *
+ * @param[in]   p_frame  Pointer to a frame.
+ * @param[out]  p_index  Pointer to the structure that is filled with the IEs.
+ */
+void nrf_802154_frame_parser_ie_index_build(const uint8_t                      * p_frame,
+                                            nrf_802154_frame_parser_ie_index_t * p_index);
+
 #endif // NRF_802154_FRAME_PARSER_H
@@ -0,0 +1,496 @@
+/* Copyright (c) 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements the indirect transmission queue for the 802.15.4 driver.
+ *
+ */
+
+#include "nrf_802154_indirect_tx.h"
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <nrf.h>
+#include <soc/nrfx_atomic.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_const.h"
+#include "../nrf_802154_debug.h"
+#include "nrf_802154_frame_parser.h"
+#include "nrf_802154_notification.h"
+#include "nrf_802154_pib.h"
+#include "nrf_802154_request.h"
+#include "timer_scheduler/nrf_802154_timer_sched.h"
+
+#if NRF_802154_INDIRECT_TX_ENABLED
+
+/**
+ * @brief Structure that describes a frame in the indirect transmission queue.
+ */
+typedef struct
+{
+    nrfx_atomic_u32_t frame;                       ///< Address of the queued frame, or 0 if the entry holds none.
+    uint8_t           addr[EXTENDED_ADDRESS_SIZE]; ///< Destination address of the frame.
+    uint8_t           addr_size;                   ///< Size of the destination address.
+    uint32_t          t0;                          ///< Time when the frame was queued [us].
+    uint32_t          timeout;                     ///< Time after which the frame expires [us].
+} indirect_tx_entry_t;
+
+/**
+ * @brief Counters of the queue statistics.
+ *
+ * The counters are updated from the thread context and from the timer and RADIO interrupts,
+ * see @ref nrf_802154_indirect_tx_stats_t.
+ */
+typedef struct
+{
+    nrfx_atomic_u32_t queued;
+    nrfx_atomic_u32_t polls;
+    nrfx_atomic_u32_t dispatched;
+    nrfx_atomic_u32_t dispatch_failed;
+    nrfx_atomic_u32_t expired;
+} indirect_tx_counters_t;
+
+static indirect_tx_entry_t    m_queue[NRF_802154_INDIRECT_TX_QUEUE_SIZE]; ///< Indirect transmission queue.
+static nrfx_atomic_u32_t      m_free[NRFX_ATOMIC_BITMAP_WORDS(NRF_802154_INDIRECT_TX_QUEUE_SIZE)]; ///< Entries that can take a new frame.
+static nrf_802154_timer_t     m_dispatch_timer;                           ///< Timer used to transmit a frame after a data request is acknowledged.
+static nrf_802154_timer_t     m_expiry_timer;                             ///< Timer used to remove expired frames.
+static indirect_tx_counters_t m_stats;                                    ///< Queue statistics.
+
+/**
+ * @brief Gets the frame held by a queue entry.
+ *
+ * @param[in]  p_entry  Pointer to the queue entry.
+ *
+ * @returns  Pointer to the frame, or NULL if the entry holds none.
+ */
+static const uint8_t * entry_frame_get(const indirect_tx_entry_t * p_entry)
+{
+    return (const uint8_t *)nrfx_atomic_u32_load(&p_entry->frame);
+}
+
+/**
+ * @brief Atomically takes a frame out of a queue entry.
+ *
+ * Only one of the contexts that compete for the same entry succeeds. The entry is not
+ * released, so the frame can be put back with @ref entry_frame_set.
+ *
+ * @param[in]  p_entry  Pointer to the queue entry.
+ * @param[in]  p_frame  Frame expected in the entry.
+ *
+ * @retval  true   The frame was taken out of the entry.
+ * @retval  false  The entry does not hold @p p_frame anymore.
+ */
+static bool entry_claim(indirect_tx_entry_t * p_entry, const uint8_t * p_frame)
+{
+    uint32_t expected = (uint32_t)p_frame;
+
+    return (p_frame != NULL) && nrfx_atomic_u32_cas(&p_entry->frame, &expected, 0);
+}
+
+/**
+ * @brief Publishes a frame in a queue entry owned by the caller.
+ *
+ * The frame address validates the entry, so it is stored after all other fields.
+ *
+ * @param[in]  p_entry  Pointer to the queue entry.
+ * @param[in]  p_frame  Frame to be published.
+ */
+static void entry_frame_set(indirect_tx_entry_t * p_entry, const uint8_t * p_frame)
+{
+    (void)nrfx_atomic_u32_fetch_store(&p_entry->frame, (uint32_t)p_frame);
+}
+
+/**
+ * @brief Releases a queue entry whose frame was taken out, so that it can take a new frame.
+ *
+ * @param[in]  p_entry  Pointer to the queue entry.
+ */
+static void entry_release(indirect_tx_entry_t * p_entry)
+{
+    (void)nrfx_atomic_bit_set(m_free, (size_t)(p_entry - m_queue));
+}
+
+/**
+ * @brief Finds the queue entry of a frame for the given destination.
+ *
+ * @param[in]  p_addr     Pointer to the destination address.
+ * @param[in]  addr_size  Size of the destination address.
+ *
+ * @returns  Pointer to the oldest matching entry, or NULL if there is none.
+ */
+static indirect_tx_entry_t * entry_find(const uint8_t * p_addr, uint8_t addr_size)
+{
+    indirect_tx_entry_t * p_found = NULL;
+    uint32_t              now     = nrf_802154_timer_sched_time_get();
+
+    for (uint32_t i = 0; i < NRF_802154_INDIRECT_TX_QUEUE_SIZE; i++)
+    {
+        indirect_tx_entry_t * p_entry = &m_queue[i];
+
+        if ((entry_frame_get(p_entry) != NULL) &&
+            (p_entry->addr_size == addr_size) &&
+            (0 == memcmp(p_entry->addr, p_addr, addr_size)))
+        {
+            if ((p_found == NULL) ||
+                ((now - p_entry->t0) > (now - p_found->t0)))
+            {
+                p_found = p_entry;
+            }
+        }
+    }
+
+    return p_found;
+}
+
+/**
+ * @brief Arms the expiry timer for the frame that expires first.
+ */
+static void expiry_timer_update(void)
+{
+    uint32_t now       = nrf_802154_timer_sched_time_get();
+    uint32_t remaining = UINT32_MAX;
+    bool     found     = false;
+
+    for (uint32_t i = 0; i < NRF_802154_INDIRECT_TX_QUEUE_SIZE; i++)
+    {
+        indirect_tx_entry_t * p_entry = &m_queue[i];
+
+        if (entry_frame_get(p_entry) != NULL)
+        {
+            uint32_t elapsed = now - p_entry->t0;
+            uint32_t left    = (elapsed < p_entry->timeout) ? (p_entry->timeout - elapsed) : 0;
+
+            if (left < remaining)
+            {
+                remaining = left;
+            }
+
+            found = true;
+        }
+    }
+
+    nrf_802154_timer_sched_remove(&m_expiry_timer, NULL);
+
+    if (found)
+    {
+        m_expiry_timer.t0 = now;
+        m_expiry_timer.dt = remaining;
+
+        nrf_802154_timer_sched_add(&m_expiry_timer, true);
+    }
+}
+
+static void expiry_timer_fired(void * p_context)
+{
+    (void)p_context;
+
+    uint32_t now = nrf_802154_timer_sched_time_get();
+
+    for (uint32_t i = 0; i < NRF_802154_INDIRECT_TX_QUEUE_SIZE; i++)
+    {
+        indirect_tx_entry_t * p_entry = &m_queue[i];
+        const uint8_t       * p_frame = entry_frame_get(p_entry);
+
+        if ((p_frame != NULL) &&
+            !nrf_802154_timer_sched_time_is_in_future(now, p_entry->t0, p_entry->timeout) &&
+            entry_claim(p_entry, p_frame))
+        {
+            entry_release(p_entry);
+            (void)nrfx_atomic_u32_fetch_add(&m_stats.expired, 1);
+            nrf_802154_notify_transmit_failed(p_frame, NRF_802154_TX_ERROR_EXPIRED);
+        }
+    }
+
+    expiry_timer_update();
+}
+
+static void dispatch_timer_fired(void * p_context)
+{
+    const uint8_t       * p_frame = (const uint8_t *)p_context;
+    indirect_tx_entry_t * p_entry = NULL;
+
+    // The frame may have been removed since the data request, and its entry reused.
+    for (uint32_t i = 0; i < NRF_802154_INDIRECT_TX_QUEUE_SIZE; i++)
+    {
+        if (entry_claim(&m_queue[i], p_frame))
+        {
+            p_entry = &m_queue[i];
+            break;
+        }
+    }
+
+    if (p_entry == NULL)
+    {
+        return;
+    }
+
+    if (nrf_802154_request_transmit(NRF_802154_TERM_NONE,
+                                    REQ_ORIG_INDIRECT_TX,
+                                    p_frame,
+                                    true,
+                                    NRF_802154_TX_POWER_FROM_PIB,
+                                    true,
+                                    NULL))
+    {
+        // From now on, the result is notified to the MAC layer like for any other transmission.
+        entry_release(p_entry);
+        (void)nrfx_atomic_u32_fetch_add(&m_stats.dispatched, 1);
+        expiry_timer_update();
+    }
+    else
+    {
+        // The radio is busy. Keep the frame for the next data request.
+        (void)nrfx_atomic_u32_fetch_add(&m_stats.dispatch_failed, 1);
+        entry_frame_set(p_entry, p_frame);
+    }
+}
+
+/**
+ * @brief Gets the destination address of a frame.
+ *
+ * @param[in]   p_frame      Pointer to a buffer that contains PHR and PSDU of the frame.
+ * @param[out]  p_addr_size  Size of the destination address.
+ *
+ * @returns  Pointer to the destination address, or NULL if the frame has none.
+ */
+static const uint8_t * dst_addr_get(const uint8_t * p_frame, uint8_t * p_addr_size)
+{
+    bool            extended;
+    const uint8_t * p_addr = nrf_802154_frame_parser_dst_addr_get(p_frame, &extended);
+
+    *p_addr_size = extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE;
+
+    return p_addr;
+}
+
+/**
+ * @brief Gets the source address of a frame.
+ *
+ * @param[in]   p_frame      Pointer to a buffer that contains PHR and PSDU of the frame.
+ * @param[out]  p_addr_size  Size of the source address.
+ *
+ * @returns  Pointer to the source address, or NULL if the frame has none.
+ */
+static const uint8_t * src_addr_get(const uint8_t * p_frame, uint8_t * p_addr_size)
+{
+    bool            extended;
+    const uint8_t * p_addr = nrf_802154_frame_parser_src_addr_get(p_frame, &extended);
+
+    *p_addr_size = extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE;
+
+    return p_addr;
+}
+
+/**
+ * @brief Checks if a frame is a MAC Data Request command.
+ *
+ * Frames with Information Elements are not recognized, as the command identifier follows
+ * the IEs.
+ *
+ * @param[in]  p_frame  Pointer to a buffer that contains PHR and PSDU of the frame.
+ *
+ * @retval  true   The frame is a Data Request command.
+ * @retval  false  The frame is not a Data Request command, or it cannot be recognized.
+ */
+static bool data_request_check(const uint8_t * p_frame)
+{
+    uint8_t offset;
+
+    if (((p_frame[FRAME_TYPE_OFFSET] & FRAME_TYPE_MASK) != FRAME_TYPE_COMMAND) ||
+        nrf_802154_frame_parser_ie_present_bit_is_set(p_frame))
+    {
+        return false;
+    }
+
+    if (p_frame[SECURITY_ENABLED_OFFSET] & SECURITY_ENABLED_BIT)
+    {
+        const uint8_t * p_sec_ctrl = nrf_802154_frame_parser_sec_ctrl_get(p_frame);
+
+        offset = nrf_802154_frame_parser_key_id_offset_get(p_frame);
+
+        if ((p_sec_ctrl == NULL) || (offset == NRF_802154_FRAME_PARSER_INVALID_OFFSET))
+        {
+            return false;
+        }
+
+        switch (*p_sec_ctrl & KEY_ID_MODE_MASK)
+        {
+            case KEY_ID_MODE_1:
+                offset += KEY_ID_MODE_1_SIZE;
+                break;
+
+            case KEY_ID_MODE_2:
+                offset += KEY_ID_MODE_2_SIZE;
+                break;
+
+            case KEY_ID_MODE_3:
+                offset += KEY_ID_MODE_3_SIZE;
+                break;
+
+            default:
+                break;
+        }
+    }
+    else
+    {
+        offset = nrf_802154_frame_parser_addressing_end_offset_get(p_frame);
+
+        if (offset == NRF_802154_FRAME_PARSER_INVALID_OFFSET)
+        {
+            return false;
+        }
+    }
+
+    // The PHR holds the length of the PSDU, which ends with the FCS.
+    if ((offset + FCS_SIZE) > p_frame[PHR_OFFSET])
+    {
+        return false;
+    }
+
+    return p_frame[offset] == MAC_CMD_DATA_REQ;
+}
+
+void nrf_802154_indirect_tx_init(void)
+{
+    memset(m_queue, 0, sizeof(m_queue));
+    memset((void *)m_free, 0, sizeof(m_free));
+    memset((void *)&m_stats, 0, sizeof(m_stats));
+
+    for (size_t i = 0; i < NRF_802154_INDIRECT_TX_QUEUE_SIZE; i++)
+    {
+        (void)nrfx_atomic_bit_set(m_free, i);
+    }
+
+    m_expiry_timer.callback  = expiry_timer_fired;
+    m_expiry_timer.p_context = NULL;
+}
+
+bool nrf_802154_indirect_tx_add(const uint8_t * p_data, uint32_t timeout)
+{
+    uint8_t               addr_size;
+    const uint8_t       * p_addr = dst_addr_get(p_data, &addr_size);
+    indirect_tx_entry_t * p_entry;
+    size_t                index;
+
+    // The entry is owned from the moment it is claimed, so concurrent calls never share it.
+    if ((p_addr == NULL) ||
+        !nrfx_atomic_bitmap_first_set_claim(m_free, NRF_802154_INDIRECT_TX_QUEUE_SIZE, &index))
+    {
+        return false;
+    }
+
+    p_entry            = &m_queue[index];
+    memcpy(p_entry->addr, p_addr, addr_size);
+    p_entry->addr_size = addr_size;
+    p_entry->t0        = nrf_802154_timer_sched_time_get();
+    p_entry->timeout   = timeout;
+    entry_frame_set(p_entry, p_data);
+
+    (void)nrfx_atomic_u32_fetch_add(&m_stats.queued, 1);
+    expiry_timer_update();
+
+    return true;
+}
+
+bool nrf_802154_indirect_tx_remove(const uint8_t * p_data)
+{
+    for (uint32_t i = 0; i < NRF_802154_INDIRECT_TX_QUEUE_SIZE; i++)
+    {
+        if (entry_claim(&m_queue[i], p_data))
+        {
+            entry_release(&m_queue[i]);
+            expiry_timer_update();
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool nrf_802154_indirect_tx_pending_check(const uint8_t * p_frame)
+{
+    uint8_t         addr_size;
+    const uint8_t * p_addr = src_addr_get(p_frame, &addr_size);
+
+    return (p_addr != NULL) && (entry_find(p_addr, addr_size) != NULL);
+}
+
+void nrf_802154_indirect_tx_ack_sent(const uint8_t * p_frame, const uint8_t * p_ack)
+{
+    uint8_t               addr_size;
+    const uint8_t       * p_addr;
+    indirect_tx_entry_t * p_entry;
+
+    if (!(p_ack[FRAME_PENDING_OFFSET] & FRAME_PENDING_BIT) || !data_request_check(p_frame))
+    {
+        return;
+    }
+
+    p_addr = src_addr_get(p_frame, &addr_size);
+
+    if (p_addr == NULL)
+    {
+        return;
+    }
+
+    p_entry = entry_find(p_addr, addr_size);
+
+    if (p_entry != NULL)
+    {
+        (void)nrfx_atomic_u32_fetch_add(&m_stats.polls, 1);
+
+        // The transmission is requested outside of the RADIO interrupt handler.
+        nrf_802154_timer_sched_remove(&m_dispatch_timer, NULL);
+
+        m_dispatch_timer.callback  = dispatch_timer_fired;
+        m_dispatch_timer.p_context = (void *)entry_frame_get(p_entry);
+        m_dispatch_timer.t0        = nrf_802154_timer_sched_time_get();
+        m_dispatch_timer.dt        = 0;
+
+        nrf_802154_timer_sched_add(&m_dispatch_timer, false);
+    }
+}
+
+void nrf_802154_indirect_tx_stats_get(nrf_802154_indirect_tx_stats_t * p_stats)
+{
+    p_stats->queued          = nrfx_atomic_u32_load(&m_stats.queued);
+    p_stats->polls           = nrfx_atomic_u32_load(&m_stats.polls);
+    p_stats->dispatched      = nrfx_atomic_u32_load(&m_stats.dispatched);
+    p_stats->dispatch_failed = nrfx_atomic_u32_load(&m_stats.dispatch_failed);
+    p_stats->expired         = nrfx_atomic_u32_load(&m_stats.expired);
+}
+
+#endif // NRF_802154_INDIRECT_TX_ENABLED
@@ -0,0 +1,108 @@
+/* Copyright (c) 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef NRF_802154_INDIRECT_TX_H__
+#define NRF_802154_INDIRECT_TX_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_types.h"
+
+/**
+ * @defgroup nrf_802154_indirect_tx 802.15.4 driver indirect transmission queue
+ * @{
+ * @ingroup nrf_802154
+ * @brief Indirect transmission feature.
+ *
+ * Frames for sleepy devices are kept in a queue keyed by their destination address. The pending
+ * bit in ACK frames is set for devices that have a queued frame, and a queued frame is transmitted
+ * right after the ACK to a data request of its destination, without waiting for the MAC layer.
+ */
+
+/**
+ * @brief Initializes the indirect transmission module.
+ */
+void nrf_802154_indirect_tx_init(void);
+
+/**
+ * @brief Adds a frame to the indirect transmission queue.
+ *
+ * @param[in]  p_data   Pointer to a buffer that contains PHR and PSDU of the frame.
+ * @param[in]  timeout  Time in microseconds after which the frame expires.
+ *
+ * @retval  true   The frame was queued.
+ * @retval  false  The queue is full or the frame has no destination address.
+ */
+bool nrf_802154_indirect_tx_add(const uint8_t * p_data, uint32_t timeout);
+
+/**
+ * @brief Removes a frame from the indirect transmission queue.
+ *
+ * @param[in]  p_data  Pointer to a buffer that contains PHR and PSDU of the frame.
+ *
+ * @retval  true   The frame was removed.
+ * @retval  false  The frame is not queued, or its transmission has already started.
+ */
+bool nrf_802154_indirect_tx_remove(const uint8_t * p_data);
+
+/**
+ * @brief Checks if a frame is queued for the source of the given frame.
+ *
+ * @param[in]  p_frame  Pointer to a buffer that contains PHR and PSDU of the received frame.
+ *
+ * @retval  true   A frame is queued for the source of @p p_frame.
+ * @retval  false  No frame is queued for the source of @p p_frame.
+ */
+bool nrf_802154_indirect_tx_pending_check(const uint8_t * p_frame);
+
+/**
+ * @brief Handles the end of the transmission of an ACK frame.
+ *
+ * If @p p_frame is a data request and @p p_ack has the pending bit set, the transmission of
+ * the frame queued for the source of the data request is scheduled.
+ *
+ * @param[in]  p_frame  Pointer to a buffer that contains PHR and PSDU of the acknowledged frame.
+ * @param[in]  p_ack    Pointer to a buffer that contains PHR and PSDU of the ACK frame.
+ */
+void nrf_802154_indirect_tx_ack_sent(const uint8_t * p_frame, const uint8_t * p_ack);
+
+/**
+ * @brief Gets the statistics of the indirect transmission queue.
+ *
+ * @param[out]  p_stats  Pointer to the structure to be filled.
+ */
+void nrf_802154_indirect_tx_stats_get(nrf_802154_indirect_tx_stats_t * p_stats);
+
+/**
+ *@}
+ **/
+
+#endif // NRF_802154_INDIRECT_TX_H__
@@ -0,0 +1,405 @@
+/* Copyright (c) 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements the wake-on-radio listen feature of the 802.15.4 driver.
+ *
+ */
+
+#include "nrf_802154_wor.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_critical_section.h"
+#include "nrf_802154_procedures_duration.h"
+#include "nrf_802154_request.h"
+#include "rsch/nrf_802154_rsch.h"
+#include "timer_scheduler/nrf_802154_timer_sched.h"
+
+#if NRF_802154_WOR_ENABLED
+
+#define SAMPLE_TIMEOUT_MARGIN 1000u ///< Time after the end of a sample after which it is considered lost [us].
+
+/**
+ * @brief States of the wake-on-radio listen.
+ */
+typedef enum
+{
+    WOR_STATE_STOPPED, ///< Listen stopped.
+    WOR_STATE_SLEEP,   ///< Radio asleep, waiting for the timeslot of the next sample.
+    WOR_STATE_SAMPLE,  ///< Energy detection sample in progress.
+    WOR_STATE_LISTEN,  ///< Radio held in the receive state.
+} wor_state_t;
+
+static volatile wor_state_t   m_state;         ///< State of the wake-on-radio listen.
+static uint32_t               m_interval;      ///< Time between the starts of two samples [us].
+static uint32_t               m_sample_time;   ///< Duration of a sample [us].
+static uint32_t               m_hold_time;     ///< Time the radio is held awake after a wakeup [us].
+static uint8_t                m_ed_threshold;  ///< Energy level that wakes the radio.
+static uint32_t               m_sample_t0;     ///< Base time of the next sample [us].
+static uint32_t               m_on_t0;         ///< Time when the radio was woken up [us].
+static uint32_t               m_total_t0;      ///< Time from which the total time is not yet counted [us].
+static bool                   m_woken;         ///< If the radio is held awake after a sample that reached the threshold.
+static volatile bool          m_frame_started; ///< If the reception of a frame started since the wakeup.
+static volatile uint32_t      m_frame_t0;      ///< Time of the last start of a frame [us].
+static nrf_802154_timer_t     m_timer;         ///< Timer that ends the sample or the hold time.
+static nrf_802154_wor_stats_t m_stats;         ///< Wake-on-radio statistics.
+
+/**
+ * @brief Enters the section in which the statistics are updated.
+ *
+ * The statistics are updated from the thread context, the timer and the RADIO interrupt, and
+ * the times do not fit in an atomic word, so they are only accessed in the driver critical section.
+ * An update cannot be postponed like a request, so the section is entered forcefully, like in
+ * the RADIO interrupt handler.
+ */
+static void stats_enter(void)
+{
+    nrf_802154_critical_section_forcefully_enter();
+}
+
+/**
+ * @brief Exits the section entered with @ref stats_enter.
+ */
+static void stats_exit(void)
+{
+    nrf_802154_critical_section_exit();
+}
+
+static void timer_start(uint32_t t0, uint32_t dt)
+{
+    m_timer.t0 = t0;
+    m_timer.dt = dt;
+
+    nrf_802154_timer_sched_add(&m_timer, true);
+}
+
+/**
+ * @brief Requests the timeslot of the next sample.
+ *
+ * Samples are kept aligned to the interval, unless the radio was held awake past the start of
+ * the next sample.
+ *
+ * @param[in]  now  Current time [us].
+ */
+static void next_sample_schedule(uint32_t now)
+{
+    m_state = WOR_STATE_SLEEP;
+
+    if (!nrf_802154_rsch_delayed_timeslot_request(m_sample_t0,
+                                                  m_interval,
+                                                  m_sample_time,
+                                                  RSCH_PRIO_DETECT,
+                                                  RSCH_DLY_WOR))
+    {
+        m_sample_t0 = now;
+
+        if (!nrf_802154_rsch_delayed_timeslot_request(m_sample_t0,
+                                                      m_interval,
+                                                      m_sample_time,
+                                                      RSCH_PRIO_DETECT,
+                                                      RSCH_DLY_WOR))
+        {
+            m_state = WOR_STATE_STOPPED;
+            return;
+        }
+    }
+
+    m_sample_t0 += m_interval;
+}
+
+/**
+ * @brief Puts the radio to sleep and schedules the next sample.
+ *
+ * @param[in]  now  Current time [us].
+ *
+ * @retval  true   The radio is going to sleep.
+ * @retval  false  The radio is busy receiving a frame or performing an operation requested by
+ *                 the higher layer.
+ */
+static bool radio_sleep(uint32_t now)
+{
+    if (!nrf_802154_request_sleep(NRF_802154_TERM_NONE))
+    {
+        return false;
+    }
+
+    stats_enter();
+
+    if (m_woken && !m_frame_started)
+    {
+        m_stats.wakeups_missed++;
+    }
+
+    m_stats.time_on    += now - m_on_t0;
+    m_stats.time_total += now - m_total_t0;
+    m_total_t0          = now;
+
+    stats_exit();
+
+    m_woken = false;
+
+    next_sample_schedule(now);
+
+    return true;
+}
+
+/**
+ * @brief Puts the radio to sleep, or keeps it in the receive state and retries when the radio is
+ *        busy.
+ *
+ * @param[in]  now  Current time [us].
+ */
+static void radio_sleep_or_retry(uint32_t now)
+{
+    if (!radio_sleep(now))
+    {
+        m_state = WOR_STATE_LISTEN;
+        timer_start(now, nrf_802154_rx_duration_get(MAX_PACKET_SIZE, true));
+    }
+}
+
+static void timer_fired(void * p_context)
+{
+    (void)p_context;
+
+    uint32_t now = nrf_802154_timer_sched_time_get();
+
+    switch (m_state)
+    {
+        case WOR_STATE_SAMPLE:
+            // Energy detection was aborted by a request from the higher layer.
+            stats_enter();
+            m_stats.samples_skipped++;
+            stats_exit();
+            radio_sleep_or_retry(now);
+            break;
+
+        case WOR_STATE_LISTEN:
+            if (m_frame_started)
+            {
+                uint32_t frame_t0 = m_frame_t0;
+
+                if (nrf_802154_timer_sched_time_is_in_future(now, frame_t0, m_hold_time))
+                {
+                    timer_start(frame_t0, m_hold_time);
+                    break;
+                }
+            }
+
+            radio_sleep_or_retry(now);
+            break;
+
+        default:
+            break;
+    }
+}
+
+void nrf_802154_wor_init(void)
+{
+    m_state = WOR_STATE_STOPPED;
+
+    memset(&m_stats, 0, sizeof(m_stats));
+
+    m_timer.callback  = timer_fired;
+    m_timer.p_context = NULL;
+}
+
+bool nrf_802154_wor_start(uint32_t interval,
+                          uint32_t sample_time,
+                          uint32_t hold_time,
+                          uint8_t  ed_threshold)
+{
+    uint32_t now;
+
+    if ((m_state != WOR_STATE_STOPPED) || (sample_time == 0) || (interval <= sample_time))
+    {
+        return false;
+    }
+
+    now = nrf_802154_timer_sched_time_get();
+
+    m_interval      = interval;
+    m_sample_time   = sample_time;
+    m_hold_time     = hold_time;
+    m_ed_threshold  = ed_threshold;
+    m_sample_t0     = now;
+    m_on_t0         = now;
+    m_total_t0      = now;
+    m_woken         = false;
+    m_frame_started = false;
+
+    radio_sleep_or_retry(now);
+
+    return true;
+}
+
+void nrf_802154_wor_stop(void)
+{
+    wor_state_t state = m_state;
+    uint32_t    now;
+
+    m_state = WOR_STATE_STOPPED;
+
+    (void)nrf_802154_rsch_delayed_timeslot_cancel(RSCH_DLY_WOR);
+    nrf_802154_timer_sched_remove(&m_timer, NULL);
+
+    if (state == WOR_STATE_STOPPED)
+    {
+        return;
+    }
+
+    now = nrf_802154_timer_sched_time_get();
+
+    stats_enter();
+
+    if (state != WOR_STATE_SLEEP)
+    {
+        m_stats.time_on += now - m_on_t0;
+    }
+
+    m_stats.time_total += now - m_total_t0;
+
+    stats_exit();
+}
+
+bool nrf_802154_wor_is_active(void)
+{
+    return m_state != WOR_STATE_STOPPED;
+}
+
+void nrf_802154_wor_timeslot_started(void)
+{
+    uint32_t now;
+
+    if (m_state != WOR_STATE_SLEEP)
+    {
+        return;
+    }
+
+    now     = nrf_802154_timer_sched_time_get();
+    m_on_t0 = now;
+    m_state = WOR_STATE_SAMPLE;
+
+    if (nrf_802154_request_energy_detection(NRF_802154_TERM_NONE, m_sample_time))
+    {
+        timer_start(now, m_sample_time + SAMPLE_TIMEOUT_MARGIN);
+    }
+    else
+    {
+        // The radio is busy with an operation requested by the higher layer. The next sample
+        // cannot be requested from this callback, so it is requested when the radio goes to sleep.
+        stats_enter();
+        m_stats.samples_skipped++;
+        stats_exit();
+
+        m_frame_started = false;
+        m_state         = WOR_STATE_LISTEN;
+
+        timer_start(now, nrf_802154_rx_duration_get(MAX_PACKET_SIZE, true));
+    }
+}
+
+bool nrf_802154_wor_energy_detected_hook(uint8_t result)
+{
+    uint32_t now;
+    bool     wakeup;
+
+    if (m_state != WOR_STATE_SAMPLE)
+    {
+        return false;
+    }
+
+    nrf_802154_timer_sched_remove(&m_timer, NULL);
+
+    now    = nrf_802154_timer_sched_time_get();
+    wakeup = (result >= m_ed_threshold);
+
+    stats_enter();
+    m_stats.samples++;
+
+    if (wakeup)
+    {
+        m_stats.wakeups++;
+    }
+
+    stats_exit();
+
+    if (wakeup)
+    {
+        m_woken         = true;
+        m_frame_started = false;
+        m_state         = WOR_STATE_LISTEN;
+
+        timer_start(now, m_hold_time);
+    }
+    else
+    {
+        radio_sleep_or_retry(now);
+    }
+
+    return true;
+}
+
+void nrf_802154_wor_rx_started_hook(const uint8_t * p_frame)
+{
+    (void)p_frame;
+
+    if (m_state == WOR_STATE_LISTEN)
+    {
+        m_frame_t0      = nrf_802154_timer_sched_time_get();
+        m_frame_started = true;
+
+        stats_enter();
+        m_stats.frames++;
+        stats_exit();
+    }
+}
+
+void nrf_802154_wor_stats_get(nrf_802154_wor_stats_t * p_stats)
+{
+    stats_enter();
+
+    *p_stats = m_stats;
+
+    if (m_state != WOR_STATE_STOPPED)
+    {
+        p_stats->time_total += nrf_802154_timer_sched_time_get() - m_total_t0;
+    }
+
+    stats_exit();
+}
+
+#endif // NRF_802154_WOR_ENABLED
@@ -0,0 +1,125 @@
+/* Copyright (c) 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef NRF_802154_WOR_H__
+#define NRF_802154_WOR_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_types.h"
+
+/**
+ * @defgroup nrf_802154_wor 802.15.4 driver wake-on-radio listen
+ * @{
+ * @ingroup nrf_802154
+ * @brief Wake-on-radio (preamble sampling) listen feature.
+ *
+ * Instead of listening continuously, the driver wakes the radio periodically for a short energy
+ * detection sample. When the detected energy reaches the threshold, the radio stays in the receive
+ * state for the hold time, which is extended every time the reception of a frame starts. Otherwise,
+ * the radio goes back to sleep, which lets the Radio Scheduler release the high-frequency clock.
+ */
+
+/**
+ * @brief Initializes the wake-on-radio module.
+ */
+void nrf_802154_wor_init(void);
+
+/**
+ * @brief Starts the wake-on-radio listen.
+ *
+ * @param[in]  interval      Time between the starts of two samples, in microseconds (us).
+ * @param[in]  sample_time   Duration of the energy detection sample, in microseconds (us).
+ * @param[in]  hold_time     Time the radio stays in the receive state after a sample that reached
+ *                           the threshold or after the start of a frame, in microseconds (us).
+ * @param[in]  ed_threshold  Energy level that wakes the radio, in the units of
+ *                           @ref nrf_802154_energy_detected.
+ *
+ * @retval  true   The wake-on-radio listen has started.
+ * @retval  false  The listen is already active or the parameters are invalid.
+ */
+bool nrf_802154_wor_start(uint32_t interval,
+                          uint32_t sample_time,
+                          uint32_t hold_time,
+                          uint8_t  ed_threshold);
+
+/**
+ * @brief Stops the wake-on-radio listen.
+ *
+ * The radio is left in its current state.
+ */
+void nrf_802154_wor_stop(void);
+
+/**
+ * @brief Checks if the wake-on-radio listen is active.
+ *
+ * @retval  true   The wake-on-radio listen is active.
+ * @retval  false  The wake-on-radio listen is stopped.
+ */
+bool nrf_802154_wor_is_active(void);
+
+/**
+ * @brief Handles the start of the delayed timeslot of a sample.
+ *
+ * @note This function is intended to be called from
+ *       @ref nrf_802154_rsch_delayed_timeslot_started.
+ */
+void nrf_802154_wor_timeslot_started(void);
+
+/**
+ * @brief Handles the end of an energy detection procedure.
+ *
+ * @param[in]  result  Detected energy level.
+ *
+ * @retval  true   The procedure was a wake-on-radio sample and the result was consumed.
+ * @retval  false  The result is to be passed to the higher layer.
+ */
+bool nrf_802154_wor_energy_detected_hook(uint8_t result);
+
+/**
+ * @brief Handles the start of the reception of a frame.
+ *
+ * @param[in]  p_frame  Pointer to the buffer containing the frame being received.
+ */
+void nrf_802154_wor_rx_started_hook(const uint8_t * p_frame);
+
+/**
+ * @brief Gets the statistics of the wake-on-radio listen.
+ *
+ * @param[out]  p_stats  Pointer to the structure to be filled.
+ */
+void nrf_802154_wor_stats_get(nrf_802154_wor_stats_t * p_stats);
+
+/**
+ *@}
+ **/
+
+#endif // NRF_802154_WOR_H__
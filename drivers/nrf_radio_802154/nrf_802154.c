@@ -54,6 +54,7 @@
 #include "nrf_802154_rssi.h"
 #include "nrf_802154_rx_buffer.h"
 #include "nrf_802154_timer_coord.h"
+#include "nrf_802154_tx_buffer.h"
 #include "hal/nrf_radio.h"
 #include "platform/clock/nrf_802154_clock.h"
 #include "platform/lp_timer/nrf_802154_lp_timer.h"
@@ -64,13 +65,14 @@
 #include "timer_scheduler/nrf_802154_timer_sched.h"
 
 #include "mac_features/nrf_802154_ack_timeout.h"
+#include "mac_features/nrf_802154_channel_hop.h"
 #include "mac_features/nrf_802154_csma_ca.h"
 #include "mac_features/nrf_802154_delayed_trx.h"
+#include "mac_features/nrf_802154_dup_filter.h"
+#include "mac_features/nrf_802154_indirect_tx.h"
+#include "mac_features/nrf_802154_wor.h"
 #include "mac_features/ack_generator/nrf_802154_ack_data.h"
-
-#if ENABLE_FEM
 #include "fem/nrf_fem_protocol_api.h"
-#endif
 
 #define RAW_LENGTH_OFFSET  0
 #define RAW_PAYLOAD_OFFSET 1
@@ -158,7 +160,11 @@ void nrf_802154_tx_power_set(int8_t power)
 
 int8_t nrf_802154_tx_power_get(void)
 {
-    return nrf_802154_pib_tx_power_get();
+    int8_t pa_gain;
+
+    nrf_802154_fal_pa_is_configured(&pa_gain);
+
+    return (int8_t)nrf_802154_pib_tx_power_get(nrf_802154_pib_channel_get()) + pa_gain;
 }
 
 void nrf_802154_temperature_changed(void)
@@ -219,6 +225,24 @@ void nrf_802154_init(void)
     nrf_802154_temperature_init();
     nrf_802154_timer_coord_init();
     nrf_802154_timer_sched_init();
+#if !NRF_802154_USE_RAW_API && (NRF_802154_TX_BUFFERS > 0)
+    nrf_802154_tx_buffer_init();
+#endif // !NRF_802154_USE_RAW_API && (NRF_802154_TX_BUFFERS > 0)
+#if NRF_802154_INDIRECT_TX_ENABLED
+    nrf_802154_indirect_tx_init();
+#endif // NRF_802154_INDIRECT_TX_ENABLED
+#if NRF_802154_DUP_FILTER_ENABLED
+    nrf_802154_dup_filter_init();
+#endif // NRF_802154_DUP_FILTER_ENABLED
+#if NRF_802154_CHANNEL_HOP_ENABLED
+    nrf_802154_channel_hop_init();
+#endif // NRF_802154_CHANNEL_HOP_ENABLED
+#if NRF_802154_WOR_ENABLED
+    nrf_802154_wor_init();
+#endif // NRF_802154_WOR_ENABLED
+#if NRF_802154_PROCEDURES_DURATION_CALIBRATION_ENABLED
+    nrf_802154_core_procedures_duration_calibration_request();
+#endif // NRF_802154_PROCEDURES_DURATION_CALIBRATION_ENABLED
 }
 
 void nrf_802154_deinit(void)
@@ -261,7 +285,11 @@ void nrf_802154_fem_control_cfg_set(nrf_802154_fem_control_cfg_t const * const p
     config.ppi_ch_id_set = p_cfg->ppi_ch_id_set;
     config.ppi_ch_id_clr = p_cfg->ppi_ch_id_clr;
 
+    config.fem_config.pa_fixed_gain_db = p_cfg->pa_fixed_gain_db;
+
     nrf_fem_interface_configuration_set(&config);
+
+    nrf_802154_pib_tx_power_update();
 }
 
 void nrf_802154_fem_control_cfg_get(nrf_802154_fem_control_cfg_t * p_cfg)
@@ -283,6 +311,8 @@ void nrf_802154_fem_control_cfg_get(nrf_802154_fem_control_cfg_t * p_cfg)
 
     p_cfg->ppi_ch_id_clr = config.ppi_ch_id_clr;
     p_cfg->ppi_ch_id_set = config.ppi_ch_id_set;
+
+    p_cfg->pa_fixed_gain_db = config.fem_config.pa_fixed_gain_db;
 }
 
 #endif // ENABLE_FEM
@@ -366,6 +396,26 @@ bool nrf_802154_transmit_raw(const uint8_t * p_data, bool cca)
                                          REQ_ORIG_HIGHER_LAYER,
                                          p_data,
                                          cca,
+                                         NRF_802154_TX_POWER_FROM_PIB,
+                                         false,
+                                         NULL);
+
+    nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_TRANSMIT);
+    return result;
+}
+
+bool nrf_802154_transmit_raw_with_power(const uint8_t * p_data, bool cca, int8_t power)
+{
+    bool                  result;
+    nrf_802154_tx_power_t tx_power = { .use_pib = false, .dbm = power };
+
+    nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_TRANSMIT);
+
+    result = nrf_802154_request_transmit(NRF_802154_TERM_NONE,
+                                         REQ_ORIG_HIGHER_LAYER,
+                                         p_data,
+                                         cca,
+                                         tx_power,
                                          false,
                                          NULL);
 
@@ -386,6 +436,64 @@ bool nrf_802154_transmit(const uint8_t * p_data, uint8_t length, bool cca)
                                          REQ_ORIG_HIGHER_LAYER,
                                          m_tx_buffer,
                                          cca,
+                                         NRF_802154_TX_POWER_FROM_PIB,
+                                         false,
+                                         NULL);
+
+    nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_TRANSMIT);
+    return result;
+}
+
+bool nrf_802154_transmit_with_power(const uint8_t * p_data, uint8_t length, bool cca, int8_t power)
+{
+    bool                  result;
+    nrf_802154_tx_power_t tx_power = { .use_pib = false, .dbm = power };
+
+    nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_TRANSMIT);
+
+    tx_buffer_fill(p_data, length);
+    result = nrf_802154_request_transmit(NRF_802154_TERM_NONE,
+                                         REQ_ORIG_HIGHER_LAYER,
+                                         m_tx_buffer,
+                                         cca,
+                                         tx_power,
+                                         false,
+                                         NULL);
+
+    nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_TRANSMIT);
+    return result;
+}
+
+#if NRF_802154_TX_BUFFERS > 0
+
+uint8_t * nrf_802154_tx_buffer_get(void)
+{
+    uint8_t * p_buffer = nrf_802154_tx_buffer_alloc();
+
+    return (p_buffer != NULL) ? (p_buffer + RAW_PAYLOAD_OFFSET) : NULL;
+}
+
+void nrf_802154_tx_buffer_put(uint8_t * p_data)
+{
+    nrf_802154_tx_buffer_release(p_data - RAW_PAYLOAD_OFFSET);
+}
+
+bool nrf_802154_transmit_buffer(uint8_t * p_data, uint8_t length, bool cca)
+{
+    bool      result;
+    uint8_t * p_buffer = p_data - RAW_PAYLOAD_OFFSET;
+
+    assert(nrf_802154_tx_buffer_is_allocated(p_buffer));
+    assert(length <= MAX_PACKET_SIZE - FCS_SIZE);
+
+    nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_TRANSMIT);
+
+    p_buffer[RAW_LENGTH_OFFSET] = length + FCS_SIZE;
+    result = nrf_802154_request_transmit(NRF_802154_TERM_NONE,
+                                         REQ_ORIG_HIGHER_LAYER,
+                                         p_buffer,
+                                         cca,
+                                         NRF_802154_TX_POWER_FROM_PIB,
                                          false,
                                          NULL);
 
@@ -393,6 +501,8 @@ bool nrf_802154_transmit(const uint8_t * p_data, uint8_t length, bool cca)
     return result;
 }
 
+#endif // NRF_802154_TX_BUFFERS > 0
+
 #endif // NRF_802154_USE_RAW_API
 
 bool nrf_802154_transmit_raw_at(const uint8_t * p_data,
@@ -490,11 +600,9 @@ bool nrf_802154_continuous_carrier(void)
 
 void nrf_802154_buffer_free_raw(uint8_t * p_data)
 {
-    bool          result;
-    rx_buffer_t * p_buffer = (rx_buffer_t *)p_data;
+    bool result;
 
-    assert(p_buffer->free == false);
-    (void)p_buffer;
+    assert(nrf_802154_rx_buffer_is_taken(p_data));
 
     nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_BUFFER_FREE);
 
@@ -507,11 +615,9 @@ void nrf_802154_buffer_free_raw(uint8_t * p_data)
 
 bool nrf_802154_buffer_free_immediately_raw(uint8_t * p_data)
 {
-    bool          result;
-    rx_buffer_t * p_buffer = (rx_buffer_t *)p_data;
+    bool result;
 
-    assert(p_buffer->free == false);
-    (void)p_buffer;
+    assert(nrf_802154_rx_buffer_is_taken(p_data));
 
     nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_BUFFER_FREE);
 
@@ -525,11 +631,9 @@ bool nrf_802154_buffer_free_immediately_raw(uint8_t * p_data)
 
 void nrf_802154_buffer_free(uint8_t * p_data)
 {
-    bool          result;
-    rx_buffer_t * p_buffer = (rx_buffer_t *)(p_data - RAW_PAYLOAD_OFFSET);
+    bool result;
 
-    assert(p_buffer->free == false);
-    (void)p_buffer;
+    assert(nrf_802154_rx_buffer_is_taken(p_data - RAW_PAYLOAD_OFFSET));
 
     nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_BUFFER_FREE);
 
@@ -542,11 +646,9 @@ void nrf_802154_buffer_free(uint8_t * p_data)
 
 bool nrf_802154_buffer_free_immediately(uint8_t * p_data)
 {
-    bool          result;
-    rx_buffer_t * p_buffer = (rx_buffer_t *)(p_data - RAW_PAYLOAD_OFFSET);
+    bool result;
 
-    assert(p_buffer->free == false);
-    (void)p_buffer;
+    assert(nrf_802154_rx_buffer_is_taken(p_data - RAW_PAYLOAD_OFFSET));
 
     nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_BUFFER_FREE);
 
@@ -685,6 +787,25 @@ void nrf_802154_transmit_csma_ca(const uint8_t * p_data, uint8_t length)
     nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_CSMACA);
 }
 
+#if NRF_802154_TX_BUFFERS > 0
+
+void nrf_802154_transmit_csma_ca_buffer(uint8_t * p_data, uint8_t length)
+{
+    uint8_t * p_buffer = p_data - RAW_PAYLOAD_OFFSET;
+
+    assert(nrf_802154_tx_buffer_is_allocated(p_buffer));
+    assert(length <= MAX_PACKET_SIZE - FCS_SIZE);
+
+    nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_CSMACA);
+
+    p_buffer[RAW_LENGTH_OFFSET] = length + FCS_SIZE;
+    nrf_802154_csma_ca_start(p_buffer);
+
+    nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_CSMACA);
+}
+
+#endif // NRF_802154_TX_BUFFERS > 0
+
 #endif // NRF_802154_USE_RAW_API
 #endif // NRF_802154_CSMA_CA_ENABLED
 
@@ -697,6 +818,83 @@ void nrf_802154_ack_timeout_set(uint32_t time)
 
 #endif // NRF_802154_ACK_TIMEOUT_ENABLED
 
+#if NRF_802154_INDIRECT_TX_ENABLED && NRF_802154_USE_RAW_API
+
+bool nrf_802154_transmit_indirect_raw(const uint8_t * p_data, uint32_t timeout)
+{
+    return nrf_802154_indirect_tx_add(p_data, timeout);
+}
+
+bool nrf_802154_transmit_indirect_cancel_raw(const uint8_t * p_data)
+{
+    return nrf_802154_indirect_tx_remove(p_data);
+}
+
+void nrf_802154_indirect_stats_get(nrf_802154_indirect_tx_stats_t * p_stats)
+{
+    nrf_802154_indirect_tx_stats_get(p_stats);
+}
+
+#endif // NRF_802154_INDIRECT_TX_ENABLED && NRF_802154_USE_RAW_API
+
+#if NRF_802154_DUP_FILTER_ENABLED
+
+void nrf_802154_duplicate_stats_get(nrf_802154_dup_filter_stats_t * p_stats)
+{
+    nrf_802154_dup_filter_stats_get(p_stats);
+}
+
+#endif // NRF_802154_DUP_FILTER_ENABLED
+
+#if NRF_802154_CHANNEL_HOP_ENABLED
+
+bool nrf_802154_multichannel_listen_start(const uint8_t * p_channels,
+                                          uint8_t         count,
+                                          uint32_t        dwell)
+{
+    return nrf_802154_channel_hop_start(p_channels, count, dwell);
+}
+
+void nrf_802154_multichannel_listen_stop(void)
+{
+    nrf_802154_channel_hop_stop();
+}
+
+uint8_t nrf_802154_multichannel_listen_channel_get(void)
+{
+    return nrf_802154_channel_hop_is_active() ? nrf_802154_channel_hop_channel_get() :
+           nrf_802154_pib_channel_get();
+}
+
+void nrf_802154_multichannel_listen_stats_get(nrf_802154_channel_hop_stats_t * p_stats)
+{
+    nrf_802154_channel_hop_stats_get(p_stats);
+}
+
+#endif // NRF_802154_CHANNEL_HOP_ENABLED
+
+#if NRF_802154_WOR_ENABLED
+
+bool nrf_802154_wake_on_radio_start(uint32_t interval,
+                                    uint32_t sample_time,
+                                    uint32_t hold_time,
+                                    uint8_t  ed_threshold)
+{
+    return nrf_802154_wor_start(interval, sample_time, hold_time, ed_threshold);
+}
+
+void nrf_802154_wake_on_radio_stop(void)
+{
+    nrf_802154_wor_stop();
+}
+
+void nrf_802154_wake_on_radio_stats_get(nrf_802154_wor_stats_t * p_stats)
+{
+    nrf_802154_wor_stats_get(p_stats);
+}
+
+#endif // NRF_802154_WOR_ENABLED
+
 __WEAK void nrf_802154_tx_ack_started(const uint8_t * p_data)
 {
     (void)p_data;
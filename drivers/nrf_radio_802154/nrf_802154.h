@@ -91,6 +91,9 @@ void nrf_802154_radio_irq_handler(void);
 /**
  * @brief Sets the channel on which the radio is to operate.
  *
+ * @note If the multi-channel listen is active, the channel is applied only after
+ *       @ref nrf_802154_multichannel_listen_stop is called.
+ *
  * @param[in]  channel  Channel number (11-26).
  */
 void nrf_802154_channel_set(uint8_t channel);
@@ -108,6 +111,13 @@ uint8_t nrf_802154_channel_get(void);
  * @note The driver recalculates the requested value to the nearest value accepted by the hardware.
  *       The calculation result is rounded up.
  *
+ * @note @p power is the power at the output of the FEM. The gain of the FEM is subtracted from
+ *       the requested value by the FEM abstraction layer: the simple GPIO and three-pin GPIO FEMs
+ *       subtract @c pa_fixed_gain_db of their configuration. The RADIO setting is precalculated
+ *       for all channels when this function or @ref nrf_802154_fem_control_cfg_set is called. If
+ *       the FEM is configured with nrf_fem_interface_configuration_set, call this function again
+ *       afterwards.
+ *
  * @param[in]  power  Transmit power in dBm.
  */
 void nrf_802154_tx_power_set(int8_t power);
@@ -377,6 +387,25 @@ bool nrf_802154_receive_at_cancel(void);
  */
 bool nrf_802154_transmit_raw(const uint8_t * p_data, bool cca);
 
+/**
+ * @brief Changes the radio state to @ref RADIO_STATE_TX to transmit a frame with the given power.
+ *
+ * This function works like @ref nrf_802154_transmit_raw, but the frame is transmitted with
+ * @p power instead of the power set by @ref nrf_802154_tx_power_set. It allows adapting
+ * the transmit power to the link to each neighbor. The power is compensated for the gain of
+ * the FEM Power Amplifier in the same way. ACK frames and retransmissions performed by the CSMA-CA
+ * procedure use the power set by @ref nrf_802154_tx_power_set.
+ *
+ * @param[in]  p_data  Pointer to the array with data to transmit. The first byte must contain frame
+ *                     length (including PHR and FCS).
+ * @param[in]  cca     If the driver is to perform a CCA procedure before transmission.
+ * @param[in]  power   Transmit power of this frame in dBm.
+ *
+ * @retval  true   The transmission procedure was scheduled.
+ * @retval  false  The driver could not schedule the transmission procedure.
+ */
+bool nrf_802154_transmit_raw_with_power(const uint8_t * p_data, bool cca, int8_t power);
+
 #else // NRF_802154_USE_RAW_API
 
 /**
@@ -419,6 +448,72 @@ bool nrf_802154_transmit_raw(const uint8_t * p_data, bool cca);
  */
 bool nrf_802154_transmit(const uint8_t * p_data, uint8_t length, bool cca);
 
+/**
+ * @brief Changes the radio state to transmit a frame with the given power.
+ *
+ * This function works like @ref nrf_802154_transmit, but the frame is transmitted with @p power
+ * instead of the power set by @ref nrf_802154_tx_power_set. It allows adapting the transmit power
+ * to the link to each neighbor. The power is compensated for the gain of the FEM Power Amplifier
+ * in the same way.
+ *
+ * @param[in]  p_data  Pointer to the array with the payload of data to transmit. The array should
+ *                     exclude PHR or FCS fields of the 802.15.4 frame.
+ * @param[in]  length  Length of the given frame. This value must exclude PHR and FCS fields from
+ *                     the given frame (exact size of buffer pointed to by @p p_data).
+ * @param[in]  cca     If the driver is to perform a CCA procedure before transmission.
+ * @param[in]  power   Transmit power of this frame in dBm.
+ *
+ * @retval  true   The transmission procedure was scheduled.
+ * @retval  false  The driver could not schedule the transmission procedure.
+ */
+bool nrf_802154_transmit_with_power(const uint8_t * p_data, uint8_t length, bool cca, int8_t power);
+
+#if NRF_802154_TX_BUFFERS > 0
+
+/**
+ * @brief Lends a transmit buffer owned by the driver to the higher layer.
+ *
+ * The higher layer prepares a frame in place in the lent buffer and transmits it with
+ * @ref nrf_802154_transmit_buffer or @ref nrf_802154_transmit_csma_ca_buffer, which do not copy
+ * the frame. Space for the PHR is reserved in front of the returned pointer. Up to
+ * @ref NRF_802154_TX_BUFFERS frames can be prepared at the same time.
+ *
+ * @note This function can be safely called from any context.
+ *
+ * @verbatim
+ *       returned pointer
+ *       v
+ * +-----+-----------------------------------------------------------+------------+
+ * | PHR | MAC header and payload (up to MAX_PACKET_SIZE - FCS_SIZE) | FCS        |
+ * +-----+-----------------------------------------------------------+------------+
+ * @endverbatim
+ *
+ * @returns  Pointer to the buffer for the MAC header and payload, or NULL if all transmit buffers
+ *           are lent.
+ */
+uint8_t * nrf_802154_tx_buffer_get(void);
+
+/**
+ * @brief Changes the radio state to transmit a frame prepared in a lent transmit buffer.
+ *
+ * This function works like @ref nrf_802154_transmit, but the frame is not copied. The buffer must
+ * not be modified until the transmission result is reported by @ref nrf_802154_transmitted or
+ * @ref nrf_802154_transmit_failed, with @p p_frame equal to @p p_data. Afterwards, the buffer
+ * can be transmitted again or returned with @ref nrf_802154_tx_buffer_put.
+ *
+ * @param[in]  p_data  Pointer returned by @ref nrf_802154_tx_buffer_get.
+ * @param[in]  length  Length of the MAC header and payload. This value must exclude PHR and FCS
+ *                     fields.
+ * @param[in]  cca     If the driver is to perform a CCA procedure before transmission.
+ *
+ * @retval  true   The transmission procedure was scheduled.
+ * @retval  false  The driver could not schedule the transmission procedure. The buffer remains
+ *                 lent to the higher layer.
+ */
+bool nrf_802154_transmit_buffer(uint8_t * p_data, uint8_t length, bool cca);
+
+#endif // NRF_802154_TX_BUFFERS > 0
+
 #endif // NRF_802154_USE_RAW_API
 
 /**
@@ -894,6 +989,21 @@ void nrf_802154_buffer_free(uint8_t * p_data);
  */
 bool nrf_802154_buffer_free_immediately(uint8_t * p_data);
 
+#if NRF_802154_TX_BUFFERS > 0
+
+/**
+ * @brief Returns a transmit buffer lent by @ref nrf_802154_tx_buffer_get to the driver.
+ *
+ * @note This function can be safely called from any context, including the
+ *       @ref nrf_802154_transmitted and @ref nrf_802154_transmit_failed callbacks.
+ *
+ * @param[in]  p_data  Pointer returned by @ref nrf_802154_tx_buffer_get. The buffer must not be
+ *                     in the middle of a transmission.
+ */
+void nrf_802154_tx_buffer_put(uint8_t * p_data);
+
+#endif // NRF_802154_TX_BUFFERS > 0
+
 #endif // NRF_802154_USE_RAW_API
 
 /**
@@ -1034,7 +1144,8 @@ void nrf_802154_src_addr_matching_method_set(nrf_802154_src_addr_match_t match_m
  * @param[in]  data_type Type of data to be set. Refer to the @ref nrf_802154_ack_data_t type.
  *
  * @retval True   Address successfully added to the list.
- * @retval False  Not enough memory to store this address in the list.
+ * @retval False  Not enough memory to store this address in the list, or the IE data is longer
+ *                than @ref NRF_802154_MAX_ACK_IE_SIZE or is not a well-formed list of Header IEs.
  */
 bool nrf_802154_ack_data_set(const uint8_t * p_addr,
                              bool            extended,
@@ -1213,6 +1324,22 @@ void nrf_802154_transmit_csma_ca_raw(const uint8_t * p_data);
  */
 void nrf_802154_transmit_csma_ca(const uint8_t * p_data, uint8_t length);
 
+#if NRF_802154_TX_BUFFERS > 0
+
+/**
+ * @brief Performs the CSMA-CA procedure and transmits a frame prepared in a lent transmit buffer.
+ *
+ * This function works like @ref nrf_802154_transmit_csma_ca, but the frame is not copied.
+ * See @ref nrf_802154_transmit_buffer for the rules of the buffer ownership.
+ *
+ * @param[in]  p_data  Pointer returned by @ref nrf_802154_tx_buffer_get.
+ * @param[in]  length  Length of the MAC header and payload. This value must exclude PHR and FCS
+ *                     fields.
+ */
+void nrf_802154_transmit_csma_ca_buffer(uint8_t * p_data, uint8_t length);
+
+#endif // NRF_802154_TX_BUFFERS > 0
+
 #endif // NRF_802154_USE_RAW_API
 #endif // NRF_802154_CSMA_CA_ENABLED
 
@@ -1235,6 +1362,185 @@ void nrf_802154_ack_timeout_set(uint32_t time);
 
 #endif // NRF_802154_ACK_TIMEOUT_ENABLED
 
+/**
+ * @}
+ * @defgroup nrf_802154_indirect Indirect transmission
+ * @{
+ */
+#if NRF_802154_INDIRECT_TX_ENABLED && NRF_802154_USE_RAW_API
+
+/**
+ * @brief Queues a frame for indirect transmission to a sleepy device.
+ *
+ * The frame is kept by the driver until its destination polls for it with a data request. The
+ * pending bit is set in ACK frames sent to the destination while the frame is queued, and the frame
+ * is transmitted right after such an ACK frame, with a single CCA attempt. The end of
+ * the transmission is notified by @ref nrf_802154_transmitted_raw or
+ * @ref nrf_802154_transmit_failed. If the frame is not polled for before @p timeout expires,
+ * @ref nrf_802154_transmit_failed is called with @ref NRF_802154_TX_ERROR_EXPIRED.
+ *
+ * @note The buffer pointed to by @p p_data must remain valid until the end of the transmission
+ *       is notified.
+ *
+ * @param[in]  p_data   Pointer to the frame to transmit. See also @ref nrf_802154_transmit_raw.
+ * @param[in]  timeout  Time in microseconds (us) after which the frame expires.
+ *
+ * @retval  true   The frame was queued.
+ * @retval  false  The queue is full or the frame has no destination address.
+ */
+bool nrf_802154_transmit_indirect_raw(const uint8_t * p_data, uint32_t timeout);
+
+/**
+ * @brief Removes a frame from the indirect transmission queue.
+ *
+ * No notification is called for a removed frame.
+ *
+ * @param[in]  p_data  Pointer to the frame passed to @ref nrf_802154_transmit_indirect_raw.
+ *
+ * @retval  true   The frame was removed.
+ * @retval  false  The frame is not queued, or its transmission has already started.
+ */
+bool nrf_802154_transmit_indirect_cancel_raw(const uint8_t * p_data);
+
+/**
+ * @brief Gets the statistics of the indirect transmission queue.
+ *
+ * @param[out]  p_stats  Pointer to the structure to be filled.
+ */
+void nrf_802154_indirect_stats_get(nrf_802154_indirect_tx_stats_t * p_stats);
+
+#endif // NRF_802154_INDIRECT_TX_ENABLED && NRF_802154_USE_RAW_API
+
+/**
+ * @}
+ * @defgroup nrf_802154_duplicate Duplicate frame rejection
+ * @{
+ */
+#if NRF_802154_DUP_FILTER_ENABLED
+
+/**
+ * @brief Gets the statistics of the duplicate frame rejection.
+ *
+ * The hit rate of the rejection is the ratio of @c hits to @c checked.
+ *
+ * @param[out]  p_stats  Pointer to the structure to be filled.
+ */
+void nrf_802154_duplicate_stats_get(nrf_802154_dup_filter_stats_t * p_stats);
+
+#endif // NRF_802154_DUP_FILTER_ENABLED
+
+/**
+ * @}
+ * @defgroup nrf_802154_multichannel Multi-channel listen
+ * @{
+ */
+#if NRF_802154_CHANNEL_HOP_ENABLED
+
+/**
+ * @brief Starts listening on multiple channels.
+ *
+ * In the receive state, the driver cycles through the given channels, staying on each of them for
+ * @p dwell microseconds. When the reception of a frame starts, the driver stays on its channel
+ * until the frame is handled, including the transmission of the ACK frame, and then resumes
+ * hopping.
+ *
+ * Transmissions, CCA and energy detection requested while the multi-channel listen is active are
+ * performed on the channel the driver is on when they are requested. The driver does not hop
+ * until such an operation ends and the driver is back in the receive state.
+ *
+ * @note The channel set by @ref nrf_802154_channel_set is not modified. A channel set while the
+ *       multi-channel listen is active is only stored, and @ref nrf_802154_channel_get returns it,
+ *       but the radio does not switch to it. It is used after
+ *       @ref nrf_802154_multichannel_listen_stop is called.
+ *
+ * @param[in]  p_channels  Pointer to the list of channels (11-26). The list is copied.
+ * @param[in]  count       Number of channels in the list, up to
+ *                         @ref NRF_802154_CHANNEL_HOP_MAX_CHANNELS.
+ * @param[in]  dwell       Time in microseconds (us) spent on each channel.
+ *
+ * @retval  true   The multi-channel listen has started.
+ * @retval  false  The channel list or the dwell time is invalid.
+ */
+bool nrf_802154_multichannel_listen_start(const uint8_t * p_channels,
+                                          uint8_t         count,
+                                          uint32_t        dwell);
+
+/**
+ * @brief Stops listening on multiple channels and returns to the channel set in the PIB.
+ */
+void nrf_802154_multichannel_listen_stop(void);
+
+/**
+ * @brief Gets the channel the driver currently listens on.
+ *
+ * When called from @ref nrf_802154_received_raw or @ref nrf_802154_received, this function
+ * returns the channel on which the frame was received.
+ *
+ * @returns  Channel number (11-26).
+ */
+uint8_t nrf_802154_multichannel_listen_channel_get(void);
+
+/**
+ * @brief Gets the statistics of the multi-channel listen.
+ *
+ * @param[out]  p_stats  Pointer to the structure to be filled.
+ */
+void nrf_802154_multichannel_listen_stats_get(nrf_802154_channel_hop_stats_t * p_stats);
+
+#endif // NRF_802154_CHANNEL_HOP_ENABLED
+
+/**
+ * @}
+ * @defgroup nrf_802154_wake_on_radio Wake-on-radio listen
+ * @{
+ */
+#if NRF_802154_WOR_ENABLED
+
+/**
+ * @brief Starts the wake-on-radio listen.
+ *
+ * The driver puts the radio to sleep and wakes it every @p interval microseconds to detect
+ * energy on the channel for @p sample_time microseconds. When the detected energy reaches
+ * @p ed_threshold, the radio stays in the receive state for @p hold_time microseconds, or longer
+ * if the reception of a frame starts within that time. Received frames are notified as in
+ * the receive state. Otherwise, the radio goes back to sleep and the high-frequency clock is
+ * released.
+ *
+ * @note The samples are not passed to @ref nrf_802154_energy_detected.
+ * @note While the listen is active, the radio is put to sleep after every operation requested by
+ *       the higher layer, once the next sample is taken.
+ * @note @p interval must be longer than the startup time of the high-frequency clock.
+ *
+ * @param[in]  interval      Time between the starts of two samples, in microseconds (us).
+ * @param[in]  sample_time   Duration of the energy detection sample, in microseconds (us).
+ * @param[in]  hold_time     Time the radio is held in the receive state, in microseconds (us).
+ * @param[in]  ed_threshold  Energy level that wakes the radio, in the units of
+ *                           @ref nrf_802154_energy_detected.
+ *
+ * @retval  true   The wake-on-radio listen has started.
+ * @retval  false  The listen is already active or @p interval is not longer than @p sample_time.
+ */
+bool nrf_802154_wake_on_radio_start(uint32_t interval,
+                                    uint32_t sample_time,
+                                    uint32_t hold_time,
+                                    uint8_t  ed_threshold);
+
+/**
+ * @brief Stops the wake-on-radio listen.
+ *
+ * The radio is left in its current state.
+ */
+void nrf_802154_wake_on_radio_stop(void);
+
+/**
+ * @brief Gets the statistics of the wake-on-radio listen.
+ *
+ * @param[out]  p_stats  Pointer to the structure to be filled.
+ */
+void nrf_802154_wake_on_radio_stats_get(nrf_802154_wor_stats_t * p_stats);
+
+#endif // NRF_802154_WOR_ENABLED
+
 /** @} */
 
 #ifdef __cplusplus
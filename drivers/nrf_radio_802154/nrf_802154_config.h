@@ -134,6 +134,22 @@ extern "C" {
 #define NRF_802154_SWI_PRIORITY 5
 #endif
 
+/**
+ * @def NRF_802154_CRITICAL_SECTION_BASEPRI_ENABLED
+ *
+ * If the critical sections of the driver mask interrupts with the BASEPRI register instead of
+ * disabling the RADIO and RTC interrupts in NVIC. BASEPRI masks all interrupts whose priority is
+ * not higher than @ref NRF_802154_IRQ_PRIORITY. Priority 0 cannot be masked, so
+ * @ref NRF_802154_IRQ_PRIORITY must be greater than 0, and the other interrupts used by the driver
+ * must not have a higher priority (lower number) than the RADIO interrupt.
+ *
+ * This option is ignored on cores without the BASEPRI register, like Cortex-M0.
+ *
+ */
+#ifndef NRF_802154_CRITICAL_SECTION_BASEPRI_ENABLED
+#define NRF_802154_CRITICAL_SECTION_BASEPRI_ENABLED 0
+#endif
+
 /**
  * @def NRF_802154_USE_RAW_API
  *
@@ -141,7 +157,8 @@ extern "C" {
  * the RAW API because it provides more optimized functions.
  *
  * @note If the RAW API is not available for the MAC layer, only less optimized functions performing
- *       copy are available.
+ *       copy are available, unless transmit buffers are lent to the MAC layer. See
+ *       @ref NRF_802154_TX_BUFFERS.
  *
  */
 #ifndef NRF_802154_USE_RAW_API
@@ -178,6 +195,64 @@ extern "C" {
 #define NRF_802154_RX_BUFFERS 16
 #endif
 
+/**
+ * @def NRF_802154_RX_SHORT_BUFFERS
+ *
+ * The number of short buffers in the receive queue.
+ *
+ * Frames are always received to full-size buffers. A received frame that fits in a short buffer
+ * is copied to it before it is passed to the higher layer, so that the full-size buffer can be
+ * used to receive the next frame. This way, short frames such as ACKs, data requests and most
+ * MAC commands can be queued at a fraction of the RAM, and fewer full-size buffers are needed.
+ * Setting this value to 0 disables the short buffers.
+ *
+ */
+#ifndef NRF_802154_RX_SHORT_BUFFERS
+#define NRF_802154_RX_SHORT_BUFFERS 0
+#endif
+
+/**
+ * @def NRF_802154_RX_SHORT_BUFFER_SIZE
+ *
+ * The size of a short receive buffer, including the PHR.
+ *
+ */
+#ifndef NRF_802154_RX_SHORT_BUFFER_SIZE
+#define NRF_802154_RX_SHORT_BUFFER_SIZE 32
+#endif
+
+/**
+ * @def NRF_802154_RX_IE_INDEX_CACHE_ENABLED
+ *
+ * If the Header IEs commonly used by the higher layers are indexed once per received frame.
+ *
+ * The index is built when it is requested for the first time, and stored along with the frame in
+ * its receive buffer, so that the next requests do not parse the frame again. This adds 11 bytes
+ * to each full-size and short receive buffer.
+ *
+ * The driver itself does not request the index, so the cache only pays off when the higher layer
+ * calls @ref nrf_802154_rx_buffer_ie_index_get more than once per frame. It is disabled
+ * by default.
+ *
+ */
+#ifndef NRF_802154_RX_IE_INDEX_CACHE_ENABLED
+#define NRF_802154_RX_IE_INDEX_CACHE_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_TX_BUFFERS
+ *
+ * The number of transmit buffers that can be lent to the MAC layer when the RAW API is disabled.
+ *
+ * A frame prepared in place in a lent buffer is transmitted without being copied to the driver's
+ * static transmit buffer, and each buffer can hold a different frame. Setting this value to 0
+ * disables the lending.
+ *
+ */
+#ifndef NRF_802154_TX_BUFFERS
+#define NRF_802154_TX_BUFFERS 0
+#endif
+
 /**
  * @def NRF_802154_DISABLE_BCC_MATCHING
  *
@@ -214,6 +289,42 @@ extern "C" {
 #define NRF_802154_FRAME_TIMESTAMP_ENABLED 1
 #endif
 
+/**
+ * @def NRF_802154_PROCEDURES_DURATION_CALIBRATION_ENABLED
+ *
+ * If the driver measures the RADIO ramp-up, ramp-down and RX-to-TX turnaround times, and uses
+ * the measured values instead of the default ones to size timeslot requests.
+ *
+ * The measurement is performed in a dedicated timeslot requested when the driver is initialized.
+ * If the radio is not sleeping when the timeslot starts, the measurement is postponed.
+ *
+ */
+#ifndef NRF_802154_PROCEDURES_DURATION_CALIBRATION_ENABLED
+#define NRF_802154_PROCEDURES_DURATION_CALIBRATION_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_PROCEDURES_DURATION_CALIBRATION_MARGIN
+ *
+ * The time in microseconds (us) added to each measured duration to cover the resolution of
+ * the measurement.
+ *
+ */
+#ifndef NRF_802154_PROCEDURES_DURATION_CALIBRATION_MARGIN
+#define NRF_802154_PROCEDURES_DURATION_CALIBRATION_MARGIN 1
+#endif
+
+/**
+ * @def NRF_802154_PROCEDURES_DURATION_CALIBRATION_SAMPLES
+ *
+ * The number of times each RADIO state transition is measured. The ramp-up and turnaround times
+ * are averaged, and the longest ramp-down time is used.
+ *
+ */
+#ifndef NRF_802154_PROCEDURES_DURATION_CALIBRATION_SAMPLES
+#define NRF_802154_PROCEDURES_DURATION_CALIBRATION_SAMPLES 8
+#endif
+
 /**
  * @def NRF_802154_DELAYED_TRX_ENABLED
  *
@@ -275,6 +386,20 @@ extern "C" {
 #define NRF_802154_RTC_IRQ_PRIORITY 6
 #endif
 
+/**
+ * @def NRF_802154_RTC_IRQ_DIRECT
+ *
+ * If the RTC interrupt handler is connected directly to the interrupt vector, instead of through
+ * the software ISR table of the operating system.
+ *
+ * @note This configuration is only applicable for the Low Power Timer Abstraction Layer
+ *       implementation in nrf_802154_lp_timer_zephyr.c.
+ *
+ */
+#ifndef NRF_802154_RTC_IRQ_DIRECT
+#define NRF_802154_RTC_IRQ_DIRECT 0
+#endif
+
 /**
  * @}
  * @defgroup nrf_802154_config_csma CSMA/CA procedure configuration
@@ -388,6 +513,118 @@ extern "C" {
 #define NRF_802154_MAX_ACK_IE_SIZE 8
 #endif
 
+/**
+ * @}
+ * @defgroup nrf_802154_config_indirect_tx Indirect transmission feature configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_INDIRECT_TX_ENABLED
+ *
+ * If the indirect transmission queue is available. Frames for sleepy devices can then be queued
+ * in the driver, which sets the pending bit in ACK frames for them and transmits a queued frame
+ * right after acknowledging a data request from its destination.
+ *
+ */
+#ifndef NRF_802154_INDIRECT_TX_ENABLED
+#define NRF_802154_INDIRECT_TX_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_INDIRECT_TX_QUEUE_SIZE
+ *
+ * The number of frames that can be held in the indirect transmission queue.
+ *
+ */
+#ifndef NRF_802154_INDIRECT_TX_QUEUE_SIZE
+#define NRF_802154_INDIRECT_TX_QUEUE_SIZE 8
+#endif
+
+/**
+ * @}
+ * @defgroup nrf_802154_config_channel_hop Multi-channel listen feature configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_CHANNEL_HOP_ENABLED
+ *
+ * If the multi-channel listen is available. In the receive state, the driver can then cycle
+ * through a list of channels, and lock onto a channel while a frame is being received on it.
+ *
+ */
+#ifndef NRF_802154_CHANNEL_HOP_ENABLED
+#define NRF_802154_CHANNEL_HOP_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_CHANNEL_HOP_MAX_CHANNELS
+ *
+ * The maximum number of channels in the multi-channel listen sequence.
+ *
+ */
+#ifndef NRF_802154_CHANNEL_HOP_MAX_CHANNELS
+#define NRF_802154_CHANNEL_HOP_MAX_CHANNELS 16
+#endif
+
+/**
+ * @}
+ * @defgroup nrf_802154_config_wor Wake-on-radio feature configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_WOR_ENABLED
+ *
+ * If the wake-on-radio listen is available. The driver can then sample the channel energy
+ * periodically instead of listening continuously, and keep the radio asleep between the samples.
+ *
+ */
+#ifndef NRF_802154_WOR_ENABLED
+#define NRF_802154_WOR_ENABLED 0
+#endif
+
+/**
+ * @}
+ * @defgroup nrf_802154_config_dup_filter Duplicate frame rejection feature configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_DUP_FILTER_ENABLED
+ *
+ * If the driver rejects retransmitted frames. A frame with the same source address, sequence number
+ * and frame type as the most recent frame from its source is acknowledged, but it is not passed to
+ * the MAC layer. A short source address is only compared within the same source PAN.
+ *
+ */
+#ifndef NRF_802154_DUP_FILTER_ENABLED
+#define NRF_802154_DUP_FILTER_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_DUP_FILTER_SIZE
+ *
+ * The number of entries in the table of recently received frames. It must be a power of two.
+ * Each entry occupies 16 bytes.
+ *
+ */
+#ifndef NRF_802154_DUP_FILTER_SIZE
+#define NRF_802154_DUP_FILTER_SIZE 16
+#endif
+
+/**
+ * @def NRF_802154_DUP_FILTER_LIFETIME
+ *
+ * The time in microseconds (us) after which a received frame is no longer considered when
+ * rejecting duplicates. It must cover all retransmissions of a frame.
+ *
+ */
+#ifndef NRF_802154_DUP_FILTER_LIFETIME
+#define NRF_802154_DUP_FILTER_LIFETIME 500000UL
+#endif
+
 /**
  * @}
  * @defgroup nrf_802154_config_transmission Transmission start notification feature configuration
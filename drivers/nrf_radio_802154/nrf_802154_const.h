@@ -78,9 +78,20 @@
 #define FRAME_VERSION_2              0x20                                         ///< Bits containing the frame version 0b10.
 #define FRAME_VERSION_3              0x30                                         ///< Bits containing the frame version 0b11.
 
-#define IE_HEADER_LENGTH_MASK        0x3f                                         ///< Mask of bits containing the length of an IE header content.
+#define IE_CSL_ID                    0x1a                                         ///< Element ID of the CSL IE.
+#define IE_HEADER_ELEMENT_ID_MASK    0x7f80                                       ///< Mask of bits containing the Element ID in the Header IE descriptor.
+#define IE_HEADER_ELEMENT_ID_SHIFT   7                                            ///< Position of the Element ID in the Header IE descriptor.
+#define IE_HEADER_LENGTH_MASK        0x7f                                         ///< Mask of bits containing the length of an IE header content.
+#define IE_HT1_ID                    0x7e                                         ///< Element ID of the Header Termination 1 IE, followed by Payload IEs.
+#define IE_HT2_ID                    0x7f                                         ///< Element ID of the Header Termination 2 IE, followed by the payload.
 #define IE_PRESENT_OFFSET            2                                            ///< Byte containing the IE Present bit.
 #define IE_PRESENT_BIT               0x02                                         ///< Bits containing the IE Present field.
+#define IE_RENDEZVOUS_TIME_ID        0x1d                                         ///< Element ID of the Rendezvous Time IE.
+#define IE_TIME_CORRECTION_ID        0x1e                                         ///< Element ID of the Time Correction IE.
+#define IE_TYPE_BIT                  0x8000                                       ///< Bit of the IE descriptor that is set in Payload IEs.
+#define IE_VENDOR_ID                 0x00                                         ///< Element ID of the Vendor Specific IE.
+#define IE_VENDOR_THREAD_OUI         0xeab89b                                     ///< OUI of the Thread Vendor Specific IEs.
+#define IE_VENDOR_THREAD_PROBING_ID  0x00                                         ///< Subtype of the Thread Enhanced-ACK Probing IE, carrying Link Metrics.
 
 #define KEY_ID_MODE_MASK             0x18                                         ///< Mask of bits containing Key Identifier Mode in the Security Control field.
 #define KEY_ID_MODE_0                0                                            ///< Bits containing the 0x00 Key Identifier Mode.
@@ -128,7 +139,9 @@
 #define FCF_SIZE                     2                                            ///< Size of the FCF field.
 #define FCS_SIZE                     2                                            ///< Size of the FCS field.
 #define FRAME_COUNTER_SIZE           4                                            ///< Size of the Frame Counter field.
+#define IE_DESCRIPTOR_SIZE           2                                            ///< Size of the descriptor of an IE.
 #define IE_HEADER_SIZE               4                                            ///< Size of the obligatory IE Header field elements, including the header termination.
+#define IE_VENDOR_OUI_SIZE           3                                            ///< Size of the OUI field of the Vendor Specific IE.
 #define IMM_ACK_LENGTH               5                                            ///< Length of the ACK frame.
 #define KEY_ID_MODE_1_SIZE           1                                            ///< Size of the 0x01 Key Identifier Mode field.
 #define KEY_ID_MODE_2_SIZE           5                                            ///< Size of the 0x10 Key Identifier Mode field.
@@ -172,6 +185,9 @@ typedef enum
 #if NRF_802154_DELAYED_TRX_ENABLED
     REQ_ORIG_DELAYED_TRX,
 #endif // NRF_802154_DELAYED_TRX_ENABLED
+#if NRF_802154_INDIRECT_TX_ENABLED
+    REQ_ORIG_INDIRECT_TX,
+#endif // NRF_802154_INDIRECT_TX_ENABLED
 } req_originator_t;
 
 #endif // NRD_DRV_RADIO802154_CONST_H_
@@ -62,13 +62,18 @@
 #include "hal/nrf_radio.h"
 #include "hal/nrf_timer.h"
 #include "fem/nrf_fem_protocol_api.h"
+#include "mac_features/nrf_802154_channel_hop.h"
 #include "mac_features/nrf_802154_delayed_trx.h"
+#include "mac_features/nrf_802154_dup_filter.h"
 #include "mac_features/nrf_802154_filter.h"
 #include "mac_features/nrf_802154_frame_parser.h"
+#include "mac_features/nrf_802154_indirect_tx.h"
+#include "mac_features/nrf_802154_wor.h"
 #include "mac_features/ack_generator/nrf_802154_ack_data.h"
 #include "mac_features/ack_generator/nrf_802154_ack_generator.h"
 #include "rsch/nrf_802154_rsch.h"
 #include "rsch/nrf_802154_rsch_crit_sect.h"
+#include "timer_scheduler/nrf_802154_timer_sched.h"
 
 #include "nrf_802154_core_hooks.h"
 
@@ -165,13 +170,29 @@ static rx_buffer_t * const mp_current_rx_buffer = &nrf_802154_rx_buffers[0];
 
 #endif
 
-static const uint8_t * mp_ack;         ///< Pointer to Ack frame buffer.
-static const uint8_t * mp_tx_data;     ///< Pointer to the data to transmit.
-static uint32_t        m_ed_time_left; ///< Remaining time of the current energy detection procedure [us].
-static uint8_t         m_ed_result;    ///< Result of the current energy detection procedure.
+static const uint8_t *       mp_ack;         ///< Pointer to Ack frame buffer.
+static const uint8_t *       mp_tx_data;     ///< Pointer to the data to transmit.
+static nrf_802154_tx_power_t m_tx_power;     ///< Transmit power of the frame to transmit.
+static uint32_t              m_ed_time_left; ///< Remaining time of the current energy detection procedure [us].
+static uint8_t               m_ed_result;    ///< Result of the current energy detection procedure.
 
 static volatile radio_state_t m_state; ///< State of the radio driver.
 
+#if NRF_802154_PROCEDURES_DURATION_CALIBRATION_ENABLED
+/// Duration model used to size timeslot requests. Measured in a dedicated timeslot.
+nrf_802154_procedures_duration_model_t nrf_802154_procedures_duration_model =
+{
+    .tx_ramp_up       = TX_RAMP_UP_TIME,
+    .rx_ramp_up       = RX_RAMP_UP_TIME,
+    .rx_ramp_down     = RX_RAMP_DOWN_TIME,
+    .max_ramp_down    = MAX_RAMP_DOWN_TIME,
+    .rx_tx_turnaround = RX_TX_TURNAROUND_TIME,
+};
+
+static nrf_802154_timer_t m_calibration_retry_timer; ///< Timer used to retry a postponed calibration.
+
+#endif // NRF_802154_PROCEDURES_DURATION_CALIBRATION_ENABLED
+
 /// Common parameters for the FAL handling.
 static const nrf_802154_fal_event_t m_deactivate_on_disable =
 {
@@ -226,6 +247,10 @@ typedef struct
     bool tx_started   : 1; ///< If the requested transmission has started.
 
 #endif  // NRF_802154_TX_STARTED_NOTIFY_ENABLED
+#if NRF_802154_DUP_FILTER_ENABLED
+    bool frame_duplicate : 1; ///< If frame being received is a duplicate of a recently received one.
+
+#endif  // NRF_802154_DUP_FILTER_ENABLED
     bool rssi_started : 1;
 } nrf_802154_flags_t;
 static nrf_802154_flags_t m_flags;               ///< Flags used to store the current driver state.
@@ -255,6 +280,12 @@ static void rx_flags_clear(void)
 #if !NRF_802154_DISABLE_BCC_MATCHING
     m_flags.psdu_being_received = false;
 #endif // !NRF_802154_DISABLE_BCC_MATCHING
+#if NRF_802154_DUP_FILTER_ENABLED
+    m_flags.frame_duplicate = false;
+#endif // NRF_802154_DUP_FILTER_ENABLED
+#if NRF_802154_CHANNEL_HOP_ENABLED
+    nrf_802154_channel_hop_frame_ended();
+#endif // NRF_802154_CHANNEL_HOP_ENABLED
 }
 
 /** Request the RSSI measurement. */
@@ -398,7 +429,12 @@ static void energy_detected_notify(uint8_t result)
 {
     nrf_802154_critical_section_nesting_allow();
 
-    nrf_802154_notify_energy_detected(result);
+#if NRF_802154_WOR_ENABLED
+    if (!nrf_802154_wor_energy_detected_hook(result))
+#endif // NRF_802154_WOR_ENABLED
+    {
+        nrf_802154_notify_energy_detected(result);
+    }
 
     nrf_802154_critical_section_nesting_deny();
 }
@@ -505,6 +541,28 @@ static uint8_t * rx_buffer_get(void)
     return rx_buffer_is_available() ? mp_current_rx_buffer->data : NULL;
 }
 
+/** Take the frame received to the currently used rx buffer.
+ *
+ * @returns Pointer to the received frame that should be passed to the higher layer.
+ */
+static uint8_t * rx_buffer_frame_take(void)
+{
+    return nrf_802154_rx_buffer_frame_take(mp_current_rx_buffer);
+}
+
+/** Check if the frame received to the currently used rx buffer is a duplicate.
+ *
+ * A duplicate is acknowledged, but it stays in the rx buffer and is not passed to the higher layer.
+ */
+static bool rx_frame_is_duplicate(void)
+{
+#if NRF_802154_DUP_FILTER_ENABLED
+    return m_flags.frame_duplicate;
+#else // NRF_802154_DUP_FILTER_ENABLED
+    return false;
+#endif // NRF_802154_DUP_FILTER_ENABLED
+}
+
 /***************************************************************************************************
  * @section Radio parameters calculators
  **************************************************************************************************/
@@ -520,6 +578,38 @@ static void channel_set(uint8_t channel)
     nrf_radio_frequency_set(NRF_RADIO, 2405 + 5 * (channel - 11));
 }
 
+/** Get the channel the radio is to operate on.
+ *
+ * @returns Current channel of the multi-channel listen if it is active, or the channel set
+ *          in the PIB otherwise.
+ */
+static uint8_t channel_get(void)
+{
+#if NRF_802154_CHANNEL_HOP_ENABLED
+    if (nrf_802154_channel_hop_is_active())
+    {
+        return nrf_802154_channel_hop_channel_get();
+    }
+#endif // NRF_802154_CHANNEL_HOP_ENABLED
+
+    return nrf_802154_pib_channel_get();
+}
+
+/** Get the RADIO TX power setting for the frame to transmit.
+ *
+ * @returns Setting for the power requested with the frame, or the setting precalculated for
+ *          the power stored in the PIB.
+ */
+static nrf_radio_txpower_t tx_power_get(void)
+{
+    if (m_tx_power.use_pib)
+    {
+        return nrf_802154_pib_tx_power_get(channel_get());
+    }
+
+    return nrf_802154_pib_tx_power_convert(channel_get(), m_tx_power.dbm);
+}
+
 /***************************************************************************************************
  * @section ACK transmission management
  **************************************************************************************************/
@@ -599,7 +689,7 @@ static void nrf_radio_init(void)
     nrf_radio_mhmu_pattern_mask_set(NRF_RADIO, MHMU_MASK);
 
     // Set channel
-    channel_set(nrf_802154_pib_channel_get());
+    channel_set(channel_get());
 }
 
 /** Reset radio peripheral. */
@@ -1391,10 +1481,9 @@ static bool current_operation_terminate(nrf_802154_term_t term_lvl,
                 {
                     tx_ack_terminate();
 
-                    if (notify)
+                    if (notify && !rx_frame_is_duplicate())
                     {
-                        mp_current_rx_buffer->free = false;
-                        received_frame_notify(mp_current_rx_buffer->data);
+                        received_frame_notify(rx_buffer_frame_take());
                     }
                 }
                 else
@@ -1529,7 +1618,7 @@ static void rx_init(bool disabled_was_triggered)
     // Clear the RSSI measurement flag.
     m_flags.rssi_started = false;
 
-    nrf_radio_txpower_set(NRF_RADIO, nrf_802154_pib_tx_power_get());
+    nrf_radio_txpower_set(NRF_RADIO, nrf_802154_pib_tx_power_get(channel_get()));
 
     // Find available RX buffer
     free_buffer = rx_buffer_is_available();
@@ -1725,7 +1814,7 @@ static bool tx_init(const uint8_t * p_data, bool cca, bool disabled_was_triggere
         return false;
     }
 
-    nrf_radio_txpower_set(NRF_RADIO, nrf_802154_pib_tx_power_get());
+    nrf_radio_txpower_set(NRF_RADIO, tx_power_get());
     nrf_radio_packetptr_set(NRF_RADIO, p_data);
 
     // Set shorts
@@ -1837,7 +1926,7 @@ static void continuous_carrier_init(bool disabled_was_triggered)
     }
 
     // Set Tx Power
-    nrf_radio_txpower_set(NRF_RADIO, nrf_802154_pib_tx_power_get());
+    nrf_radio_txpower_set(NRF_RADIO, nrf_802154_pib_tx_power_get(channel_get()));
 
     // Set FEM
     fem_for_pa_set();
@@ -1854,6 +1943,170 @@ static void continuous_carrier_init(bool disabled_was_triggered)
     }
 }
 
+#if NRF_802154_PROCEDURES_DURATION_CALIBRATION_ENABLED
+
+/***************************************************************************************************
+ * @section Procedure duration calibration
+ **************************************************************************************************/
+
+#define CALIBRATION_DELAY           10000   ///< Time from the initialization to the calibration timeslot [us].
+#define CALIBRATION_RETRY_DELAY     1000000 ///< Time after which a calibration postponed by a radio operation is retried [us].
+#define CALIBRATION_TIMESLOT_LENGTH (NRF_802154_PROCEDURES_DURATION_CALIBRATION_SAMPLES * \
+                                     (TX_RAMP_UP_TIME + 2 * RX_RAMP_UP_TIME +              \
+                                      RX_TX_TURNAROUND_TIME + 3 * MAX_RAMP_DOWN_TIME +     \
+                                      MAX_CRIT_SECT_TIME)) ///< Length of the calibration timeslot [us].
+
+/// Average of the measured durations, rounded up, with the margin for the measurement resolution.
+#define CALIBRATED_DURATION(sum)                                                            \
+    ((uint16_t)(NRF_802154_DIVIDE_AND_CEIL((sum),                                           \
+                                           NRF_802154_PROCEDURES_DURATION_CALIBRATION_SAMPLES) \
+                + NRF_802154_PROCEDURES_DURATION_CALIBRATION_MARGIN))
+
+/** Measure the time from triggering a RADIO task to the given RADIO event.
+ *
+ * The TIMER is started by the same PPI that triggers the task, and the event captures the TIMER
+ * through another PPI, so the measurement does not depend on the CPU latency.
+ *
+ * @param[in]  task   RADIO task that starts the transition.
+ * @param[in]  event  RADIO event that ends the transition.
+ *
+ * @returns Duration of the transition [us].
+ */
+static uint16_t radio_transition_measure(nrf_radio_task_t task, nrf_radio_event_t event)
+{
+    uint16_t duration;
+
+    // Anomaly 78: use SHUTDOWN instead of STOP and CLEAR.
+    nrf_timer_task_trigger(NRF_802154_TIMER_INSTANCE, NRF_TIMER_TASK_SHUTDOWN);
+    nrf_radio_event_clear(NRF_RADIO, event);
+    nrf_egu_event_clear(NRF_802154_SWI_EGU_INSTANCE, EGU_EVENT);
+
+    nrf_ppi_channel_and_fork_endpoint_setup(NRF_PPI,
+                                            PPI_EGU_RAMP_UP,
+                                            (uint32_t)nrf_egu_event_address_get(
+                                                NRF_802154_SWI_EGU_INSTANCE,
+                                                EGU_EVENT),
+                                            (uint32_t)nrf_radio_task_address_get(NRF_RADIO, task),
+                                            (uint32_t)nrf_timer_task_address_get(
+                                                NRF_802154_TIMER_INSTANCE,
+                                                NRF_TIMER_TASK_START));
+    nrf_ppi_channel_endpoint_setup(NRF_PPI,
+                                   PPI_TIMER_TX_ACK,
+                                   (uint32_t)nrf_radio_event_address_get(NRF_RADIO, event),
+                                   (uint32_t)nrf_timer_task_address_get(
+                                       NRF_802154_TIMER_INSTANCE,
+                                       NRF_TIMER_TASK_CAPTURE3));
+    nrf_ppi_channel_enable(NRF_PPI, PPI_EGU_RAMP_UP);
+    nrf_ppi_channel_enable(NRF_PPI, PPI_TIMER_TX_ACK);
+
+    nrf_egu_task_trigger(NRF_802154_SWI_EGU_INSTANCE, EGU_TASK);
+
+    while (!nrf_radio_event_check(NRF_RADIO, event))
+    {
+        // Intentionally empty: the transition takes tens of microseconds.
+    }
+
+    nrf_ppi_channel_disable(NRF_PPI, PPI_EGU_RAMP_UP);
+    nrf_ppi_channel_disable(NRF_PPI, PPI_TIMER_TX_ACK);
+    nrf_ppi_channel_and_fork_endpoint_setup(NRF_PPI, PPI_EGU_RAMP_UP, 0, 0, 0);
+    nrf_ppi_channel_endpoint_setup(NRF_PPI, PPI_TIMER_TX_ACK, 0, 0);
+
+    duration = (uint16_t)nrf_timer_cc_get(NRF_802154_TIMER_INSTANCE, NRF_TIMER_CC_CHANNEL3);
+
+    nrf_timer_task_trigger(NRF_802154_TIMER_INSTANCE, NRF_TIMER_TASK_SHUTDOWN);
+    nrf_radio_event_clear(NRF_RADIO, event);
+    nrf_egu_event_clear(NRF_802154_SWI_EGU_INSTANCE, EGU_EVENT);
+
+    return duration;
+}
+
+/** Measure the RADIO state transitions and store them in the procedure duration model.
+ *
+ * Each transition is measured @ref NRF_802154_PROCEDURES_DURATION_CALIBRATION_SAMPLES times.
+ * The ramp-up and turnaround times are averaged, and the maximum ramp-down time is the longest
+ * of all measured ramp-downs.
+ *
+ * The RADIO must be disabled. It is disabled again when this function returns.
+ */
+static void procedures_duration_calibrate(void)
+{
+    nrf_802154_procedures_duration_model_t model;
+    uint32_t                               tx_ramp_up       = 0;
+    uint32_t                               rx_ramp_up       = 0;
+    uint32_t                               rx_ramp_down     = 0;
+    uint32_t                               rx_tx_turnaround = 0;
+    uint16_t                               max_ramp_down    = 0;
+    uint16_t                               ramp_down[3];
+
+    assert(nrf_radio_state_get(NRF_RADIO) == NRF_RADIO_STATE_DISABLED);
+
+    nrf_timer_shorts_disable(NRF_802154_TIMER_INSTANCE,
+                             NRF_TIMER_SHORT_COMPARE0_STOP_MASK |
+                             NRF_TIMER_SHORT_COMPARE1_STOP_MASK);
+
+    for (uint32_t i = 0; i < NRF_802154_PROCEDURES_DURATION_CALIBRATION_SAMPLES; i++)
+    {
+        tx_ramp_up  += radio_transition_measure(NRF_RADIO_TASK_TXEN, NRF_RADIO_EVENT_READY);
+        ramp_down[0] = radio_transition_measure(NRF_RADIO_TASK_DISABLE, NRF_RADIO_EVENT_DISABLED);
+
+        rx_ramp_up  += radio_transition_measure(NRF_RADIO_TASK_RXEN, NRF_RADIO_EVENT_READY);
+        ramp_down[1] = radio_transition_measure(NRF_RADIO_TASK_DISABLE, NRF_RADIO_EVENT_DISABLED);
+
+        (void)radio_transition_measure(NRF_RADIO_TASK_RXEN, NRF_RADIO_EVENT_READY);
+        rx_tx_turnaround += radio_transition_measure(NRF_RADIO_TASK_TXEN, NRF_RADIO_EVENT_READY);
+        ramp_down[2]      = radio_transition_measure(NRF_RADIO_TASK_DISABLE,
+                                                     NRF_RADIO_EVENT_DISABLED);
+
+        rx_ramp_down += ramp_down[1];
+
+        for (uint32_t j = 0; j < sizeof(ramp_down) / sizeof(ramp_down[0]); j++)
+        {
+            if (ramp_down[j] > max_ramp_down)
+            {
+                max_ramp_down = ramp_down[j];
+            }
+        }
+    }
+
+    model.tx_ramp_up       = CALIBRATED_DURATION(tx_ramp_up);
+    model.rx_ramp_up       = CALIBRATED_DURATION(rx_ramp_up);
+    model.rx_ramp_down     = CALIBRATED_DURATION(rx_ramp_down);
+    model.rx_tx_turnaround = CALIBRATED_DURATION(rx_tx_turnaround);
+    model.max_ramp_down    = max_ramp_down + NRF_802154_PROCEDURES_DURATION_CALIBRATION_MARGIN;
+
+    nrf_802154_procedures_duration_model = model;
+}
+
+/** Request the timeslot in which the RADIO state transitions are measured.
+ *
+ * @param[in]  dt  Time from now to the start of the timeslot [us].
+ */
+static void calibration_timeslot_request(uint32_t dt)
+{
+    bool result;
+
+    result = nrf_802154_rsch_delayed_timeslot_request(nrf_802154_timer_sched_time_get(),
+                                                      dt,
+                                                      CALIBRATION_TIMESLOT_LENGTH,
+                                                      RSCH_PRIO_IDLE_LISTENING,
+                                                      RSCH_DLY_CALIBRATION);
+    assert(result);
+    (void)result;
+}
+
+/** Timer callback used to retry the calibration postponed by a radio operation.
+ *
+ * @param[in]  p_context  Not used.
+ */
+static void calibration_retry(void * p_context)
+{
+    (void)p_context;
+
+    calibration_timeslot_request(CALIBRATION_DELAY);
+}
+
+#endif // NRF_802154_PROCEDURES_DURATION_CALIBRATION_ENABLED
+
 /***************************************************************************************************
  * @section Radio Scheduler notification handlers
  **************************************************************************************************/
@@ -1957,8 +2210,12 @@ static void cont_prec_denied(void)
 
             case RADIO_STATE_TX_ACK:
                 state_set(RADIO_STATE_RX);
-                mp_current_rx_buffer->free = false;
-                received_frame_notify_and_nesting_allow(mp_current_rx_buffer->data);
+
+                if (!rx_frame_is_duplicate())
+                {
+                    received_frame_notify_and_nesting_allow(rx_buffer_frame_take());
+                }
+
                 break;
 
             case RADIO_STATE_CCA_TX:
@@ -2047,6 +2304,11 @@ static void irq_bcmatch_state_rx(void)
         filter_result               = nrf_802154_filter_frame_part(mp_current_rx_buffer->data,
                                                                    &num_data_bytes);
 
+#if NRF_802154_CHANNEL_HOP_ENABLED
+        // Stay on the current channel until the frame is handled.
+        nrf_802154_channel_hop_frame_started();
+#endif // NRF_802154_CHANNEL_HOP_ENABLED
+
         if (filter_result == NRF_802154_RX_ERROR_NONE)
         {
             if (num_data_bytes != prev_num_data_bytes)
@@ -2122,6 +2384,11 @@ static void irq_crcok_state_rx(void)
     m_flags.rssi_started = true;
 
 #if NRF_802154_DISABLE_BCC_MATCHING
+#if NRF_802154_CHANNEL_HOP_ENABLED
+    // Without BCMATCH handling, a frame is detected only when it is complete.
+    nrf_802154_channel_hop_frame_started();
+#endif // NRF_802154_CHANNEL_HOP_ENABLED
+
     uint8_t               num_data_bytes      = PHR_SIZE + FCF_SIZE;
     uint8_t               prev_num_data_bytes = 0;
     nrf_802154_rx_error_t filter_result;
@@ -2162,8 +2429,7 @@ static void irq_crcok_state_rx(void)
         if (((p_received_data[FRAME_TYPE_OFFSET] & FRAME_TYPE_MASK) != FRAME_TYPE_ACK) ||
             nrf_802154_pib_promiscuous_get())
         {
-            mp_current_rx_buffer->free = false;
-            received_frame_notify_and_nesting_allow(p_received_data);
+            received_frame_notify_and_nesting_allow(rx_buffer_frame_take());
         }
 
         return;
@@ -2263,6 +2529,11 @@ static void irq_crcok_state_rx(void)
                 }
             }
 
+#if NRF_802154_DUP_FILTER_ENABLED
+            // The ACK transmission is already set up, so the lookup does not delay it.
+            m_flags.frame_duplicate = nrf_802154_dup_filter_check(p_received_data);
+#endif // NRF_802154_DUP_FILTER_ENABLED
+
             if (wait_for_phyend)
             {
                 state_set(RADIO_STATE_TX_ACK);
@@ -2289,7 +2560,12 @@ static void irq_crcok_state_rx(void)
             }
             else
             {
-                mp_current_rx_buffer->free = false;
+                bool duplicate = rx_frame_is_duplicate();
+
+                if (!duplicate)
+                {
+                    p_received_data = rx_buffer_frame_take();
+                }
 
 #if !NRF_802154_DISABLE_BCC_MATCHING
                 nrf_ppi_channel_disable(NRF_PPI, PPI_TIMER_TX_ACK);
@@ -2301,7 +2577,10 @@ static void irq_crcok_state_rx(void)
                 rx_terminate();
                 rx_init(true);
 
-                received_frame_notify_and_nesting_allow(p_received_data);
+                if (!duplicate)
+                {
+                    received_frame_notify_and_nesting_allow(p_received_data);
+                }
             }
         }
         else
@@ -2313,7 +2592,7 @@ static void irq_crcok_state_rx(void)
                 nrf_802154_pib_promiscuous_get())
             {
                 // Find new RX buffer
-                mp_current_rx_buffer->free = false;
+                p_received_data = rx_buffer_frame_take();
                 rx_buffer_in_use_set(nrf_802154_rx_buffer_free_find());
 
                 if (rx_buffer_is_available())
@@ -2362,6 +2641,7 @@ static void irq_crcok_state_rx(void)
 static void irq_phyend_state_tx_ack(void)
 {
     uint8_t * p_received_data = mp_current_rx_buffer->data;
+    bool      duplicate       = rx_frame_is_duplicate();
     uint32_t  ints_to_enable  = 0;
     uint32_t  ints_to_disable = 0;
 
@@ -2452,8 +2732,16 @@ static void irq_phyend_state_tx_ack(void)
         nrf_radio_task_trigger(NRF_RADIO, NRF_RADIO_TASK_DISABLE);
     }
 
-    // Find new RX buffer
-    mp_current_rx_buffer->free = false;
+#if NRF_802154_INDIRECT_TX_ENABLED
+    nrf_802154_indirect_tx_ack_sent(p_received_data, mp_ack);
+#endif // NRF_802154_INDIRECT_TX_ENABLED
+
+    // Find new RX buffer. A duplicate frame is dropped and its buffer is reused.
+    if (!duplicate)
+    {
+        p_received_data = rx_buffer_frame_take();
+    }
+
     rx_buffer_in_use_set(nrf_802154_rx_buffer_free_find());
 
     if (rx_buffer_is_available())
@@ -2471,7 +2759,10 @@ static void irq_phyend_state_tx_ack(void)
 
     rx_flags_clear();
 
-    received_frame_notify_and_nesting_allow(p_received_data);
+    if (!duplicate)
+    {
+        received_frame_notify_and_nesting_allow(p_received_data);
+    }
 }
 
 static void irq_phyend_state_tx_frame(void)
@@ -2584,7 +2875,7 @@ static void irq_phyend_state_tx_frame(void)
 static void irq_end_state_rx_ack(void)
 {
     bool          ack_match    = ack_is_matched();
-    rx_buffer_t * p_ack_buffer = NULL;
+    uint8_t     * p_ack_frame  = NULL;
     uint8_t     * p_ack_data   = mp_current_rx_buffer->data;
 
     if (!ack_match &&
@@ -2617,8 +2908,7 @@ static void irq_end_state_rx_ack(void)
 
     if (ack_match)
     {
-        p_ack_buffer               = mp_current_rx_buffer;
-        mp_current_rx_buffer->free = false;
+        p_ack_frame = rx_buffer_frame_take();
     }
 
     rx_ack_terminate();
@@ -2627,9 +2917,9 @@ static void irq_end_state_rx_ack(void)
 
     if (ack_match)
     {
-        transmitted_frame_notify(p_ack_buffer->data,           // phr + psdu
+        transmitted_frame_notify(p_ack_frame,                  // phr + psdu
                                  rssi_last_measurement_get(),  // rssi
-                                 lqi_get(p_ack_buffer->data)); // lqi;
+                                 lqi_get(p_ack_frame));        // lqi;
     }
     else
     {
@@ -2693,7 +2983,7 @@ static void irq_edend_state_ed(void)
     else
     {
         // In case channel change was requested during energy detection procedure.
-        channel_set(nrf_802154_pib_channel_get());
+        channel_set(channel_get());
 
         ed_terminate();
         state_set(RADIO_STATE_RX);
@@ -3034,6 +3324,7 @@ bool nrf_802154_core_transmit(nrf_802154_term_t              term_lvl,
                               req_originator_t               req_orig,
                               const uint8_t                * p_data,
                               bool                           cca,
+                              nrf_802154_tx_power_t          tx_power,
                               bool                           immediate,
                               nrf_802154_notification_func_t notify_function)
 {
@@ -3049,6 +3340,7 @@ bool nrf_802154_core_transmit(nrf_802154_term_t              term_lvl,
             state_set(RADIO_STATE_RX);
 
             mp_tx_data = p_data;
+            m_tx_power = tx_power;
             result     = tx_init(p_data, cca, true);
 
             if (!immediate)
@@ -3144,14 +3436,13 @@ bool nrf_802154_core_continuous_carrier(nrf_802154_term_t term_lvl)
 
 bool nrf_802154_core_notify_buffer_free(uint8_t * p_data)
 {
-    rx_buffer_t * p_buffer     = (rx_buffer_t *)p_data;
     bool          in_crit_sect = critical_section_enter_and_verify_timeslot_length();
-
-    p_buffer->free = true;
+    rx_buffer_t * p_buffer     = nrf_802154_rx_buffer_release(p_data);
 
     if (in_crit_sect)
     {
-        if (timeslot_is_granted())
+        // A frame stored in a short buffer does not hold a buffer the receiver could use.
+        if ((p_buffer != NULL) && timeslot_is_granted())
         {
             switch (m_state)
             {
@@ -3205,7 +3496,7 @@ bool nrf_802154_core_channel_update(void)
     {
         if (timeslot_is_granted())
         {
-            channel_set(nrf_802154_pib_channel_get());
+            channel_set(channel_get());
         }
 
         switch (m_state)
@@ -3305,11 +3596,52 @@ bool nrf_802154_core_last_rssi_measurement_get(int8_t * p_rssi)
     return result;
 }
 
+#if NRF_802154_PROCEDURES_DURATION_CALIBRATION_ENABLED
+
+void nrf_802154_core_procedures_duration_calibration_request(void)
+{
+    calibration_timeslot_request(CALIBRATION_DELAY);
+}
+
+void nrf_802154_core_procedures_duration_calibration_timeslot_started(void)
+{
+    bool calibrated = false;
+
+    if (nrf_802154_critical_section_enter())
+    {
+        // Checking if a timeslot is granted is valid only in a critical section
+        if ((m_state == RADIO_STATE_SLEEP) && timeslot_is_granted())
+        {
+            procedures_duration_calibrate();
+            calibrated = true;
+        }
+
+        nrf_802154_critical_section_exit();
+    }
+
+    if (!calibrated)
+    {
+        // The timeslot cannot be requested again before this one ends.
+        m_calibration_retry_timer.t0        = nrf_802154_timer_sched_time_get();
+        m_calibration_retry_timer.dt        = CALIBRATION_RETRY_DELAY;
+        m_calibration_retry_timer.callback  = calibration_retry;
+        m_calibration_retry_timer.p_context = NULL;
+
+        nrf_802154_timer_sched_add(&m_calibration_retry_timer, false);
+    }
+}
+
+#endif // NRF_802154_PROCEDURES_DURATION_CALIBRATION_ENABLED
+
+nrf_802154_prof_region_define(m_prof_radio_irq);
+
 #if NRF_802154_INTERNAL_RADIO_IRQ_HANDLING
 void RADIO_IRQHandler(void)
 #else // NRF_802154_INTERNAL_RADIO_IRQ_HANDLING
 void nrf_802154_core_irq_handler(void)
 #endif  // NRF_802154_INTERNAL_RADIO_IRQ_HANDLING
 {
+    nrf_802154_prof_begin(m_prof_radio_irq);
     irq_handler();
+    nrf_802154_prof_end(m_prof_radio_irq);
 }
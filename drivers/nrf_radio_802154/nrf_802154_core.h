@@ -130,6 +130,7 @@ bool nrf_802154_core_receive(nrf_802154_term_t              term_lvl,
  * @param[in]  req_orig         Module that originates this request.
  * @param[in]  p_data           Pointer to a frame to transmit.
  * @param[in]  cca              If the driver is to perform CCA procedure before transmission.
+ * @param[in]  tx_power         Transmit power of the frame.
  * @param[in]  immediate        If true, the driver schedules transmission immediately or never.
  *                              If false, the transmission may be postponed until
  *                              the TX preconditions are met.
@@ -142,6 +143,7 @@ bool nrf_802154_core_transmit(nrf_802154_term_t              term_lvl,
                               req_originator_t               req_orig,
                               const uint8_t                * p_data,
                               bool                           cca,
+                              nrf_802154_tx_power_t          tx_power,
                               bool                           immediate,
                               nrf_802154_notification_func_t notify_function);
 
@@ -226,6 +228,24 @@ bool nrf_802154_core_rssi_measure(void);
  */
 bool nrf_802154_core_last_rssi_measurement_get(int8_t * p_rssi);
 
+#if NRF_802154_PROCEDURES_DURATION_CALIBRATION_ENABLED
+/**
+ * @brief Requests the timeslot in which the core module measures the RADIO state transitions.
+ *
+ * @note This function must be called after the Radio Scheduler and the Timer Scheduler are
+ *       initialized.
+ */
+void nrf_802154_core_procedures_duration_calibration_request(void);
+
+/**
+ * @brief Notifies the core module that the timeslot for the measurement of the RADIO state
+ * transitions has started.
+ *
+ * If the radio is not sleeping, the measurement is postponed and a new timeslot is requested.
+ */
+void nrf_802154_core_procedures_duration_calibration_timeslot_started(void);
+#endif // NRF_802154_PROCEDURES_DURATION_CALIBRATION_ENABLED
+
 #if !NRF_802154_INTERNAL_IRQ_HANDLING
 /**
  * @brief Notifies the core module that there is a pending IRQ to be handled.
@@ -44,6 +44,7 @@
 #include "mac_features/nrf_802154_ack_timeout.h"
 #include "mac_features/nrf_802154_csma_ca.h"
 #include "mac_features/nrf_802154_delayed_trx.h"
+#include "mac_features/nrf_802154_wor.h"
 #include "nrf_802154_config.h"
 #include "nrf_802154_types.h"
 
@@ -117,6 +118,10 @@ static const rx_started_hook m_rx_started_hooks[] =
     nrf_802154_delayed_trx_rx_started_hook,
 #endif
 
+#if NRF_802154_WOR_ENABLED
+    nrf_802154_wor_rx_started_hook,
+#endif
+
     NULL,
 };
 
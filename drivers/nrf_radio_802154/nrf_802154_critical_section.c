@@ -51,6 +51,24 @@
 
 #define NESTED_CRITICAL_SECTION_ALLOWED_PRIORITY_NONE (-1)
 
+#if NRF_802154_CRITICAL_SECTION_BASEPRI_ENABLED && \
+    (defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__))
+#define CRITICAL_SECTION_BASEPRI_USED 1
+#else
+#define CRITICAL_SECTION_BASEPRI_USED 0
+#endif
+
+#if CRITICAL_SECTION_BASEPRI_USED
+
+#if NRF_802154_IRQ_PRIORITY == 0
+#error "BASEPRI critical sections require NRF_802154_IRQ_PRIORITY greater than 0."
+#endif
+
+#define CRITICAL_SECTION_BASEPRI (NRF_802154_IRQ_PRIORITY << (8 - __NVIC_PRIO_BITS))
+
+static uint32_t m_critical_section_basepri;                         ///< BASEPRI value restored when the outermost critical section is exited
+#endif // CRITICAL_SECTION_BASEPRI_USED
+
 static volatile uint8_t m_critical_section_monitor;                 ///< Monitors each critical section enter operation
 static volatile uint8_t m_nested_critical_section_counter;          ///< Counter of nested critical sections
 static volatile int8_t  m_nested_critical_section_allowed_priority; ///< Indicator if nested critical sections are currently allowed
@@ -59,6 +77,32 @@ static volatile int8_t  m_nested_critical_section_allowed_priority; ///< Indicat
  * @section Critical sections management
  **************************************************************************************************/
 
+#if CRITICAL_SECTION_BASEPRI_USED
+
+/** @brief Mask the interrupts used by the driver.
+ *
+ * @note A single BASEPRI write masks the RADIO, RTC and SWI interrupts together. Only the
+ *       outermost critical section modifies BASEPRI.
+ *
+ * @param[in]  cnt  Nesting counter before the critical section was entered.
+ */
+static inline void irq_mask(uint8_t cnt)
+{
+    if (cnt == 0)
+    {
+        m_critical_section_basepri = __get_BASEPRI();
+        __set_BASEPRI_MAX(CRITICAL_SECTION_BASEPRI);
+    }
+}
+
+/** @brief Unmask the interrupts used by the driver. */
+static inline void irq_unmask(void)
+{
+    __set_BASEPRI(m_critical_section_basepri);
+}
+
+#else // CRITICAL_SECTION_BASEPRI_USED
+
 /** @brief Enter critical section for RADIO peripheral
  *
  * @note RADIO peripheral registers (and NVIC) are modified only when timeslot is granted for the
@@ -85,6 +129,27 @@ static void radio_critical_section_exit(void)
     }
 }
 
+/** @brief Mask the interrupts used by the driver.
+ *
+ * @param[in]  cnt  Nesting counter before the critical section was entered.
+ */
+static inline void irq_mask(uint8_t cnt)
+{
+    (void)cnt;
+
+    nrf_802154_lp_timer_critical_section_enter();
+    radio_critical_section_enter();
+}
+
+/** @brief Unmask the interrupts used by the driver. */
+static inline void irq_unmask(void)
+{
+    radio_critical_section_exit();
+    nrf_802154_lp_timer_critical_section_exit();
+}
+
+#endif // CRITICAL_SECTION_BASEPRI_USED
+
 /** @brief Convert active priority value to int8_t type.
  *
  * @param[in]  active_priority  Active priority in uint32_t format
@@ -125,8 +190,7 @@ static bool critical_section_enter(bool forced)
         while (__STREXB(cnt + 1, &m_nested_critical_section_counter));
 
         nrf_802154_critical_section_rsch_enter();
-        nrf_802154_lp_timer_critical_section_enter();
-        radio_critical_section_enter();
+        irq_mask(cnt);
         __DSB();
         __ISB();
 
@@ -160,8 +224,7 @@ static void critical_section_exit(void)
             exiting_crit_sect = true;
 
             nrf_802154_critical_section_rsch_exit();
-            radio_critical_section_exit();
-            nrf_802154_lp_timer_critical_section_exit();
+            irq_unmask();
 
             exiting_crit_sect = false;
         }
@@ -148,6 +148,26 @@ extern volatile uint32_t nrf_802154_debug_log_ptr;
 
 #endif // ENABLE_DEBUG_GPIO
 
+#if ENABLE_DEBUG_PROF
+
+#include <soc/nrfx_prof.h>
+
+#if !NRFX_CHECK(NRFX_PROF_ENABLED)
+#error "ENABLE_DEBUG_PROF requires NRFX_PROF_ENABLED."
+#endif
+
+#define nrf_802154_prof_region_define(name) NRFX_PROF_REGION_DEFINE(name)
+#define nrf_802154_prof_begin(name)         NRFX_PROF_BEGIN(name)
+#define nrf_802154_prof_end(name)           NRFX_PROF_END(name)
+
+#else // ENABLE_DEBUG_PROF
+
+#define nrf_802154_prof_region_define(name) struct nrf_802154_prof_unused_ ## name
+#define nrf_802154_prof_begin(name)
+#define nrf_802154_prof_end(name)
+
+#endif // ENABLE_DEBUG_PROF
+
 /**
  * @brief Initializes debug helpers for the nRF 802.15.4 driver.
  */
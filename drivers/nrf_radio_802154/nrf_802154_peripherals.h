@@ -106,6 +106,14 @@ extern "C" {
 #define NRF_802154_COUNTER_TIMER_INSTANCE \
     NRFX_CONCAT_2(NRF_TIMER, NRF_802154_COUNTER_TIMER_INSTANCE_NO)
 
+#if NRFX_CHECK(NRFX_PROF_ENABLED) && defined(NRFX_PROF_TIMER)
+#if (NRFX_PROF_TIMER == NRF_802154_HIGH_PRECISION_TIMER_INSTANCE_NO) || \
+    (NRFX_PROF_TIMER == NRF_802154_TIMER_INSTANCE_NO) ||                \
+    (NRFX_PROF_TIMER == NRF_802154_COUNTER_TIMER_INSTANCE_NO)
+#error "NRFX_PROF_TIMER is used by the nRF 802.15.4 radio driver."
+#endif
+#endif
+
 /**
  * @def NRF_802154_SWI_EGU_INSTANCE_NO
  *
@@ -46,8 +46,12 @@
 #include "nrf_802154_utils.h"
 #include "fal/nrf_802154_fal.h"
 
+#define MIN_CHANNEL   11 ///< Lowest channel in the 2.4 GHz band.
+#define CHANNEL_COUNT 16 ///< Number of channels in the 2.4 GHz band.
+
 typedef struct
 {
+    nrf_radio_txpower_t  tx_power_table[CHANNEL_COUNT];        ///< RADIO TX power setting on each channel.
     int8_t               tx_power;                             ///< Transmit power.
     uint8_t              pan_id[PAN_ID_SIZE];                  ///< Pan Id of this node.
     uint8_t              short_addr[SHORT_ADDRESS_SIZE];       ///< Short Address of this node.
@@ -120,6 +124,32 @@ static nrf_radio_txpower_t to_radio_tx_power_convert(int8_t integer_tx_power)
     return radio_tx_power;
 }
 
+/**
+ * Converts a transmit power at the FEM output to the RADIO TX power setting on a channel.
+ *
+ * The gain of the FEM is compensated by the FAL.
+ *
+ * @param[in]  channel  Channel on which the frame is to be transmitted.
+ * @param[in]  dbm      Transmit power at the FEM output in dBm.
+ *
+ * @retval     RADIO TX power allowed value.
+ */
+static nrf_radio_txpower_t tx_power_compensate(uint8_t channel, int8_t dbm)
+{
+    return to_radio_tx_power_convert(nrf_802154_fal_tx_power_get(channel, dbm));
+}
+
+/**
+ * Recalculates the RADIO TX power settings of all channels.
+ */
+static void tx_power_table_update(void)
+{
+    for (uint32_t i = 0; i < CHANNEL_COUNT; i++)
+    {
+        m_data.tx_power_table[i] = tx_power_compensate(MIN_CHANNEL + i, m_data.tx_power);
+    }
+}
+
 void nrf_802154_pib_init(void)
 {
     m_data.promiscuous = false;
@@ -136,6 +166,8 @@ void nrf_802154_pib_init(void)
     m_data.cca.ed_threshold   = NRF_802154_CCA_ED_THRESHOLD_DEFAULT;
     m_data.cca.corr_threshold = NRF_802154_CCA_CORR_THRESHOLD_DEFAULT;
     m_data.cca.corr_limit     = NRF_802154_CCA_CORR_LIMIT_DEFAULT;
+
+    nrf_802154_pib_tx_power_update();
 }
 
 bool nrf_802154_pib_promiscuous_get(void)
@@ -178,16 +210,28 @@ void nrf_802154_pib_channel_set(uint8_t channel)
     m_data.channel = channel;
 }
 
-nrf_radio_txpower_t nrf_802154_pib_tx_power_get(void)
+nrf_radio_txpower_t nrf_802154_pib_tx_power_get(uint8_t channel)
 {
-    int8_t tx_power = nrf_802154_fal_tx_power_get(m_data.channel, m_data.tx_power);
+    assert((channel >= MIN_CHANNEL) && (channel < MIN_CHANNEL + CHANNEL_COUNT));
 
-    return to_radio_tx_power_convert(tx_power);
+    return m_data.tx_power_table[channel - MIN_CHANNEL];
 }
 
 void nrf_802154_pib_tx_power_set(int8_t dbm)
 {
     m_data.tx_power = dbm;
+
+    nrf_802154_pib_tx_power_update();
+}
+
+void nrf_802154_pib_tx_power_update(void)
+{
+    tx_power_table_update();
+}
+
+nrf_radio_txpower_t nrf_802154_pib_tx_power_convert(uint8_t channel, int8_t dbm)
+{
+    return tx_power_compensate(channel, dbm);
 }
 
 const uint8_t * nrf_802154_pib_pan_id_get(void)
@@ -45,6 +45,9 @@
 extern "C" {
 #endif
 
+/** Transmit power of frames transmitted with the power stored in the PIB. */
+#define NRF_802154_TX_POWER_FROM_PIB ((nrf_802154_tx_power_t){ .use_pib = true, .dbm = 0 })
+
 /**
  * @brief Initializes this module.
  */
@@ -110,11 +113,17 @@ uint8_t nrf_802154_pib_channel_get(void);
 void nrf_802154_pib_channel_set(uint8_t channel);
 
 /**
- * @brief Gets the transmit power.
+ * @brief Gets the RADIO TX power setting for the given channel.
+ *
+ * The setting is looked up in a table precalculated for all channels when the transmit power or
+ * the FEM configuration changes. The gain of the FEM is compensated by
+ * @ref nrf_802154_fal_tx_power_get.
+ *
+ * @param[in]  channel  Channel on which the frame is to be transmitted (11-26).
  *
- * @returns  Transmit power in dBm.
+ * @returns  RADIO TX power setting.
  */
-nrf_radio_txpower_t nrf_802154_pib_tx_power_get(void);
+nrf_radio_txpower_t nrf_802154_pib_tx_power_get(uint8_t channel);
 
 /**
  * @brief Sets the transmit power used for ACK frames.
@@ -123,6 +132,24 @@ nrf_radio_txpower_t nrf_802154_pib_tx_power_get(void);
  */
 void nrf_802154_pib_tx_power_set(int8_t dbm);
 
+/**
+ * @brief Recalculates the RADIO TX power settings after the FEM configuration changes.
+ */
+void nrf_802154_pib_tx_power_update(void);
+
+/**
+ * @brief Converts a transmit power to the RADIO TX power setting for the given channel.
+ *
+ * This function is used for frames transmitted with a power different from the one stored in
+ * the PIB.
+ *
+ * @param[in]  channel  Channel on which the frame is to be transmitted.
+ * @param[in]  dbm      Transmit power in dBm.
+ *
+ * @returns  RADIO TX power setting.
+ */
+nrf_radio_txpower_t nrf_802154_pib_tx_power_convert(uint8_t channel, int8_t dbm);
+
 /**
  * @brief Gets the PAN ID used by this device.
  *
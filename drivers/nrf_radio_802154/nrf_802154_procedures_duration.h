@@ -40,6 +40,7 @@
 #include <stdint.h>
 #include "nrf.h"
 
+#include "nrf_802154_config.h"
 #include "nrf_802154_const.h"
 
 #define TX_RAMP_UP_TIME                   40 // us
@@ -48,6 +49,44 @@
 #define MAX_RAMP_DOWN_TIME                6  // us
 #define RX_TX_TURNAROUND_TIME             20 // us
 
+#if NRF_802154_PROCEDURES_DURATION_CALIBRATION_ENABLED
+
+/**
+ * @brief Durations of the RADIO state transitions used to calculate procedure durations.
+ */
+typedef struct
+{
+    uint16_t tx_ramp_up;       ///< Time from the TXEN task to the READY event in the DISABLED state [us].
+    uint16_t rx_ramp_up;       ///< Time from the RXEN task to the READY event [us].
+    uint16_t rx_ramp_down;     ///< Time from the DISABLE task to the DISABLED event in the RX state [us].
+    uint16_t max_ramp_down;    ///< Maximum time from the DISABLE task to the DISABLED event [us].
+    uint16_t rx_tx_turnaround; ///< Time from the TXEN task to the READY event in the RX state [us].
+} nrf_802154_procedures_duration_model_t;
+
+/**
+ * @brief Duration model used to calculate procedure durations.
+ *
+ * The model holds the default durations until the core module measures them in the calibration
+ * timeslot.
+ */
+extern nrf_802154_procedures_duration_model_t nrf_802154_procedures_duration_model;
+
+#define TX_RAMP_UP_DURATION               (nrf_802154_procedures_duration_model.tx_ramp_up)
+#define RX_RAMP_UP_DURATION               (nrf_802154_procedures_duration_model.rx_ramp_up)
+#define RX_RAMP_DOWN_DURATION             (nrf_802154_procedures_duration_model.rx_ramp_down)
+#define MAX_RAMP_DOWN_DURATION            (nrf_802154_procedures_duration_model.max_ramp_down)
+#define RX_TX_TURNAROUND_DURATION         (nrf_802154_procedures_duration_model.rx_tx_turnaround)
+
+#else // NRF_802154_PROCEDURES_DURATION_CALIBRATION_ENABLED
+
+#define TX_RAMP_UP_DURATION               TX_RAMP_UP_TIME
+#define RX_RAMP_UP_DURATION               RX_RAMP_UP_TIME
+#define RX_RAMP_DOWN_DURATION             RX_RAMP_DOWN_TIME
+#define MAX_RAMP_DOWN_DURATION            MAX_RAMP_DOWN_TIME
+#define RX_TX_TURNAROUND_DURATION         RX_TX_TURNAROUND_TIME
+
+#endif // NRF_802154_PROCEDURES_DURATION_CALIBRATION_ENABLED
+
 #define A_CCA_DURATION_SYMBOLS            8  // sym
 #define A_TURNAROUND_TIME_SYMBOLS         12 // sym
 #define A_UNIT_BACKOFF_SYMBOLS            20 // sym
@@ -102,7 +141,7 @@ __STATIC_INLINE uint16_t nrf_802154_tx_duration_get(uint8_t psdu_length,
     // if CCA: + RX ramp up + CCA + RX ramp down
     // + TX ramp up + SHR + PHR + PSDU
     // if ACK: + macAckWaitDuration
-    uint16_t us_time = MAX_RAMP_DOWN_TIME + TX_RAMP_UP_TIME + nrf_802154_frame_duration_get(
+    uint16_t us_time = MAX_RAMP_DOWN_DURATION + TX_RAMP_UP_DURATION + nrf_802154_frame_duration_get(
         psdu_length,
         true,
         true);
@@ -114,7 +153,7 @@ __STATIC_INLINE uint16_t nrf_802154_tx_duration_get(uint8_t psdu_length,
 
     if (cca)
     {
-        us_time += RX_RAMP_UP_TIME + RX_RAMP_DOWN_TIME + PHY_US_TIME_FROM_SYMBOLS(
+        us_time += RX_RAMP_UP_DURATION + RX_RAMP_DOWN_DURATION + PHY_US_TIME_FROM_SYMBOLS(
             A_CCA_DURATION_SYMBOLS);
     }
 
@@ -124,7 +163,7 @@ __STATIC_INLINE uint16_t nrf_802154_tx_duration_get(uint8_t psdu_length,
 __STATIC_INLINE uint16_t nrf_802154_cca_before_tx_duration_get(void)
 {
     // CCA + turnaround time
-    uint16_t us_time = PHY_US_TIME_FROM_SYMBOLS(A_CCA_DURATION_SYMBOLS) + RX_TX_TURNAROUND_TIME;
+    uint16_t us_time = PHY_US_TIME_FROM_SYMBOLS(A_CCA_DURATION_SYMBOLS) + RX_TX_TURNAROUND_DURATION;
 
     return us_time;
 }
@@ -148,8 +187,8 @@ __STATIC_INLINE uint16_t nrf_802154_rx_duration_get(uint8_t psdu_length, bool ac
 __STATIC_INLINE uint16_t nrf_802154_cca_duration_get(void)
 {
     // ramp down + rx ramp up + CCA
-    uint16_t us_time = MAX_RAMP_DOWN_TIME +
-                       RX_RAMP_UP_TIME +
+    uint16_t us_time = MAX_RAMP_DOWN_DURATION +
+                       RX_RAMP_UP_DURATION +
                        PHY_US_TIME_FROM_SYMBOLS(A_CCA_DURATION_SYMBOLS);
 
     return us_time;
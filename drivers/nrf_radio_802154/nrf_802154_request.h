@@ -87,6 +87,7 @@ bool nrf_802154_request_receive(nrf_802154_term_t              term_lvl,
  * @param[in]  req_orig         Module that originates this request.
  * @param[in]  p_data           Pointer to the frame to transmit.
  * @param[in]  cca              If the driver is to perform the CCA procedure before transmission.
+ * @param[in]  tx_power         Transmit power of the frame.
  * @param[in]  immediate        If true, the driver schedules transmission immediately or never.
  *                              If false, the transmission can be postponed until the TX
  *                              preconditions are met.
@@ -99,6 +100,7 @@ bool nrf_802154_request_transmit(nrf_802154_term_t              term_lvl,
                                  req_originator_t               req_orig,
                                  const uint8_t                * p_data,
                                  bool                           cca,
+                                 nrf_802154_tx_power_t          tx_power,
                                  bool                           immediate,
                                  nrf_802154_notification_func_t notify_function);
 
@@ -71,6 +71,7 @@ bool nrf_802154_request_transmit(nrf_802154_term_t              term_lvl,
                                  req_originator_t               req_orig,
                                  const uint8_t                * p_data,
                                  bool                           cca,
+                                 nrf_802154_tx_power_t          tx_power,
                                  bool                           immediate,
                                  nrf_802154_notification_func_t notify_function)
 {
@@ -79,6 +80,7 @@ bool nrf_802154_request_transmit(nrf_802154_term_t              term_lvl,
                      req_orig,
                      p_data,
                      cca,
+                     tx_power,
                      immediate,
                      notify_function)
 }
@@ -36,7 +36,9 @@
 
 #include "nrf_802154_rx_buffer.h"
 
+#include <assert.h>
 #include <stddef.h>
+#include <string.h>
 
 #include "nrf_802154_config.h"
 
@@ -44,14 +46,70 @@
 #error Not enough rx buffers in the 802.15.4 radio driver.
 #endif
 
+#if NRF_802154_RX_SHORT_BUFFERS > 0
+
+#if (NRF_802154_RX_SHORT_BUFFER_SIZE < (IMM_ACK_LENGTH + PHR_SIZE)) || \
+    (NRF_802154_RX_SHORT_BUFFER_SIZE > MAX_PACKET_SIZE)
+#error Invalid size of short rx buffers in the 802.15.4 radio driver.
+#endif
+
+/**
+ * @brief Structure that contains a received frame short enough to be moved out of
+ *        the full-size buffer.
+ */
+typedef struct
+{
+    uint8_t                            data[NRF_802154_RX_SHORT_BUFFER_SIZE];
+    bool                               free;           // If this buffer is free or contains a frame.
+#if NRF_802154_RX_IE_INDEX_CACHE_ENABLED
+    bool                               ie_index_valid; // If ie_index contains the IEs of the frame.
+    nrf_802154_frame_parser_ie_index_t ie_index;       // Header IEs of the frame.
+#endif
+} rx_short_buffer_t;
+
+static rx_short_buffer_t m_rx_short_buffers[NRF_802154_RX_SHORT_BUFFERS]; ///< Short receive buffers.
+
+#endif // NRF_802154_RX_SHORT_BUFFERS > 0
+
 rx_buffer_t nrf_802154_rx_buffers[NRF_802154_RX_BUFFERS]; ///< Receive buffers.
 
+#if NRF_802154_RX_SHORT_BUFFERS > 0
+
+/**
+ * @brief Gets the short buffer that contains the given frame.
+ *
+ * @param[in]  p_data  Pointer to the frame.
+ *
+ * @returns  Pointer to the short buffer, or NULL if the frame is stored in a full-size buffer.
+ */
+static rx_short_buffer_t * short_buffer_get(const uint8_t * p_data)
+{
+    const uint8_t * p_first = m_rx_short_buffers[0].data;
+    const uint8_t * p_end   = (const uint8_t *)&m_rx_short_buffers[NRF_802154_RX_SHORT_BUFFERS];
+
+    if ((p_data < p_first) || (p_data >= p_end))
+    {
+        return NULL;
+    }
+
+    return &m_rx_short_buffers[(p_data - p_first) / sizeof(rx_short_buffer_t)];
+}
+
+#endif // NRF_802154_RX_SHORT_BUFFERS > 0
+
 void nrf_802154_rx_buffer_init(void)
 {
     for (uint32_t i = 0; i < NRF_802154_RX_BUFFERS; i++)
     {
         nrf_802154_rx_buffers[i].free = true;
     }
+
+#if NRF_802154_RX_SHORT_BUFFERS > 0
+    for (uint32_t i = 0; i < NRF_802154_RX_SHORT_BUFFERS; i++)
+    {
+        m_rx_short_buffers[i].free = true;
+    }
+#endif
 }
 
 rx_buffer_t * nrf_802154_rx_buffer_free_find(void)
@@ -66,3 +124,106 @@ rx_buffer_t * nrf_802154_rx_buffer_free_find(void)
 
     return NULL;
 }
+
+uint8_t * nrf_802154_rx_buffer_frame_take(rx_buffer_t * p_buffer)
+{
+#if NRF_802154_RX_SHORT_BUFFERS > 0
+    uint32_t length = p_buffer->data[PHR_OFFSET] + PHR_SIZE;
+
+    if (length <= NRF_802154_RX_SHORT_BUFFER_SIZE)
+    {
+        for (uint32_t i = 0; i < NRF_802154_RX_SHORT_BUFFERS; i++)
+        {
+            if (m_rx_short_buffers[i].free)
+            {
+                memcpy(m_rx_short_buffers[i].data, p_buffer->data, length);
+                m_rx_short_buffers[i].free = false;
+#if NRF_802154_RX_IE_INDEX_CACHE_ENABLED
+                m_rx_short_buffers[i].ie_index_valid = false;
+#endif
+
+                return m_rx_short_buffers[i].data;
+            }
+        }
+    }
+#endif // NRF_802154_RX_SHORT_BUFFERS > 0
+
+    p_buffer->free = false;
+#if NRF_802154_RX_IE_INDEX_CACHE_ENABLED
+    p_buffer->ie_index_valid = false;
+#endif
+
+    return p_buffer->data;
+}
+
+rx_buffer_t * nrf_802154_rx_buffer_release(uint8_t * p_data)
+{
+#if NRF_802154_RX_SHORT_BUFFERS > 0
+    rx_short_buffer_t * p_short_buffer = short_buffer_get(p_data);
+
+    if (p_short_buffer != NULL)
+    {
+        p_short_buffer->free = true;
+
+        return NULL;
+    }
+#endif // NRF_802154_RX_SHORT_BUFFERS > 0
+
+    rx_buffer_t * p_buffer = (rx_buffer_t *)p_data;
+
+    p_buffer->free = true;
+
+    return p_buffer;
+}
+
+bool nrf_802154_rx_buffer_is_taken(const uint8_t * p_data)
+{
+#if NRF_802154_RX_SHORT_BUFFERS > 0
+    rx_short_buffer_t * p_short_buffer = short_buffer_get(p_data);
+
+    if (p_short_buffer != NULL)
+    {
+        return !p_short_buffer->free;
+    }
+#endif // NRF_802154_RX_SHORT_BUFFERS > 0
+
+    return !((const rx_buffer_t *)p_data)->free;
+}
+
+void nrf_802154_rx_buffer_ie_index_get(const uint8_t                      * p_data,
+                                       nrf_802154_frame_parser_ie_index_t * p_index)
+{
+    assert(nrf_802154_rx_buffer_is_taken(p_data));
+
+#if NRF_802154_RX_IE_INDEX_CACHE_ENABLED
+    bool                               * p_valid;
+    nrf_802154_frame_parser_ie_index_t * p_cached;
+
+#if NRF_802154_RX_SHORT_BUFFERS > 0
+    rx_short_buffer_t * p_short_buffer = short_buffer_get(p_data);
+
+    if (p_short_buffer != NULL)
+    {
+        p_valid  = &p_short_buffer->ie_index_valid;
+        p_cached = &p_short_buffer->ie_index;
+    }
+    else
+#endif // NRF_802154_RX_SHORT_BUFFERS > 0
+    {
+        rx_buffer_t * p_buffer = (rx_buffer_t *)p_data;
+
+        p_valid  = &p_buffer->ie_index_valid;
+        p_cached = &p_buffer->ie_index;
+    }
+
+    if (!*p_valid)
+    {
+        nrf_802154_frame_parser_ie_index_build(p_data, p_cached);
+        *p_valid = true;
+    }
+
+    *p_index = *p_cached;
+#else // NRF_802154_RX_IE_INDEX_CACHE_ENABLED
+    nrf_802154_frame_parser_ie_index_build(p_data, p_index);
+#endif // NRF_802154_RX_IE_INDEX_CACHE_ENABLED
+}
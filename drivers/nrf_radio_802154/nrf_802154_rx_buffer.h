@@ -39,7 +39,9 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "nrf_802154_config.h"
 #include "nrf_802154_const.h"
+#include "mac_features/nrf_802154_frame_parser.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -50,8 +52,12 @@ extern "C" {
  */
 typedef struct
 {
-    uint8_t data[MAX_PACKET_SIZE + 1];
-    bool    free; // If this buffer is free or contains a frame.
+    uint8_t                            data[MAX_PACKET_SIZE + 1];
+    bool                               free;           // If this buffer is free or contains a frame.
+#if NRF_802154_RX_IE_INDEX_CACHE_ENABLED
+    bool                               ie_index_valid; // If ie_index contains the IEs of the frame.
+    nrf_802154_frame_parser_ie_index_t ie_index;       // Header IEs of the frame.
+#endif
 } rx_buffer_t;
 
 /**
@@ -75,6 +81,52 @@ void nrf_802154_rx_buffer_init(void);
  */
 rx_buffer_t * nrf_802154_rx_buffer_free_find(void);
 
+/**
+ * @brief Takes the frame received to a buffer.
+ *
+ * If the frame fits in a short buffer and one is free, the frame is copied to it and
+ * @p p_buffer remains free, so that it can be used to receive the next frame.
+ * Otherwise, @p p_buffer is marked as containing a frame.
+ *
+ * @param[in]  p_buffer  Pointer to the buffer that contains the received frame.
+ *
+ * @returns  Pointer to the frame to be passed to the higher layer.
+ */
+uint8_t * nrf_802154_rx_buffer_frame_take(rx_buffer_t * p_buffer);
+
+/**
+ * @brief Releases the buffer that contains a frame passed to the higher layer.
+ *
+ * @param[in]  p_data  Pointer to the frame returned by @ref nrf_802154_rx_buffer_frame_take.
+ *
+ * @returns  Pointer to the released full-size buffer, or NULL if the frame was stored
+ *           in a short buffer.
+ */
+rx_buffer_t * nrf_802154_rx_buffer_release(uint8_t * p_data);
+
+/**
+ * @brief Checks if the buffer that contains a frame passed to the higher layer is in use.
+ *
+ * @param[in]  p_data  Pointer to the frame returned by @ref nrf_802154_rx_buffer_frame_take.
+ *
+ * @retval true   The buffer contains the frame.
+ * @retval false  The buffer has already been released.
+ */
+bool nrf_802154_rx_buffer_is_taken(const uint8_t * p_data);
+
+/**
+ * @brief Gets the commonly used Header IEs of a frame passed to the higher layer.
+ *
+ * The IEs are indexed on the first call for the frame. With
+ * @ref NRF_802154_RX_IE_INDEX_CACHE_ENABLED, the index is kept in the buffer until the frame is
+ * released, and the next calls copy it without parsing the frame again.
+ *
+ * @param[in]   p_data   Pointer to the frame returned by @ref nrf_802154_rx_buffer_frame_take.
+ * @param[out]  p_index  Pointer to the structure that is filled with the IEs.
+ */
+void nrf_802154_rx_buffer_ie_index_get(const uint8_t                      * p_data,
+                                       nrf_802154_frame_parser_ie_index_t * p_index);
+
 #ifdef __cplusplus
 }
 #endif
@@ -194,6 +194,7 @@ typedef struct
             req_originator_t               req_orig;   ///< Request originator.
             const uint8_t                * p_data;     ///< Pointer to a buffer containing PHR and PSDU of the frame to transmit.
             bool                           cca;        ///< If CCA was requested prior to transmission.
+            nrf_802154_tx_power_t          tx_power;   ///< Transmit power of the frame.
             bool                           immediate;  ///< If TX procedure must be performed immediately.
             bool                         * p_result;   ///< Transmit request result.
         } transmit;                                    ///< Transmit request details.
@@ -592,6 +593,7 @@ void nrf_802154_swi_transmit(nrf_802154_term_t              term_lvl,
                              req_originator_t               req_orig,
                              const uint8_t                * p_data,
                              bool                           cca,
+                             nrf_802154_tx_power_t          tx_power,
                              bool                           immediate,
                              nrf_802154_notification_func_t notify_function,
                              bool                         * p_result)
@@ -603,6 +605,7 @@ void nrf_802154_swi_transmit(nrf_802154_term_t              term_lvl,
     p_slot->data.transmit.req_orig   = req_orig;
     p_slot->data.transmit.p_data     = p_data;
     p_slot->data.transmit.cca        = cca;
+    p_slot->data.transmit.tx_power   = tx_power;
     p_slot->data.transmit.immediate  = immediate;
     p_slot->data.transmit.notif_func = notify_function;
     p_slot->data.transmit.p_result   = p_result;
@@ -815,6 +818,7 @@ void SWI_IRQHandler(void)
                                                  p_slot->data.transmit.req_orig,
                                                  p_slot->data.transmit.p_data,
                                                  p_slot->data.transmit.cca,
+                                                 p_slot->data.transmit.tx_power,
                                                  p_slot->data.transmit.immediate,
                                                  p_slot->data.transmit.notif_func);
                     break;
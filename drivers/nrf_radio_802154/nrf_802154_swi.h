@@ -181,6 +181,7 @@ void nrf_802154_swi_receive(nrf_802154_term_t              term_lvl,
  * @param[in]   p_data           Pointer to a buffer that contains PHR and PSDU of the frame to be
  *                               transmitted.
  * @param[in]   cca              If the driver should perform the CCA procedure before transmission.
+ * @param[in]   tx_power         Transmit power of the frame.
  * @param[in]   immediate        If true, the driver schedules transmission immediately or never;
  *                               if false, the transmission may be postponed until TX preconditions
  *                               are met.
@@ -193,6 +194,7 @@ void nrf_802154_swi_transmit(nrf_802154_term_t              term_lvl,
                              req_originator_t               req_orig,
                              const uint8_t                * p_data,
                              bool                           cca,
+                             nrf_802154_tx_power_t          tx_power,
                              bool                           immediate,
                              nrf_802154_notification_func_t notify_function,
                              bool                         * p_result);
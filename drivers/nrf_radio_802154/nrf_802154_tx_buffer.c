@@ -0,0 +1,121 @@
+/* Copyright (c) 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements the pool of transmit buffers lent to the higher layer by the nRF 802.15.4
+ *   radio driver.
+ *
+ */
+
+#include "nrf_802154_tx_buffer.h"
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <nrf.h>
+#include <soc/nrfx_atomic.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_const.h"
+
+#if !NRF_802154_USE_RAW_API && (NRF_802154_TX_BUFFERS > 0)
+
+#define TX_BUFFER_SIZE (PHR_SIZE + MAX_PACKET_SIZE) ///< Size of a transmit buffer.
+
+static uint8_t           m_tx_buffers[NRF_802154_TX_BUFFERS][TX_BUFFER_SIZE];                ///< Transmit buffers.
+static nrfx_atomic_u32_t m_free[NRFX_ATOMIC_BITMAP_WORDS(NRF_802154_TX_BUFFERS)]; ///< Bitmap of free buffers.
+
+/**
+ * @brief Gets the index of the transmit buffer.
+ *
+ * @param[in]  p_buffer  Pointer to the PHR of the buffer.
+ *
+ * @returns  Index of the buffer, or NRF_802154_TX_BUFFERS if @p p_buffer is not a transmit buffer.
+ */
+static uint32_t buffer_index_get(const uint8_t * p_buffer)
+{
+    const uint8_t * p_first = m_tx_buffers[0];
+    const uint8_t * p_end   = m_tx_buffers[NRF_802154_TX_BUFFERS];
+
+    if ((p_buffer < p_first) || (p_buffer >= p_end) ||
+        (((p_buffer - p_first) % TX_BUFFER_SIZE) != 0))
+    {
+        return NRF_802154_TX_BUFFERS;
+    }
+
+    return (p_buffer - p_first) / TX_BUFFER_SIZE;
+}
+
+void nrf_802154_tx_buffer_init(void)
+{
+    for (size_t i = 0; i < NRFX_ATOMIC_BITMAP_WORDS(NRF_802154_TX_BUFFERS); i++)
+    {
+        m_free[i] = 0;
+    }
+
+    for (size_t i = 0; i < NRF_802154_TX_BUFFERS; i++)
+    {
+        (void)nrfx_atomic_bit_set(m_free, i);
+    }
+}
+
+uint8_t * nrf_802154_tx_buffer_alloc(void)
+{
+    size_t index;
+
+    if (!nrfx_atomic_bitmap_first_set_claim(m_free, NRF_802154_TX_BUFFERS, &index))
+    {
+        return NULL;
+    }
+
+    return m_tx_buffers[index];
+}
+
+void nrf_802154_tx_buffer_release(uint8_t * p_buffer)
+{
+    uint32_t index = buffer_index_get(p_buffer);
+
+    assert(index < NRF_802154_TX_BUFFERS);
+
+    // The atomic operation orders the writes to the buffer before it can be allocated again.
+    (void)nrfx_atomic_bit_set(m_free, index);
+}
+
+bool nrf_802154_tx_buffer_is_allocated(const uint8_t * p_buffer)
+{
+    uint32_t index = buffer_index_get(p_buffer);
+
+    return (index < NRF_802154_TX_BUFFERS) && !nrfx_atomic_bit_check(m_free, index);
+}
+
+#endif // !NRF_802154_USE_RAW_API && (NRF_802154_TX_BUFFERS > 0)
@@ -0,0 +1,85 @@
+/* Copyright (c) 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Module that contains buffers lent to the higher layer to prepare frames to transmit.
+ *
+ */
+
+#ifndef NRF_802154_TX_BUFFER_H_
+#define NRF_802154_TX_BUFFER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Initializes the pool of transmit buffers.
+ */
+void nrf_802154_tx_buffer_init(void);
+
+/**
+ * @brief Allocates a transmit buffer from the pool.
+ *
+ * This function can be called from any context.
+ *
+ * @returns  Pointer to the PHR of a free buffer that can hold a frame of the maximum length,
+ *           or NULL if all buffers are in use.
+ */
+uint8_t * nrf_802154_tx_buffer_alloc(void);
+
+/**
+ * @brief Returns a transmit buffer to the pool.
+ *
+ * This function can be called from any context.
+ *
+ * @param[in]  p_buffer  Pointer returned by @ref nrf_802154_tx_buffer_alloc.
+ */
+void nrf_802154_tx_buffer_release(uint8_t * p_buffer);
+
+/**
+ * @brief Checks if the given pointer refers to an allocated transmit buffer.
+ *
+ * @param[in]  p_buffer  Pointer to check.
+ *
+ * @retval true   @p p_buffer was returned by @ref nrf_802154_tx_buffer_alloc and has not been
+ *                released yet.
+ * @retval false  @p p_buffer is not an allocated transmit buffer.
+ */
+bool nrf_802154_tx_buffer_is_allocated(const uint8_t * p_buffer);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRF_802154_TX_BUFFER_H_ */
@@ -31,6 +31,7 @@
 #ifndef NRF_802154_TYPES_H__
 #define NRF_802154_TYPES_H__
 
+#include <stdbool.h>
 #include <stdint.h>
 
 #include "hal/nrf_radio.h"
@@ -68,6 +69,7 @@ typedef uint8_t nrf_802154_tx_error_t;
 #define NRF_802154_TX_ERROR_NO_ACK          0x05 // !< ACK frame was not received during the timeout period.
 #define NRF_802154_TX_ERROR_ABORTED         0x06 // !< Procedure was aborted by another operation.
 #define NRF_802154_TX_ERROR_TIMESLOT_DENIED 0x07 // !< Transmission did not start due to a denied timeslot request.
+#define NRF_802154_TX_ERROR_EXPIRED         0x08 // !< Frame expired in the indirect transmission queue.
 
 /**
  * @brief Possible errors during the frame reception.
@@ -155,6 +157,65 @@ typedef uint8_t nrf_802154_src_addr_match_t;
 #define NRF_802154_SRC_ADDR_MATCH_ZIGBEE   0x01 // !< Implementation for the Zigbee protocol.
 #define NRF_802154_SRC_ADDR_MATCH_ALWAYS_1 0x02 // !< Standard compliant implementation.
 
+/**
+ * @brief Statistics of the indirect transmission queue.
+ */
+typedef struct
+{
+    uint32_t queued;          // !< Number of frames added to the queue.
+    uint32_t polls;           // !< Number of acknowledged data requests for which a frame was queued.
+    uint32_t dispatched;      // !< Number of frames transmitted in response to a data request.
+    uint32_t dispatch_failed; // !< Number of data requests not answered because the radio was busy.
+    uint32_t expired;         // !< Number of frames that expired in the queue.
+} nrf_802154_indirect_tx_stats_t;
+
+/**
+ * @brief Statistics of the duplicate frame rejection.
+ */
+typedef struct
+{
+    uint32_t checked; // !< Number of acknowledged frames looked up in the recent frame table.
+    uint32_t hits;    // !< Number of frames rejected as duplicates.
+} nrf_802154_dup_filter_stats_t;
+
+/**
+ * @brief Transmit power of a frame.
+ */
+typedef struct
+{
+    bool   use_pib; // !< If the frame is transmitted with the power stored in the PIB. @c dbm is ignored then.
+    int8_t dbm;     // !< Transmit power at the FEM output [dBm].
+} nrf_802154_tx_power_t;
+
+/**
+ * @brief Statistics of the multi-channel listen.
+ *
+ * The average time to detect a frame is the ratio of @c time_to_detect_total to @c detections.
+ */
+typedef struct
+{
+    uint32_t hops;                 // !< Number of channel changes.
+    uint32_t detections;           // !< Number of frames detected while hopping.
+    uint64_t time_to_detect_total; // !< Sum of the times from the start of the search to the detection of a frame [us].
+    uint32_t time_to_detect_max;   // !< Maximum time from the start of the search to the detection of a frame [us].
+} nrf_802154_channel_hop_stats_t;
+
+/**
+ * @brief Statistics of the wake-on-radio listen.
+ *
+ * The duty cycle of the radio is the ratio of @c time_on to @c time_total.
+ */
+typedef struct
+{
+    uint32_t samples;         // !< Number of energy detection samples taken.
+    uint32_t samples_skipped; // !< Number of samples not taken because the radio was busy.
+    uint32_t wakeups;         // !< Number of samples in which the energy reached the threshold.
+    uint32_t wakeups_missed;  // !< Number of wakeups after which no frame started: the sample caught the end of a frame or noise.
+    uint32_t frames;          // !< Number of frames whose reception started while the radio was held awake.
+    uint64_t time_on;         // !< Time the radio was awake [us].
+    uint64_t time_total;      // !< Time the wake-on-radio listen was active [us].
+} nrf_802154_wor_stats_t;
+
 /**
  * @brief RSSI measurement results.
  */
@@ -42,6 +42,7 @@
 
 #include <nrf.h>
 #include <hal/nrf_rtc.h>
+#include <soc/nrfx_atomic.h>
 
 #include "platform/clock/nrf_802154_clock.h"
 #include "nrf_802154_config.h"
@@ -92,7 +93,7 @@ static uint64_t m_target_times[CHANNEL_CNT];       ///< Target time of given cha
 
 static volatile uint32_t m_lp_timer_irq_enabled;   ///< Information that RTC interrupt was enabled while entering critical section.
 static volatile uint32_t m_offset_counter;         ///< Counter of RTC overflows, incremented by 2 on each OVERFLOW event.
-static volatile uint8_t  m_mutex;                  ///< Mutex for write access to @ref m_offset_counter.
+static nrfx_atomic_u32_t m_mutex;                  ///< Mutex for write access to @ref m_offset_counter.
 static volatile bool     m_clock_ready;            ///< Information that LFCLK is ready.
 static volatile bool     m_shall_fire_immediately; ///< Information if timer should fire immediately.
 
@@ -105,17 +106,10 @@ static uint32_t overflow_counter_get(void);
  */
 static inline bool mutex_get(void)
 {
-    do
+    if (nrfx_atomic_u32_fetch_store(&m_mutex, 1) != 0)
     {
-        volatile uint8_t mutex_value = __LDREXB(&m_mutex);
-
-        if (mutex_value)
-        {
-            __CLREX();
-            return false;
-        }
+        return false;
     }
-    while (__STREXB(1, &m_mutex));
 
     // Disable OVERFLOW interrupt to prevent lock-up in interrupt context while mutex is locked from lower priority context
     // and OVERFLOW event flag is stil up.
@@ -132,8 +126,7 @@ static inline void mutex_release(void)
     // Re-enable OVERFLOW interrupt.
     nrf_rtc_int_enable(NRF_802154_RTC_INSTANCE, NRF_RTC_INT_OVERFLOW_MASK);
 
-    __DMB();
-    m_mutex = 0;
+    (void)nrfx_atomic_u32_fetch_store(&m_mutex, 0);
 }
 
 /** @brief Check if timer shall strike.
@@ -34,10 +34,19 @@
 #include "nrf_802154_lp_timer_nodrv.c"
 #undef nrf_802154_lp_timer_init
 
+#if NRF_802154_RTC_IRQ_DIRECT
+NRFX_IRQ_DIRECT_ISR_DEFINE(NRF_802154_RTC_IRQ_HANDLER)
+#endif
+
 void nrf_802154_lp_timer_init(void)
 {
+#if NRF_802154_RTC_IRQ_DIRECT
+    NRFX_IRQ_DIRECT_CONNECT(NRF_802154_RTC_IRQN, NRF_802154_RTC_IRQ_PRIORITY,
+                            NRF_802154_RTC_IRQ_HANDLER, 0);
+#else
     IRQ_CONNECT(NRF_802154_RTC_IRQN, NRF_802154_RTC_IRQ_PRIORITY,
                 NRF_802154_RTC_IRQ_HANDLER, NULL, 0);
+#endif
 
     nrf_802154_lp_timer_init_nodrv();
 }
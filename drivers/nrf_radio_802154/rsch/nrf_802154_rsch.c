@@ -3,6 +3,7 @@
 #include <assert.h>
 #include <stddef.h>
 #include <nrf.h>
+#include <soc/nrfx_atomic.h>
 
 #include "../nrf_802154_debug.h"
 #include "nrf_802154_priority_drop.h"
@@ -47,9 +48,9 @@
                                                 PREC_RAMP_UP_MARGIN)
 #endif
 
-static volatile uint8_t     m_ntf_mutex;                     ///< Mutex for notyfying core.
+static nrfx_atomic_u32_t    m_ntf_mutex;                     ///< Mutex for notyfying core.
 static volatile uint8_t     m_ntf_mutex_monitor;             ///< Mutex monitor, incremented every failed ntf mutex lock.
-static volatile uint8_t     m_req_mutex;                     ///< Mutex for requesting preconditions.
+static nrfx_atomic_u32_t    m_req_mutex;                     ///< Mutex for requesting preconditions.
 static volatile uint8_t     m_req_mutex_monitor;             ///< Mutex monitor, incremented every failed req mutex lock.
 static volatile rsch_prio_t m_last_notified_prio;            ///< Last reported approved priority level.
 static volatile rsch_prio_t m_approved_prios[RSCH_PREC_CNT]; ///< Priority levels approved by each precondition.
@@ -74,28 +75,18 @@ static dly_ts_t m_dly_ts[RSCH_DLY_TS_NUM];
  *  @retval  true   Mutex was acquired.
  *  @retval  false  Mutex could not be acquired.
  */
-static inline bool mutex_trylock(volatile uint8_t * p_mutex, volatile uint8_t * p_mutex_monitor)
+static inline bool mutex_trylock(nrfx_atomic_u32_t * p_mutex, volatile uint8_t * p_mutex_monitor)
 {
     nrf_802154_log_entry(mutex_trylock, 2);
 
-    do
+    if (nrfx_atomic_u32_fetch_store(p_mutex, 1) != 0)
     {
-        uint8_t mutex_value = __LDREXB(p_mutex);
-
-        if (mutex_value)
-        {
-            __CLREX();
-
-            (*p_mutex_monitor)++;
+        (*p_mutex_monitor)++;
 
-            nrf_802154_log_exit(mutex_trylock, 2);
+        nrf_802154_log_exit(mutex_trylock, 2);
 
-            return false;
-        }
+        return false;
     }
-    while (__STREXB(1, p_mutex));
-
-    __DMB();
 
     nrf_802154_log_exit(mutex_trylock, 2);
 
@@ -103,12 +94,11 @@ static inline bool mutex_trylock(volatile uint8_t * p_mutex, volatile uint8_t *
 }
 
 /** @brief Release mutex. */
-static inline void mutex_unlock(volatile uint8_t * p_mutex)
+static inline void mutex_unlock(nrfx_atomic_u32_t * p_mutex)
 {
     nrf_802154_log_entry(mutex_unlock, 2);
 
-    __DMB();
-    *p_mutex = 0;
+    (void)nrfx_atomic_u32_fetch_store(p_mutex, 0);
 
     nrf_802154_log_exit(mutex_unlock, 2);
 }
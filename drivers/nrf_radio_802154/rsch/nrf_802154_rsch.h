@@ -88,10 +88,12 @@ typedef enum
  */
 typedef enum
 {
-    RSCH_DLY_TX,     ///< Timeslot for delayed TX operation.
-    RSCH_DLY_RX,     ///< Timeslot for delayed RX operation.
+    RSCH_DLY_TX,          ///< Timeslot for delayed TX operation.
+    RSCH_DLY_RX,          ///< Timeslot for delayed RX operation.
+    RSCH_DLY_WOR,         ///< Timeslot for a wake-on-radio sample.
+    RSCH_DLY_CALIBRATION, ///< Timeslot for the measurement of the RADIO state transitions.
 
-    RSCH_DLY_TS_NUM, ///< Number of delayed timeslots.
+    RSCH_DLY_TS_NUM,      ///< Number of delayed timeslots.
 } rsch_dly_ts_id_t;
 
 /**
@@ -47,6 +47,7 @@
 #include <stdint.h>
 
 #include <nrf.h>
+#include <soc/nrfx_atomic.h>
 #include "../nrf_802154_debug.h"
 #include "platform/lp_timer/nrf_802154_lp_timer.h"
 
@@ -54,9 +55,9 @@
 _Pragma("diag_suppress=Pe167")
 #endif
 
-static volatile uint8_t              m_timer_mutex;        ///< Mutex for starting the timer.
-static volatile uint8_t              m_fired_mutex;        ///< Mutex for the timer firing procedure.
-static volatile uint8_t              m_queue_changed_cntr; ///< Information that scheduler queue was modified.
+static nrfx_atomic_u32_t             m_timer_mutex;        ///< Mutex for starting the timer.
+static nrfx_atomic_u32_t             m_fired_mutex;        ///< Mutex for the timer firing procedure.
+static nrfx_atomic_u32_t             m_queue_changed_cntr; ///< Information that scheduler queue was modified.
 static volatile nrf_802154_timer_t * mp_head;              ///< Head of the running timers list.
 
 /** @brief Non-blocking mutex for starting the timer.
@@ -64,44 +65,21 @@ static volatile nrf_802154_timer_t * mp_head;              ///< Head of the runn
  *  @retval  true   Mutex was acquired.
  *  @retval  false  Mutex could not be acquired.
  */
-static inline bool mutex_trylock(volatile uint8_t * p_mutex)
+static inline bool mutex_trylock(nrfx_atomic_u32_t * p_mutex)
 {
-    do
-    {
-        volatile uint8_t mutex_value = __LDREXB(p_mutex);
-
-        if (mutex_value)
-        {
-            __CLREX();
-            return false;
-        }
-    }
-    while (__STREXB(1, p_mutex));
-
-    __DMB();
-
-    return true;
+    return nrfx_atomic_u32_fetch_store(p_mutex, 1) == 0;
 }
 
 /** @brief Release mutex. */
-static inline void mutex_unlock(volatile uint8_t * p_mutex)
+static inline void mutex_unlock(nrfx_atomic_u32_t * p_mutex)
 {
-    __DMB();
-    *p_mutex = 0;
+    (void)nrfx_atomic_u32_fetch_store(p_mutex, 0);
 }
 
 /** @brief Increment queue counter value to detect changes in the queue. */
 static inline void queue_cntr_bump(void)
 {
-    volatile uint8_t cntr;
-
-    do
-    {
-        cntr = __LDREXB(&m_queue_changed_cntr);
-    }
-    while (__STREXB(cntr + 1, &m_queue_changed_cntr));
-
-    __DMB();
+    (void)nrfx_atomic_u32_fetch_add(&m_queue_changed_cntr, 1);
 }
 
 /**
@@ -139,7 +117,7 @@ static inline bool is_timer_prior(const nrf_802154_timer_t * p_timer_1,
 static inline void handle_timer(void)
 {
     volatile nrf_802154_timer_t * p_head;
-    uint8_t                       queue_cntr;
+    uint32_t                      queue_cntr;
 
     do
     {
@@ -191,7 +169,7 @@ static bool timer_remove(nrf_802154_timer_t * p_timer, bool * p_was_running)
     nrf_802154_timer_t         ** pp_item;
     nrf_802154_timer_t * volatile p_next; // Volatile pointer to prevent compiler from removing any code related to this variable during optimization (IAR).
     nrf_802154_timer_t          * p_cur;
-    uint8_t                       queue_cntr;
+    uint32_t                      queue_cntr;
     bool                          timer_start;
     bool                          timer_stop;
 
@@ -352,7 +330,7 @@ void nrf_802154_timer_sched_add(nrf_802154_timer_t * p_timer, bool round_up)
 
     nrf_802154_timer_t ** pp_item;
     nrf_802154_timer_t  * p_next;
-    uint8_t               queue_cntr;
+    uint32_t              queue_cntr;
 
     while (true)
     {
@@ -419,8 +397,8 @@ void nrf_802154_timer_sched_remove(nrf_802154_timer_t * p_timer, bool * p_was_ru
 
 bool nrf_802154_timer_sched_is_running(nrf_802154_timer_t * p_timer)
 {
-    uint8_t queue_cntr;
-    bool    result;
+    uint32_t queue_cntr;
+    bool     result;
 
     do
     {
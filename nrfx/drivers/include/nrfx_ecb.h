@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NRFX_ECB_H__
+#define NRFX_ECB_H__
+
+#include <nrfx.h>
+#include <hal/nrf_ecb.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_ecb ECB driver
+ * @{
+ * @ingroup nrf_ecb
+ * @brief   AES Electronic Codebook mode encryption (ECB) peripheral driver.
+ *
+ * The driver serializes the access to the single ECB peripheral. Users submit jobs, each made
+ * of one or more blocks, which are queued and processed back-to-back from the ENDECB interrupt.
+ * The CTR mode and CMAC helpers are built on top of the job queue.
+ *
+ * The peripheral shares the AES core with CCM and AAR, which have higher priority. A block
+ * aborted because of that is restarted.
+ */
+
+/** @brief Size of the AES-128 key and block, in bytes. */
+#define NRFX_ECB_BLOCK_SIZE 16
+
+/**
+ * @brief Block processed by the ECB peripheral.
+ *
+ * The layout is the one read by the peripheral through EasyDMA, so the structure must be
+ * placed in Data RAM.
+ */
+typedef struct
+{
+    uint8_t key[NRFX_ECB_BLOCK_SIZE];        /**< AES-128 key. */
+    uint8_t cleartext[NRFX_ECB_BLOCK_SIZE];  /**< Block to encrypt. */
+    uint8_t ciphertext[NRFX_ECB_BLOCK_SIZE]; /**< Encrypted block, written by the peripheral. */
+} nrfx_ecb_data_t;
+
+/** @brief ECB job type. */
+typedef struct nrfx_ecb_job_s nrfx_ecb_job_t;
+
+/**
+ * @brief ECB job handler type.
+ *
+ * The handler is called from the ECB interrupt.
+ *
+ * @param[in] p_job  Pointer to the completed job.
+ * @param[in] result @ref NRFX_SUCCESS if all blocks were encrypted,
+ *                   @ref NRFX_ERROR_INTERNAL if the peripheral kept aborting a block.
+ */
+typedef void (* nrfx_ecb_handler_t)(nrfx_ecb_job_t * p_job, nrfx_err_t result);
+
+/** @brief ECB job structure. */
+struct nrfx_ecb_job_s
+{
+    nrfx_ecb_data_t *  p_blocks;  /**< Blocks to encrypt. */
+    size_t             count;     /**< Number of blocks. */
+    nrfx_ecb_handler_t handler;   /**< Handler called when the job is completed. Can be NULL. */
+    void *             p_context; /**< User context. */
+    nrfx_ecb_job_t *   p_next;    /**< Next job in the queue. For internal use only. */
+    size_t             done;      /**< Number of encrypted blocks. For internal use only. */
+    nrfx_err_t         result;    /**< Result passed to the handler, valid when the job is completed. */
+    volatile bool      pending;   /**< True while the job is queued or processed. For internal use only. */
+};
+
+/** @brief ECB driver configuration structure. */
+typedef struct
+{
+    uint8_t interrupt_priority; /**< Interrupt priority. */
+} nrfx_ecb_config_t;
+
+/**
+ * @brief ECB driver default configuration.
+ *
+ * This configuration sets up the ECB driver with the following options:
+ * - default interrupt priority
+ */
+#define NRFX_ECB_DEFAULT_CONFIG                                 \
+{                                                               \
+    .interrupt_priority = NRFX_ECB_DEFAULT_CONFIG_IRQ_PRIORITY, \
+}
+
+/**
+ * @brief Function for initializing the ECB driver.
+ *
+ * @param[in] p_config Pointer to the structure with the initial configuration.
+ *
+ * @retval NRFX_SUCCESS                   Initialization was successful.
+ * @retval NRFX_ERROR_ALREADY_INITIALIZED The driver is already initialized.
+ */
+nrfx_err_t nrfx_ecb_init(nrfx_ecb_config_t const * p_config);
+
+/**
+ * @brief Function for uninitializing the ECB driver.
+ *
+ * The queue must be empty when this function is called.
+ */
+void nrfx_ecb_uninit(void);
+
+/**
+ * @brief Function for submitting a job.
+ *
+ * The job is appended to the queue and started at once if the peripheral is idle.
+ * The job structure and the blocks must stay valid until the job is completed.
+ * This function can be called from any context, including the job handler.
+ *
+ * @param[in] p_job Pointer to the job. The @c p_blocks, @c count, @c handler and
+ *                  @c p_context fields must be set.
+ *
+ * @retval NRFX_SUCCESS    The job was queued.
+ * @retval NRFX_ERROR_BUSY The job is already queued.
+ */
+nrfx_err_t nrfx_ecb_job_submit(nrfx_ecb_job_t * p_job);
+
+/**
+ * @brief Function for checking if a job is queued or being processed.
+ *
+ * @param[in] p_job Pointer to the job.
+ *
+ * @retval true  The job is not completed yet.
+ * @retval false The job is completed.
+ */
+bool nrfx_ecb_job_is_pending(nrfx_ecb_job_t const * p_job);
+
+/**
+ * @brief Function for encrypting a single block.
+ *
+ * The function blocks until the block is encrypted. It must not be called from an interrupt
+ * with a priority equal to or higher than the one of the ECB interrupt.
+ *
+ * @param[in]  p_key        Pointer to the AES-128 key.
+ * @param[in]  p_cleartext  Pointer to the block to encrypt.
+ * @param[out] p_ciphertext Pointer to the buffer for the encrypted block.
+ *
+ * @retval NRFX_SUCCESS        The block was encrypted.
+ * @retval NRFX_ERROR_INTERNAL The peripheral kept aborting the block.
+ */
+nrfx_err_t nrfx_ecb_encrypt(uint8_t const * p_key,
+                            uint8_t const * p_cleartext,
+                            uint8_t *       p_ciphertext);
+
+/**
+ * @brief Function for encrypting or decrypting data in the CTR mode.
+ *
+ * The keystream is generated in batches of @ref NRFX_ECB_CONFIG_BATCH_BLOCKS blocks.
+ * The counter block is incremented as a 128-bit big-endian number after each block and holds
+ * the next counter value on return, so a message can be processed in several calls as long
+ * as all but the last one process a multiple of @ref NRFX_ECB_BLOCK_SIZE bytes.
+ *
+ * The function blocks until the data is processed. It must not be called from an interrupt
+ * with a priority equal to or higher than the one of the ECB interrupt.
+ *
+ * @param[in]    p_key     Pointer to the AES-128 key.
+ * @param[inout] p_counter Pointer to the counter block.
+ * @param[in]    p_in      Pointer to the input data.
+ * @param[out]   p_out     Pointer to the output buffer. Can be the same as @p p_in.
+ * @param[in]    length    Length of the data, in bytes.
+ *
+ * @retval NRFX_SUCCESS        The data was processed.
+ * @retval NRFX_ERROR_INTERNAL The peripheral kept aborting a block.
+ */
+nrfx_err_t nrfx_ecb_ctr_crypt(uint8_t const * p_key,
+                              uint8_t *       p_counter,
+                              uint8_t const * p_in,
+                              uint8_t *       p_out,
+                              size_t          length);
+
+/**
+ * @brief Function for calculating the AES-CMAC of data.
+ *
+ * The function blocks until the MAC is calculated. It must not be called from an interrupt
+ * with a priority equal to or higher than the one of the ECB interrupt.
+ *
+ * @param[in]  p_key  Pointer to the AES-128 key.
+ * @param[in]  p_data Pointer to the data.
+ * @param[in]  length Length of the data, in bytes.
+ * @param[out] p_mac  Pointer to the buffer for the 16-byte MAC.
+ *
+ * @retval NRFX_SUCCESS        The MAC was calculated.
+ * @retval NRFX_ERROR_INTERNAL The peripheral kept aborting a block.
+ */
+nrfx_err_t nrfx_ecb_cmac(uint8_t const * p_key,
+                         uint8_t const * p_data,
+                         size_t          length,
+                         uint8_t *       p_mac);
+
+/** @} */
+
+
+void nrfx_ecb_irq_handler(void);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_ECB_H__
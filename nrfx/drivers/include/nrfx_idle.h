@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NRFX_IDLE_H__
+#define NRFX_IDLE_H__
+
+#include <nrfx.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_idle Peripheral idle manager
+ * @{
+ * @ingroup nrfx
+ * @brief   Module for disabling peripherals lazily between transfers.
+ *
+ * Drivers report the beginning and the end of every transfer. The module tracks the gaps
+ * between transfers and disables the peripheral at the end of a transfer if the gaps observed
+ * so far are long enough to make it worthwhile. The peripheral registers keep their configuration
+ * while the peripheral is disabled, so re-enabling it at the beginning of the next transfer
+ * takes a single register write.
+ */
+
+/** @brief Peripheral power states tracked by the idle manager. */
+typedef enum
+{
+    NRFX_IDLE_STATE_ACTIVE, ///< Transfer in progress.
+    NRFX_IDLE_STATE_READY,  ///< Peripheral enabled, no transfer in progress.
+    NRFX_IDLE_STATE_OFF,    ///< Peripheral disabled by the idle manager.
+    NRFX_IDLE_STATE_COUNT   ///< Number of states.
+} nrfx_idle_state_t;
+
+/**
+ * @brief Time source type.
+ *
+ * @return Current time, in arbitrary units that wrap around at 2^32.
+ */
+typedef uint32_t (*nrfx_idle_time_get_t)(void);
+
+/**
+ * @brief Type of the function that enables or disables a peripheral.
+ *
+ * @param[in] p_reg Pointer to the structure of registers of the peripheral.
+ */
+typedef void (*nrfx_idle_switch_t)(void * p_reg);
+
+/** @brief Idle manager entry for a single peripheral. */
+typedef struct
+{
+    void *             p_reg;                                /**< Peripheral registers. */
+    nrfx_idle_switch_t enable;                               /**< Function enabling the peripheral. */
+    nrfx_idle_switch_t disable;                              /**< Function disabling the peripheral. */
+    uint32_t           timestamp;                            /**< Time of the last state change. */
+    uint32_t           gap_avg;                              /**< Average gap between transfers. */
+    uint64_t           residency[NRFX_IDLE_STATE_COUNT];     /**< Total time spent in each state. */
+    nrfx_idle_state_t  state;                                /**< Current state. */
+} nrfx_idle_t;
+
+/**
+ * @brief Function for initializing the idle manager.
+ *
+ * Until this function is called, peripherals are never disabled by the idle manager.
+ *
+ * @param[in] time_get  Time source. Must not be NULL.
+ * @param[in] threshold Minimum average gap between transfers, in units of @p time_get,
+ *                      for which the peripheral is disabled after a transfer.
+ */
+void nrfx_idle_init(nrfx_idle_time_get_t time_get, uint32_t threshold);
+
+/**
+ * @brief Function for initializing the idle manager entry of a peripheral.
+ *
+ * Drivers call this function when they enable the peripheral. The entry starts
+ * in the @ref NRFX_IDLE_STATE_READY state.
+ *
+ * @param[out] p_idle  Pointer to the entry.
+ * @param[in]  p_reg   Pointer to the structure of registers of the peripheral.
+ * @param[in]  enable  Function enabling the peripheral.
+ * @param[in]  disable Function disabling the peripheral.
+ */
+void nrfx_idle_entry_init(nrfx_idle_t *      p_idle,
+                          void *             p_reg,
+                          nrfx_idle_switch_t enable,
+                          nrfx_idle_switch_t disable);
+
+/**
+ * @brief Function for reporting the beginning of a transfer.
+ *
+ * The peripheral is enabled if it was disabled by the idle manager.
+ *
+ * @param[in] p_idle Pointer to the entry.
+ */
+void nrfx_idle_active(nrfx_idle_t * p_idle);
+
+/**
+ * @brief Function for reporting the end of a transfer.
+ *
+ * @param[in] p_idle        Pointer to the entry.
+ * @param[in] allow_disable True if the peripheral can be disabled until the next transfer.
+ *                          False if it must stay enabled, for example because the next
+ *                          transfer is to be started through (D)PPI.
+ */
+void nrfx_idle_inactive(nrfx_idle_t * p_idle, bool allow_disable);
+
+/**
+ * @brief Function for getting the total time spent by a peripheral in the specified state.
+ *
+ * @param[in] p_idle Pointer to the entry.
+ * @param[in] state  State to be checked.
+ *
+ * @return Residency in the state, in units of the time source.
+ */
+uint64_t nrfx_idle_residency_get(nrfx_idle_t const * p_idle, nrfx_idle_state_t state);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_IDLE_H__
@@ -333,6 +333,13 @@ void nrfx_nfct_irq_handler(void);
  * the timing module measures the necessary waiting period after which NFCT can be activated.
  * This debouncing technique is used to filter possible field instabilities.
  *
+ * When NRFX_NFCT_CONFIG_USE_RTC is set, an instance of NRF_RTC is used for both workarounds
+ * instead of NRF_TIMER. The RTC runs from LFCLK, so the field is sampled without keeping
+ * the HFCLK-domain timer running. Each poll and each waiting period is driven by the compare
+ * event of the RTC, so the timing is quantized to 30.5 us RTC ticks: the field polls come
+ * within one tick of the 100 us period, which does not drift, and the activation delay of
+ * the anomaly 190 workaround is never shortened and is extended by less than two ticks.
+ *
  * The current code contains a patch for the anomaly 25 (NFCT: Reset value of
  * SENSRES register is incorrect), so that the module now works on Windows Phone.
  * @}
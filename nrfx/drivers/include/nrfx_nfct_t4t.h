@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NRFX_NFCT_T4T_H__
+#define NRFX_NFCT_T4T_H__
+
+#include <nrfx_nfct.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_nfct_t4t NFCT Type 4 Tag emulation
+ * @{
+ * @ingroup nrf_nfct
+ * @brief   NFC Forum Type 4 Tag emulation built on top of the NFCT driver.
+ *
+ * The module implements the ISO-DEP (ISO/IEC 14443-4) protocol and the Type 4 Tag
+ * NDEF application, and responds to the reader directly from the NFCT interrupt.
+ * The responses to RATS, NDEF application and file selection and to reading of
+ * the Capability Container are prepared when the module is initialized, and
+ * READ BINARY commands are served from the NDEF message provided by the user,
+ * so that no command waits for the application. Responses larger than the frame
+ * size accepted by the reader are sent in chained blocks.
+ *
+ * Commands that the module does not handle are passed to the user, and the frame
+ * waiting time is extended with S(WTX) requests until the user provides the response.
+ *
+ * The module uses the NFCT driver exclusively. The user is still responsible for
+ * starting HFCLK and calling @ref nrfx_nfct_state_force with @ref NRFX_NFCT_STATE_ACTIVATED
+ * when @ref NRFX_NFCT_T4T_EVT_FIELD_DETECTED is reported.
+ */
+
+/** @brief Maximum size of the NDEF message, limited by the 16-bit NLEN field of the NDEF file. */
+#define NRFX_NFCT_T4T_NDEF_SIZE_MAX 0xFFFDUL
+
+/** @brief Type 4 Tag emulation events. */
+typedef enum
+{
+    NRFX_NFCT_T4T_EVT_FIELD_DETECTED, ///< External NFC field is detected.
+    NRFX_NFCT_T4T_EVT_FIELD_LOST,     ///< External NFC field is lost.
+    NRFX_NFCT_T4T_EVT_ACTIVATED,      ///< ISO-DEP protocol was activated by the reader.
+    NRFX_NFCT_T4T_EVT_DESELECTED,     ///< ISO-DEP protocol was deactivated by the reader.
+    NRFX_NFCT_T4T_EVT_NDEF_READ,      ///< The reader read the last byte of the NDEF message.
+    NRFX_NFCT_T4T_EVT_APDU,           ///< Command not handled by the emulation. Every command must be answered with @ref nrfx_nfct_t4t_response_set.
+} nrfx_nfct_t4t_evt_id_t;
+
+/** @brief Type 4 Tag emulation event structure. */
+typedef struct
+{
+    nrfx_nfct_t4t_evt_id_t evt_id; ///< Type of event.
+    nrfx_nfct_data_desc_t  apdu;   ///< Command APDU. Filled when nrfx_nfct_t4t_evt_t.evt_id is @ref NRFX_NFCT_T4T_EVT_APDU.
+} nrfx_nfct_t4t_evt_t;
+
+/**
+ * @brief Type 4 Tag emulation event handler.
+ *
+ * @note The handler is called from the NFCT interrupt.
+ *
+ * @param[in] p_event Pointer to the event structure.
+ */
+typedef void (*nrfx_nfct_t4t_handler_t)(nrfx_nfct_t4t_evt_t const * p_event);
+
+/** @brief Type 4 Tag emulation configuration structure. */
+typedef struct
+{
+    uint8_t const *         p_ndef;    ///< NDEF message. The buffer must remain valid while the module is initialized.
+    uint16_t                ndef_size; ///< Size of the NDEF message.
+    uint8_t                 fwi;       ///< Frame waiting time integer announced to the reader. FWT = 4096 * 2^fwi / fc.
+    uint8_t                 wtxm;      ///< Frame waiting time multiplier requested while waiting for the user response. Range 1..59.
+    nrfx_nfct_t4t_handler_t handler;   ///< Event handler. Must not be NULL.
+} nrfx_nfct_t4t_config_t;
+
+/** @brief Type 4 Tag emulation default configuration. */
+#define NRFX_NFCT_T4T_DEFAULT_CONFIG(_p_ndef, _ndef_size, _handler) \
+{                                                                   \
+    .p_ndef    = _p_ndef,                                           \
+    .ndef_size = _ndef_size,                                        \
+    .fwi       = 7,                                                 \
+    .wtxm      = 1,                                                 \
+    .handler   = _handler,                                          \
+}
+
+/**
+ * @brief Function for initializing the Type 4 Tag emulation.
+ *
+ * The function initializes the NFCT driver.
+ *
+ * @param[in] p_config Pointer to the configuration structure.
+ *
+ * @retval NRFX_SUCCESS             Initialization was successful.
+ * @retval NRFX_ERROR_INVALID_STATE The module or the NFCT driver is already initialized.
+ * @retval NRFX_ERROR_INVALID_PARAM Invalid configuration.
+ */
+nrfx_err_t nrfx_nfct_t4t_init(nrfx_nfct_t4t_config_t const * p_config);
+
+/** @brief Function for uninitializing the Type 4 Tag emulation and the NFCT driver. */
+void nrfx_nfct_t4t_uninit(void);
+
+/** @brief Function for enabling the tag. The tag starts sensing the field. */
+void nrfx_nfct_t4t_enable(void);
+
+/** @brief Function for disabling the tag. */
+void nrfx_nfct_t4t_disable(void);
+
+/**
+ * @brief Function for replacing the NDEF message.
+ *
+ * The message cannot be replaced while the reader has the ISO-DEP protocol activated.
+ *
+ * @param[in] p_ndef    NDEF message. The buffer must remain valid while the module is initialized.
+ * @param[in] ndef_size Size of the NDEF message.
+ *
+ * @retval NRFX_SUCCESS             The message was replaced.
+ * @retval NRFX_ERROR_BUSY          The ISO-DEP protocol is active.
+ * @retval NRFX_ERROR_INVALID_PARAM The message is too large.
+ */
+nrfx_err_t nrfx_nfct_t4t_ndef_set(uint8_t const * p_ndef, uint16_t ndef_size);
+
+/**
+ * @brief Function for providing the response to the command reported with @ref NRFX_NFCT_T4T_EVT_APDU.
+ *
+ * The response is sent when the reader acknowledges the current frame waiting time
+ * extension. The function can be called from the event handler.
+ *
+ * @param[in] p_data Response APDU, including the status word. The buffer must remain
+ *                   valid until the next event is reported.
+ * @param[in] size   Size of the response APDU.
+ *
+ * @retval NRFX_SUCCESS             The response is scheduled.
+ * @retval NRFX_ERROR_INVALID_STATE No command is waiting for a response.
+ */
+nrfx_err_t nrfx_nfct_t4t_response_set(uint8_t const * p_data, uint16_t size);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_NFCT_T4T_H__
@@ -259,6 +259,60 @@ void nrfx_rtc_overflow_disable(nrfx_rtc_t const * p_instance);
  */
 uint32_t nrfx_rtc_max_ticks_get(nrfx_rtc_t const * p_instance);
 
+/**
+ * @brief Function for enabling the extended 64-bit counter of the RTC driver instance.
+ *
+ * This function enables the overflow event and interrupt. From this point on, the driver
+ * counts the overflows of the 24-bit hardware counter and extends it to 64 bits.
+ * The overflow event is still reported to the user handler as @ref NRFX_RTC_INT_OVERFLOW.
+ *
+ * @note Clearing the counter with @ref nrfx_rtc_counter_clear resets only the lower
+ *       24 bits of the extended counter.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ */
+void nrfx_rtc_extended_enable(nrfx_rtc_t const * p_instance);
+
+/**
+ * @brief Function for retrieving the current value of the extended 64-bit counter.
+ *
+ * The value is read consistently without disabling interrupts, so this function can be
+ * called from any context, including interrupts of priority higher than the RTC interrupt.
+ * The overflow event that is pending and not yet handled by the driver is taken into account.
+ *
+ * @note The extended counter must be enabled with @ref nrfx_rtc_extended_enable.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ *
+ * @return Value of the extended counter.
+ */
+uint64_t nrfx_rtc_extended_counter_get(nrfx_rtc_t const * p_instance);
+
+/**
+ * @brief Function for setting a compare channel to an absolute value of the extended counter.
+ *
+ * If the requested value is further in the future than @ref nrfx_rtc_max_ticks_get,
+ * the compare register is armed by the driver on a later counter overflow, when
+ * the value is within the range of the 24-bit hardware counter.
+ * Calling @ref nrfx_rtc_cc_set or @ref nrfx_rtc_cc_disable for the same channel cancels
+ * the request.
+ *
+ * @note The extended counter must be enabled with @ref nrfx_rtc_extended_enable.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ * @param[in] channel    One of the channels of the instance.
+ * @param[in] val        Absolute value of the extended counter to be compared against.
+ * @param[in] enable_irq True to enable the interrupt. False to disable the interrupt.
+ *
+ * @retval NRFX_SUCCESS       The procedure is successful.
+ * @retval NRFX_ERROR_TIMEOUT The compare is not set because the requested value is behind or too
+ *                            close to the current counter value.
+ */
+nrfx_err_t nrfx_rtc_extended_cc_set(nrfx_rtc_t const * p_instance,
+                                    uint32_t           channel,
+                                    uint64_t           val,
+                                    bool               enable_irq);
+
 /**
  * @brief Function for disabling all instance interrupts.
   *
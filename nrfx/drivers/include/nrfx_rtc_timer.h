@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NRFX_RTC_TIMER_H__
+#define NRFX_RTC_TIMER_H__
+
+#include <nrfx.h>
+#include <nrfx_rtc.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_rtc_timer RTC software timers
+ * @{
+ * @ingroup nrf_rtc
+ * @brief   Software timers multiplexed on a single compare channel of an RTC instance.
+ *
+ * Running timers are kept in a binary min-heap ordered by their deadlines. Only the earliest
+ * deadline is armed in the hardware compare channel. All timers that are due within the
+ * configured tolerance window expire in the same interrupt.
+ */
+
+/** @brief Value of the heap index of a timer that is not running. */
+#define NRFX_RTC_TIMER_IDX_INVALID UINT16_MAX
+
+/**
+ * @brief Software timer handler type.
+ *
+ * @param[in] p_context Context passed to @ref nrfx_rtc_timer_setup.
+ */
+typedef void (*nrfx_rtc_timer_handler_t)(void * p_context);
+
+/** @brief Software timer structure. */
+typedef struct
+{
+    uint64_t                 deadline;  /**< Absolute expiration time, in ticks of the extended RTC counter. */
+    uint32_t                 period;    /**< Period in ticks, or 0 for a single-shot timer. */
+    nrfx_rtc_timer_handler_t handler;   /**< Handler called when the timer expires. */
+    void *                   p_context; /**< User context passed to the handler. */
+    uint16_t                 heap_idx;  /**< Position in the heap of running timers. For internal use only. */
+} nrfx_rtc_timer_t;
+
+/** @brief Software timer service configuration structure. */
+typedef struct
+{
+    nrfx_rtc_t        rtc;        /**< RTC instance used by the service. */
+    nrfx_rtc_config_t rtc_config; /**< Configuration of the RTC instance. */
+    uint8_t           channel;    /**< Compare channel used by the service. */
+    uint32_t          tolerance;  /**< Timers due within this number of ticks from now expire together. */
+} nrfx_rtc_timer_config_t;
+
+/**
+ * @brief Function for initializing the software timer service.
+ *
+ * The service initializes the RTC instance, enables its extended counter and starts it.
+ * The RTC instance cannot be used by other modules.
+ *
+ * @param[in] p_config Pointer to the structure with the configuration.
+ *
+ * @retval NRFX_SUCCESS             Successfully initialized.
+ * @retval NRFX_ERROR_INVALID_STATE The service or the RTC instance is already initialized.
+ */
+nrfx_err_t nrfx_rtc_timer_init(nrfx_rtc_timer_config_t const * p_config);
+
+/**
+ * @brief Function for uninitializing the software timer service.
+ *
+ * All running timers are stopped.
+ */
+void nrfx_rtc_timer_uninit(void);
+
+/**
+ * @brief Function for getting the current time of the software timer service.
+ *
+ * @return Value of the extended RTC counter, in ticks.
+ */
+uint64_t nrfx_rtc_timer_now(void);
+
+/**
+ * @brief Function for setting up a software timer.
+ *
+ * This function must be called once before the timer is started for the first time.
+ *
+ * @param[out] p_timer   Pointer to the timer.
+ * @param[in]  handler   Handler called when the timer expires. Must not be NULL.
+ * @param[in]  p_context Context passed to the handler.
+ */
+void nrfx_rtc_timer_setup(nrfx_rtc_timer_t *       p_timer,
+                          nrfx_rtc_timer_handler_t handler,
+                          void *                   p_context);
+
+/**
+ * @brief Function for starting a software timer.
+ *
+ * If the timer is already running, it is restarted with the new parameters.
+ *
+ * A periodic timer is rescheduled relative to its previous deadline rather than to the moment
+ * it expired, so it does not drift. If the expiration was delayed by more than one period,
+ * the missed periods are skipped.
+ *
+ * @param[in] p_timer  Pointer to the timer.
+ * @param[in] deadline Absolute expiration time, in ticks of the extended RTC counter.
+ *                     A deadline in the past makes the timer expire as soon as possible.
+ * @param[in] period   Period in ticks, or 0 for a single-shot timer.
+ *
+ * @retval NRFX_SUCCESS      The timer is started.
+ * @retval NRFX_ERROR_NO_MEM The maximum number of running timers is reached.
+ */
+nrfx_err_t nrfx_rtc_timer_start(nrfx_rtc_timer_t * p_timer, uint64_t deadline, uint32_t period);
+
+/**
+ * @brief Function for stopping a software timer.
+ *
+ * Stopping a timer that is not running has no effect.
+ *
+ * @param[in] p_timer Pointer to the timer.
+ */
+void nrfx_rtc_timer_stop(nrfx_rtc_timer_t * p_timer);
+
+/**
+ * @brief Function for checking if a software timer is running.
+ *
+ * @param[in] p_timer Pointer to the timer.
+ *
+ * @retval true  The timer is running.
+ * @retval false The timer is not running.
+ */
+bool nrfx_rtc_timer_is_running(nrfx_rtc_timer_t const * p_timer);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_RTC_TIMER_H__
@@ -35,6 +35,9 @@
 #include <nrfx.h>
 #include <hal/nrf_spim.h>
 #include <hal/nrf_gpio.h>
+#if NRFX_CHECK(NRFX_IDLE_ENABLED)
+#include <nrfx_idle.h>
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -251,11 +254,14 @@ typedef void (* nrfx_spim_evt_handler_t)(nrfx_spim_evt_t const * p_event,
  * @param[in] p_instance Pointer to the driver instance structure.
  * @param[in] p_config   Pointer to the structure with the initial configuration.
  * @param[in] handler    Event handler provided by the user. If NULL, transfers
- *                       will be performed in blocking mode.
+ *                       will be performed in blocking mode. The blocking mode
+ *                       is available only if @ref NRFX_SPIM_BLOCKING_ENABLED is set.
  * @param[in] p_context  Context passed to event handler.
  *
  * @retval NRFX_SUCCESS             Initialization was successful.
  * @retval NRFX_ERROR_INVALID_STATE The driver was already initialized.
+ * @retval NRFX_ERROR_NOT_SUPPORTED The handler is NULL and the blocking mode
+ *                                  is disabled.
  * @retval NRFX_ERROR_BUSY          Some other peripheral with the same
  *                                  instance ID is already in use. This is
  *                                  possible only if @ref nrfx_prs module
@@ -388,6 +394,20 @@ uint32_t nrfx_spim_end_event_get(nrfx_spim_t const * p_instance);
  */
 void nrfx_spim_abort(nrfx_spim_t const * p_instance);
 
+#if NRFX_CHECK(NRFX_IDLE_ENABLED) || defined(__NRFX_DOXYGEN__)
+/**
+ * @brief Function for getting the idle manager entry of the SPIM driver instance.
+ *
+ * The entry can be used to read the residency of the peripheral in particular power states.
+ * It is reset every time the instance is initialized.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ *
+ * @return Pointer to the idle manager entry.
+ */
+nrfx_idle_t const * nrfx_spim_idle_get(nrfx_spim_t const * p_instance);
+#endif
+
 /** @} */
 
 
@@ -35,6 +35,9 @@
 #include <nrfx.h>
 #include <nrfx_twi_twim.h>
 #include <hal/nrf_twim.h>
+#if NRFX_CHECK(NRFX_IDLE_ENABLED)
+#include <nrfx_idle.h>
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -215,10 +218,14 @@ typedef void (* nrfx_twim_evt_handler_t)(nrfx_twim_evt_t const * p_event,
  * @param[in] p_instance    Pointer to the driver instance structure.
  * @param[in] p_config      Pointer to the structure with the initial configuration.
  * @param[in] event_handler Event handler provided by the user. If NULL, blocking mode is enabled.
+ *                          The blocking mode is available only if
+ *                          @ref NRFX_TWIM_BLOCKING_ENABLED is set.
  * @param[in] p_context     Context passed to event handler.
  *
  * @retval NRFX_SUCCESS             Initialization was successful.
  * @retval NRFX_ERROR_INVALID_STATE The driver is in invalid state.
+ * @retval NRFX_ERROR_NOT_SUPPORTED The handler is NULL and the blocking mode
+ *                                  is disabled.
  * @retval NRFX_ERROR_BUSY          Some other peripheral with the same
  *                                  instance ID is already in use. This is
  *                                  possible only if @ref nrfx_prs module
@@ -319,6 +326,20 @@ nrfx_err_t nrfx_twim_xfer(nrfx_twim_t           const * p_instance,
  */
 bool nrfx_twim_is_busy(nrfx_twim_t const * p_instance);
 
+#if NRFX_CHECK(NRFX_IDLE_ENABLED) || defined(__NRFX_DOXYGEN__)
+/**
+ * @brief Function for getting the idle manager entry of the TWIM driver instance.
+ *
+ * The entry can be used to read the residency of the peripheral in particular power states.
+ * It is reset every time the instance is enabled with @ref nrfx_twim_enable.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ *
+ * @return Pointer to the idle manager entry.
+ */
+nrfx_idle_t const * nrfx_twim_idle_get(nrfx_twim_t const * p_instance);
+#endif
+
 
 /**
  * @brief Function for returning the address of a TWIM start task.
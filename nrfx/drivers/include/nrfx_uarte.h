@@ -187,10 +187,13 @@ typedef void (*nrfx_uarte_event_handler_t)(nrfx_uarte_event_t const * p_event,
  * @param[in] p_instance    Pointer to the driver instance structure.
  * @param[in] p_config      Pointer to the structure with the initial configuration.
  * @param[in] event_handler Event handler provided by the user. If not provided driver works in
- *                          blocking mode.
+ *                          blocking mode, which is available only if
+ *                          @ref NRFX_UARTE_BLOCKING_ENABLED is set.
  *
  * @retval NRFX_SUCCESS             Initialization was successful.
  * @retval NRFX_ERROR_INVALID_STATE Driver is already initialized.
+ * @retval NRFX_ERROR_NOT_SUPPORTED The handler is not provided and the blocking mode
+ *                                  is disabled.
  * @retval NRFX_ERROR_BUSY          Some other peripheral with the same
  *                                  instance ID is already in use. This is
  *                                  possible only if @ref nrfx_prs module
@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NRFX_WDT_MONITOR_H__
+#define NRFX_WDT_MONITOR_H__
+
+#include <nrfx_wdt.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_wdt_monitor WDT liveness monitor
+ * @{
+ * @ingroup nrf_wdt
+ * @brief   Liveness monitor that records which task stalled before the watchdog reset.
+ *
+ * Every monitored task or interrupt gets its own WDT reload request channel and a name.
+ * Feeding a channel also stores a timestamp in a retained RAM region. When the watchdog
+ * times out, the TIMEOUT interrupt captures the channels that were not fed, the program
+ * counter of the interrupted code and a snapshot of its stack into a crash record in the
+ * same region. The record survives the watchdog reset and can be read after reboot with
+ * @ref nrfx_wdt_monitor_record_get, or dumped from RAM and decoded on a host with
+ * scripts/nrfx_wdt_record_decode.py.
+ *
+ * The exception frame of the interrupted code is found through the EXC_RETURN value that
+ * the core places in LR on the exception entry, so the WDT interrupt must be connected
+ * directly to @ref nrfx_wdt_monitor_irq_handler, without any wrapper in between. Code running
+ * on both the main and the process stack is handled. If the interrupt is connected to
+ * the WDT driver handler instead, the record is captured without the frame and the stack.
+ *
+ * @note The WDT resets the chip two 32.768 kHz clock cycles after the TIMEOUT event,
+ *       so the WDT interrupt must have the highest priority in the system to capture the record.
+ */
+
+/** @brief Maximum length of the channel name stored in the record, including the terminating null. */
+#define NRFX_WDT_MONITOR_NAME_SIZE 8
+
+/** @brief Record flag set when the exception frame of the interrupted code was not passed to the monitor. */
+#define NRFX_WDT_MONITOR_RECORD_NO_FRAME           (1UL << 0)
+
+/**
+ * @brief Record flag set when the exception frame lies outside of the stack RAM.
+ *
+ * The address of the frame is stored in nrfx_wdt_monitor_record_t.sp, but the frame and
+ * the stack are not read.
+ */
+#define NRFX_WDT_MONITOR_RECORD_FRAME_OUT_OF_RANGE (1UL << 1)
+
+/** @brief Liveness data of a single channel. */
+typedef struct
+{
+    char     name[NRFX_WDT_MONITOR_NAME_SIZE]; ///< Name of the task that feeds the channel.
+    uint32_t last_feed;                        ///< Timestamp of the last feed.
+} nrfx_wdt_monitor_channel_t;
+
+/**
+ * @brief Crash record captured in the WDT TIMEOUT interrupt.
+ *
+ * The layout is decoded by scripts/nrfx_wdt_record_decode.py. Keep both in sync.
+ */
+typedef struct
+{
+    uint32_t                   magic;        ///< Marks a captured record.
+    uint32_t                   timestamp;    ///< Time of the TIMEOUT event.
+    uint32_t                   stalled_mask; ///< Mask of channels that were not fed in the last period.
+    uint32_t                   channel_count; ///< Number of channels in use.
+    uint32_t                   pc;           ///< Program counter of the interrupted code. 0 if the frame was not captured.
+    uint32_t                   lr;           ///< Link register of the interrupted code.
+    uint32_t                   xpsr;         ///< Program status register of the interrupted code.
+    uint32_t                   sp;           ///< Stack pointer of the interrupted code, that is, the address of the exception frame.
+    uint32_t                   stack_words;  ///< Number of valid words in nrfx_wdt_monitor_record_t.stack.
+    uint32_t                   flags;        ///< Why the frame is missing, see @ref NRFX_WDT_MONITOR_RECORD_NO_FRAME.
+    uint32_t                   stack[NRFX_WDT_MONITOR_CONFIG_STACK_WORDS]; ///< Stack snapshot starting at the exception frame.
+    nrfx_wdt_monitor_channel_t channels[NRF_WDT_CHANNEL_NUMBER];          ///< Liveness data at the time of the TIMEOUT event.
+    uint32_t                   checksum;     ///< Sum of all preceding words of the record.
+} nrfx_wdt_monitor_record_t;
+
+/**
+ * @brief Retained RAM region of the monitor.
+ *
+ * The region must be placed in RAM that is not initialized on startup, and must be retained
+ * in the System OFF mode if the record is to be checked after such wake-up.
+ */
+typedef struct
+{
+    nrfx_wdt_monitor_record_t  record;                           ///< Crash record from the previous reset.
+    nrfx_wdt_monitor_channel_t channels[NRF_WDT_CHANNEL_NUMBER]; ///< Liveness data of the running system.
+} nrfx_wdt_monitor_retained_t;
+
+/**
+ * @brief Function for getting the current time.
+ *
+ * @return Current time in arbitrary units, for example RTC ticks.
+ */
+typedef uint32_t (*nrfx_wdt_monitor_time_get_t)(void);
+
+/**
+ * @brief Monitor configuration structure.
+ *
+ * The exception frame and the stack snapshot are read only within @p ram_start and @p ram_end.
+ * On Zephyr, where thread stacks are linked apart from the main stack, the whole data RAM
+ * can be given, from CONFIG_SRAM_BASE_ADDRESS to CONFIG_SRAM_BASE_ADDRESS + KB(CONFIG_SRAM_SIZE).
+ *
+ * @note If @p ram_end is 0, the initial main stack pointer from the vector table is used as
+ *       the end and @p ram_start is ignored. This suits only systems that place all stacks
+ *       below the main stack. A frame found elsewhere is flagged with
+ *       @ref NRFX_WDT_MONITOR_RECORD_FRAME_OUT_OF_RANGE.
+ */
+typedef struct
+{
+    nrfx_wdt_monitor_retained_t * p_retained; ///< Retained RAM region.
+    nrfx_wdt_monitor_time_get_t   time_get;   ///< Time source for the timestamps. Can be NULL, then timestamps are 0.
+    nrfx_wdt_event_handler_t      handler;    ///< Called from the TIMEOUT interrupt after the record is captured. Can be NULL.
+    uintptr_t                     ram_start;  ///< Start of the RAM that holds the main stack and the stacks of all threads.
+    uintptr_t                     ram_end;    ///< End of that RAM, past its last byte. 0 to use the initial main stack pointer instead, see the note below.
+} nrfx_wdt_monitor_config_t;
+
+/**
+ * @brief Function for initializing the monitor and the WDT driver instance.
+ *
+ * A valid crash record from the previous reset is preserved, the liveness data is cleared.
+ *
+ * @param[in] p_instance   Pointer to the WDT driver instance structure.
+ * @param[in] p_wdt_config Pointer to the WDT configuration.
+ * @param[in] p_config     Pointer to the monitor configuration.
+ *
+ * @retval NRFX_SUCCESS             Initialization was successful.
+ * @retval NRFX_ERROR_INVALID_STATE The monitor or the WDT driver instance was already initialized.
+ */
+nrfx_err_t nrfx_wdt_monitor_init(nrfx_wdt_t const *                p_instance,
+                                 nrfx_wdt_config_t const *         p_wdt_config,
+                                 nrfx_wdt_monitor_config_t const * p_config);
+
+/**
+ * @brief Function for allocating a WDT channel for a monitored task.
+ *
+ * @param[in]  p_name       Name of the task. Truncated to @ref NRFX_WDT_MONITOR_NAME_SIZE - 1 characters.
+ * @param[out] p_channel_id ID of the allocated channel.
+ *
+ * @retval NRFX_SUCCESS      The channel was allocated.
+ * @retval NRFX_ERROR_NO_MEM No free channels.
+ */
+nrfx_err_t nrfx_wdt_monitor_channel_alloc(char const *          p_name,
+                                          nrfx_wdt_channel_id * p_channel_id);
+
+/** @brief Function for starting the watchdog. */
+void nrfx_wdt_monitor_enable(void);
+
+/**
+ * @brief Function for feeding the channel of a monitored task.
+ *
+ * @param[in] channel_id ID of the channel.
+ */
+void nrfx_wdt_monitor_feed(nrfx_wdt_channel_id channel_id);
+
+/**
+ * @brief Function for getting the crash record captured before the last reset.
+ *
+ * @return Pointer to the record, or NULL if there is no valid record.
+ */
+nrfx_wdt_monitor_record_t const * nrfx_wdt_monitor_record_get(void);
+
+/** @brief Function for invalidating the crash record after it has been processed. */
+void nrfx_wdt_monitor_record_clear(void);
+
+/**
+ * @brief Function for handling the WDT interrupt with the exception frame of the interrupted code.
+ *
+ * The function is called by @ref nrfx_wdt_monitor_irq_handler. It can also be called from
+ * a custom exception entry, for example one written for a toolchain other than GCC.
+ *
+ * @param[in] p_frame    Exception frame, that is, the stack pointer selected by bit 2 of @p exc_return.
+ * @param[in] exc_return Value of LR on the exception entry. If it is not an EXC_RETURN value,
+ *                       @p p_frame is ignored.
+ */
+void nrfx_wdt_monitor_irq_handle(uint32_t const * p_frame, uint32_t exc_return);
+
+/** @brief WDT interrupt handler of the monitor, to be placed directly in the vector table. */
+void nrfx_wdt_monitor_irq_handler(void);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_WDT_MONITOR_H__
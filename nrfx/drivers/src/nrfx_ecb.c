@@ -0,0 +1,429 @@
+/*
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <nrfx.h>
+
+#if NRFX_CHECK(NRFX_ECB_ENABLED)
+
+#include <nrfx_ecb.h>
+#include <string.h>
+
+#define NRFX_LOG_MODULE ECB
+#include <nrfx_log.h>
+
+// Number of times a block aborted by the peripheral is restarted before its job fails.
+#define ERROR_RETRIES_MAX 3
+
+// Constant XORed into a CMAC subkey when the shifted-out bit is set (RFC 4493).
+#define CMAC_RB 0x87
+
+/** @brief ECB driver control block structure. */
+typedef struct
+{
+    nrfx_ecb_job_t * p_head;  /**< Job being processed, or NULL if the peripheral is idle. */
+    nrfx_ecb_job_t * p_tail;  /**< Last queued job. */
+    uint8_t          retries; /**< Number of restarts of the current block. */
+    nrfx_drv_state_t state;   /**< Driver state. */
+} nrfx_ecb_cb_t;
+
+static nrfx_ecb_cb_t m_cb;
+
+static void block_start(nrfx_ecb_job_t * p_job)
+{
+    nrf_ecb_data_pointer_set(NRF_ECB, &p_job->p_blocks[p_job->done]);
+    nrf_ecb_task_trigger(NRF_ECB, NRF_ECB_TASK_STARTECB);
+}
+
+static nrfx_err_t job_run(nrfx_ecb_data_t * p_blocks, size_t count)
+{
+    nrfx_ecb_job_t job =
+    {
+        .p_blocks  = p_blocks,
+        .count     = count,
+        .handler   = NULL,
+        .p_context = NULL,
+        .pending   = false,
+    };
+
+    nrfx_err_t err_code = nrfx_ecb_job_submit(&job);
+
+    NRFX_ASSERT(err_code == NRFX_SUCCESS);
+    (void)err_code;
+
+    while (job.pending)
+    {}
+
+    // The result is stored by the interrupt handler before the job stops being pending.
+    __COMPILER_BARRIER();
+    return job.result;
+}
+
+static void counter_increment(uint8_t * p_counter)
+{
+    for (size_t i = NRFX_ECB_BLOCK_SIZE; i > 0; i--)
+    {
+        if (++p_counter[i - 1] != 0)
+        {
+            break;
+        }
+    }
+}
+
+static void cmac_subkey_double(uint8_t * p_subkey)
+{
+    uint8_t msb = p_subkey[0] & 0x80;
+
+    for (size_t i = 0; i < NRFX_ECB_BLOCK_SIZE - 1; i++)
+    {
+        p_subkey[i] = (uint8_t)((p_subkey[i] << 1) | (p_subkey[i + 1] >> 7));
+    }
+    p_subkey[NRFX_ECB_BLOCK_SIZE - 1] <<= 1;
+
+    if (msb)
+    {
+        p_subkey[NRFX_ECB_BLOCK_SIZE - 1] ^= CMAC_RB;
+    }
+}
+
+nrfx_err_t nrfx_ecb_init(nrfx_ecb_config_t const * p_config)
+{
+    NRFX_ASSERT(p_config);
+
+    nrfx_err_t err_code;
+
+    if (m_cb.state != NRFX_DRV_STATE_UNINITIALIZED)
+    {
+        err_code = NRFX_ERROR_ALREADY_INITIALIZED;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    m_cb.p_head  = NULL;
+    m_cb.p_tail  = NULL;
+    m_cb.retries = 0;
+
+    nrf_ecb_event_clear(NRF_ECB, NRF_ECB_EVENT_ENDECB);
+    nrf_ecb_event_clear(NRF_ECB, NRF_ECB_EVENT_ERRORECB);
+    nrf_ecb_int_enable(NRF_ECB, NRF_ECB_INT_ENDECB_MASK | NRF_ECB_INT_ERRORECB_MASK);
+    NRFX_IRQ_PRIORITY_SET(ECB_IRQn, p_config->interrupt_priority);
+    NRFX_IRQ_ENABLE(ECB_IRQn);
+
+    m_cb.state = NRFX_DRV_STATE_INITIALIZED;
+
+    err_code = NRFX_SUCCESS;
+    NRFX_LOG_INFO("Function: %s, error code: %s.", __func__, NRFX_LOG_ERROR_STRING_GET(err_code));
+    return err_code;
+}
+
+void nrfx_ecb_uninit(void)
+{
+    NRFX_ASSERT(m_cb.state == NRFX_DRV_STATE_INITIALIZED);
+    NRFX_ASSERT(m_cb.p_head == NULL);
+
+    NRFX_IRQ_DISABLE(ECB_IRQn);
+    nrf_ecb_int_disable(NRF_ECB, NRF_ECB_INT_ENDECB_MASK | NRF_ECB_INT_ERRORECB_MASK);
+    nrf_ecb_task_trigger(NRF_ECB, NRF_ECB_TASK_STOPECB);
+
+    m_cb.state = NRFX_DRV_STATE_UNINITIALIZED;
+    NRFX_LOG_INFO("Uninitialized.");
+}
+
+nrfx_err_t nrfx_ecb_job_submit(nrfx_ecb_job_t * p_job)
+{
+    NRFX_ASSERT(m_cb.state == NRFX_DRV_STATE_INITIALIZED);
+    NRFX_ASSERT(p_job);
+    NRFX_ASSERT(p_job->p_blocks);
+    NRFX_ASSERT(p_job->count > 0);
+
+    nrfx_err_t err_code = NRFX_SUCCESS;
+
+    // Appending the job and starting the peripheral if it is idle must be one step with respect
+    // to the interrupt handler, which retires the head and starts the next job. A compare-and-swap
+    // of the tail, as nrfx_atomic_u32_cas() offers, could append to a job that was just retired
+    // and leave the new one queued with the peripheral stopped, so a short critical section is
+    // used instead.
+    NRFX_CRITICAL_SECTION_ENTER();
+
+    if (p_job->pending)
+    {
+        err_code = NRFX_ERROR_BUSY;
+    }
+    else
+    {
+        p_job->p_next  = NULL;
+        p_job->done    = 0;
+        p_job->pending = true;
+
+        if (m_cb.p_head == NULL)
+        {
+            m_cb.p_head  = p_job;
+            m_cb.retries = 0;
+            block_start(p_job);
+        }
+        else
+        {
+            m_cb.p_tail->p_next = p_job;
+        }
+        m_cb.p_tail = p_job;
+    }
+
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    return err_code;
+}
+
+bool nrfx_ecb_job_is_pending(nrfx_ecb_job_t const * p_job)
+{
+    NRFX_ASSERT(p_job);
+
+    return p_job->pending;
+}
+
+nrfx_err_t nrfx_ecb_encrypt(uint8_t const * p_key,
+                            uint8_t const * p_cleartext,
+                            uint8_t *       p_ciphertext)
+{
+    NRFX_ASSERT(p_key);
+    NRFX_ASSERT(p_cleartext);
+    NRFX_ASSERT(p_ciphertext);
+
+    nrfx_ecb_data_t data;
+    nrfx_err_t      err_code;
+
+    memcpy(data.key, p_key, NRFX_ECB_BLOCK_SIZE);
+    memcpy(data.cleartext, p_cleartext, NRFX_ECB_BLOCK_SIZE);
+
+    err_code = job_run(&data, 1);
+    if (err_code == NRFX_SUCCESS)
+    {
+        memcpy(p_ciphertext, data.ciphertext, NRFX_ECB_BLOCK_SIZE);
+    }
+
+    memset(&data, 0, sizeof(data));
+    return err_code;
+}
+
+nrfx_err_t nrfx_ecb_ctr_crypt(uint8_t const * p_key,
+                              uint8_t *       p_counter,
+                              uint8_t const * p_in,
+                              uint8_t *       p_out,
+                              size_t          length)
+{
+    NRFX_ASSERT(p_key);
+    NRFX_ASSERT(p_counter);
+    NRFX_ASSERT(p_in || (length == 0));
+    NRFX_ASSERT(p_out || (length == 0));
+
+    nrfx_ecb_data_t blocks[NRFX_ECB_CONFIG_BATCH_BLOCKS];
+    nrfx_err_t      err_code = NRFX_SUCCESS;
+
+    while (length > 0)
+    {
+        size_t count = (length + NRFX_ECB_BLOCK_SIZE - 1) / NRFX_ECB_BLOCK_SIZE;
+
+        if (count > NRFX_ECB_CONFIG_BATCH_BLOCKS)
+        {
+            count = NRFX_ECB_CONFIG_BATCH_BLOCKS;
+        }
+
+        for (size_t i = 0; i < count; i++)
+        {
+            memcpy(blocks[i].key, p_key, NRFX_ECB_BLOCK_SIZE);
+            memcpy(blocks[i].cleartext, p_counter, NRFX_ECB_BLOCK_SIZE);
+            counter_increment(p_counter);
+        }
+
+        err_code = job_run(blocks, count);
+        if (err_code != NRFX_SUCCESS)
+        {
+            break;
+        }
+
+        for (size_t i = 0; i < count; i++)
+        {
+            size_t chunk = (length < NRFX_ECB_BLOCK_SIZE) ? length : NRFX_ECB_BLOCK_SIZE;
+
+            for (size_t j = 0; j < chunk; j++)
+            {
+                p_out[j] = p_in[j] ^ blocks[i].ciphertext[j];
+            }
+            p_in   += chunk;
+            p_out  += chunk;
+            length -= chunk;
+        }
+    }
+
+    memset(blocks, 0, sizeof(blocks));
+    return err_code;
+}
+
+nrfx_err_t nrfx_ecb_cmac(uint8_t const * p_key,
+                         uint8_t const * p_data,
+                         size_t          length,
+                         uint8_t *       p_mac)
+{
+    NRFX_ASSERT(p_key);
+    NRFX_ASSERT(p_data || (length == 0));
+    NRFX_ASSERT(p_mac);
+
+    nrfx_ecb_data_t data;
+    uint8_t         subkey[NRFX_ECB_BLOCK_SIZE];
+    size_t          count  = (length + NRFX_ECB_BLOCK_SIZE - 1) / NRFX_ECB_BLOCK_SIZE;
+    bool            padded = (length == 0) || ((length % NRFX_ECB_BLOCK_SIZE) != 0);
+    nrfx_err_t      err_code;
+
+    // The subkeys are derived from the encrypted zero block.
+    memcpy(data.key, p_key, NRFX_ECB_BLOCK_SIZE);
+    memset(data.cleartext, 0, NRFX_ECB_BLOCK_SIZE);
+
+    err_code = job_run(&data, 1);
+
+    if (err_code == NRFX_SUCCESS)
+    {
+        memcpy(subkey, data.ciphertext, NRFX_ECB_BLOCK_SIZE);
+        cmac_subkey_double(subkey);
+        if (padded)
+        {
+            cmac_subkey_double(subkey);
+        }
+
+        if (count == 0)
+        {
+            count = 1;
+        }
+
+        // The chaining value starts from zero.
+        memset(data.ciphertext, 0, NRFX_ECB_BLOCK_SIZE);
+    }
+
+    for (size_t i = 0; (i < count) && (err_code == NRFX_SUCCESS); i++)
+    {
+        bool   last  = (i == count - 1);
+        size_t chunk = (length < NRFX_ECB_BLOCK_SIZE) ? length : NRFX_ECB_BLOCK_SIZE;
+
+        for (size_t j = 0; j < NRFX_ECB_BLOCK_SIZE; j++)
+        {
+            uint8_t byte = (j < chunk) ? p_data[j] : ((j == chunk) ? 0x80 : 0);
+
+            if (last)
+            {
+                byte ^= subkey[j];
+            }
+            data.cleartext[j] = data.ciphertext[j] ^ byte;
+        }
+        p_data += chunk;
+        length -= chunk;
+
+        err_code = job_run(&data, 1);
+    }
+
+    if (err_code == NRFX_SUCCESS)
+    {
+        memcpy(p_mac, data.ciphertext, NRFX_ECB_BLOCK_SIZE);
+    }
+
+    memset(&data, 0, sizeof(data));
+    memset(subkey, 0, sizeof(subkey));
+    return err_code;
+}
+
+void nrfx_ecb_irq_handler(void)
+{
+    nrfx_ecb_job_t *   p_job = m_cb.p_head;
+    nrfx_ecb_handler_t handler;
+    nrfx_err_t         result;
+
+    if (p_job == NULL)
+    {
+        nrf_ecb_event_clear(NRF_ECB, NRF_ECB_EVENT_ENDECB);
+        nrf_ecb_event_clear(NRF_ECB, NRF_ECB_EVENT_ERRORECB);
+        return;
+    }
+
+    if (nrf_ecb_event_check(NRF_ECB, NRF_ECB_EVENT_ERRORECB))
+    {
+        nrf_ecb_event_clear(NRF_ECB, NRF_ECB_EVENT_ERRORECB);
+        NRFX_LOG_DEBUG("Event: NRF_ECB_EVENT_ERRORECB.");
+
+        if (m_cb.retries < ERROR_RETRIES_MAX)
+        {
+            m_cb.retries++;
+            block_start(p_job);
+            return;
+        }
+
+        result = NRFX_ERROR_INTERNAL;
+    }
+    else if (nrf_ecb_event_check(NRF_ECB, NRF_ECB_EVENT_ENDECB))
+    {
+        nrf_ecb_event_clear(NRF_ECB, NRF_ECB_EVENT_ENDECB);
+        m_cb.retries = 0;
+
+        if (++p_job->done < p_job->count)
+        {
+            block_start(p_job);
+            return;
+        }
+
+        result = NRFX_SUCCESS;
+    }
+    else
+    {
+        return;
+    }
+
+    // Start the next job before calling the handler, so that the peripheral works meanwhile.
+    NRFX_CRITICAL_SECTION_ENTER();
+
+    m_cb.p_head  = p_job->p_next;
+    m_cb.retries = 0;
+    if (m_cb.p_head != NULL)
+    {
+        block_start(m_cb.p_head);
+    }
+
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    // The job may go out of scope as soon as it stops being pending.
+    handler       = p_job->handler;
+    p_job->result = result;
+    __COMPILER_BARRIER();
+    p_job->pending = false;
+
+    if (handler != NULL)
+    {
+        handler(p_job, result);
+    }
+}
+
+#endif // NRFX_CHECK(NRFX_ECB_ENABLED)
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <nrfx.h>
+
+#if NRFX_CHECK(NRFX_IDLE_ENABLED)
+
+#include <nrfx_idle.h>
+
+// Weight of the most recent gap in the average, as a power of two.
+#define GAP_AVG_SHIFT 2
+
+static nrfx_idle_time_get_t m_time_get;
+static uint32_t             m_threshold;
+
+static uint32_t time_get(void)
+{
+    return m_time_get ? m_time_get() : 0;
+}
+
+static void state_set(nrfx_idle_t * p_idle, nrfx_idle_state_t state, uint32_t now)
+{
+    p_idle->residency[p_idle->state] += (uint32_t)(now - p_idle->timestamp);
+    p_idle->timestamp = now;
+    p_idle->state     = state;
+}
+
+void nrfx_idle_init(nrfx_idle_time_get_t time_get, uint32_t threshold)
+{
+    NRFX_ASSERT(time_get);
+
+    m_threshold = threshold;
+    m_time_get  = time_get;
+}
+
+void nrfx_idle_entry_init(nrfx_idle_t *      p_idle,
+                          void *             p_reg,
+                          nrfx_idle_switch_t enable,
+                          nrfx_idle_switch_t disable)
+{
+    NRFX_ASSERT(p_idle);
+    NRFX_ASSERT(enable);
+    NRFX_ASSERT(disable);
+
+    p_idle->p_reg     = p_reg;
+    p_idle->enable    = enable;
+    p_idle->disable   = disable;
+    p_idle->timestamp = time_get();
+    p_idle->gap_avg   = 0;
+    p_idle->state     = NRFX_IDLE_STATE_READY;
+    for (uint32_t i = 0; i < NRFX_IDLE_STATE_COUNT; i++)
+    {
+        p_idle->residency[i] = 0;
+    }
+}
+
+void nrfx_idle_active(nrfx_idle_t * p_idle)
+{
+    if (p_idle->state == NRFX_IDLE_STATE_ACTIVE)
+    {
+        return;
+    }
+
+    if (p_idle->state == NRFX_IDLE_STATE_OFF)
+    {
+        p_idle->enable(p_idle->p_reg);
+    }
+
+    // The peripheral is disabled only at the end of a transfer, so the timestamp
+    // always marks the end of the previous transfer.
+    uint32_t now = time_get();
+    uint32_t gap = now - p_idle->timestamp;
+
+    p_idle->gap_avg = (uint32_t)((int32_t)p_idle->gap_avg +
+                                 (((int32_t)(gap - p_idle->gap_avg)) >> GAP_AVG_SHIFT));
+    state_set(p_idle, NRFX_IDLE_STATE_ACTIVE, now);
+}
+
+void nrfx_idle_inactive(nrfx_idle_t * p_idle, bool allow_disable)
+{
+    uint32_t now = time_get();
+
+    state_set(p_idle, NRFX_IDLE_STATE_READY, now);
+
+    if (allow_disable && m_time_get && (p_idle->gap_avg >= m_threshold))
+    {
+        p_idle->disable(p_idle->p_reg);
+        state_set(p_idle, NRFX_IDLE_STATE_OFF, now);
+    }
+}
+
+uint64_t nrfx_idle_residency_get(nrfx_idle_t const * p_idle, nrfx_idle_state_t state)
+{
+    NRFX_ASSERT(state < NRFX_IDLE_STATE_COUNT);
+
+    uint64_t residency = p_idle->residency[state];
+
+    if (p_idle->state == state)
+    {
+        residency += (uint32_t)(time_get() - p_idle->timestamp);
+    }
+    return residency;
+}
+
+#endif // NRFX_CHECK(NRFX_IDLE_ENABLED)
@@ -51,20 +51,35 @@
 
 #if NRFX_CHECK(USE_WORKAROUND_FOR_ANOMALY_79) || NRFX_CHECK(USE_WORKAROUND_FOR_ANOMALY_190)
 #define NFCT_WORKAROUND_USES_TIMER 1
+#if NRFX_CHECK(NRFX_NFCT_CONFIG_USE_RTC)
+#define NFCT_WORKAROUND_USES_RTC 1
+#endif
 #endif
 
 #if NRFX_CHECK(NFCT_WORKAROUND_USES_TIMER)
+#if NRFX_CHECK(NFCT_WORKAROUND_USES_RTC)
+#include <nrfx_rtc.h>
+#else
 #include <nrfx_timer.h>
+#endif
 
 typedef struct
 {
+#if NRFX_CHECK(NFCT_WORKAROUND_USES_RTC)
+    const nrfx_rtc_t   rtc;                       /**< RTC instance that supports the correct NFC field detection. */
+#else
     const nrfx_timer_t timer;                     /**< Timer instance that supports the correct NFC field detection. */
+#endif
 #if NRFX_CHECK(USE_WORKAROUND_FOR_ANOMALY_190)
     bool               fieldevents_filter_active; /**< Flag that indicates that the field events are ignored. */
     bool               is_hfclk_on;               /**< HFCLK has started - one of the NFC activation conditions. */
     bool               is_delayed;                /**< Required time delay has passed - one of the NFC activation conditions. */
 #elif NRFX_CHECK(USE_WORKAROUND_FOR_ANOMALY_79)
     uint32_t           field_state_cnt;           /**< Counter of the FIELDLOST events. */
+#if NRFX_CHECK(NFCT_WORKAROUND_USES_RTC)
+    uint32_t           poll_cc;                   /**< RTC compare value of the next field poll. */
+    uint32_t           poll_frac;                 /**< Fraction of the RTC tick carried to the next field poll, in 1/1000000 of a tick. */
+#endif // NRFX_CHECK(NFCT_WORKAROUND_USES_RTC)
 #endif // NRFX_CHECK(USE_WORKAROUND_FOR_ANOMALY_190)
 } nrfx_nfct_timer_workaround_t;
 
@@ -77,9 +92,27 @@ typedef struct
     #define NRFX_NFCT_TIMER_PERIOD       NRFX_NFCT_FIELD_TIMER_PERIOD
 #endif // NRFX_CHECK(USE_WORKAROUND_FOR_ANOMALY_190)
 
+#if NRFX_CHECK(NFCT_WORKAROUND_USES_RTC)
+    #define NRFX_NFCT_RTC_FREQUENCY      32768UL
+    /* The compare event armed at COUNTER + N comes after N - 1 to N ticks, depending on the phase
+     * of the counter. The delay is rounded up to whole ticks and extended by one tick, so that it
+     * is never shortened. It is then longer than requested by less than two ticks (61 us). */
+    #define NRFX_NFCT_RTC_DELAY          ((((NRFX_NFCT_TIMER_PERIOD * NRFX_NFCT_RTC_FREQUENCY) + \
+                                            999999UL) / 1000000UL) + 1UL)
+    /* Field polls are scheduled on a grid of NRFX_NFCT_TIMER_PERIOD kept with a fraction of a tick,
+     * so each poll comes within one tick (30.5 us) of its nominal time and the period does not
+     * drift. */
+    #define NRFX_NFCT_RTC_POLL_STEP      (NRFX_NFCT_TIMER_PERIOD * NRFX_NFCT_RTC_FREQUENCY)
+    #define NRFX_NFCT_RTC_POLL_MIN       2UL /**< Minimum distance of the compare value from COUNTER. */
+#endif // NRFX_CHECK(NFCT_WORKAROUND_USES_RTC)
+
 static nrfx_nfct_timer_workaround_t m_timer_workaround =
 {
+#if NRFX_CHECK(NFCT_WORKAROUND_USES_RTC)
+    .rtc   = NRFX_RTC_INSTANCE(NRFX_NFCT_CONFIG_RTC_INSTANCE_ID),
+#else
     .timer = NRFX_TIMER_INSTANCE(NRFX_NFCT_CONFIG_TIMER_INSTANCE_ID),
+#endif
 };
 #endif // NRFX_CHECK(NFCT_WORKAROUND_USES_TIMER)
 
@@ -171,6 +204,62 @@ static void nrfx_nfct_frame_delay_max_set(bool default_delay)
     }
 }
 
+#if NRFX_CHECK(NFCT_WORKAROUND_USES_TIMER)
+#if NRFX_CHECK(NFCT_WORKAROUND_USES_RTC) && NRFX_CHECK(USE_WORKAROUND_FOR_ANOMALY_79)
+static void nrfx_nfct_field_poll_schedule(void)
+{
+    uint32_t now = nrfx_rtc_counter_get(&m_timer_workaround.rtc);
+    uint32_t ticks;
+
+    m_timer_workaround.poll_frac += NRFX_NFCT_RTC_POLL_STEP;
+    ticks                         = m_timer_workaround.poll_frac / 1000000UL;
+    m_timer_workaround.poll_frac %= 1000000UL;
+    m_timer_workaround.poll_cc    = (m_timer_workaround.poll_cc + ticks) & RTC_COUNTER_COUNTER_Msk;
+
+    /* If the poll was handled too late to keep the grid, the grid restarts from the nearest
+     * compare value that can still be armed. */
+    if (((m_timer_workaround.poll_cc - now) & RTC_COUNTER_COUNTER_Msk) - NRFX_NFCT_RTC_POLL_MIN >
+        ticks)
+    {
+        m_timer_workaround.poll_cc = (now + NRFX_NFCT_RTC_POLL_MIN) & RTC_COUNTER_COUNTER_Msk;
+    }
+
+    (void)nrfx_rtc_cc_set(&m_timer_workaround.rtc, 0, m_timer_workaround.poll_cc, true);
+}
+#endif // NRFX_CHECK(NFCT_WORKAROUND_USES_RTC) && NRFX_CHECK(USE_WORKAROUND_FOR_ANOMALY_79)
+
+static void nrfx_nfct_field_timer_start(void)
+{
+#if NRFX_CHECK(NFCT_WORKAROUND_USES_RTC)
+    /* The RTC keeps counting, only the compare channel is armed relative to the current value. */
+    uint32_t now = nrfx_rtc_counter_get(&m_timer_workaround.rtc);
+
+#if NRFX_CHECK(USE_WORKAROUND_FOR_ANOMALY_79)
+    m_timer_workaround.poll_cc   = now;
+    m_timer_workaround.poll_frac = 0;
+    nrfx_nfct_field_poll_schedule();
+#else
+    (void)nrfx_rtc_cc_set(&m_timer_workaround.rtc,
+                          0,
+                          now + NRFX_NFCT_RTC_DELAY,
+                          true);
+#endif // NRFX_CHECK(USE_WORKAROUND_FOR_ANOMALY_79)
+#else
+    nrfx_timer_clear(&m_timer_workaround.timer);
+    nrfx_timer_enable(&m_timer_workaround.timer);
+#endif // NRFX_CHECK(NFCT_WORKAROUND_USES_RTC)
+}
+
+static void nrfx_nfct_field_timer_stop(void)
+{
+#if NRFX_CHECK(NFCT_WORKAROUND_USES_RTC)
+    (void)nrfx_rtc_cc_disable(&m_timer_workaround.rtc, 0);
+#else
+    nrfx_timer_disable(&m_timer_workaround.timer);
+#endif // NRFX_CHECK(NFCT_WORKAROUND_USES_RTC)
+}
+#endif // NRFX_CHECK(NFCT_WORKAROUND_USES_TIMER)
+
 /**@brief Function for evaluating and handling the NFC field events.
  *
  * @param[in]  field_state  Current field state.
@@ -207,11 +296,9 @@ static void nrfx_nfct_field_event_handler(volatile nrfx_nfct_field_state_t field
                 m_timer_workaround.is_delayed                = false;
                 m_timer_workaround.fieldevents_filter_active = true;
 
-                nrfx_timer_clear(&m_timer_workaround.timer);
-                nrfx_timer_enable(&m_timer_workaround.timer);
+                nrfx_nfct_field_timer_start();
 #elif NRFX_CHECK(USE_WORKAROUND_FOR_ANOMALY_79)
-                nrfx_timer_clear(&m_timer_workaround.timer);
-                nrfx_timer_enable(&m_timer_workaround.timer);
+                nrfx_nfct_field_timer_start();
                 m_timer_workaround.field_state_cnt = 0;
 #endif // NRFX_CHECK(USE_WORKAROUND_FOR_ANOMALY_190)
 #endif // NRFX_CHECK(NFCT_WORKAROUND_USES_TIMER)
@@ -266,8 +353,7 @@ static void nrfx_nfct_activate_check(void)
         is_field_validation_pending = true;
 
         // Start the timer second time to validate whether the tag has locked to the field.
-        nrfx_timer_clear(&m_timer_workaround.timer);
-        nrfx_timer_enable(&m_timer_workaround.timer);
+        nrfx_nfct_field_timer_start();
     }
 }
 #endif // NRFX_CHECK(USE_WORKAROUND_FOR_ANOMALY_190)
@@ -322,7 +408,7 @@ static void nrfx_nfct_field_poll(void)
                 .evt_id = NRFX_NFCT_EVT_FIELD_LOST,
             };
 
-            nrfx_timer_disable(&m_timer_workaround.timer);
+            nrfx_nfct_field_timer_stop();
             m_nfct_cb.field_on = false;
 
             nrfx_nfct_frame_delay_max_set(true);
@@ -341,6 +427,55 @@ static void nrfx_nfct_field_poll(void)
 }
 #endif // NRFX_CHECK(USE_WORKAROUND_FOR_ANOMALY_79)
 
+static void nrfx_nfct_field_timer_expired(void)
+{
+#if NRFX_CHECK(USE_WORKAROUND_FOR_ANOMALY_190)
+    m_timer_workaround.is_delayed = true;
+
+    nrfx_nfct_field_timer_stop();
+    nrfx_nfct_activate_check();
+#elif NRFX_CHECK(USE_WORKAROUND_FOR_ANOMALY_79)
+    nrfx_nfct_field_poll();
+#endif // NRFX_CHECK(USE_WORKAROUND_FOR_ANOMALY_190)
+}
+
+#if NRFX_CHECK(NFCT_WORKAROUND_USES_RTC)
+static void nrfx_nfct_field_rtc_handler(nrfx_rtc_int_type_t int_type)
+{
+    if (int_type != NRFX_RTC_INT_COMPARE0)
+    {
+        return;
+    }
+
+#if NRFX_CHECK(USE_WORKAROUND_FOR_ANOMALY_79)
+    /* The compare channel fires once, so it is rearmed for the next field poll. */
+    nrfx_nfct_field_poll_schedule();
+#endif // NRFX_CHECK(USE_WORKAROUND_FOR_ANOMALY_79)
+    nrfx_nfct_field_timer_expired();
+}
+
+static inline nrfx_err_t nrfx_nfct_field_timer_config(void)
+{
+    nrfx_err_t        err_code;
+    nrfx_rtc_config_t rtc_cfg =
+    {
+        .prescaler          = RTC_FREQ_TO_PRESCALER(NRFX_NFCT_RTC_FREQUENCY),
+        .interrupt_priority = NRFX_NFCT_DEFAULT_CONFIG_IRQ_PRIORITY,
+        .tick_latency       = 0,
+        .reliable           = false,
+    };
+
+    err_code = nrfx_rtc_init(&m_timer_workaround.rtc, &rtc_cfg, nrfx_nfct_field_rtc_handler);
+    if (err_code != NRFX_SUCCESS)
+    {
+        return err_code;
+    }
+
+    /* The RTC is left running, the field is sampled only while the compare channel is armed. */
+    nrfx_rtc_enable(&m_timer_workaround.rtc);
+    return err_code;
+}
+#else
 static void nrfx_nfct_field_timer_handler(nrf_timer_event_t event_type, void * p_context)
 {
     (void)p_context;
@@ -350,14 +485,7 @@ static void nrfx_nfct_field_timer_handler(nrf_timer_event_t event_type, void * p
         return;
     }
 
-#if NRFX_CHECK(USE_WORKAROUND_FOR_ANOMALY_190)
-    m_timer_workaround.is_delayed = true;
-
-    nrfx_timer_disable(&m_timer_workaround.timer);
-    nrfx_nfct_activate_check();
-#elif NRFX_CHECK(USE_WORKAROUND_FOR_ANOMALY_79)
-    nrfx_nfct_field_poll();
-#endif // NRFX_CHECK(USE_WORKAROUND_FOR_ANOMALY_190)
+    nrfx_nfct_field_timer_expired();
 }
 
 static inline nrfx_err_t nrfx_nfct_field_timer_config(void)
@@ -387,6 +515,7 @@ static inline nrfx_err_t nrfx_nfct_field_timer_config(void)
                                 true);
     return err_code;
 }
+#endif // NRFX_CHECK(NFCT_WORKAROUND_USES_RTC)
 #endif // NRFX_CHECK(NFCT_WORKAROUND_USES_TIMER)
 
 static inline
@@ -424,6 +553,10 @@ nrfx_err_t nrfx_nfct_init(nrfx_nfct_config_t const * p_config)
         return NRFX_ERROR_INVALID_STATE;
     }
 
+#if defined(SYSTEM_DEFERRED_NFCT)
+    SystemInitDeferred(SYSTEM_DEFERRED_NFCT);
+#endif
+
     m_nfct_cb.config = *p_config;
     nrfx_nfct_hw_init_setup();
 
@@ -452,7 +585,11 @@ void nrfx_nfct_uninit(void)
 
 #if NRFX_CHECK(NFCT_WORKAROUND_USES_TIMER)
     /* De-initialize Timer module as the workaround for NFCT HW issues. */
+#if NRFX_CHECK(NFCT_WORKAROUND_USES_RTC)
+    nrfx_rtc_uninit(&m_timer_workaround.rtc);
+#else
     nrfx_timer_uninit(&m_timer_workaround.timer);
+#endif // NRFX_CHECK(NFCT_WORKAROUND_USES_RTC)
 #endif // NRFX_CHECK(NFCT_WORKAROUND_USES_TIMER)
 
     m_nfct_cb.state = NRFX_DRV_STATE_UNINITIALIZED;
@@ -0,0 +1,828 @@
+/*
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <nrfx.h>
+
+#if NRFX_CHECK(NRFX_NFCT_T4T_ENABLED)
+
+#include <nrfx_nfct_t4t.h>
+#include <string.h>
+
+#define NRFX_LOG_MODULE NFCT_T4T
+#include <nrfx_log.h>
+
+#if !NRFX_CHECK(NRFX_NFCT_ENABLED)
+#error "NFCT driver must be enabled to use the Type 4 Tag emulation."
+#endif
+
+#if (NRFX_NFCT_T4T_CONFIG_FRAME_SIZE < 16) || (NRFX_NFCT_T4T_CONFIG_FRAME_SIZE > 256)
+#error "NRFX_NFCT_T4T_CONFIG_FRAME_SIZE must be in the range 16..256."
+#endif
+
+#if NRFX_NFCT_T4T_CONFIG_APDU_SIZE < 20
+#error "NRFX_NFCT_T4T_CONFIG_APDU_SIZE must be at least 20."
+#endif
+
+#define T4T_MIN(a, b)      (((a) < (b)) ? (a) : (b))
+
+#define T4T_CRC_SIZE       2u    // Size of the CRC, added and removed by the peripheral.
+#define T4T_SW_SIZE        2u    // Size of the status word.
+#define T4T_NLEN_SIZE      2u    // Size of the NLEN field preceding the NDEF message in the NDEF file.
+#define T4T_MLE            0xFFu // Maximum R-APDU data size announced in the CC file.
+#define T4T_FWI_MAX        14u   // Maximum frame waiting time integer.
+#define T4T_WTXM_MAX       59u   // Maximum frame waiting time multiplier.
+
+// Layer 3 and 4 commands.
+#define T4T_RATS           0xE0u
+#define T4T_HLTA           0x50u
+#define T4T_RATS_CID_MASK  0x0Fu
+#define T4T_RATS_CID_RFU   0x0Fu
+
+// ISO-DEP protocol control byte.
+#define PCB_BN             0x01u
+#define PCB_NAD            0x04u
+#define PCB_CID            0x08u
+#define PCB_CHAINING       0x10u
+#define PCB_R_NAK          0x10u
+#define PCB_I_MASK         0xE2u
+#define PCB_I              0x02u
+#define PCB_R_MASK         0xE6u
+#define PCB_R              0xA2u
+#define PCB_S_MASK         0xC7u
+#define PCB_S              0xC2u
+#define PCB_S_TYPE_MASK    0x30u
+#define PCB_S_DESELECT     0x00u
+#define PCB_S_WTX          0x30u
+#define PCB_WTXM_MASK      0x3Fu
+
+// APDU fields.
+#define APDU_CLA           0
+#define APDU_INS           1
+#define APDU_P1            2
+#define APDU_P2            3
+#define APDU_LC            4
+#define APDU_DATA          5
+#define APDU_HEADER_SIZE   4u
+
+#define INS_SELECT         0xA4u
+#define INS_READ_BINARY    0xB0u
+#define INS_UPDATE_BINARY  0xD6u
+#define SELECT_BY_NAME     0x04u
+#define SELECT_BY_ID       0x00u
+
+#define SW_OK              0x9000u
+#define SW_WRONG_LENGTH    0x6700u
+#define SW_NOT_ALLOWED     0x6982u
+#define SW_NOT_FOUND       0x6A82u
+#define SW_WRONG_P1P2      0x6A86u
+#define SW_WRONG_PARAMS    0x6B00u
+#define SW_INS_UNKNOWN     0x6D00u
+#define SW_CLA_UNKNOWN     0x6E00u
+
+#define CLA_INTERINDUSTRY  0x00u
+#define SELECT_FIRST       0x00u
+
+#define FILE_ID_CC         0xE103u
+#define FILE_ID_NDEF       0xE104u
+#define CC_SIZE            15u
+
+/** @brief Source of the response data. */
+typedef enum
+{
+    T4T_FILE_NONE, ///< Status word only.
+    T4T_FILE_CC,   ///< Capability Container.
+    T4T_FILE_NDEF, ///< NDEF file, that is, NLEN followed by the NDEF message.
+    T4T_FILE_USER, ///< Response provided by the user, including the status word.
+} t4t_file_t;
+
+/** @brief Response APDU descriptor. The response is sent as data slice followed by status word. */
+typedef struct
+{
+    uint8_t const * p_user; ///< User response. Used with @ref T4T_FILE_USER.
+    uint16_t        offset; ///< Offset of the data in the file.
+    uint16_t        size;   ///< Total size of the response, including the status word.
+    uint16_t        pos;    ///< Position of the first byte of the last sent block.
+    uint16_t        chunk;  ///< Size of the last sent block.
+    uint8_t         sw[T4T_SW_SIZE];
+    t4t_file_t      file;
+} t4t_response_t;
+
+/** @brief Control block of the Type 4 Tag emulation. */
+typedef struct
+{
+    nrfx_nfct_t4t_config_t     config;
+    t4t_response_t             resp;
+    uint8_t const * volatile   p_user_resp;
+    volatile uint16_t          user_resp_size;
+    volatile bool              apdu_pending;
+    bool                       active;
+    bool                       chaining;
+    bool                       deselecting;
+    bool                       app_selected;
+    t4t_file_t                 selected_file;
+    uint8_t                    bn;
+    uint16_t                   tx_max;
+    uint16_t                   apdu_size;
+    bool                       apdu_overflow;
+    uint16_t                   tx_size;
+    uint8_t                    ats[5];
+    uint8_t                    cc[CC_SIZE];
+    nrfx_drv_state_t           state;
+} t4t_cb_t;
+
+static t4t_cb_t m_cb;
+
+static uint8_t m_rx_buf[NRFX_NFCT_T4T_CONFIG_FRAME_SIZE];
+static uint8_t m_tx_buf[NRFX_NFCT_T4T_CONFIG_FRAME_SIZE];
+static uint8_t m_apdu_buf[NRFX_NFCT_T4T_CONFIG_APDU_SIZE];
+
+static const uint8_t m_ndef_aid[] = {0xD2, 0x76, 0x00, 0x00, 0x85, 0x01, 0x01};
+
+// Frame sizes indexed by FSDI and FSCI.
+static const uint16_t m_frame_sizes[] = {16, 24, 32, 40, 48, 64, 96, 128, 256};
+
+static void event_send(nrfx_nfct_t4t_evt_id_t evt_id)
+{
+    nrfx_nfct_t4t_evt_t evt =
+    {
+        .evt_id = evt_id,
+    };
+    m_cb.config.handler(&evt);
+}
+
+static void rx_start(void)
+{
+    nrfx_nfct_data_desc_t rx =
+    {
+        .data_size = sizeof(m_rx_buf),
+        .p_data    = m_rx_buf,
+    };
+    nrfx_nfct_rx(&rx);
+}
+
+static void tx_start(uint16_t size)
+{
+    nrfx_nfct_data_desc_t tx =
+    {
+        .data_size = size,
+        .p_data    = m_tx_buf,
+    };
+
+    m_cb.tx_size = size;
+    (void)nrfx_nfct_tx(&tx, NRF_NFCT_FRAME_DELAY_MODE_WINDOWGRID);
+}
+
+static void cc_build(void)
+{
+    uint16_t mlc      = T4T_MIN(0xFFu, NRFX_NFCT_T4T_CONFIG_APDU_SIZE - APDU_DATA);
+    uint16_t file_max = (uint16_t)(m_cb.config.ndef_size + T4T_NLEN_SIZE);
+    uint8_t  cc[CC_SIZE] =
+    {
+        0x00, CC_SIZE,                                  // CCLEN
+        0x20,                                           // Mapping version 2.0
+        0x00, T4T_MLE,                                  // MLe
+        (uint8_t)(mlc >> 8), (uint8_t)mlc,              // MLc
+        0x04, 0x06,                                     // NDEF File Control TLV
+        (uint8_t)(FILE_ID_NDEF >> 8), (uint8_t)FILE_ID_NDEF,
+        (uint8_t)(file_max >> 8), (uint8_t)file_max,
+        0x00,                                           // Read access granted
+        0xFF,                                           // No write access
+    };
+
+    memcpy(m_cb.cc, cc, sizeof(cc));
+}
+
+static uint16_t file_size_get(t4t_file_t file)
+{
+    switch (file)
+    {
+        case T4T_FILE_CC:
+            return CC_SIZE;
+        case T4T_FILE_NDEF:
+            return (uint16_t)(m_cb.config.ndef_size + T4T_NLEN_SIZE);
+        default:
+            return 0;
+    }
+}
+
+/* Copies part of the file. The NDEF file is not stored in memory as a whole,
+ * its NLEN field is generated from the NDEF message size. */
+static void file_copy(uint8_t * p_dst, t4t_file_t file, uint16_t offset, uint16_t size)
+{
+    if (file == T4T_FILE_CC)
+    {
+        memcpy(p_dst, &m_cb.cc[offset], size);
+        return;
+    }
+
+    while ((offset < T4T_NLEN_SIZE) && size)
+    {
+        *p_dst++ = (offset == 0) ? (uint8_t)(m_cb.config.ndef_size >> 8) :
+                                   (uint8_t)m_cb.config.ndef_size;
+        offset++;
+        size--;
+    }
+    memcpy(p_dst, &m_cb.config.p_ndef[offset - T4T_NLEN_SIZE], size);
+}
+
+/* Copies part of the response APDU, that is, the data followed by the status word. */
+static void response_copy(uint8_t * p_dst, uint16_t pos, uint16_t size)
+{
+    t4t_response_t const * p_resp = &m_cb.resp;
+
+    if (p_resp->file == T4T_FILE_USER)
+    {
+        memcpy(p_dst, &p_resp->p_user[pos], size);
+        return;
+    }
+
+    uint16_t data_size = (uint16_t)(p_resp->size - T4T_SW_SIZE);
+
+    if (pos < data_size)
+    {
+        uint16_t part = T4T_MIN(size, (uint16_t)(data_size - pos));
+
+        file_copy(p_dst, p_resp->file, (uint16_t)(p_resp->offset + pos), part);
+        p_dst += part;
+        pos   += part;
+        size  -= part;
+    }
+    memcpy(p_dst, &p_resp->sw[pos - data_size], size);
+}
+
+/* Sends the I-block with the response data starting at the given position. */
+static void response_block_send(uint16_t pos)
+{
+    uint16_t chunk = T4T_MIN((uint16_t)(m_cb.tx_max - 1), (uint16_t)(m_cb.resp.size - pos));
+    bool     last  = (pos + chunk) == m_cb.resp.size;
+
+    m_tx_buf[0] = (uint8_t)(PCB_I | m_cb.bn | (last ? 0 : PCB_CHAINING));
+    response_copy(&m_tx_buf[1], pos, chunk);
+
+    m_cb.resp.pos   = pos;
+    m_cb.resp.chunk = chunk;
+    m_cb.chaining   = !last;
+    tx_start((uint16_t)(chunk + 1));
+}
+
+static void response_sw_set(t4t_file_t file, uint16_t offset, uint16_t size, uint16_t sw)
+{
+    m_cb.resp.file   = file;
+    m_cb.resp.offset = offset;
+    m_cb.resp.size   = (uint16_t)(size + T4T_SW_SIZE);
+    m_cb.resp.sw[0]  = (uint8_t)(sw >> 8);
+    m_cb.resp.sw[1]  = (uint8_t)sw;
+}
+
+static void wtx_send(void)
+{
+    m_tx_buf[0] = PCB_S | PCB_S_WTX;
+    m_tx_buf[1] = m_cb.config.wtxm;
+    tx_start(2);
+}
+
+/* Sends the user response if it is already provided, or extends the frame waiting time otherwise. */
+static void user_response_send(void)
+{
+    if (m_cb.p_user_resp == NULL)
+    {
+        wtx_send();
+        return;
+    }
+
+    m_cb.resp.file   = T4T_FILE_USER;
+    m_cb.resp.p_user = m_cb.p_user_resp;
+    m_cb.resp.size   = m_cb.user_resp_size;
+    m_cb.p_user_resp = NULL;
+    m_cb.apdu_pending = false;
+    response_block_send(0);
+}
+
+static bool select_handle(uint8_t const * p_apdu, uint16_t size)
+{
+    uint8_t lc = (size > APDU_LC) ? p_apdu[APDU_LC] : 0;
+
+    // The command data is followed by at most the Le byte.
+    if ((size < (uint16_t)(APDU_DATA + lc)) || (size > (uint16_t)(APDU_DATA + lc + 1)))
+    {
+        response_sw_set(T4T_FILE_NONE, 0, 0, SW_WRONG_LENGTH);
+        return true;
+    }
+
+    if (p_apdu[APDU_P1] == SELECT_BY_NAME)
+    {
+        if ((lc == sizeof(m_ndef_aid)) &&
+            (memcmp(&p_apdu[APDU_DATA], m_ndef_aid, sizeof(m_ndef_aid)) == 0))
+        {
+            // Only the first or only occurrence of the application can be selected.
+            if (p_apdu[APDU_P2] != SELECT_FIRST)
+            {
+                response_sw_set(T4T_FILE_NONE, 0, 0, SW_WRONG_P1P2);
+                return true;
+            }
+            m_cb.app_selected  = true;
+            m_cb.selected_file = T4T_FILE_NONE;
+            response_sw_set(T4T_FILE_NONE, 0, 0, SW_OK);
+            return true;
+        }
+
+        // Other applications are handled by the user.
+        m_cb.app_selected = false;
+        return false;
+    }
+
+    if (!m_cb.app_selected)
+    {
+        return false;
+    }
+
+    if ((p_apdu[APDU_P1] != SELECT_BY_ID) || (lc != 2))
+    {
+        response_sw_set(T4T_FILE_NONE, 0, 0, SW_NOT_FOUND);
+        return true;
+    }
+
+    uint16_t file_id = (uint16_t)((p_apdu[APDU_DATA] << 8) | p_apdu[APDU_DATA + 1]);
+
+    switch (file_id)
+    {
+        case FILE_ID_CC:
+            m_cb.selected_file = T4T_FILE_CC;
+            break;
+        case FILE_ID_NDEF:
+            m_cb.selected_file = T4T_FILE_NDEF;
+            break;
+        default:
+            response_sw_set(T4T_FILE_NONE, 0, 0, SW_NOT_FOUND);
+            return true;
+    }
+    response_sw_set(T4T_FILE_NONE, 0, 0, SW_OK);
+    return true;
+}
+
+static void read_binary_handle(uint8_t const * p_apdu, uint16_t size)
+{
+    if (m_cb.selected_file == T4T_FILE_NONE)
+    {
+        response_sw_set(T4T_FILE_NONE, 0, 0, SW_NOT_FOUND);
+        return;
+    }
+    if (size != (APDU_HEADER_SIZE + 1))
+    {
+        response_sw_set(T4T_FILE_NONE, 0, 0, SW_WRONG_LENGTH);
+        return;
+    }
+
+    uint16_t offset    = (uint16_t)((p_apdu[APDU_P1] << 8) | p_apdu[APDU_P2]);
+    uint16_t le        = p_apdu[APDU_LC] ? p_apdu[APDU_LC] : T4T_MLE;
+    uint16_t file_size = file_size_get(m_cb.selected_file);
+
+    if ((offset & 0x8000u) || (offset > file_size))
+    {
+        response_sw_set(T4T_FILE_NONE, 0, 0, SW_WRONG_PARAMS);
+        return;
+    }
+
+    le = T4T_MIN(le, (uint16_t)(file_size - offset));
+    response_sw_set(m_cb.selected_file, offset, le, SW_OK);
+
+    if ((m_cb.selected_file == T4T_FILE_NDEF) && le && ((offset + le) == file_size))
+    {
+        event_send(NRFX_NFCT_T4T_EVT_NDEF_READ);
+    }
+}
+
+/* Handles the complete command APDU. Returns false if the command is passed to the user. */
+static bool apdu_handle(uint8_t const * p_apdu, uint16_t size)
+{
+    if (size < APDU_HEADER_SIZE)
+    {
+        response_sw_set(T4T_FILE_NONE, 0, 0, SW_WRONG_LENGTH);
+        return true;
+    }
+
+    if (p_apdu[APDU_INS] == INS_SELECT)
+    {
+        return select_handle(p_apdu, size);
+    }
+    if (!m_cb.app_selected)
+    {
+        return false;
+    }
+    if (p_apdu[APDU_CLA] != CLA_INTERINDUSTRY)
+    {
+        response_sw_set(T4T_FILE_NONE, 0, 0, SW_CLA_UNKNOWN);
+        return true;
+    }
+
+    switch (p_apdu[APDU_INS])
+    {
+        case INS_READ_BINARY:
+            read_binary_handle(p_apdu, size);
+            break;
+        case INS_UPDATE_BINARY:
+            response_sw_set(T4T_FILE_NONE, 0, 0, SW_NOT_ALLOWED);
+            break;
+        default:
+            response_sw_set(T4T_FILE_NONE, 0, 0, SW_INS_UNKNOWN);
+            break;
+    }
+    return true;
+}
+
+static void i_block_handle(uint8_t pcb, uint8_t const * p_inf, uint16_t inf_size)
+{
+    // Rule D: toggle the block number on every received I-block.
+    m_cb.bn ^= PCB_BN;
+    m_cb.chaining = false;
+
+    if (m_cb.apdu_size + inf_size > sizeof(m_apdu_buf))
+    {
+        m_cb.apdu_overflow = true;
+    }
+    else
+    {
+        memcpy(&m_apdu_buf[m_cb.apdu_size], p_inf, inf_size);
+        m_cb.apdu_size = (uint16_t)(m_cb.apdu_size + inf_size);
+    }
+
+    if (pcb & PCB_CHAINING)
+    {
+        m_tx_buf[0] = (uint8_t)(PCB_R | m_cb.bn);
+        tx_start(1);
+        return;
+    }
+
+    uint16_t apdu_size = m_cb.apdu_size;
+
+    m_cb.apdu_size = 0;
+    if (m_cb.apdu_overflow)
+    {
+        m_cb.apdu_overflow = false;
+        response_sw_set(T4T_FILE_NONE, 0, 0, SW_WRONG_LENGTH);
+    }
+    else if (!apdu_handle(m_apdu_buf, apdu_size))
+    {
+        nrfx_nfct_t4t_evt_t evt =
+        {
+            .evt_id = NRFX_NFCT_T4T_EVT_APDU,
+            .apdu   =
+            {
+                .data_size = apdu_size,
+                .p_data    = m_apdu_buf,
+            },
+        };
+
+        m_cb.apdu_pending = true;
+        m_cb.config.handler(&evt);
+        user_response_send();
+        return;
+    }
+    response_block_send(0);
+}
+
+static void r_block_handle(uint8_t pcb)
+{
+    if ((pcb & PCB_BN) == m_cb.bn)
+    {
+        // Rule 11: retransmit the last block.
+        tx_start(m_cb.tx_size);
+        return;
+    }
+
+    if (pcb & PCB_R_NAK)
+    {
+        // Rule 12.
+        m_tx_buf[0] = (uint8_t)(PCB_R | m_cb.bn);
+        tx_start(1);
+    }
+    else if (m_cb.chaining)
+    {
+        // Rule E and 13: continue chaining with the next block.
+        m_cb.bn ^= PCB_BN;
+        response_block_send((uint16_t)(m_cb.resp.pos + m_cb.resp.chunk));
+    }
+    else
+    {
+        rx_start();
+    }
+}
+
+static void s_block_handle(uint8_t pcb)
+{
+    switch (pcb & PCB_S_TYPE_MASK)
+    {
+        case PCB_S_DESELECT:
+            m_cb.deselecting = true;
+            m_tx_buf[0]      = pcb;
+            tx_start(1);
+            break;
+
+        case PCB_S_WTX:
+            if (m_cb.apdu_pending)
+            {
+                user_response_send();
+                break;
+            }
+            // fall through
+
+        default:
+            rx_start();
+            break;
+    }
+}
+
+static void activation_handle(uint8_t const * p_frame, uint16_t size)
+{
+    if ((size == 2) && (p_frame[0] == T4T_HLTA) && (p_frame[1] == 0x00))
+    {
+        nrfx_nfct_init_substate_force(NRFX_NFCT_ACTIVE_STATE_SLEEP);
+        return;
+    }
+    // CID 15 is RFU, so such RATS is not answered.
+    if ((size != 2) || (p_frame[0] != T4T_RATS) ||
+        ((p_frame[1] & T4T_RATS_CID_MASK) == T4T_RATS_CID_RFU))
+    {
+        rx_start();
+        return;
+    }
+
+    uint8_t fsdi = p_frame[1] >> 4;
+    uint16_t fsd = m_frame_sizes[T4T_MIN(fsdi, (uint8_t)(NRFX_ARRAY_SIZE(m_frame_sizes) - 1))];
+
+    m_cb.tx_max        = (uint16_t)(T4T_MIN(fsd, (uint16_t)sizeof(m_tx_buf)) - T4T_CRC_SIZE);
+    m_cb.bn            = PCB_BN;
+    m_cb.chaining      = false;
+    m_cb.deselecting   = false;
+    m_cb.app_selected  = false;
+    m_cb.selected_file = T4T_FILE_NONE;
+    m_cb.apdu_size     = 0;
+    m_cb.apdu_overflow = false;
+    m_cb.apdu_pending  = false;
+    m_cb.p_user_resp   = NULL;
+    m_cb.active        = true;
+
+    memcpy(m_tx_buf, m_cb.ats, sizeof(m_cb.ats));
+    tx_start(sizeof(m_cb.ats));
+
+    event_send(NRFX_NFCT_T4T_EVT_ACTIVATED);
+}
+
+static void frame_handle(nrfx_nfct_evt_rx_frameend_t const * p_rx)
+{
+    uint8_t const * p_frame = p_rx->rx_data.p_data;
+    uint16_t        size    = (uint16_t)p_rx->rx_data.data_size;
+
+    // Erroneous frames are ignored, the reader recovers by sending R(NAK).
+    if (p_rx->rx_status || (size == 0))
+    {
+        rx_start();
+        return;
+    }
+
+    if (!m_cb.active)
+    {
+        activation_handle(p_frame, size);
+        return;
+    }
+
+    uint8_t pcb = p_frame[0];
+
+    if (pcb & (PCB_CID | PCB_NAD))
+    {
+        // Neither CID nor NAD is announced in ATS.
+        rx_start();
+    }
+    else if ((pcb & PCB_I_MASK) == PCB_I)
+    {
+        i_block_handle(pcb, &p_frame[1], (uint16_t)(size - 1));
+    }
+    else if ((pcb & PCB_R_MASK) == PCB_R)
+    {
+        r_block_handle(pcb);
+    }
+    else if ((pcb & PCB_S_MASK) == PCB_S)
+    {
+        s_block_handle(pcb);
+    }
+    else
+    {
+        rx_start();
+    }
+}
+
+static void nfct_handler(nrfx_nfct_evt_t const * p_event)
+{
+    switch (p_event->evt_id)
+    {
+        case NRFX_NFCT_EVT_FIELD_DETECTED:
+            event_send(NRFX_NFCT_T4T_EVT_FIELD_DETECTED);
+            break;
+
+        case NRFX_NFCT_EVT_FIELD_LOST:
+            m_cb.active       = false;
+            m_cb.apdu_pending = false;
+            event_send(NRFX_NFCT_T4T_EVT_FIELD_LOST);
+            break;
+
+        case NRFX_NFCT_EVT_SELECTED:
+            m_cb.active = false;
+            rx_start();
+            break;
+
+        case NRFX_NFCT_EVT_RX_FRAMEEND:
+            frame_handle(&p_event->params.rx_frameend);
+            break;
+
+        case NRFX_NFCT_EVT_TX_FRAMEEND:
+            if (m_cb.deselecting)
+            {
+                m_cb.deselecting  = false;
+                m_cb.active       = false;
+                m_cb.apdu_pending = false;
+                nrfx_nfct_init_substate_force(NRFX_NFCT_ACTIVE_STATE_SLEEP);
+                event_send(NRFX_NFCT_T4T_EVT_DESELECTED);
+            }
+            else
+            {
+                rx_start();
+            }
+            break;
+
+        case NRFX_NFCT_EVT_ERROR:
+            // Response was not sent within the frame delay, wait for the reader to retry.
+            rx_start();
+            break;
+
+        default:
+            break;
+    }
+}
+
+nrfx_err_t nrfx_nfct_t4t_init(nrfx_nfct_t4t_config_t const * p_config)
+{
+    NRFX_ASSERT(p_config);
+    NRFX_ASSERT(p_config->handler);
+
+    nrfx_err_t err_code;
+
+    if (m_cb.state != NRFX_DRV_STATE_UNINITIALIZED)
+    {
+        err_code = NRFX_ERROR_INVALID_STATE;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    if ((p_config->fwi > T4T_FWI_MAX) ||
+        (p_config->wtxm == 0) || (p_config->wtxm > T4T_WTXM_MAX) ||
+        (p_config->ndef_size > NRFX_NFCT_T4T_NDEF_SIZE_MAX) ||
+        (p_config->ndef_size && !p_config->p_ndef))
+    {
+        err_code = NRFX_ERROR_INVALID_PARAM;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    nrfx_nfct_config_t nfct_config =
+    {
+        .rxtx_int_mask = NRFX_NFCT_EVT_RX_FRAMEEND |
+                         NRFX_NFCT_EVT_TX_FRAMEEND |
+                         NRF_NFCT_INT_RXERROR_MASK,
+        .cb            = nfct_handler,
+    };
+
+    err_code = nrfx_nfct_init(&nfct_config);
+    if (err_code != NRFX_SUCCESS)
+    {
+        return err_code;
+    }
+
+    nrfx_nfct_param_t param =
+    {
+        .id   = NRFX_NFCT_PARAM_ID_SEL_RES,
+        .data = { .sel_res_protocol = NRF_NFCT_SELRES_PROTOCOL_T4AT },
+    };
+    (void)nrfx_nfct_parameter_set(&param);
+
+    // The frame delay is limited by the peripheral, so long waiting times rely on S(WTX).
+    param.id       = NRFX_NFCT_PARAM_ID_FDT;
+    param.data.fdt = 4096UL << p_config->fwi;
+    (void)nrfx_nfct_parameter_set(&param);
+
+    uint8_t fsci = 0;
+    while (((fsci + 1u) < NRFX_ARRAY_SIZE(m_frame_sizes)) &&
+           (m_frame_sizes[fsci + 1] <= NRFX_NFCT_T4T_CONFIG_FRAME_SIZE))
+    {
+        fsci++;
+    }
+
+    m_cb.config = *p_config;
+    m_cb.active = false;
+    m_cb.ats[0] = sizeof(m_cb.ats);         // TL
+    m_cb.ats[1] = (uint8_t)(0x70u | fsci);  // T0: TA(1), TB(1) and TC(1) present
+    m_cb.ats[2] = 0x00;                     // TA(1): 106 kbit/s only
+    m_cb.ats[3] = (uint8_t)(p_config->fwi << 4);
+    m_cb.ats[4] = 0x00;                     // TC(1): no NAD and CID
+    cc_build();
+
+    m_cb.state = NRFX_DRV_STATE_INITIALIZED;
+
+    NRFX_LOG_INFO("Initialized.");
+    return NRFX_SUCCESS;
+}
+
+void nrfx_nfct_t4t_uninit(void)
+{
+    NRFX_ASSERT(m_cb.state != NRFX_DRV_STATE_UNINITIALIZED);
+
+    nrfx_nfct_uninit();
+    m_cb.state = NRFX_DRV_STATE_UNINITIALIZED;
+
+    NRFX_LOG_INFO("Uninitialized.");
+}
+
+void nrfx_nfct_t4t_enable(void)
+{
+    NRFX_ASSERT(m_cb.state == NRFX_DRV_STATE_INITIALIZED);
+
+    nrfx_nfct_enable();
+    m_cb.state = NRFX_DRV_STATE_POWERED_ON;
+}
+
+void nrfx_nfct_t4t_disable(void)
+{
+    NRFX_ASSERT(m_cb.state == NRFX_DRV_STATE_POWERED_ON);
+
+    nrfx_nfct_disable();
+    m_cb.active = false;
+    m_cb.state  = NRFX_DRV_STATE_INITIALIZED;
+}
+
+nrfx_err_t nrfx_nfct_t4t_ndef_set(uint8_t const * p_ndef, uint16_t ndef_size)
+{
+    NRFX_ASSERT(m_cb.state != NRFX_DRV_STATE_UNINITIALIZED);
+
+    if ((ndef_size > NRFX_NFCT_T4T_NDEF_SIZE_MAX) || (ndef_size && !p_ndef))
+    {
+        return NRFX_ERROR_INVALID_PARAM;
+    }
+    if (m_cb.active)
+    {
+        return NRFX_ERROR_BUSY;
+    }
+
+    m_cb.config.p_ndef    = p_ndef;
+    m_cb.config.ndef_size = ndef_size;
+    cc_build();
+    return NRFX_SUCCESS;
+}
+
+nrfx_err_t nrfx_nfct_t4t_response_set(uint8_t const * p_data, uint16_t size)
+{
+    NRFX_ASSERT(p_data);
+    NRFX_ASSERT(size >= T4T_SW_SIZE);
+
+    if (!m_cb.apdu_pending || m_cb.p_user_resp)
+    {
+        return NRFX_ERROR_INVALID_STATE;
+    }
+
+    // The size is stored first, the pointer marks the response as ready for the interrupt.
+    m_cb.user_resp_size = size;
+    m_cb.p_user_resp    = p_data;
+    return NRFX_SUCCESS;
+}
+
+#endif // NRFX_CHECK(NRFX_NFCT_T4T_ENABLED)
@@ -130,6 +130,10 @@ nrfx_err_t nrfx_qspi_init(nrfx_qspi_config_t const * p_config,
         return NRFX_ERROR_INVALID_PARAM;
     }
 
+#if defined(SYSTEM_DEFERRED_QSPI)
+    SystemInitDeferred(SYSTEM_DEFERRED_QSPI);
+#endif
+
     nrf_qspi_xip_offset_set(NRF_QSPI, p_config->xip_offset);
     nrf_qspi_ifconfig0_set(NRF_QSPI, &p_config->prot_if);
     nrf_qspi_ifconfig1_set(NRF_QSPI, &p_config->phy_if);
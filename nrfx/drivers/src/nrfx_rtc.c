@@ -53,18 +53,106 @@
                                         "UNKNOWN EVENT"))))))
 
 
+// Maximum number of capture/compare channels in a single RTC instance.
+#define RTC_CC_CHANNEL_COUNT_MAX 4
+
+// Number of hardware counter bits.
+#define RTC_COUNTER_BITS 24
+
+// Flag set in the overflow word while the overflow handling is in progress.
+#define RTC_OVERFLOW_UPDATE_FLAG (1UL << 31)
+
+// Minimum distance in ticks between the counter and the compare value that guarantees the match.
+#define RTC_CC_MIN_DISTANCE 2
+
 /**@brief RTC driver instance control block structure. */
 typedef struct
 {
-    nrfx_drv_state_t state;        /**< Instance state. */
-    bool             reliable;     /**< Reliable mode flag. */
-    uint8_t          tick_latency; /**< Maximum length of interrupt handler in ticks (max 7.7 ms). */
+    nrfx_drv_state_t  state;         /**< Instance state. */
+    bool              reliable;      /**< Reliable mode flag. */
+    uint8_t           tick_latency;  /**< Maximum length of interrupt handler in ticks (max 7.7 ms). */
+    bool              extended;      /**< Extended counter flag. */
+    uint8_t           ext_cc_mask;   /**< Mask of channels waiting for the extended compare value to come into range. */
+    uint8_t           ext_cc_irq;    /**< Mask of extended compare channels with the interrupt requested. */
+    volatile uint32_t overflows;     /**< Number of counter overflows, with @ref RTC_OVERFLOW_UPDATE_FLAG. */
+    uint64_t          ext_cc_val[RTC_CC_CHANNEL_COUNT_MAX]; /**< Extended compare values. */
 } nrfx_rtc_cb_t;
 
 // User callbacks local storage.
 static nrfx_rtc_handler_t m_handlers[NRFX_RTC_ENABLED_COUNT];
 static nrfx_rtc_cb_t      m_cb[NRFX_RTC_ENABLED_COUNT];
 
+static void ext_cc_cancel(nrfx_rtc_t const * p_instance, uint32_t channel)
+{
+    nrfx_rtc_cb_t * p_cb = &m_cb[p_instance->instance_id];
+
+    if (p_cb->ext_cc_mask & (1UL << channel))
+    {
+        // The mask is also modified from the overflow interrupt.
+        nrf_rtc_int_disable(p_instance->p_reg, NRF_RTC_INT_OVERFLOW_MASK);
+        p_cb->ext_cc_mask &= (uint8_t)~(1UL << channel);
+        nrf_rtc_int_enable(p_instance->p_reg, NRF_RTC_INT_OVERFLOW_MASK);
+    }
+}
+
+static uint64_t ext_counter_get(NRF_RTC_Type const * p_reg, nrfx_rtc_cb_t const * p_cb)
+{
+    uint32_t overflows;
+    uint32_t counter;
+    bool     pending;
+
+    // The overflow word changes only when the overflow interrupt preempts this loop.
+    // Since the interrupt completes before the loop resumes, the loop always terminates.
+    do
+    {
+        overflows = p_cb->overflows;
+        counter   = nrf_rtc_counter_get(p_reg);
+        pending   = nrf_rtc_event_check(p_reg, NRF_RTC_EVENT_OVERFLOW);
+    } while (overflows != p_cb->overflows);
+
+    // An overflow event that is pending but not yet counted applies only if the counter
+    // was read after it wrapped around. If the update flag is set, the overflow interrupt was
+    // preempted after it had counted the event but before it cleared it.
+    if (!(overflows & RTC_OVERFLOW_UPDATE_FLAG) &&
+        pending &&
+        (counter < (RTC_COUNTER_COUNTER_Msk / 2)))
+    {
+        overflows++;
+    }
+    overflows &= ~RTC_OVERFLOW_UPDATE_FLAG;
+
+    return ((uint64_t)overflows << RTC_COUNTER_BITS) | counter;
+}
+
+static bool ext_cc_arm(NRF_RTC_Type * p_reg, nrfx_rtc_cb_t * p_cb, uint32_t channel)
+{
+    uint64_t now = ext_counter_get(p_reg, p_cb);
+    uint64_t val = p_cb->ext_cc_val[channel];
+    uint32_t latency = p_cb->reliable ? p_cb->tick_latency : 0;
+
+    if ((int64_t)(val - now) < RTC_CC_MIN_DISTANCE)
+    {
+        // The overflow was handled late and the value is already due. Fire as soon as possible.
+        val = now + RTC_CC_MIN_DISTANCE;
+    }
+    else if ((val - now) > (RTC_COUNTER_COUNTER_Msk - latency))
+    {
+        // Not in range of the hardware counter yet. Retry on the next overflow.
+        return false;
+    }
+
+    // The event and the interrupt are enabled only now, when the compare value is written for
+    // the final epoch. Enabled earlier, they would fire at the stale value of the channel.
+    nrf_rtc_cc_set(p_reg, channel, RTC_WRAP((uint32_t)val));
+    nrf_rtc_event_clear(p_reg, RTC_CHANNEL_EVENT_ADDR(channel));
+    nrf_rtc_event_enable(p_reg, RTC_CHANNEL_INT_MASK(channel));
+    if (p_cb->ext_cc_irq & (1UL << channel))
+    {
+        nrf_rtc_int_enable(p_reg, RTC_CHANNEL_INT_MASK(channel));
+    }
+    return true;
+}
+
 nrfx_err_t nrfx_rtc_init(nrfx_rtc_t const *        p_instance,
                          nrfx_rtc_config_t const * p_config,
                          nrfx_rtc_handler_t        handler)
@@ -112,7 +200,10 @@ void nrfx_rtc_uninit(nrfx_rtc_t const * p_instance)
     nrf_rtc_event_disable(p_instance->p_reg, mask);
     nrf_rtc_int_disable(p_instance->p_reg, mask);
 
-    m_cb[p_instance->instance_id].state = NRFX_DRV_STATE_UNINITIALIZED;
+    m_cb[p_instance->instance_id].extended    = false;
+    m_cb[p_instance->instance_id].ext_cc_mask = 0;
+    m_cb[p_instance->instance_id].ext_cc_irq  = 0;
+    m_cb[p_instance->instance_id].state       = NRFX_DRV_STATE_UNINITIALIZED;
     NRFX_LOG_INFO("Uninitialized.");
 }
 
@@ -143,6 +234,7 @@ nrfx_err_t nrfx_rtc_cc_disable(nrfx_rtc_t const * p_instance, uint32_t channel)
     uint32_t int_mask = RTC_CHANNEL_INT_MASK(channel);
     nrf_rtc_event_t event = RTC_CHANNEL_EVENT_ADDR(channel);
 
+    ext_cc_cancel(p_instance, channel);
     nrf_rtc_event_disable(p_instance->p_reg, int_mask);
     if (nrf_rtc_int_enable_check(p_instance->p_reg, int_mask))
     {
@@ -177,6 +269,7 @@ nrfx_err_t nrfx_rtc_cc_set(nrfx_rtc_t const * p_instance,
     uint32_t int_mask = RTC_CHANNEL_INT_MASK(channel);
     nrf_rtc_event_t event = RTC_CHANNEL_EVENT_ADDR(channel);
 
+    ext_cc_cancel(p_instance, channel);
     nrf_rtc_event_disable(p_instance->p_reg, int_mask);
     nrf_rtc_int_disable(p_instance->p_reg, int_mask);
 
@@ -277,6 +370,111 @@ uint32_t nrfx_rtc_max_ticks_get(nrfx_rtc_t const * p_instance)
     return ticks;
 }
 
+void nrfx_rtc_extended_enable(nrfx_rtc_t const * p_instance)
+{
+    NRFX_ASSERT(m_cb[p_instance->instance_id].state != NRFX_DRV_STATE_UNINITIALIZED);
+
+    m_cb[p_instance->instance_id].overflows = 0;
+    m_cb[p_instance->instance_id].extended  = true;
+    nrfx_rtc_overflow_enable(p_instance, true);
+    NRFX_LOG_INFO("Extended counter enabled.");
+}
+
+uint64_t nrfx_rtc_extended_counter_get(nrfx_rtc_t const * p_instance)
+{
+    NRFX_ASSERT(m_cb[p_instance->instance_id].extended);
+
+    return ext_counter_get(p_instance->p_reg, &m_cb[p_instance->instance_id]);
+}
+
+nrfx_err_t nrfx_rtc_extended_cc_set(nrfx_rtc_t const * p_instance,
+                                    uint32_t           channel,
+                                    uint64_t           val,
+                                    bool               enable_irq)
+{
+    nrfx_rtc_cb_t * p_cb = &m_cb[p_instance->instance_id];
+
+    NRFX_ASSERT(p_cb->state != NRFX_DRV_STATE_UNINITIALIZED);
+    NRFX_ASSERT(p_cb->extended);
+    NRFX_ASSERT(channel < p_instance->cc_channel_count);
+
+    nrfx_err_t err_code;
+    uint32_t int_mask = RTC_CHANNEL_INT_MASK(channel);
+    uint32_t latency = p_cb->reliable ? p_cb->tick_latency : 0;
+
+    nrf_rtc_event_disable(p_instance->p_reg, int_mask);
+    nrf_rtc_int_disable(p_instance->p_reg, int_mask);
+
+    // Prevent the overflow interrupt from arming the channel while it is being configured.
+    nrf_rtc_int_disable(p_instance->p_reg, NRF_RTC_INT_OVERFLOW_MASK);
+    p_cb->ext_cc_mask &= (uint8_t)~(1UL << channel);
+
+    if (val < ext_counter_get(p_instance->p_reg, p_cb) + RTC_CC_MIN_DISTANCE + latency)
+    {
+        nrf_rtc_int_enable(p_instance->p_reg, NRF_RTC_INT_OVERFLOW_MASK);
+        err_code = NRFX_ERROR_TIMEOUT;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    if (enable_irq)
+    {
+        p_cb->ext_cc_irq |= (uint8_t)(1UL << channel);
+    }
+    else
+    {
+        p_cb->ext_cc_irq &= (uint8_t)~(1UL << channel);
+    }
+
+    p_cb->ext_cc_val[channel] = val;
+    if (!ext_cc_arm(p_instance->p_reg, p_cb, channel))
+    {
+        p_cb->ext_cc_mask |= (uint8_t)(1UL << channel);
+    }
+    nrf_rtc_int_enable(p_instance->p_reg, NRF_RTC_INT_OVERFLOW_MASK);
+
+    NRFX_LOG_INFO("RTC id: %d, channel enabled: %lu, extended compare value: 0x%08lx%08lx.",
+                  p_instance->instance_id,
+                  (unsigned long)channel,
+                  (unsigned long)(val >> 32),
+                  (unsigned long)val);
+    err_code = NRFX_SUCCESS;
+    NRFX_LOG_INFO("Function: %s, error code: %s.", __func__, NRFX_LOG_ERROR_STRING_GET(err_code));
+    return err_code;
+}
+
+static void overflow_handle(NRF_RTC_Type * p_reg,
+                            uint32_t       instance_id,
+                            uint32_t       channel_count)
+{
+    nrfx_rtc_cb_t * p_cb = &m_cb[instance_id];
+
+    if (p_cb->extended)
+    {
+        uint32_t overflows = (p_cb->overflows + 1) & ~RTC_OVERFLOW_UPDATE_FLAG;
+
+        // Publish the new overflow count before clearing the event, so that a reader
+        // preempting this sequence does not count the overflow twice.
+        p_cb->overflows = overflows | RTC_OVERFLOW_UPDATE_FLAG;
+        nrf_rtc_event_clear(p_reg, NRF_RTC_EVENT_OVERFLOW);
+        p_cb->overflows = overflows;
+
+        for (uint32_t i = 0; i < channel_count; i++)
+        {
+            if ((p_cb->ext_cc_mask & (1UL << i)) && ext_cc_arm(p_reg, p_cb, i))
+            {
+                p_cb->ext_cc_mask &= (uint8_t)~(1UL << i);
+            }
+        }
+    }
+    else
+    {
+        nrf_rtc_event_clear(p_reg, NRF_RTC_EVENT_OVERFLOW);
+    }
+}
+
 static void irq_handler(NRF_RTC_Type * p_reg,
                         uint32_t       instance_id,
                         uint32_t       channel_count)
@@ -315,7 +513,7 @@ static void irq_handler(NRF_RTC_Type * p_reg,
     if (nrf_rtc_int_enable_check(p_reg, NRF_RTC_INT_OVERFLOW_MASK) &&
         nrf_rtc_event_check(p_reg, event))
     {
-        nrf_rtc_event_clear(p_reg, event);
+        overflow_handle(p_reg, instance_id, channel_count);
         NRFX_LOG_DEBUG("Event: %s, instance id: %lu.",
                        EVT_TO_STR(event),
                        (unsigned long)instance_id);
@@ -0,0 +1,358 @@
+/*
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <nrfx.h>
+
+#if NRFX_CHECK(NRFX_RTC_TIMER_ENABLED)
+
+#if !NRFX_CHECK(NRFX_RTC_ENABLED)
+#error "The RTC driver is required by the software timer service. Check <nrfx_config.h>."
+#endif
+
+#include <nrfx_rtc_timer.h>
+
+#define NRFX_LOG_MODULE RTC_TIMER
+#include <nrfx_log.h>
+
+NRFX_STATIC_ASSERT(NRFX_RTC_TIMER_CONFIG_MAX_TIMERS < NRFX_RTC_TIMER_IDX_INVALID);
+
+// Minimum distance in ticks between the counter and the compare value accepted by the RTC driver.
+#define RTC_CC_MIN_DISTANCE 2
+
+/** @brief Software timer service control block structure. */
+typedef struct
+{
+    nrfx_rtc_t       rtc;       /**< RTC instance used by the service. */
+    uint8_t          channel;   /**< Compare channel used by the service. */
+    uint32_t         tolerance; /**< Expiration tolerance window, in ticks. */
+    uint32_t         min_delay; /**< Minimum delay in ticks that can be armed in the compare channel. */
+    uint16_t         count;     /**< Number of running timers. */
+    nrfx_drv_state_t state;     /**< Service state. */
+} nrfx_rtc_timer_cb_t;
+
+static nrfx_rtc_timer_cb_t m_cb;
+
+// Binary min-heap of running timers, ordered by deadlines.
+static nrfx_rtc_timer_t * m_heap[NRFX_RTC_TIMER_CONFIG_MAX_TIMERS];
+
+static void heap_place(nrfx_rtc_timer_t * p_timer, uint16_t idx)
+{
+    m_heap[idx]       = p_timer;
+    p_timer->heap_idx = idx;
+}
+
+static void heap_sift_up(nrfx_rtc_timer_t * p_timer, uint16_t idx)
+{
+    while (idx > 0)
+    {
+        uint16_t parent = (uint16_t)((idx - 1) / 2);
+
+        if (m_heap[parent]->deadline <= p_timer->deadline)
+        {
+            break;
+        }
+        heap_place(m_heap[parent], idx);
+        idx = parent;
+    }
+    heap_place(p_timer, idx);
+}
+
+static void heap_sift_down(nrfx_rtc_timer_t * p_timer, uint16_t idx)
+{
+    for (;;)
+    {
+        uint32_t child = 2 * (uint32_t)idx + 1;
+
+        if (child >= m_cb.count)
+        {
+            break;
+        }
+        if ((child + 1 < m_cb.count) && (m_heap[child + 1]->deadline < m_heap[child]->deadline))
+        {
+            child++;
+        }
+        if (p_timer->deadline <= m_heap[child]->deadline)
+        {
+            break;
+        }
+        heap_place(m_heap[child], idx);
+        idx = (uint16_t)child;
+    }
+    heap_place(p_timer, idx);
+}
+
+static void heap_insert(nrfx_rtc_timer_t * p_timer)
+{
+    heap_sift_up(p_timer, m_cb.count++);
+}
+
+static void heap_remove(nrfx_rtc_timer_t * p_timer)
+{
+    uint16_t           idx    = p_timer->heap_idx;
+    nrfx_rtc_timer_t * p_last = m_heap[--m_cb.count];
+
+    p_timer->heap_idx = NRFX_RTC_TIMER_IDX_INVALID;
+    if (p_last == p_timer)
+    {
+        return;
+    }
+
+    // Move the last timer to the released slot and restore the heap property in
+    // whichever direction it is violated.
+    if ((idx > 0) && (p_last->deadline < m_heap[(idx - 1) / 2]->deadline))
+    {
+        heap_sift_up(p_last, idx);
+    }
+    else
+    {
+        heap_sift_down(p_last, idx);
+    }
+}
+
+// Must be called in a critical section.
+static void compare_update(void)
+{
+    if (m_cb.count == 0)
+    {
+        (void)nrfx_rtc_cc_disable(&m_cb.rtc, m_cb.channel);
+        return;
+    }
+
+    uint64_t val = m_heap[0]->deadline;
+
+    while (nrfx_rtc_extended_cc_set(&m_cb.rtc, m_cb.channel, val, true) != NRFX_SUCCESS)
+    {
+        // The earliest timer is already due. Expire it as soon as possible.
+        val = nrfx_rtc_extended_counter_get(&m_cb.rtc) + m_cb.min_delay;
+    }
+}
+
+static void timers_expire(void)
+{
+    for (;;)
+    {
+        nrfx_rtc_timer_t * p_timer = NULL;
+
+        NRFX_CRITICAL_SECTION_ENTER();
+
+        uint64_t now = nrfx_rtc_extended_counter_get(&m_cb.rtc);
+
+        if ((m_cb.count > 0) && (m_heap[0]->deadline <= now + m_cb.tolerance))
+        {
+            p_timer = m_heap[0];
+            heap_remove(p_timer);
+
+            if (p_timer->period)
+            {
+                p_timer->deadline += p_timer->period;
+                if (p_timer->deadline <= now)
+                {
+                    uint64_t missed = (now - p_timer->deadline) / p_timer->period + 1;
+
+                    p_timer->deadline += missed * p_timer->period;
+                }
+                heap_insert(p_timer);
+            }
+        }
+        else
+        {
+            compare_update();
+        }
+
+        NRFX_CRITICAL_SECTION_EXIT();
+
+        if (p_timer == NULL)
+        {
+            break;
+        }
+
+        // The handler is called outside of the critical section, so it may start or stop timers,
+        // including the one that has just expired.
+        p_timer->handler(p_timer->p_context);
+    }
+}
+
+static void rtc_handler(nrfx_rtc_int_type_t int_type)
+{
+    if ((uint32_t)int_type == m_cb.channel)
+    {
+        timers_expire();
+    }
+}
+
+nrfx_err_t nrfx_rtc_timer_init(nrfx_rtc_timer_config_t const * p_config)
+{
+    NRFX_ASSERT(p_config);
+    NRFX_ASSERT(p_config->channel < p_config->rtc.cc_channel_count);
+    nrfx_err_t err_code;
+
+    if (m_cb.state != NRFX_DRV_STATE_UNINITIALIZED)
+    {
+        err_code = NRFX_ERROR_INVALID_STATE;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    err_code = nrfx_rtc_init(&p_config->rtc, &p_config->rtc_config, rtc_handler);
+    if (err_code != NRFX_SUCCESS)
+    {
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    m_cb.rtc       = p_config->rtc;
+    m_cb.channel   = p_config->channel;
+    m_cb.tolerance = p_config->tolerance;
+    m_cb.min_delay = RTC_CC_MIN_DISTANCE +
+                     (p_config->rtc_config.reliable ? p_config->rtc_config.tick_latency : 0);
+    m_cb.count     = 0;
+
+    nrfx_rtc_extended_enable(&m_cb.rtc);
+    nrfx_rtc_enable(&m_cb.rtc);
+    m_cb.state = NRFX_DRV_STATE_POWERED_ON;
+
+    NRFX_LOG_INFO("Function: %s, error code: %s.", __func__, NRFX_LOG_ERROR_STRING_GET(err_code));
+    return err_code;
+}
+
+void nrfx_rtc_timer_uninit(void)
+{
+    NRFX_ASSERT(m_cb.state != NRFX_DRV_STATE_UNINITIALIZED);
+
+    nrfx_rtc_uninit(&m_cb.rtc);
+
+    while (m_cb.count > 0)
+    {
+        heap_remove(m_heap[m_cb.count - 1]);
+    }
+
+    m_cb.state = NRFX_DRV_STATE_UNINITIALIZED;
+    NRFX_LOG_INFO("Uninitialized.");
+}
+
+uint64_t nrfx_rtc_timer_now(void)
+{
+    NRFX_ASSERT(m_cb.state == NRFX_DRV_STATE_POWERED_ON);
+
+    return nrfx_rtc_extended_counter_get(&m_cb.rtc);
+}
+
+void nrfx_rtc_timer_setup(nrfx_rtc_timer_t *       p_timer,
+                          nrfx_rtc_timer_handler_t handler,
+                          void *                   p_context)
+{
+    NRFX_ASSERT(p_timer);
+    NRFX_ASSERT(handler);
+
+    p_timer->deadline  = 0;
+    p_timer->period    = 0;
+    p_timer->handler   = handler;
+    p_timer->p_context = p_context;
+    p_timer->heap_idx  = NRFX_RTC_TIMER_IDX_INVALID;
+}
+
+nrfx_err_t nrfx_rtc_timer_start(nrfx_rtc_timer_t * p_timer, uint64_t deadline, uint32_t period)
+{
+    NRFX_ASSERT(m_cb.state == NRFX_DRV_STATE_POWERED_ON);
+    NRFX_ASSERT(p_timer);
+    NRFX_ASSERT(p_timer->handler);
+    nrfx_err_t err_code = NRFX_SUCCESS;
+
+    NRFX_CRITICAL_SECTION_ENTER();
+
+    bool was_first = (p_timer->heap_idx == 0);
+
+    if (p_timer->heap_idx != NRFX_RTC_TIMER_IDX_INVALID)
+    {
+        heap_remove(p_timer);
+    }
+
+    if (m_cb.count < NRFX_RTC_TIMER_CONFIG_MAX_TIMERS)
+    {
+        p_timer->deadline = deadline;
+        p_timer->period   = period;
+        heap_insert(p_timer);
+    }
+    else
+    {
+        err_code = NRFX_ERROR_NO_MEM;
+    }
+
+    // The compare channel needs to be rearmed only if the earliest deadline changed.
+    if (was_first || (p_timer->heap_idx == 0))
+    {
+        compare_update();
+    }
+
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    if (err_code != NRFX_SUCCESS)
+    {
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+    }
+    return err_code;
+}
+
+void nrfx_rtc_timer_stop(nrfx_rtc_timer_t * p_timer)
+{
+    NRFX_ASSERT(m_cb.state == NRFX_DRV_STATE_POWERED_ON);
+    NRFX_ASSERT(p_timer);
+
+    NRFX_CRITICAL_SECTION_ENTER();
+
+    if (p_timer->heap_idx != NRFX_RTC_TIMER_IDX_INVALID)
+    {
+        bool was_first = (p_timer->heap_idx == 0);
+
+        heap_remove(p_timer);
+        if (was_first)
+        {
+            compare_update();
+        }
+    }
+
+    NRFX_CRITICAL_SECTION_EXIT();
+}
+
+bool nrfx_rtc_timer_is_running(nrfx_rtc_timer_t const * p_timer)
+{
+    NRFX_ASSERT(p_timer);
+
+    return p_timer->heap_idx != NRFX_RTC_TIMER_IDX_INVALID;
+}
+
+#endif // NRFX_CHECK(NRFX_RTC_TIMER_ENABLED)
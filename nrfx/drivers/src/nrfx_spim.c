@@ -42,6 +42,7 @@
 
 #include <nrfx_spim.h>
 #include "prs/nrfx_prs.h"
+#include <soc/nrfx_prof.h>
 #include <hal/nrf_gpio.h>
 
 #define NRFX_LOG_MODULE SPIM
@@ -191,9 +192,48 @@ typedef struct
     size_t          tx_length;
     size_t          rx_length;
 #endif
+
+#if NRFX_CHECK(NRFX_IDLE_ENABLED)
+    nrfx_idle_t     idle;
+    uint32_t        flags;
+#endif
 } spim_control_block_t;
 static spim_control_block_t m_cb[NRFX_SPIM_ENABLED_COUNT];
 
+/* With a single enabled instance, its registers and control block are known at compile
+ * time, so the transfer path does not dereference the instance structure and the
+ * compiler can drop the branches that depend on the instance. */
+#if (NRFX_CHECK(NRFX_SPIM0_ENABLED) + NRFX_CHECK(NRFX_SPIM1_ENABLED) + \
+     NRFX_CHECK(NRFX_SPIM2_ENABLED) + NRFX_CHECK(NRFX_SPIM3_ENABLED) + \
+     NRFX_CHECK(NRFX_SPIM4_ENABLED)) == 1
+#if NRFX_CHECK(NRFX_SPIM0_ENABLED)
+#define SPIM_SINGLE_REG NRF_SPIM0
+#elif NRFX_CHECK(NRFX_SPIM1_ENABLED)
+#define SPIM_SINGLE_REG NRF_SPIM1
+#elif NRFX_CHECK(NRFX_SPIM2_ENABLED)
+#define SPIM_SINGLE_REG NRF_SPIM2
+#elif NRFX_CHECK(NRFX_SPIM3_ENABLED)
+#define SPIM_SINGLE_REG NRF_SPIM3
+#elif NRFX_CHECK(NRFX_SPIM4_ENABLED)
+#define SPIM_SINGLE_REG NRF_SPIM4
+#endif
+#define SPIM_REG(p_instance) ((void)(p_instance), SPIM_SINGLE_REG)
+#define SPIM_CB(p_instance)  ((void)(p_instance), &m_cb[0])
+#define SPIM_IS_SPIM3(p_spim) ((void)(p_spim), NRFX_CHECK(NRFX_SPIM3_ENABLED))
+#else
+#define SPIM_REG(p_instance) ((NRF_SPIM_Type *)(p_instance)->p_reg)
+#define SPIM_CB(p_instance)  (&m_cb[(p_instance)->drv_inst_idx])
+#define SPIM_IS_SPIM3(p_spim) (NRFX_CHECK(NRFX_SPIM3_ENABLED) && ((p_spim) == NRF_SPIM3))
+#endif
+
+/* Transfers without an event handler are polled in the calling context. When the blocking
+ * mode is disabled, the handler is required at init and the polling code is not built. */
+#if NRFX_CHECK(NRFX_SPIM_BLOCKING_ENABLED)
+#define SPIM_BLOCKING(p_cb) ((p_cb)->handler == NULL)
+#else
+#define SPIM_BLOCKING(p_cb) ((void)(p_cb), false)
+#endif
+
 #if NRFX_CHECK(NRFX_SPIM3_NRF52840_ANOMALY_198_WORKAROUND_ENABLED)
 
 // Workaround for nRF52840 anomaly 198: SPIM3 transmit data might be corrupted.
@@ -235,6 +275,23 @@ static void anomaly_198_disable(void)
 }
 #endif // NRFX_CHECK(NRFX_SPIM3_NRF52840_ANOMALY_198_WORKAROUND_ENABLED)
 
+#if NRFX_CHECK(NRFX_IDLE_ENABLED)
+// Transfers after which the peripheral must stay enabled, as it is about to be started
+// through (D)PPI.
+#define SPIM_IDLE_KEEP_ENABLED_FLAGS (NRFX_SPIM_FLAG_HOLD_XFER | \
+                                      NRFX_SPIM_FLAG_REPEATED_XFER)
+
+static void spim_idle_enable(void * p_reg)
+{
+    nrf_spim_enable((NRF_SPIM_Type *)p_reg);
+}
+
+static void spim_idle_disable(void * p_reg)
+{
+    nrf_spim_disable((NRF_SPIM_Type *)p_reg);
+}
+#endif
+
 static void spim_abort(NRF_SPIM_Type * p_spim, spim_control_block_t * p_cb)
 {
     nrf_spim_task_trigger(p_spim, NRF_SPIM_TASK_STOP);
@@ -244,6 +301,9 @@ static void spim_abort(NRF_SPIM_Type * p_spim, spim_control_block_t * p_cb)
     {
         NRFX_LOG_ERROR("Failed to stop instance with base address: %p.", (void *)p_spim);
     }
+#if NRFX_CHECK(NRFX_IDLE_ENABLED)
+    nrfx_idle_inactive(&p_cb->idle, false);
+#endif
     p_cb->transfer_in_progress = false;
 }
 
@@ -253,7 +313,8 @@ nrfx_err_t nrfx_spim_init(nrfx_spim_t const *        p_instance,
                           void *                     p_context)
 {
     NRFX_ASSERT(p_config);
-    spim_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    NRFX_ASSERT(SPIM_REG(p_instance) == p_instance->p_reg);
+    spim_control_block_t * p_cb = SPIM_CB(p_instance);
     nrfx_err_t err_code;
 
     if (p_cb->state != NRFX_DRV_STATE_UNINITIALIZED)
@@ -265,6 +326,17 @@ nrfx_err_t nrfx_spim_init(nrfx_spim_t const *        p_instance,
         return err_code;
     }
 
+#if !NRFX_CHECK(NRFX_SPIM_BLOCKING_ENABLED)
+    if (handler == NULL)
+    {
+        err_code = NRFX_ERROR_NOT_SUPPORTED;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+#endif
+
 #if NRFX_CHECK(NRFX_SPIM_EXTENDED_ENABLED)
     // Check if SPIM instance supports the extended features.
     if (
@@ -283,7 +355,7 @@ nrfx_err_t nrfx_spim_init(nrfx_spim_t const *        p_instance,
     }
 #endif
 
-    NRF_SPIM_Type * p_spim = (NRF_SPIM_Type *)p_instance->p_reg;
+    NRF_SPIM_Type * p_spim = SPIM_REG(p_instance);
 
 #if NRFX_CHECK(NRFX_PRS_ENABLED)
     static nrfx_irq_handler_t const irq_handlers[NRFX_SPIM_ENABLED_COUNT] = {
@@ -303,7 +375,7 @@ nrfx_err_t nrfx_spim_init(nrfx_spim_t const *        p_instance,
         nrfx_spim_4_irq_handler,
         #endif
     };
-    if (nrfx_prs_acquire(p_instance->p_reg,
+    if (nrfx_prs_acquire(SPIM_REG(p_instance),
             irq_handlers[p_instance->drv_inst_idx]) != NRFX_SUCCESS)
     {
         err_code = NRFX_ERROR_BUSY;
@@ -411,12 +483,15 @@ nrfx_err_t nrfx_spim_init(nrfx_spim_t const *        p_instance,
     nrf_spim_orc_set(p_spim, p_config->orc);
 
     nrf_spim_enable(p_spim);
+#if NRFX_CHECK(NRFX_IDLE_ENABLED)
+    nrfx_idle_entry_init(&p_cb->idle, p_spim, spim_idle_enable, spim_idle_disable);
+#endif
 
-    if (p_cb->handler)
+    if (!SPIM_BLOCKING(p_cb))
     {
-        NRFX_IRQ_PRIORITY_SET(nrfx_get_irq_number(p_instance->p_reg),
+        NRFX_IRQ_PRIORITY_SET(nrfx_get_irq_number(SPIM_REG(p_instance)),
             p_config->irq_priority);
-        NRFX_IRQ_ENABLE(nrfx_get_irq_number(p_instance->p_reg));
+        NRFX_IRQ_ENABLE(nrfx_get_irq_number(SPIM_REG(p_instance)));
     }
 
     p_cb->transfer_in_progress = false;
@@ -429,13 +504,13 @@ nrfx_err_t nrfx_spim_init(nrfx_spim_t const *        p_instance,
 
 void nrfx_spim_uninit(nrfx_spim_t const * p_instance)
 {
-    spim_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    spim_control_block_t * p_cb = SPIM_CB(p_instance);
     NRFX_ASSERT(p_cb->state != NRFX_DRV_STATE_UNINITIALIZED);
-    NRF_SPIM_Type * p_spim = p_instance->p_reg;
+    NRF_SPIM_Type * p_spim = SPIM_REG(p_instance);
 
-    if (p_cb->handler)
+    if (!SPIM_BLOCKING(p_cb))
     {
-        NRFX_IRQ_DISABLE(nrfx_get_irq_number(p_instance->p_reg));
+        NRFX_IRQ_DISABLE(nrfx_get_irq_number(SPIM_REG(p_instance)));
         nrf_spim_int_disable(p_spim, NRF_SPIM_ALL_INTS_MASK);
         if (p_cb->transfer_in_progress)
         {
@@ -474,14 +549,14 @@ void nrfx_spim_uninit(nrfx_spim_t const * p_instance)
 #endif
 
 #ifdef USE_WORKAROUND_FOR_ANOMALY_195
-    if (p_spim == NRF_SPIM3)
+    if (SPIM_IS_SPIM3(p_spim))
     {
         *(volatile uint32_t *)0x4002F004 = 1;
     }
 #endif
 
 #if NRFX_CHECK(NRFX_PRS_ENABLED)
-    nrfx_prs_release(p_instance->p_reg);
+    nrfx_prs_release(SPIM_REG(p_instance));
 #endif
 
     p_cb->state = NRFX_DRV_STATE_UNINITIALIZED;
@@ -494,7 +569,7 @@ nrfx_err_t nrfx_spim_xfer_dcx(nrfx_spim_t const *           p_instance,
                               uint8_t                       cmd_length)
 {
     NRFX_ASSERT(cmd_length <= NRF_SPIM_DCX_CNT_ALL_CMD);
-    nrf_spim_dcx_cnt_set((NRF_SPIM_Type *)p_instance->p_reg, cmd_length);
+    nrf_spim_dcx_cnt_set(SPIM_REG(p_instance), cmd_length);
     return nrfx_spim_xfer(p_instance, p_xfer_desc, 0);
 }
 #endif
@@ -519,6 +594,10 @@ static void finish_transfer(spim_control_block_t * p_cb)
         }
     }
 
+#if NRFX_CHECK(NRFX_IDLE_ENABLED)
+    nrfx_idle_inactive(&p_cb->idle, !(p_cb->flags & SPIM_IDLE_KEEP_ENABLED_FLAGS));
+#endif
+
     // By clearing this flag before calling the handler we allow subsequent
     // transfers to be started directly from the handler function.
     p_cb->transfer_in_progress = false;
@@ -579,6 +658,11 @@ static nrfx_err_t spim_xfer(NRF_SPIM_Type               * p_spim,
         return err_code;
     }
 
+#if NRFX_CHECK(NRFX_IDLE_ENABLED)
+    p_cb->flags = flags;
+    nrfx_idle_active(&p_cb->idle);
+#endif
+
 #if NRFX_CHECK(NRFX_SPIM_NRF52_ANOMALY_109_WORKAROUND_ENABLED)
     p_cb->tx_length = 0;
     p_cb->rx_length = 0;
@@ -588,7 +672,7 @@ static nrfx_err_t spim_xfer(NRF_SPIM_Type               * p_spim,
     nrf_spim_rx_buffer_set(p_spim, p_xfer_desc->p_rx_buffer, p_xfer_desc->rx_length);
 
 #if NRFX_CHECK(NRFX_SPIM3_NRF52840_ANOMALY_198_WORKAROUND_ENABLED)
-    if (p_spim == NRF_SPIM3)
+    if (SPIM_IS_SPIM3(p_spim))
     {
         anomaly_198_enable(p_xfer_desc->p_tx_buffer, p_xfer_desc->tx_length);
     }
@@ -614,16 +698,19 @@ static nrfx_err_t spim_xfer(NRF_SPIM_Type               * p_spim,
     }
 #endif
 
-    if (!p_cb->handler)
+    if (SPIM_BLOCKING(p_cb))
     {
         if (!(flags & NRFX_SPIM_FLAG_HOLD_XFER))
         {
             while (!nrf_spim_event_check(p_spim, NRF_SPIM_EVENT_END))
             {}
+#if NRFX_CHECK(NRFX_IDLE_ENABLED)
+            nrfx_idle_inactive(&p_cb->idle, !(flags & SPIM_IDLE_KEEP_ENABLED_FLAGS));
+#endif
         }
 
 #if NRFX_CHECK(NRFX_SPIM3_NRF52840_ANOMALY_198_WORKAROUND_ENABLED)
-        if (p_spim == NRF_SPIM3)
+        if (SPIM_IS_SPIM3(p_spim))
         {
             anomaly_198_disable();
         }
@@ -658,7 +745,7 @@ nrfx_err_t nrfx_spim_xfer(nrfx_spim_t const *           p_instance,
                           nrfx_spim_xfer_desc_t const * p_xfer_desc,
                           uint32_t                      flags)
 {
-    spim_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    spim_control_block_t * p_cb = SPIM_CB(p_instance);
     NRFX_ASSERT(p_cb->state != NRFX_DRV_STATE_UNINITIALIZED);
     NRFX_ASSERT(p_xfer_desc->p_tx_buffer != NULL || p_xfer_desc->tx_length == 0);
     NRFX_ASSERT(p_xfer_desc->p_rx_buffer != NULL || p_xfer_desc->rx_length == 0);
@@ -680,8 +767,8 @@ nrfx_err_t nrfx_spim_xfer(nrfx_spim_t const *           p_instance,
     }
     else
     {
-        if (p_cb->handler && !(flags & (NRFX_SPIM_FLAG_REPEATED_XFER |
-                                        NRFX_SPIM_FLAG_NO_XFER_EVT_HANDLER)))
+        if (!SPIM_BLOCKING(p_cb) && !(flags & (NRFX_SPIM_FLAG_REPEATED_XFER |
+                                               NRFX_SPIM_FLAG_NO_XFER_EVT_HANDLER)))
         {
             p_cb->transfer_in_progress = true;
         }
@@ -706,29 +793,40 @@ nrfx_err_t nrfx_spim_xfer(nrfx_spim_t const *           p_instance,
         }
     }
 
-    return spim_xfer(p_instance->p_reg, p_cb,  p_xfer_desc, flags);
+    return spim_xfer(SPIM_REG(p_instance), p_cb, p_xfer_desc, flags);
 }
 
 void nrfx_spim_abort(nrfx_spim_t const * p_instance)
 {
-    spim_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    spim_control_block_t * p_cb = SPIM_CB(p_instance);
     NRFX_ASSERT(p_cb->state != NRFX_DRV_STATE_UNINITIALIZED);
 
-    spim_abort(p_instance->p_reg, p_cb);
+    spim_abort(SPIM_REG(p_instance), p_cb);
 }
 
 uint32_t nrfx_spim_start_task_get(nrfx_spim_t const * p_instance)
 {
-    NRF_SPIM_Type * p_spim = (NRF_SPIM_Type *)p_instance->p_reg;
+    NRF_SPIM_Type * p_spim = SPIM_REG(p_instance);
     return nrf_spim_task_address_get(p_spim, NRF_SPIM_TASK_START);
 }
 
 uint32_t nrfx_spim_end_event_get(nrfx_spim_t const * p_instance)
 {
-    NRF_SPIM_Type * p_spim = (NRF_SPIM_Type *)p_instance->p_reg;
+    NRF_SPIM_Type * p_spim = SPIM_REG(p_instance);
     return nrf_spim_event_address_get(p_spim, NRF_SPIM_EVENT_END);
 }
 
+#if NRFX_CHECK(NRFX_IDLE_ENABLED)
+nrfx_idle_t const * nrfx_spim_idle_get(nrfx_spim_t const * p_instance)
+{
+    spim_control_block_t * p_cb = SPIM_CB(p_instance);
+
+    NRFX_ASSERT(p_cb->state != NRFX_DRV_STATE_UNINITIALIZED);
+
+    return &p_cb->idle;
+}
+#endif
+
 static void irq_handler(NRF_SPIM_Type * p_spim, spim_control_block_t * p_cb)
 {
 
@@ -758,7 +856,7 @@ static void irq_handler(NRF_SPIM_Type * p_spim, spim_control_block_t * p_cb)
     if (nrf_spim_event_check(p_spim, NRF_SPIM_EVENT_END))
     {
 #if NRFX_CHECK(NRFX_SPIM3_NRF52840_ANOMALY_198_WORKAROUND_ENABLED)
-        if (p_spim == NRF_SPIM3)
+        if (SPIM_IS_SPIM3(p_spim))
         {
             anomaly_198_disable();
         }
@@ -771,37 +869,57 @@ static void irq_handler(NRF_SPIM_Type * p_spim, spim_control_block_t * p_cb)
 }
 
 #if NRFX_CHECK(NRFX_SPIM0_ENABLED)
+NRFX_PROF_REGION_DEFINE(m_prof_spim0_irq);
+
 void nrfx_spim_0_irq_handler(void)
 {
+    NRFX_PROF_BEGIN(m_prof_spim0_irq);
     irq_handler(NRF_SPIM0, &m_cb[NRFX_SPIM0_INST_IDX]);
+    NRFX_PROF_END(m_prof_spim0_irq);
 }
 #endif
 
 #if NRFX_CHECK(NRFX_SPIM1_ENABLED)
+NRFX_PROF_REGION_DEFINE(m_prof_spim1_irq);
+
 void nrfx_spim_1_irq_handler(void)
 {
+    NRFX_PROF_BEGIN(m_prof_spim1_irq);
     irq_handler(NRF_SPIM1, &m_cb[NRFX_SPIM1_INST_IDX]);
+    NRFX_PROF_END(m_prof_spim1_irq);
 }
 #endif
 
 #if NRFX_CHECK(NRFX_SPIM2_ENABLED)
+NRFX_PROF_REGION_DEFINE(m_prof_spim2_irq);
+
 void nrfx_spim_2_irq_handler(void)
 {
+    NRFX_PROF_BEGIN(m_prof_spim2_irq);
     irq_handler(NRF_SPIM2, &m_cb[NRFX_SPIM2_INST_IDX]);
+    NRFX_PROF_END(m_prof_spim2_irq);
 }
 #endif
 
 #if NRFX_CHECK(NRFX_SPIM3_ENABLED)
+NRFX_PROF_REGION_DEFINE(m_prof_spim3_irq);
+
 void nrfx_spim_3_irq_handler(void)
 {
+    NRFX_PROF_BEGIN(m_prof_spim3_irq);
     irq_handler(NRF_SPIM3, &m_cb[NRFX_SPIM3_INST_IDX]);
+    NRFX_PROF_END(m_prof_spim3_irq);
 }
 #endif
 
 #if NRFX_CHECK(NRFX_SPIM4_ENABLED)
+NRFX_PROF_REGION_DEFINE(m_prof_spim4_irq);
+
 void nrfx_spim_4_irq_handler(void)
 {
+    NRFX_PROF_BEGIN(m_prof_spim4_irq);
     irq_handler(NRF_SPIM4, &m_cb[NRFX_SPIM4_INST_IDX]);
+    NRFX_PROF_END(m_prof_spim4_irq);
 }
 #endif
 
@@ -66,6 +66,10 @@ nrfx_err_t nrfx_temp_init(nrfx_temp_config_t const * p_config, nrfx_temp_data_ha
     *(uint32_t volatile *)0x4000C504 = 0;
 #endif
 
+#if defined(SYSTEM_DEFERRED_TEMP)
+    SystemInitDeferred(SYSTEM_DEFERRED_TEMP);
+#endif
+
     m_data_handler = handler;
 
     if (m_data_handler)
@@ -43,6 +43,7 @@
 #include <nrfx_twim.h>
 #include <hal/nrf_gpio.h>
 #include "prs/nrfx_prs.h"
+#include <soc/nrfx_prof.h>
 
 #define NRFX_LOG_MODULE TWIM
 #include <nrfx_log.h>
@@ -133,10 +134,61 @@ typedef struct
 #if NRFX_CHECK(NRFX_TWIM_NRF52_ANOMALY_109_WORKAROUND_ENABLED)
     nrf_twim_frequency_t    bus_frequency;
 #endif
+#if NRFX_CHECK(NRFX_IDLE_ENABLED)
+    nrfx_idle_t             idle;
+#endif
 } twim_control_block_t;
 
 static twim_control_block_t m_cb[NRFX_TWIM_ENABLED_COUNT];
 
+/* With a single enabled instance, its registers and control block are known at compile
+ * time, so the transfer path does not dereference the instance structure and the
+ * compiler can drop the branches that depend on the instance. */
+#if (NRFX_CHECK(NRFX_TWIM0_ENABLED) + NRFX_CHECK(NRFX_TWIM1_ENABLED) + \
+     NRFX_CHECK(NRFX_TWIM2_ENABLED) + NRFX_CHECK(NRFX_TWIM3_ENABLED)) == 1
+#if NRFX_CHECK(NRFX_TWIM0_ENABLED)
+#define TWIM_SINGLE_REG NRF_TWIM0
+#elif NRFX_CHECK(NRFX_TWIM1_ENABLED)
+#define TWIM_SINGLE_REG NRF_TWIM1
+#elif NRFX_CHECK(NRFX_TWIM2_ENABLED)
+#define TWIM_SINGLE_REG NRF_TWIM2
+#elif NRFX_CHECK(NRFX_TWIM3_ENABLED)
+#define TWIM_SINGLE_REG NRF_TWIM3
+#endif
+#define TWIM_REG(p_instance) ((void)(p_instance), TWIM_SINGLE_REG)
+#define TWIM_CB(p_instance)  ((void)(p_instance), &m_cb[0])
+#else
+#define TWIM_REG(p_instance) ((NRF_TWIM_Type *)(p_instance)->p_twim)
+#define TWIM_CB(p_instance)  (&m_cb[(p_instance)->drv_inst_idx])
+#endif
+
+/* Transfers without an event handler are polled in the calling context. When the blocking
+ * mode is disabled, the handler is required at init and the polling code is not built. */
+#if NRFX_CHECK(NRFX_TWIM_BLOCKING_ENABLED)
+#define TWIM_BLOCKING(p_cb) ((p_cb)->handler == NULL)
+#else
+#define TWIM_BLOCKING(p_cb) ((void)(p_cb), false)
+#endif
+
+#if NRFX_CHECK(NRFX_IDLE_ENABLED)
+// Transfers after which the peripheral must stay enabled, as it either still holds the bus
+// or is about to be started through (D)PPI.
+#define TWIM_IDLE_KEEP_ENABLED_FLAGS (NRFX_TWIM_FLAG_TX_NO_STOP          | \
+                                      NRFX_TWIM_FLAG_HOLD_XFER           | \
+                                      NRFX_TWIM_FLAG_REPEATED_XFER       | \
+                                      NRFX_TWIM_FLAG_NO_XFER_EVT_HANDLER)
+
+static void twim_idle_enable(void * p_reg)
+{
+    nrf_twim_enable((NRF_TWIM_Type *)p_reg);
+}
+
+static void twim_idle_disable(void * p_reg)
+{
+    nrf_twim_disable((NRF_TWIM_Type *)p_reg);
+}
+#endif
+
 static nrfx_err_t twi_process_error(uint32_t errorsrc)
 {
     nrfx_err_t ret = NRFX_ERROR_INTERNAL;
@@ -221,7 +273,8 @@ nrfx_err_t nrfx_twim_init(nrfx_twim_t const *        p_instance,
 {
     NRFX_ASSERT(p_config);
     NRFX_ASSERT(p_config->scl != p_config->sda);
-    twim_control_block_t * p_cb  = &m_cb[p_instance->drv_inst_idx];
+    NRFX_ASSERT(TWIM_REG(p_instance) == p_instance->p_twim);
+    twim_control_block_t * p_cb  = TWIM_CB(p_instance);
     nrfx_err_t err_code;
 
     if (p_cb->state != NRFX_DRV_STATE_UNINITIALIZED)
@@ -233,6 +286,17 @@ nrfx_err_t nrfx_twim_init(nrfx_twim_t const *        p_instance,
         return err_code;
     }
 
+#if !NRFX_CHECK(NRFX_TWIM_BLOCKING_ENABLED)
+    if (event_handler == NULL)
+    {
+        err_code = NRFX_ERROR_NOT_SUPPORTED;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+#endif
+
 #if NRFX_CHECK(NRFX_PRS_ENABLED)
     static nrfx_irq_handler_t const irq_handlers[NRFX_TWIM_ENABLED_COUNT] = {
         #if NRFX_CHECK(NRFX_TWIM0_ENABLED)
@@ -248,7 +312,7 @@ nrfx_err_t nrfx_twim_init(nrfx_twim_t const *        p_instance,
         nrfx_twim_3_irq_handler,
         #endif
     };
-    if (nrfx_prs_acquire(p_instance->p_twim,
+    if (nrfx_prs_acquire(TWIM_REG(p_instance),
             irq_handlers[p_instance->drv_inst_idx]) != NRFX_SUCCESS)
     {
         err_code = NRFX_ERROR_BUSY;
@@ -276,16 +340,16 @@ nrfx_err_t nrfx_twim_init(nrfx_twim_t const *        p_instance,
     TWIM_PIN_INIT(p_config->scl);
     TWIM_PIN_INIT(p_config->sda);
 
-    NRF_TWIM_Type * p_twim = p_instance->p_twim;
+    NRF_TWIM_Type * p_twim = TWIM_REG(p_instance);
     nrf_twim_pins_set(p_twim, p_config->scl, p_config->sda);
     nrf_twim_frequency_set(p_twim,
         (nrf_twim_frequency_t)p_config->frequency);
 
-    if (p_cb->handler)
+    if (!TWIM_BLOCKING(p_cb))
     {
-        NRFX_IRQ_PRIORITY_SET(nrfx_get_irq_number(p_instance->p_twim),
+        NRFX_IRQ_PRIORITY_SET(nrfx_get_irq_number(TWIM_REG(p_instance)),
             p_config->interrupt_priority);
-        NRFX_IRQ_ENABLE(nrfx_get_irq_number(p_instance->p_twim));
+        NRFX_IRQ_ENABLE(nrfx_get_irq_number(TWIM_REG(p_instance)));
     }
 
     p_cb->state = NRFX_DRV_STATE_INITIALIZED;
@@ -297,23 +361,24 @@ nrfx_err_t nrfx_twim_init(nrfx_twim_t const *        p_instance,
 
 void nrfx_twim_uninit(nrfx_twim_t const * p_instance)
 {
-    twim_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    twim_control_block_t * p_cb = TWIM_CB(p_instance);
+
     NRFX_ASSERT(p_cb->state != NRFX_DRV_STATE_UNINITIALIZED);
 
-    if (p_cb->handler)
+    if (!TWIM_BLOCKING(p_cb))
     {
-        NRFX_IRQ_DISABLE(nrfx_get_irq_number(p_instance->p_twim));
+        NRFX_IRQ_DISABLE(nrfx_get_irq_number(TWIM_REG(p_instance)));
     }
     nrfx_twim_disable(p_instance);
 
 #if NRFX_CHECK(NRFX_PRS_ENABLED)
-    nrfx_prs_release(p_instance->p_twim);
+    nrfx_prs_release(TWIM_REG(p_instance));
 #endif
 
     if (!p_cb->hold_bus_uninit)
     {
-        nrf_gpio_cfg_default(nrf_twim_scl_pin_get(p_instance->p_twim));
-        nrf_gpio_cfg_default(nrf_twim_sda_pin_get(p_instance->p_twim));
+        nrf_gpio_cfg_default(nrf_twim_scl_pin_get(TWIM_REG(p_instance)));
+        nrf_gpio_cfg_default(nrf_twim_sda_pin_get(TWIM_REG(p_instance)));
     }
 
     p_cb->state = NRFX_DRV_STATE_UNINITIALIZED;
@@ -322,10 +387,13 @@ void nrfx_twim_uninit(nrfx_twim_t const * p_instance)
 
 void nrfx_twim_enable(nrfx_twim_t const * p_instance)
 {
-    twim_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    twim_control_block_t * p_cb = TWIM_CB(p_instance);
     NRFX_ASSERT(p_cb->state == NRFX_DRV_STATE_INITIALIZED);
 
-    nrf_twim_enable(p_instance->p_twim);
+    nrf_twim_enable(TWIM_REG(p_instance));
+#if NRFX_CHECK(NRFX_IDLE_ENABLED)
+    nrfx_idle_entry_init(&p_cb->idle, TWIM_REG(p_instance), twim_idle_enable, twim_idle_disable);
+#endif
 
     p_cb->state = NRFX_DRV_STATE_POWERED_ON;
     NRFX_LOG_INFO("Instance enabled: %d.", p_instance->drv_inst_idx);
@@ -333,10 +401,11 @@ void nrfx_twim_enable(nrfx_twim_t const * p_instance)
 
 void nrfx_twim_disable(nrfx_twim_t const * p_instance)
 {
-    twim_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    twim_control_block_t * p_cb = TWIM_CB(p_instance);
+
     NRFX_ASSERT(p_cb->state != NRFX_DRV_STATE_UNINITIALIZED);
 
-    NRF_TWIM_Type * p_twim = p_instance->p_twim;
+    NRF_TWIM_Type * p_twim = TWIM_REG(p_instance);
     p_cb->int_mask = 0;
     nrf_twim_int_disable(p_twim, NRF_TWIM_ALL_INTS_MASK);
     nrf_twim_shorts_disable(p_twim, NRF_TWIM_ALL_SHORTS_MASK);
@@ -349,10 +418,21 @@ void nrfx_twim_disable(nrfx_twim_t const * p_instance)
 
 bool nrfx_twim_is_busy(nrfx_twim_t const * p_instance)
 {
-    twim_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    twim_control_block_t * p_cb = TWIM_CB(p_instance);
     return p_cb->busy;
 }
 
+#if NRFX_CHECK(NRFX_IDLE_ENABLED)
+nrfx_idle_t const * nrfx_twim_idle_get(nrfx_twim_t const * p_instance)
+{
+    twim_control_block_t * p_cb = TWIM_CB(p_instance);
+
+    NRFX_ASSERT(p_cb->state != NRFX_DRV_STATE_UNINITIALIZED);
+
+    return &p_cb->idle;
+}
+#endif
+
 
 static void twim_list_enable_handle(NRF_TWIM_Type * p_twim, uint32_t flags)
 {
@@ -408,6 +488,10 @@ static nrfx_err_t twim_xfer(twim_control_block_t        * p_cb,
                       (NRFX_TWIM_FLAG_REPEATED_XFER & flags)) ? false: true;
     }
 
+#if NRFX_CHECK(NRFX_IDLE_ENABLED)
+    nrfx_idle_active(&p_cb->idle);
+#endif
+
     p_cb->xfer_desc = *p_xfer_desc;
     p_cb->repeated = (flags & NRFX_TWIM_FLAG_REPEATED_XFER) ? true : false;
     p_cb->flags = flags;
@@ -492,7 +576,7 @@ static nrfx_err_t twim_xfer(twim_control_block_t        * p_cb,
         nrf_twim_task_trigger(p_twim, start_task);
     }
 
-    if (p_cb->handler)
+    if (!TWIM_BLOCKING(p_cb))
     {
         if (flags & NRFX_TWIM_FLAG_NO_XFER_EVT_HANDLER)
         {
@@ -583,6 +667,9 @@ static nrfx_err_t twim_xfer(twim_control_block_t        * p_cb,
 
         uint32_t errorsrc =  nrf_twim_errorsrc_get_and_clear(p_twim);
 
+#if NRFX_CHECK(NRFX_IDLE_ENABLED)
+        nrfx_idle_inactive(&p_cb->idle, !(flags & TWIM_IDLE_KEEP_ENABLED_FLAGS));
+#endif
         p_cb->busy = false;
 
         if (errorsrc)
@@ -611,11 +698,11 @@ nrfx_err_t nrfx_twim_xfer(nrfx_twim_t           const * p_instance,
                                      p_xfer_desc->secondary_length));
 
     nrfx_err_t err_code = NRFX_SUCCESS;
-    twim_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    twim_control_block_t * p_cb = TWIM_CB(p_instance);
 
     // TXRX and TXTX transfers are supported only in non-blocking mode.
-    NRFX_ASSERT( !((p_cb->handler == NULL) && (p_xfer_desc->type == NRFX_TWIM_XFER_TXRX)));
-    NRFX_ASSERT( !((p_cb->handler == NULL) && (p_xfer_desc->type == NRFX_TWIM_XFER_TXTX)));
+    NRFX_ASSERT( !(TWIM_BLOCKING(p_cb) && (p_xfer_desc->type == NRFX_TWIM_XFER_TXRX)));
+    NRFX_ASSERT( !(TWIM_BLOCKING(p_cb) && (p_xfer_desc->type == NRFX_TWIM_XFER_TXTX)));
 
     NRFX_LOG_INFO("Transfer type: %s.", TRANSFER_TO_STR(p_xfer_desc->type));
     NRFX_LOG_INFO("Transfer buffers length: primary: %d, secondary: %d.",
@@ -628,7 +715,7 @@ nrfx_err_t nrfx_twim_xfer(nrfx_twim_t           const * p_instance,
     NRFX_LOG_HEXDUMP_DEBUG(p_xfer_desc->p_secondary_buf,
                            p_xfer_desc->secondary_length * sizeof(p_xfer_desc->p_secondary_buf[0]));
 
-    err_code = twim_xfer(p_cb, (NRF_TWIM_Type *)p_instance->p_twim, p_xfer_desc, flags);
+    err_code = twim_xfer(p_cb, TWIM_REG(p_instance), p_xfer_desc, flags);
     NRFX_LOG_WARNING("Function: %s, error code: %s.",
                      __func__,
                      NRFX_LOG_ERROR_STRING_GET(err_code));
@@ -638,13 +725,13 @@ nrfx_err_t nrfx_twim_xfer(nrfx_twim_t           const * p_instance,
 uint32_t nrfx_twim_start_task_get(nrfx_twim_t const * p_instance,
                                   nrfx_twim_xfer_type_t xfer_type)
 {
-    return nrf_twim_task_address_get(p_instance->p_twim,
+    return nrf_twim_task_address_get(TWIM_REG(p_instance),
         (xfer_type != NRFX_TWIM_XFER_RX) ? NRF_TWIM_TASK_STARTTX : NRF_TWIM_TASK_STARTRX);
 }
 
 uint32_t nrfx_twim_stopped_event_get(nrfx_twim_t const * p_instance)
 {
-    return nrf_twim_event_address_get(p_instance->p_twim, NRF_TWIM_EVENT_STOPPED);
+    return nrf_twim_event_address_get(TWIM_REG(p_instance), NRF_TWIM_EVENT_STOPPED);
 }
 
 static void twim_irq_handler(NRF_TWIM_Type * p_twim, twim_control_block_t * p_cb)
@@ -803,6 +890,9 @@ static void twim_irq_handler(NRF_TWIM_Type * p_twim, twim_control_block_t * p_cb
 
     if (!p_cb->repeated)
     {
+#if NRFX_CHECK(NRFX_IDLE_ENABLED)
+        nrfx_idle_inactive(&p_cb->idle, !(p_cb->flags & TWIM_IDLE_KEEP_ENABLED_FLAGS));
+#endif
         p_cb->busy = false;
     }
 
@@ -813,30 +903,46 @@ static void twim_irq_handler(NRF_TWIM_Type * p_twim, twim_control_block_t * p_cb
 }
 
 #if NRFX_CHECK(NRFX_TWIM0_ENABLED)
+NRFX_PROF_REGION_DEFINE(m_prof_twim0_irq);
+
 void nrfx_twim_0_irq_handler(void)
 {
+    NRFX_PROF_BEGIN(m_prof_twim0_irq);
     twim_irq_handler(NRF_TWIM0, &m_cb[NRFX_TWIM0_INST_IDX]);
+    NRFX_PROF_END(m_prof_twim0_irq);
 }
 #endif
 
 #if NRFX_CHECK(NRFX_TWIM1_ENABLED)
+NRFX_PROF_REGION_DEFINE(m_prof_twim1_irq);
+
 void nrfx_twim_1_irq_handler(void)
 {
+    NRFX_PROF_BEGIN(m_prof_twim1_irq);
     twim_irq_handler(NRF_TWIM1, &m_cb[NRFX_TWIM1_INST_IDX]);
+    NRFX_PROF_END(m_prof_twim1_irq);
 }
 #endif
 
 #if NRFX_CHECK(NRFX_TWIM2_ENABLED)
+NRFX_PROF_REGION_DEFINE(m_prof_twim2_irq);
+
 void nrfx_twim_2_irq_handler(void)
 {
+    NRFX_PROF_BEGIN(m_prof_twim2_irq);
     twim_irq_handler(NRF_TWIM2, &m_cb[NRFX_TWIM2_INST_IDX]);
+    NRFX_PROF_END(m_prof_twim2_irq);
 }
 #endif
 
 #if NRFX_CHECK(NRFX_TWIM3_ENABLED)
+NRFX_PROF_REGION_DEFINE(m_prof_twim3_irq);
+
 void nrfx_twim_3_irq_handler(void)
 {
+    NRFX_PROF_BEGIN(m_prof_twim3_irq);
     twim_irq_handler(NRF_TWIM3, &m_cb[NRFX_TWIM3_INST_IDX]);
+    NRFX_PROF_END(m_prof_twim3_irq);
 }
 #endif
 
@@ -42,6 +42,7 @@
 
 #include <nrfx_uarte.h>
 #include "prs/nrfx_prs.h"
+#include <soc/nrfx_prof.h>
 #include <hal/nrf_gpio.h>
 
 #define NRFX_LOG_MODULE UARTE
@@ -100,6 +101,35 @@ typedef struct
 } uarte_control_block_t;
 static uarte_control_block_t m_cb[NRFX_UARTE_ENABLED_COUNT];
 
+/* With a single enabled instance, its registers and control block are known at compile
+ * time, so the transfer path does not dereference the instance structure and the
+ * compiler can drop the branches that depend on the instance. */
+#if (NRFX_CHECK(NRFX_UARTE0_ENABLED) + NRFX_CHECK(NRFX_UARTE1_ENABLED) + \
+     NRFX_CHECK(NRFX_UARTE2_ENABLED) + NRFX_CHECK(NRFX_UARTE3_ENABLED)) == 1
+#if NRFX_CHECK(NRFX_UARTE0_ENABLED)
+#define UARTE_SINGLE_REG NRF_UARTE0
+#elif NRFX_CHECK(NRFX_UARTE1_ENABLED)
+#define UARTE_SINGLE_REG NRF_UARTE1
+#elif NRFX_CHECK(NRFX_UARTE2_ENABLED)
+#define UARTE_SINGLE_REG NRF_UARTE2
+#elif NRFX_CHECK(NRFX_UARTE3_ENABLED)
+#define UARTE_SINGLE_REG NRF_UARTE3
+#endif
+#define UARTE_REG(p_instance) ((void)(p_instance), UARTE_SINGLE_REG)
+#define UARTE_CB(p_instance)  ((void)(p_instance), &m_cb[0])
+#else
+#define UARTE_REG(p_instance) ((NRF_UARTE_Type *)(p_instance)->p_reg)
+#define UARTE_CB(p_instance)  (&m_cb[(p_instance)->drv_inst_idx])
+#endif
+
+/* Transfers without an event handler are polled in the calling context. When the blocking
+ * mode is disabled, the handler is required at init and the polling code is not built. */
+#if NRFX_CHECK(NRFX_UARTE_BLOCKING_ENABLED)
+#define UARTE_BLOCKING(p_cb) ((p_cb)->handler == NULL)
+#else
+#define UARTE_BLOCKING(p_cb) ((void)(p_cb), false)
+#endif
+
 static void apply_config(nrfx_uarte_t        const * p_instance,
                          nrfx_uarte_config_t const * p_config)
 {
@@ -113,9 +143,9 @@ static void apply_config(nrfx_uarte_t        const * p_instance,
         nrf_gpio_cfg_input(p_config->pselrxd, NRF_GPIO_PIN_NOPULL);
     }
 
-    nrf_uarte_baudrate_set(p_instance->p_reg, p_config->baudrate);
-    nrf_uarte_configure(p_instance->p_reg, &p_config->hal_cfg);
-    nrf_uarte_txrx_pins_set(p_instance->p_reg, p_config->pseltxd, p_config->pselrxd);
+    nrf_uarte_baudrate_set(UARTE_REG(p_instance), p_config->baudrate);
+    nrf_uarte_configure(UARTE_REG(p_instance), &p_config->hal_cfg);
+    nrf_uarte_txrx_pins_set(UARTE_REG(p_instance), p_config->pseltxd, p_config->pselrxd);
     if (p_config->hal_cfg.hwfc == NRF_UARTE_HWFC_ENABLED)
     {
         if (p_config->pselcts != NRF_UARTE_PSEL_DISCONNECTED)
@@ -127,36 +157,36 @@ static void apply_config(nrfx_uarte_t        const * p_instance,
             nrf_gpio_pin_set(p_config->pselrts);
             nrf_gpio_cfg_output(p_config->pselrts);
         }
-        nrf_uarte_hwfc_pins_set(p_instance->p_reg, p_config->pselrts, p_config->pselcts);
+        nrf_uarte_hwfc_pins_set(UARTE_REG(p_instance), p_config->pselrts, p_config->pselcts);
     }
 }
 
 static void interrupts_enable(nrfx_uarte_t const * p_instance,
                               uint8_t              interrupt_priority)
 {
-    nrf_uarte_event_clear(p_instance->p_reg, NRF_UARTE_EVENT_ENDRX);
-    nrf_uarte_event_clear(p_instance->p_reg, NRF_UARTE_EVENT_ENDTX);
-    nrf_uarte_event_clear(p_instance->p_reg, NRF_UARTE_EVENT_ERROR);
-    nrf_uarte_event_clear(p_instance->p_reg, NRF_UARTE_EVENT_RXTO);
-    nrf_uarte_event_clear(p_instance->p_reg, NRF_UARTE_EVENT_TXSTOPPED);
-    nrf_uarte_int_enable(p_instance->p_reg, NRF_UARTE_INT_ENDRX_MASK |
+    nrf_uarte_event_clear(UARTE_REG(p_instance), NRF_UARTE_EVENT_ENDRX);
+    nrf_uarte_event_clear(UARTE_REG(p_instance), NRF_UARTE_EVENT_ENDTX);
+    nrf_uarte_event_clear(UARTE_REG(p_instance), NRF_UARTE_EVENT_ERROR);
+    nrf_uarte_event_clear(UARTE_REG(p_instance), NRF_UARTE_EVENT_RXTO);
+    nrf_uarte_event_clear(UARTE_REG(p_instance), NRF_UARTE_EVENT_TXSTOPPED);
+    nrf_uarte_int_enable(UARTE_REG(p_instance), NRF_UARTE_INT_ENDRX_MASK |
                                             NRF_UARTE_INT_ENDTX_MASK |
                                             NRF_UARTE_INT_ERROR_MASK |
                                             NRF_UARTE_INT_RXTO_MASK  |
                                             NRF_UARTE_INT_TXSTOPPED_MASK);
-    NRFX_IRQ_PRIORITY_SET(nrfx_get_irq_number((void *)p_instance->p_reg),
+    NRFX_IRQ_PRIORITY_SET(nrfx_get_irq_number((void *)UARTE_REG(p_instance)),
                           interrupt_priority);
-    NRFX_IRQ_ENABLE(nrfx_get_irq_number((void *)p_instance->p_reg));
+    NRFX_IRQ_ENABLE(nrfx_get_irq_number((void *)UARTE_REG(p_instance)));
 }
 
 static void interrupts_disable(nrfx_uarte_t const * p_instance)
 {
-    nrf_uarte_int_disable(p_instance->p_reg, NRF_UARTE_INT_ENDRX_MASK |
+    nrf_uarte_int_disable(UARTE_REG(p_instance), NRF_UARTE_INT_ENDRX_MASK |
                                              NRF_UARTE_INT_ENDTX_MASK |
                                              NRF_UARTE_INT_ERROR_MASK |
                                              NRF_UARTE_INT_RXTO_MASK  |
                                              NRF_UARTE_INT_TXSTOPPED_MASK);
-    NRFX_IRQ_DISABLE(nrfx_get_irq_number((void *)p_instance->p_reg));
+    NRFX_IRQ_DISABLE(nrfx_get_irq_number((void *)UARTE_REG(p_instance)));
 }
 
 static void pins_to_default(nrfx_uarte_t const * p_instance)
@@ -167,12 +197,12 @@ static void pins_to_default(nrfx_uarte_t const * p_instance)
     uint32_t rts;
     uint32_t cts;
 
-    txd = nrf_uarte_tx_pin_get(p_instance->p_reg);
-    rxd = nrf_uarte_rx_pin_get(p_instance->p_reg);
-    rts = nrf_uarte_rts_pin_get(p_instance->p_reg);
-    cts = nrf_uarte_cts_pin_get(p_instance->p_reg);
-    nrf_uarte_txrx_pins_disconnect(p_instance->p_reg);
-    nrf_uarte_hwfc_pins_disconnect(p_instance->p_reg);
+    txd = nrf_uarte_tx_pin_get(UARTE_REG(p_instance));
+    rxd = nrf_uarte_rx_pin_get(UARTE_REG(p_instance));
+    rts = nrf_uarte_rts_pin_get(UARTE_REG(p_instance));
+    cts = nrf_uarte_cts_pin_get(UARTE_REG(p_instance));
+    nrf_uarte_txrx_pins_disconnect(UARTE_REG(p_instance));
+    nrf_uarte_hwfc_pins_disconnect(UARTE_REG(p_instance));
 
     if (txd != NRF_UARTE_PSEL_DISCONNECTED)
     {
@@ -199,19 +229,19 @@ static void apply_workaround_for_enable_anomaly(nrfx_uarte_t const * p_instance)
     // - nRF9160 - anomaly 23
     // - nRF5340 - anomaly 44
     volatile uint32_t const * rxenable_reg =
-        (volatile uint32_t *)(((uint32_t)p_instance->p_reg) + 0x564);
+        (volatile uint32_t *)(((uint32_t)UARTE_REG(p_instance)) + 0x564);
     volatile uint32_t const * txenable_reg =
-        (volatile uint32_t *)(((uint32_t)p_instance->p_reg) + 0x568);
+        (volatile uint32_t *)(((uint32_t)UARTE_REG(p_instance)) + 0x568);
 
     if (*txenable_reg == 1)
     {
-        nrf_uarte_task_trigger(p_instance->p_reg, NRF_UARTE_TASK_STOPTX);
+        nrf_uarte_task_trigger(UARTE_REG(p_instance), NRF_UARTE_TASK_STOPTX);
     }
 
     if (*rxenable_reg == 1)
     {
-        nrf_uarte_enable(p_instance->p_reg);
-        nrf_uarte_task_trigger(p_instance->p_reg, NRF_UARTE_TASK_STOPRX);
+        nrf_uarte_enable(UARTE_REG(p_instance));
+        nrf_uarte_task_trigger(UARTE_REG(p_instance), NRF_UARTE_TASK_STOPRX);
 
         bool workaround_succeded;
         // The UARTE is able to receive up to four bytes after the STOPRX task has been triggered.
@@ -221,11 +251,11 @@ static void apply_workaround_for_enable_anomaly(nrfx_uarte_t const * p_instance)
         if (!workaround_succeded)
         {
             NRFX_LOG_ERROR("Failed to apply workaround for instance with base address: %p.",
-                           (void *)p_instance->p_reg);
+                           (void *)UARTE_REG(p_instance));
         }
 
-        (void)nrf_uarte_errorsrc_get_and_clear(p_instance->p_reg);
-        nrf_uarte_disable(p_instance->p_reg);
+        (void)nrf_uarte_errorsrc_get_and_clear(UARTE_REG(p_instance));
+        nrf_uarte_disable(UARTE_REG(p_instance));
     }
 #else
     (void)(p_instance);
@@ -237,7 +267,8 @@ nrfx_err_t nrfx_uarte_init(nrfx_uarte_t const *        p_instance,
                            nrfx_uarte_event_handler_t  event_handler)
 {
     NRFX_ASSERT(p_config);
-    uarte_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    NRFX_ASSERT(UARTE_REG(p_instance) == p_instance->p_reg);
+    uarte_control_block_t * p_cb = UARTE_CB(p_instance);
     nrfx_err_t err_code = NRFX_SUCCESS;
 
     if (p_cb->state != NRFX_DRV_STATE_UNINITIALIZED)
@@ -249,6 +280,17 @@ nrfx_err_t nrfx_uarte_init(nrfx_uarte_t const *        p_instance,
         return err_code;
     }
 
+#if !NRFX_CHECK(NRFX_UARTE_BLOCKING_ENABLED)
+    if (event_handler == NULL)
+    {
+        err_code = NRFX_ERROR_NOT_SUPPORTED;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+#endif
+
 #if NRFX_CHECK(NRFX_PRS_ENABLED)
     static nrfx_irq_handler_t const irq_handlers[NRFX_UARTE_ENABLED_COUNT] = {
         #if NRFX_CHECK(NRFX_UARTE0_ENABLED)
@@ -264,7 +306,7 @@ nrfx_err_t nrfx_uarte_init(nrfx_uarte_t const *        p_instance,
         nrfx_uarte_3_irq_handler,
         #endif
     };
-    if (nrfx_prs_acquire(p_instance->p_reg,
+    if (nrfx_prs_acquire(UARTE_REG(p_instance),
             irq_handlers[p_instance->drv_inst_idx]) != NRFX_SUCCESS)
     {
         err_code = NRFX_ERROR_BUSY;
@@ -282,12 +324,12 @@ nrfx_err_t nrfx_uarte_init(nrfx_uarte_t const *        p_instance,
     p_cb->handler   = event_handler;
     p_cb->p_context = p_config->p_context;
 
-    if (p_cb->handler)
+    if (!UARTE_BLOCKING(p_cb))
     {
         interrupts_enable(p_instance, p_config->interrupt_priority);
     }
 
-    nrf_uarte_enable(p_instance->p_reg);
+    nrf_uarte_enable(UARTE_REG(p_instance));
     p_cb->rx_buffer_length           = 0;
     p_cb->rx_secondary_buffer_length = 0;
     p_cb->tx_buffer_length           = 0;
@@ -300,10 +342,10 @@ nrfx_err_t nrfx_uarte_init(nrfx_uarte_t const *        p_instance,
 
 void nrfx_uarte_uninit(nrfx_uarte_t const * p_instance)
 {
-    uarte_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
-    NRF_UARTE_Type * p_reg = p_instance->p_reg;
+    uarte_control_block_t * p_cb = UARTE_CB(p_instance);
+    NRF_UARTE_Type * p_reg = UARTE_REG(p_instance);
 
-    if (p_cb->handler)
+    if (!UARTE_BLOCKING(p_cb))
     {
         interrupts_disable(p_instance);
     }
@@ -332,7 +374,7 @@ void nrfx_uarte_uninit(nrfx_uarte_t const * p_instance)
                   40000, 1, stopped);
     if (!stopped)
     {
-        NRFX_LOG_ERROR("Failed to stop instance with base address: %p.", (void *)p_instance->p_reg);
+        NRFX_LOG_ERROR("Failed to stop instance with base address: %p.", (void *)UARTE_REG(p_instance));
     }
 
     nrf_uarte_disable(p_reg);
@@ -351,7 +393,8 @@ nrfx_err_t nrfx_uarte_tx(nrfx_uarte_t const * p_instance,
                          uint8_t const *      p_data,
                          size_t               length)
 {
-    uarte_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    uarte_control_block_t * p_cb  = UARTE_CB(p_instance);
+    NRF_UARTE_Type *        p_reg = UARTE_REG(p_instance);
     NRFX_ASSERT(p_cb->state == NRFX_DRV_STATE_INITIALIZED);
     NRFX_ASSERT(p_data);
     NRFX_ASSERT(length > 0);
@@ -388,19 +431,19 @@ nrfx_err_t nrfx_uarte_tx(nrfx_uarte_t const * p_instance,
 
     err_code = NRFX_SUCCESS;
 
-    nrf_uarte_event_clear(p_instance->p_reg, NRF_UARTE_EVENT_ENDTX);
-    nrf_uarte_event_clear(p_instance->p_reg, NRF_UARTE_EVENT_TXSTOPPED);
-    nrf_uarte_tx_buffer_set(p_instance->p_reg, p_cb->p_tx_buffer, p_cb->tx_buffer_length);
-    nrf_uarte_task_trigger(p_instance->p_reg, NRF_UARTE_TASK_STARTTX);
+    nrf_uarte_event_clear(p_reg, NRF_UARTE_EVENT_ENDTX);
+    nrf_uarte_event_clear(p_reg, NRF_UARTE_EVENT_TXSTOPPED);
+    nrf_uarte_tx_buffer_set(p_reg, p_cb->p_tx_buffer, p_cb->tx_buffer_length);
+    nrf_uarte_task_trigger(p_reg, NRF_UARTE_TASK_STARTTX);
 
-    if (p_cb->handler == NULL)
+    if (UARTE_BLOCKING(p_cb))
     {
         bool endtx;
         bool txstopped;
         do
         {
-            endtx     = nrf_uarte_event_check(p_instance->p_reg, NRF_UARTE_EVENT_ENDTX);
-            txstopped = nrf_uarte_event_check(p_instance->p_reg, NRF_UARTE_EVENT_TXSTOPPED);
+            endtx     = nrf_uarte_event_check(p_reg, NRF_UARTE_EVENT_ENDTX);
+            txstopped = nrf_uarte_event_check(p_reg, NRF_UARTE_EVENT_TXSTOPPED);
         }
         while ((!endtx) && (!txstopped));
 
@@ -412,9 +455,9 @@ nrfx_err_t nrfx_uarte_tx(nrfx_uarte_t const * p_instance,
         {
             // Transmitter has to be stopped by triggering the STOPTX task to achieve
             // the lowest possible level of the UARTE power consumption.
-            nrf_uarte_task_trigger(p_instance->p_reg, NRF_UARTE_TASK_STOPTX);
+            nrf_uarte_task_trigger(p_reg, NRF_UARTE_TASK_STOPTX);
 
-            while (!nrf_uarte_event_check(p_instance->p_reg, NRF_UARTE_EVENT_TXSTOPPED))
+            while (!nrf_uarte_event_check(p_reg, NRF_UARTE_EVENT_TXSTOPPED))
             {}
         }
         p_cb->tx_buffer_length = 0;
@@ -426,16 +469,17 @@ nrfx_err_t nrfx_uarte_tx(nrfx_uarte_t const * p_instance,
 
 bool nrfx_uarte_tx_in_progress(nrfx_uarte_t const * p_instance)
 {
-    return (m_cb[p_instance->drv_inst_idx].tx_buffer_length != 0);
+    return (UARTE_CB(p_instance)->tx_buffer_length != 0);
 }
 
 nrfx_err_t nrfx_uarte_rx(nrfx_uarte_t const * p_instance,
                          uint8_t *            p_data,
                          size_t               length)
 {
-    uarte_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    uarte_control_block_t * p_cb  = UARTE_CB(p_instance);
+    NRF_UARTE_Type *        p_reg = UARTE_REG(p_instance);
 
-    NRFX_ASSERT(m_cb[p_instance->drv_inst_idx].state == NRFX_DRV_STATE_INITIALIZED);
+    NRFX_ASSERT(p_cb->state == NRFX_DRV_STATE_INITIALIZED);
     NRFX_ASSERT(p_data);
     NRFX_ASSERT(length > 0);
     NRFX_ASSERT(UARTE_LENGTH_VALIDATE(p_instance->drv_inst_idx, length));
@@ -455,19 +499,19 @@ nrfx_err_t nrfx_uarte_rx(nrfx_uarte_t const * p_instance,
 
     bool second_buffer = false;
 
-    if (p_cb->handler)
+    if (!UARTE_BLOCKING(p_cb))
     {
-        nrf_uarte_int_disable(p_instance->p_reg, NRF_UARTE_INT_ERROR_MASK |
-                                                 NRF_UARTE_INT_ENDRX_MASK);
+        nrf_uarte_int_disable(p_reg, NRF_UARTE_INT_ERROR_MASK |
+                                     NRF_UARTE_INT_ENDRX_MASK);
     }
     if (p_cb->rx_buffer_length != 0)
     {
         if (p_cb->rx_secondary_buffer_length != 0)
         {
-            if (p_cb->handler)
+            if (!UARTE_BLOCKING(p_cb))
             {
-                nrf_uarte_int_enable(p_instance->p_reg, NRF_UARTE_INT_ERROR_MASK |
-                                                        NRF_UARTE_INT_ENDRX_MASK);
+                nrf_uarte_int_enable(p_reg, NRF_UARTE_INT_ERROR_MASK |
+                                            NRF_UARTE_INT_ENDRX_MASK);
             }
             err_code = NRFX_ERROR_BUSY;
             NRFX_LOG_WARNING("Function: %s, error code: %s.",
@@ -494,30 +538,30 @@ nrfx_err_t nrfx_uarte_rx(nrfx_uarte_t const * p_instance,
 
     err_code = NRFX_SUCCESS;
 
-    nrf_uarte_event_clear(p_instance->p_reg, NRF_UARTE_EVENT_ENDRX);
-    nrf_uarte_event_clear(p_instance->p_reg, NRF_UARTE_EVENT_RXTO);
-    nrf_uarte_rx_buffer_set(p_instance->p_reg, p_data, length);
+    nrf_uarte_event_clear(p_reg, NRF_UARTE_EVENT_ENDRX);
+    nrf_uarte_event_clear(p_reg, NRF_UARTE_EVENT_RXTO);
+    nrf_uarte_rx_buffer_set(p_reg, p_data, length);
     if (!second_buffer)
     {
-        nrf_uarte_task_trigger(p_instance->p_reg, NRF_UARTE_TASK_STARTRX);
+        nrf_uarte_task_trigger(p_reg, NRF_UARTE_TASK_STARTRX);
     }
     else
     {
-        nrf_uarte_shorts_enable(p_instance->p_reg, NRF_UARTE_SHORT_ENDRX_STARTRX);
+        nrf_uarte_shorts_enable(p_reg, NRF_UARTE_SHORT_ENDRX_STARTRX);
     }
 
-    if (m_cb[p_instance->drv_inst_idx].handler == NULL)
+    if (UARTE_BLOCKING(p_cb))
     {
         bool endrx;
         bool rxto;
         bool error;
         do {
-            endrx  = nrf_uarte_event_check(p_instance->p_reg, NRF_UARTE_EVENT_ENDRX);
-            rxto   = nrf_uarte_event_check(p_instance->p_reg, NRF_UARTE_EVENT_RXTO);
-            error  = nrf_uarte_event_check(p_instance->p_reg, NRF_UARTE_EVENT_ERROR);
+            endrx  = nrf_uarte_event_check(p_reg, NRF_UARTE_EVENT_ENDRX);
+            rxto   = nrf_uarte_event_check(p_reg, NRF_UARTE_EVENT_RXTO);
+            error  = nrf_uarte_event_check(p_reg, NRF_UARTE_EVENT_ERROR);
         } while ((!endrx) && (!rxto) && (!error));
 
-        m_cb[p_instance->drv_inst_idx].rx_buffer_length = 0;
+        p_cb->rx_buffer_length = 0;
 
         if (error)
         {
@@ -532,8 +576,8 @@ nrfx_err_t nrfx_uarte_rx(nrfx_uarte_t const * p_instance,
     else
     {
         p_cb->rx_aborted = false;
-        nrf_uarte_int_enable(p_instance->p_reg, NRF_UARTE_INT_ERROR_MASK |
-                                                NRF_UARTE_INT_ENDRX_MASK);
+        nrf_uarte_int_enable(p_reg, NRF_UARTE_INT_ERROR_MASK |
+                                    NRF_UARTE_INT_ENDRX_MASK);
     }
     NRFX_LOG_INFO("Function: %s, error code: %s.", __func__, NRFX_LOG_ERROR_STRING_GET(err_code));
     return err_code;
@@ -541,13 +585,15 @@ nrfx_err_t nrfx_uarte_rx(nrfx_uarte_t const * p_instance,
 
 bool nrfx_uarte_rx_ready(nrfx_uarte_t const * p_instance)
 {
-    return nrf_uarte_event_check(p_instance->p_reg, NRF_UARTE_EVENT_ENDRX);
+    return nrf_uarte_event_check(UARTE_REG(p_instance), NRF_UARTE_EVENT_ENDRX);
 }
 
 uint32_t nrfx_uarte_errorsrc_get(nrfx_uarte_t const * p_instance)
 {
-    nrf_uarte_event_clear(p_instance->p_reg, NRF_UARTE_EVENT_ERROR);
-    return nrf_uarte_errorsrc_get_and_clear(p_instance->p_reg);
+    NRF_UARTE_Type * p_reg = UARTE_REG(p_instance);
+
+    nrf_uarte_event_clear(p_reg, NRF_UARTE_EVENT_ERROR);
+    return nrf_uarte_errorsrc_get_and_clear(p_reg);
 }
 
 static void rx_done_event(uarte_control_block_t * p_cb,
@@ -579,13 +625,14 @@ static void tx_done_event(uarte_control_block_t * p_cb,
 
 void nrfx_uarte_tx_abort(nrfx_uarte_t const * p_instance)
 {
-    uarte_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    uarte_control_block_t * p_cb  = UARTE_CB(p_instance);
+    NRF_UARTE_Type *        p_reg = UARTE_REG(p_instance);
 
-    nrf_uarte_event_clear(p_instance->p_reg, NRF_UARTE_EVENT_TXSTOPPED);
-    nrf_uarte_task_trigger(p_instance->p_reg, NRF_UARTE_TASK_STOPTX);
-    if (p_cb->handler == NULL)
+    nrf_uarte_event_clear(p_reg, NRF_UARTE_EVENT_TXSTOPPED);
+    nrf_uarte_task_trigger(p_reg, NRF_UARTE_TASK_STOPTX);
+    if (UARTE_BLOCKING(p_cb))
     {
-        while (!nrf_uarte_event_check(p_instance->p_reg, NRF_UARTE_EVENT_TXSTOPPED))
+        while (!nrf_uarte_event_check(p_reg, NRF_UARTE_EVENT_TXSTOPPED))
         {}
     }
     NRFX_LOG_INFO("TX transaction aborted.");
@@ -593,16 +640,17 @@ void nrfx_uarte_tx_abort(nrfx_uarte_t const * p_instance)
 
 void nrfx_uarte_rx_abort(nrfx_uarte_t const * p_instance)
 {
-    uarte_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    uarte_control_block_t * p_cb  = UARTE_CB(p_instance);
+    NRF_UARTE_Type *        p_reg = UARTE_REG(p_instance);
 
     // Short between ENDRX event and STARTRX task must be disabled before
     // aborting transmission.
     if (p_cb->rx_secondary_buffer_length != 0)
     {
-        nrf_uarte_shorts_disable(p_instance->p_reg, NRF_UARTE_SHORT_ENDRX_STARTRX);
+        nrf_uarte_shorts_disable(p_reg, NRF_UARTE_SHORT_ENDRX_STARTRX);
     }
     p_cb->rx_aborted = true;
-    nrf_uarte_task_trigger(p_instance->p_reg, NRF_UARTE_TASK_STOPRX);
+    nrf_uarte_task_trigger(p_reg, NRF_UARTE_TASK_STOPRX);
     NRFX_LOG_INFO("RX transaction aborted.");
 }
 
@@ -690,30 +738,46 @@ static void uarte_irq_handler(NRF_UARTE_Type *        p_uarte,
 }
 
 #if NRFX_CHECK(NRFX_UARTE0_ENABLED)
+NRFX_PROF_REGION_DEFINE(m_prof_uarte0_irq);
+
 void nrfx_uarte_0_irq_handler(void)
 {
+    NRFX_PROF_BEGIN(m_prof_uarte0_irq);
     uarte_irq_handler(NRF_UARTE0, &m_cb[NRFX_UARTE0_INST_IDX]);
+    NRFX_PROF_END(m_prof_uarte0_irq);
 }
 #endif
 
 #if NRFX_CHECK(NRFX_UARTE1_ENABLED)
+NRFX_PROF_REGION_DEFINE(m_prof_uarte1_irq);
+
 void nrfx_uarte_1_irq_handler(void)
 {
+    NRFX_PROF_BEGIN(m_prof_uarte1_irq);
     uarte_irq_handler(NRF_UARTE1, &m_cb[NRFX_UARTE1_INST_IDX]);
+    NRFX_PROF_END(m_prof_uarte1_irq);
 }
 #endif
 
 #if NRFX_CHECK(NRFX_UARTE2_ENABLED)
+NRFX_PROF_REGION_DEFINE(m_prof_uarte2_irq);
+
 void nrfx_uarte_2_irq_handler(void)
 {
+    NRFX_PROF_BEGIN(m_prof_uarte2_irq);
     uarte_irq_handler(NRF_UARTE2, &m_cb[NRFX_UARTE2_INST_IDX]);
+    NRFX_PROF_END(m_prof_uarte2_irq);
 }
 #endif
 
 #if NRFX_CHECK(NRFX_UARTE3_ENABLED)
+NRFX_PROF_REGION_DEFINE(m_prof_uarte3_irq);
+
 void nrfx_uarte_3_irq_handler(void)
 {
+    NRFX_PROF_BEGIN(m_prof_uarte3_irq);
     uarte_irq_handler(NRF_UARTE3, &m_cb[NRFX_UARTE3_INST_IDX]);
+    NRFX_PROF_END(m_prof_uarte3_irq);
 }
 #endif
 
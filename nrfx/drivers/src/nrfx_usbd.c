@@ -35,6 +35,7 @@
 
 #include <nrfx_usbd.h>
 #include "nrfx_usbd_errata.h"
+#include <soc/nrfx_atomic.h>
 #include <string.h>
 
 #define NRFX_LOG_MODULE USBD
@@ -257,7 +258,7 @@ static uint32_t m_ep_ready;
  * Mask prepared USBD data for transmission.
  * It is cleared when no more data to transmit left.
  */
-static nrfx_atomic_t m_ep_dma_waiting;
+static nrfx_atomic_u32_t m_ep_dma_waiting;
 
 /**
  * @brief Current EasyDMA state.
@@ -777,7 +778,7 @@ static inline void usbd_ep_abort(nrfx_usbd_ep_t ep)
         else
         {
             p_state->handler.consumer = NULL;
-            m_ep_dma_waiting &= ~(1U << ep2bit(ep));
+            (void)nrfx_atomic_u32_fetch_and(&m_ep_dma_waiting, ~(1U << ep2bit(ep)));
             m_ep_ready &= ~(1U << ep2bit(ep));
         }
         /* Aborted */
@@ -808,7 +809,7 @@ static inline void usbd_ep_abort(nrfx_usbd_ep_t ep)
         if ((m_ep_dma_waiting | (~m_ep_ready)) & (1U << ep2bit(ep)))
         {
             /* Device -> Host */
-            m_ep_dma_waiting &= ~(1U << ep2bit(ep));
+            (void)nrfx_atomic_u32_fetch_and(&m_ep_dma_waiting, ~(1U << ep2bit(ep)));
             m_ep_ready       |=   1U << ep2bit(ep) ;
 
             p_state->handler.feeder = NULL;
@@ -904,11 +905,11 @@ static inline void nrf_usbd_ep0in_dma_handler(void)
     if (NRFX_USBD_EP_ABORTED == p_state->status)
     {
         /* Clear transfer information just in case */
-        (void)(NRFX_ATOMIC_FETCH_AND(&m_ep_dma_waiting, ~(1U << ep2bit(ep))));
+        (void)(nrfx_atomic_u32_fetch_and(&m_ep_dma_waiting, ~(1U << ep2bit(ep))));
     }
     else if (p_state->handler.feeder == NULL)
     {
-        (void)(NRFX_ATOMIC_FETCH_AND(&m_ep_dma_waiting, ~(1U << ep2bit(ep))));
+        (void)(nrfx_atomic_u32_fetch_and(&m_ep_dma_waiting, ~(1U << ep2bit(ep))));
     }
     else
     {
@@ -937,11 +938,11 @@ static inline void nrf_usbd_epin_dma_handler(nrfx_usbd_ep_t ep)
     if (NRFX_USBD_EP_ABORTED == p_state->status)
     {
         /* Clear transfer information just in case */
-        (void)(NRFX_ATOMIC_FETCH_AND(&m_ep_dma_waiting, ~(1U << ep2bit(ep))));
+        (void)(nrfx_atomic_u32_fetch_and(&m_ep_dma_waiting, ~(1U << ep2bit(ep))));
     }
     else if (p_state->handler.feeder == NULL)
     {
-        (void)(NRFX_ATOMIC_FETCH_AND(&m_ep_dma_waiting, ~(1U << ep2bit(ep))));
+        (void)(nrfx_atomic_u32_fetch_and(&m_ep_dma_waiting, ~(1U << ep2bit(ep))));
     }
     else
     {
@@ -966,11 +967,11 @@ static inline void nrf_usbd_epiniso_dma_handler(nrfx_usbd_ep_t ep)
     if (NRFX_USBD_EP_ABORTED == p_state->status)
     {
         /* Clear transfer information just in case */
-        (void)(NRFX_ATOMIC_FETCH_AND(&m_ep_dma_waiting, ~(1U << ep2bit(ep))));
+        (void)(nrfx_atomic_u32_fetch_and(&m_ep_dma_waiting, ~(1U << ep2bit(ep))));
     }
     else if (p_state->handler.feeder == NULL)
     {
-        (void)(NRFX_ATOMIC_FETCH_AND(&m_ep_dma_waiting, ~(1U << ep2bit(ep))));
+        (void)(nrfx_atomic_u32_fetch_and(&m_ep_dma_waiting, ~(1U << ep2bit(ep))));
         /* Send event to the user - for an ISO IN endpoint, the whole transfer is finished in this moment */
         NRFX_USBD_EP_TRANSFER_EVENT(evt, ep, NRFX_USBD_EP_OK);
         m_event_handler(&evt);
@@ -997,11 +998,11 @@ static inline void nrf_usbd_ep0out_dma_handler(void)
     if (NRFX_USBD_EP_ABORTED == p_state->status)
     {
         /* Clear transfer information just in case */
-        (void)(NRFX_ATOMIC_FETCH_AND(&m_ep_dma_waiting, ~(1U << ep2bit(ep))));
+        (void)(nrfx_atomic_u32_fetch_and(&m_ep_dma_waiting, ~(1U << ep2bit(ep))));
     }
     else if (p_state->handler.consumer == NULL)
     {
-        (void)(NRFX_ATOMIC_FETCH_AND(&m_ep_dma_waiting, ~(1U << ep2bit(ep))));
+        (void)(nrfx_atomic_u32_fetch_and(&m_ep_dma_waiting, ~(1U << ep2bit(ep))));
         /* Send event to the user - for an OUT endpoint, the whole transfer is finished in this moment */
         NRFX_USBD_EP_TRANSFER_EVENT(evt, ep, NRFX_USBD_EP_OK);
         m_event_handler(&evt);
@@ -1031,11 +1032,11 @@ static inline void nrf_usbd_epout_dma_handler(nrfx_usbd_ep_t ep)
     if (NRFX_USBD_EP_ABORTED == p_state->status)
     {
         /* Clear transfer information just in case */
-        (void)(NRFX_ATOMIC_FETCH_AND(&m_ep_dma_waiting, ~(1U << ep2bit(ep))));
+        (void)(nrfx_atomic_u32_fetch_and(&m_ep_dma_waiting, ~(1U << ep2bit(ep))));
     }
     else if (p_state->handler.consumer == NULL)
     {
-        (void)(NRFX_ATOMIC_FETCH_AND(&m_ep_dma_waiting, ~(1U << ep2bit(ep))));
+        (void)(nrfx_atomic_u32_fetch_and(&m_ep_dma_waiting, ~(1U << ep2bit(ep))));
         /* Send event to the user - for an OUT endpoint, the whole transfer is finished in this moment */
         NRFX_USBD_EP_TRANSFER_EVENT(evt, ep, NRFX_USBD_EP_OK);
         m_event_handler(&evt);
@@ -1070,7 +1071,7 @@ static inline void nrf_usbd_epoutiso_dma_handler(nrfx_usbd_ep_t ep)
     }
     else if (p_state->handler.consumer == NULL)
     {
-        (void)(NRFX_ATOMIC_FETCH_AND(&m_ep_dma_waiting, ~(1U << ep2bit(ep))));
+        (void)(nrfx_atomic_u32_fetch_and(&m_ep_dma_waiting, ~(1U << ep2bit(ep))));
         /* Send event to the user - for an OUT endpoint, the whole transfer is finished in this moment */
         NRFX_USBD_EP_TRANSFER_EVENT(evt, ep, NRFX_USBD_EP_OK);
         m_event_handler(&evt);
@@ -1203,7 +1204,7 @@ static void ev_setup_handler(void)
          (USBD_BMREQUESTTYPE_DIRECTION_HostToDevice << USBD_BMREQUESTTYPE_DIRECTION_Pos)) ?
         NRFX_USBD_EPOUT0 : NRFX_USBD_EPIN0;
 
-    (void)(NRFX_ATOMIC_FETCH_AND(
+    (void)(nrfx_atomic_u32_fetch_and(
         &m_ep_dma_waiting,
         ~((1U << ep2bit(NRFX_USBD_EPOUT0)) | (1U << ep2bit(NRFX_USBD_EPIN0)))));
     m_ep_ready |= 1U << ep2bit(NRFX_USBD_EPIN0);
@@ -1389,7 +1390,7 @@ static void usbd_dmareq_process(void)
                 {
                     NRFX_LOG_DEBUG("Endpoint %x overload (r: %u, e: %u)", ep, rx_size, transfer.size);
                     p_state->status = NRFX_USBD_EP_OVERLOAD;
-                    (void)(NRFX_ATOMIC_FETCH_AND(&m_ep_dma_waiting, ~(1U << pos)));
+                    (void)(nrfx_atomic_u32_fetch_and(&m_ep_dma_waiting, ~(1U << pos)));
                     NRFX_USBD_EP_TRANSFER_EVENT(evt, ep, NRFX_USBD_EP_OVERLOAD);
                     m_event_handler(&evt);
                     /* This endpoint will not be transmitted now, repeat the loop */
@@ -1885,7 +1886,7 @@ void nrfx_usbd_ep_enable(nrfx_usbd_ep_t ep)
     {
         NRFX_CRITICAL_SECTION_ENTER();
         nrfx_usbd_transfer_out_drop(ep);
-        m_ep_dma_waiting &= ~(1U << ep2bit(ep));
+        (void)nrfx_atomic_u32_fetch_and(&m_ep_dma_waiting, ~(1U << ep2bit(ep)));
         NRFX_CRITICAL_SECTION_EXIT();
     }
 }
@@ -2024,7 +2025,7 @@ nrfx_err_t nrfx_usbd_ep_transfer(
 
         p_state->transfer_cnt = 0;
         p_state->status    =  NRFX_USBD_EP_OK;
-        m_ep_dma_waiting   |= 1U << ep_bitpos;
+        (void)nrfx_atomic_u32_fetch_or(&m_ep_dma_waiting, 1U << ep_bitpos);
         ret = NRFX_SUCCESS;
         usbd_int_rise();
     }
@@ -2068,7 +2069,7 @@ nrfx_err_t nrfx_usbd_ep_handled_transfer(
         p_state->handler   = p_handler->handler;
         p_state->p_context = p_handler->p_context;
         p_state->status    =  NRFX_USBD_EP_OK;
-        m_ep_dma_waiting   |= 1U << ep_bitpos;
+        (void)nrfx_atomic_u32_fetch_or(&m_ep_dma_waiting, 1U << ep_bitpos);
 
         ret = NRFX_SUCCESS;
         if (NRFX_USBD_ISO_DEBUG || (!NRF_USBD_EPISO_CHECK(ep)))
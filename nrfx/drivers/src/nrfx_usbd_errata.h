@@ -33,7 +33,7 @@
 #define NRFX_USBD_ERRATA_H__
 
 #include <nrfx.h>
-#include <nrf_erratas.h>
+#include <soc/nrfx_errata.h>
 
 #ifndef NRFX_USBD_ERRATA_ENABLE
 /**
@@ -47,25 +47,25 @@
 /* Errata: ISO double buffering not functional. **/
 static inline bool nrfx_usbd_errata_166(void)
 {
-    return NRFX_USBD_ERRATA_ENABLE && nrf52_errata_166();
+    return NRFX_USBD_ERRATA_ENABLE && nrfx_errata_check(166);
 }
 
 /* Errata: USBD might not reach its active state. **/
 static inline bool nrfx_usbd_errata_171(void)
 {
-    return NRFX_USBD_ERRATA_ENABLE && nrf52_errata_171();
+    return NRFX_USBD_ERRATA_ENABLE && nrfx_errata_check(171);
 }
 
 /* Errata: USB cannot be enabled. **/
 static inline bool nrfx_usbd_errata_187(void)
 {
-    return NRFX_USBD_ERRATA_ENABLE && nrf52_errata_187();
+    return NRFX_USBD_ERRATA_ENABLE && nrfx_errata_check(187);
 }
 
 /* Errata: USBD cannot receive tasks during DMA. **/
 static inline bool nrfx_usbd_errata_199(void)
 {
-    return NRFX_USBD_ERRATA_ENABLE && nrf52_errata_199();
+    return NRFX_USBD_ERRATA_ENABLE && nrfx_errata_check(199);
 }
 
 #endif // NRFX_USBD_ERRATA_H__
@@ -0,0 +1,322 @@
+/*
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <nrfx.h>
+
+#if NRFX_CHECK(NRFX_WDT_MONITOR_ENABLED)
+
+#if !NRFX_CHECK(NRFX_WDT_ENABLED) || NRFX_CHECK(NRFX_WDT_CONFIG_NO_IRQ)
+#error "WDT driver with interrupt support must be enabled to use the liveness monitor."
+#endif
+
+#include <nrfx_wdt_monitor.h>
+
+#define NRFX_LOG_MODULE WDT_MONITOR
+#include <nrfx_log.h>
+
+#define RECORD_MAGIC      0x4D544457UL // "WDTM"
+
+// All EXC_RETURN values have the top 8 bits set.
+#define EXC_RETURN_PREFIX 0xFF000000UL
+
+// Exception frame layout.
+#define FRAME_LR          5
+#define FRAME_PC          6
+#define FRAME_XPSR        7
+#define FRAME_WORDS       8
+
+typedef struct
+{
+    nrfx_wdt_t                    instance;
+    nrfx_wdt_monitor_retained_t * p_retained;
+    nrfx_wdt_monitor_time_get_t   time_get;
+    nrfx_wdt_event_handler_t      handler;
+    uint32_t const *              p_frame;
+    uintptr_t                     ram_start;
+    uintptr_t                     ram_end;
+    uint8_t                       channel_count;
+    nrfx_drv_state_t              state;
+} wdt_monitor_cb_t;
+
+static wdt_monitor_cb_t m_cb;
+
+static uint32_t time_get(void)
+{
+    return m_cb.time_get ? m_cb.time_get() : 0;
+}
+
+static uint32_t record_checksum(nrfx_wdt_monitor_record_t const * p_record)
+{
+    uint32_t const * p_word = (uint32_t const *)p_record;
+    uint32_t         sum    = 0;
+
+    for (size_t i = 0; i < offsetof(nrfx_wdt_monitor_record_t, checksum) / sizeof(uint32_t); i++)
+    {
+        sum += p_word[i];
+    }
+    return sum;
+}
+
+/* Without the stack RAM given in the configuration, the initial main stack pointer,
+ * that is the first entry of the vector table, bounds the stack snapshot. */
+static uintptr_t stack_end_get(void)
+{
+    if (m_cb.ram_end != 0)
+    {
+        return m_cb.ram_end;
+    }
+#if defined(SCB_VTOR_TBLOFF_Msk)
+    return *(uint32_t const *)SCB->VTOR;
+#else
+    return *(uint32_t const *)0;
+#endif
+}
+
+static void wdt_timeout_handler(void)
+{
+    nrfx_wdt_monitor_record_t * p_record    = &m_cb.p_retained->record;
+    uintptr_t                   stack_start = (m_cb.ram_end != 0) ? m_cb.ram_start : 0;
+    uintptr_t                   stack_end   = stack_end_get();
+    uint32_t const *            p_frame     = m_cb.p_frame;
+    uint32_t                    stalled     = 0;
+
+    for (uint8_t i = 0; i < m_cb.channel_count; i++)
+    {
+        if (nrf_wdt_request_status(m_cb.instance.p_reg, (nrf_wdt_rr_register_t)(NRF_WDT_RR0 + i)))
+        {
+            stalled |= 1UL << i;
+        }
+    }
+
+    p_record->timestamp     = time_get();
+    p_record->stalled_mask  = stalled;
+    p_record->channel_count = m_cb.channel_count;
+    p_record->pc            = 0;
+    p_record->lr            = 0;
+    p_record->xpsr          = 0;
+    p_record->sp            = 0;
+    p_record->stack_words   = 0;
+    p_record->flags         = 0;
+
+    if (!p_frame)
+    {
+        p_record->flags = NRFX_WDT_MONITOR_RECORD_NO_FRAME;
+    }
+    else if (((uintptr_t)p_frame < stack_start) ||
+             ((uintptr_t)&p_frame[FRAME_WORDS] > stack_end))
+    {
+        p_record->sp    = (uint32_t)(uintptr_t)p_frame;
+        p_record->flags = NRFX_WDT_MONITOR_RECORD_FRAME_OUT_OF_RANGE;
+    }
+    else
+    {
+        p_record->pc   = p_frame[FRAME_PC];
+        p_record->lr   = p_frame[FRAME_LR];
+        p_record->xpsr = p_frame[FRAME_XPSR];
+        p_record->sp   = (uint32_t)(uintptr_t)p_frame;
+
+        while ((p_record->stack_words < NRFX_WDT_MONITOR_CONFIG_STACK_WORDS) &&
+               ((uintptr_t)&p_frame[p_record->stack_words] < stack_end))
+        {
+            p_record->stack[p_record->stack_words] = p_frame[p_record->stack_words];
+            p_record->stack_words++;
+        }
+    }
+
+    for (uint8_t i = 0; i < NRF_WDT_CHANNEL_NUMBER; i++)
+    {
+        p_record->channels[i] = m_cb.p_retained->channels[i];
+    }
+
+    p_record->magic    = RECORD_MAGIC;
+    p_record->checksum = record_checksum(p_record);
+
+    if (m_cb.handler)
+    {
+        m_cb.handler();
+    }
+}
+
+void nrfx_wdt_monitor_irq_handle(uint32_t const * p_frame, uint32_t exc_return)
+{
+    // Without a valid EXC_RETURN, the handler was not entered directly from the exception.
+    m_cb.p_frame = ((exc_return & EXC_RETURN_PREFIX) == EXC_RETURN_PREFIX) ? p_frame : NULL;
+
+#if NRFX_CHECK(NRFX_WDT0_ENABLED)
+    if (m_cb.instance.p_reg == NRF_WDT0)
+    {
+        nrfx_wdt_0_irq_handler();
+    }
+#endif
+#if NRFX_CHECK(NRFX_WDT1_ENABLED)
+    if (m_cb.instance.p_reg == NRF_WDT1)
+    {
+        nrfx_wdt_1_irq_handler();
+    }
+#endif
+    m_cb.p_frame = NULL;
+}
+
+#if defined(__GNUC__) && defined(__ARM_ARCH)
+/* LR holds EXC_RETURN on the exception entry. Its bit 2 tells whether the interrupted code
+ * stacked the exception frame on the main or on the process stack. The sequence is valid
+ * for ARMv6-M as well. */
+__attribute__((naked)) void nrfx_wdt_monitor_irq_handler(void)
+{
+    __ASM volatile(
+        "   movs r0, #4                          \n"
+        "   mov  r1, lr                          \n"
+        "   tst  r0, r1                          \n"
+        "   beq  1f                              \n"
+        "   mrs  r0, psp                         \n"
+        "   b    2f                              \n"
+        "1: mrs  r0, msp                         \n"
+        "2: ldr  r2, =nrfx_wdt_monitor_irq_handle \n"
+        "   bx   r2                              \n"
+        "   .ltorg                               \n"
+    );
+}
+#endif
+
+nrfx_err_t nrfx_wdt_monitor_init(nrfx_wdt_t const *                p_instance,
+                                 nrfx_wdt_config_t const *         p_wdt_config,
+                                 nrfx_wdt_monitor_config_t const * p_config)
+{
+    NRFX_ASSERT(p_instance);
+    NRFX_ASSERT(p_config);
+    NRFX_ASSERT(p_config->p_retained);
+
+    nrfx_err_t err_code;
+
+    if (m_cb.state != NRFX_DRV_STATE_UNINITIALIZED)
+    {
+        err_code = NRFX_ERROR_INVALID_STATE;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    err_code = nrfx_wdt_init(p_instance, p_wdt_config, wdt_timeout_handler);
+    if (err_code != NRFX_SUCCESS)
+    {
+        return err_code;
+    }
+
+    m_cb.instance      = *p_instance;
+    m_cb.p_retained    = p_config->p_retained;
+    m_cb.time_get      = p_config->time_get;
+    m_cb.handler       = p_config->handler;
+    m_cb.ram_start     = p_config->ram_start;
+    m_cb.ram_end       = p_config->ram_end;
+    m_cb.channel_count = 0;
+
+    for (uint8_t i = 0; i < NRF_WDT_CHANNEL_NUMBER; i++)
+    {
+        m_cb.p_retained->channels[i] = (nrfx_wdt_monitor_channel_t){ .name = "" };
+    }
+
+    if (nrfx_wdt_monitor_record_get())
+    {
+        NRFX_LOG_WARNING("Watchdog crash record from the previous reset is available.");
+    }
+
+    m_cb.state = NRFX_DRV_STATE_INITIALIZED;
+    return NRFX_SUCCESS;
+}
+
+nrfx_err_t nrfx_wdt_monitor_channel_alloc(char const *          p_name,
+                                          nrfx_wdt_channel_id * p_channel_id)
+{
+    NRFX_ASSERT(p_name);
+    NRFX_ASSERT(p_channel_id);
+    NRFX_ASSERT(m_cb.state == NRFX_DRV_STATE_INITIALIZED);
+
+    nrfx_err_t err_code = nrfx_wdt_channel_alloc(&m_cb.instance, p_channel_id);
+    if (err_code != NRFX_SUCCESS)
+    {
+        return err_code;
+    }
+
+    nrfx_wdt_monitor_channel_t * p_channel =
+        &m_cb.p_retained->channels[*p_channel_id - NRF_WDT_RR0];
+
+    for (size_t i = 0; i < (NRFX_WDT_MONITOR_NAME_SIZE - 1) && p_name[i]; i++)
+    {
+        p_channel->name[i] = p_name[i];
+    }
+    p_channel->last_feed = time_get();
+    m_cb.channel_count++;
+
+    NRFX_LOG_INFO("Channel %d: %s.", *p_channel_id - NRF_WDT_RR0, p_channel->name);
+    return NRFX_SUCCESS;
+}
+
+void nrfx_wdt_monitor_enable(void)
+{
+    NRFX_ASSERT(m_cb.state == NRFX_DRV_STATE_INITIALIZED);
+
+    nrfx_wdt_enable(&m_cb.instance);
+    m_cb.state = NRFX_DRV_STATE_POWERED_ON;
+}
+
+void nrfx_wdt_monitor_feed(nrfx_wdt_channel_id channel_id)
+{
+    NRFX_ASSERT(m_cb.state == NRFX_DRV_STATE_POWERED_ON);
+
+    m_cb.p_retained->channels[channel_id - NRF_WDT_RR0].last_feed = time_get();
+    nrfx_wdt_channel_feed(&m_cb.instance, channel_id);
+}
+
+nrfx_wdt_monitor_record_t const * nrfx_wdt_monitor_record_get(void)
+{
+    NRFX_ASSERT(m_cb.p_retained);
+
+    nrfx_wdt_monitor_record_t const * p_record = &m_cb.p_retained->record;
+
+    if ((p_record->magic != RECORD_MAGIC) ||
+        (p_record->checksum != record_checksum(p_record)) ||
+        (p_record->channel_count > NRF_WDT_CHANNEL_NUMBER) ||
+        (p_record->stack_words > NRFX_WDT_MONITOR_CONFIG_STACK_WORDS))
+    {
+        return NULL;
+    }
+    return p_record;
+}
+
+void nrfx_wdt_monitor_record_clear(void)
+{
+    NRFX_ASSERT(m_cb.p_retained);
+
+    m_cb.p_retained->record.magic = 0;
+}
+
+#endif // NRFX_CHECK(NRFX_WDT_MONITOR_ENABLED)
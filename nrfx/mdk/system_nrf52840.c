@@ -42,13 +42,86 @@ NOTICE: This file has been modified by Nordic Semiconductor ASA.
     uint32_t SystemCoreClock __attribute__((used)) = __SYSTEM_CLOCK_64M;
 #endif
 
+#if defined (NRF52_SYSTEMINIT_CYCLES)
+    uint32_t SystemInitCycles[SYSTEM_INIT_STEP_COUNT];
+
+    /* Records the number of cycles spent since SystemInit() was entered. */
+    #define SYSTEM_INIT_STEP(step) SystemInitCycles[step] = DWT->CYCCNT
+#else
+    #define SYSTEM_INIT_STEP(step)
+#endif
+
 void SystemCoreClockUpdate(void)
 {
     SystemCoreClock = __SYSTEM_CLOCK_64M;
 }
 
+/* Workaround for Errata 66 "TEMP: Linearity specification not met with default settings" found at the Errata document
+   for your device located at https://infocenter.nordicsemi.com/index.jsp  */
+static void errata_66_workaround(void)
+{
+    if (nrf52_errata_66()){
+        NRF_TEMP->A0 = NRF_FICR->TEMP.A0;
+        NRF_TEMP->A1 = NRF_FICR->TEMP.A1;
+        NRF_TEMP->A2 = NRF_FICR->TEMP.A2;
+        NRF_TEMP->A3 = NRF_FICR->TEMP.A3;
+        NRF_TEMP->A4 = NRF_FICR->TEMP.A4;
+        NRF_TEMP->A5 = NRF_FICR->TEMP.A5;
+        NRF_TEMP->B0 = NRF_FICR->TEMP.B0;
+        NRF_TEMP->B1 = NRF_FICR->TEMP.B1;
+        NRF_TEMP->B2 = NRF_FICR->TEMP.B2;
+        NRF_TEMP->B3 = NRF_FICR->TEMP.B3;
+        NRF_TEMP->B4 = NRF_FICR->TEMP.B4;
+        NRF_TEMP->B5 = NRF_FICR->TEMP.B5;
+        NRF_TEMP->T0 = NRF_FICR->TEMP.T0;
+        NRF_TEMP->T1 = NRF_FICR->TEMP.T1;
+        NRF_TEMP->T2 = NRF_FICR->TEMP.T2;
+        NRF_TEMP->T3 = NRF_FICR->TEMP.T3;
+        NRF_TEMP->T4 = NRF_FICR->TEMP.T4;
+    }
+}
+
+/* Workaround for Errata 98 "NFCT: Not able to communicate with the peer" found at the Errata document
+   for your device located at https://infocenter.nordicsemi.com/index.jsp  */
+static void errata_98_workaround(void)
+{
+    if (nrf52_errata_98()){
+        *(volatile uint32_t *)0x4000568Cul = 0x00038148ul;
+    }
+}
+
+/* Workaround for Errata 120 "QSPI: Data read or written is corrupted" found at the Errata document
+   for your device located at https://infocenter.nordicsemi.com/index.jsp  */
+static void errata_120_workaround(void)
+{
+    if (nrf52_errata_120()){
+        *(volatile uint32_t *)0x40029640ul = 0x200ul;
+    }
+}
+
+#if defined (NRF52_DEFERRED_WORKAROUNDS)
+void SystemInitDeferred(uint32_t peripherals)
+{
+    if (peripherals & SYSTEM_DEFERRED_TEMP){
+        errata_66_workaround();
+    }
+    if (peripherals & SYSTEM_DEFERRED_NFCT){
+        errata_98_workaround();
+    }
+    if (peripherals & SYSTEM_DEFERRED_QSPI){
+        errata_120_workaround();
+    }
+}
+#endif
+
 void SystemInit(void)
 {
+    #if defined (NRF52_SYSTEMINIT_CYCLES)
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CYCCNT = 0;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    #endif
+
     /* Enable SWO trace functionality. If ENABLE_SWO is not defined, SWO pin will be used as GPIO (see Product
        Specification to see which one). */
     #if defined (ENABLE_SWO)
@@ -68,6 +141,7 @@ void SystemInit(void)
         NRF_P0->PIN_CNF[11] = (GPIO_PIN_CNF_DRIVE_H0H1 << GPIO_PIN_CNF_DRIVE_Pos) | (GPIO_PIN_CNF_INPUT_Connect << GPIO_PIN_CNF_INPUT_Pos) | (GPIO_PIN_CNF_DIR_Output << GPIO_PIN_CNF_DIR_Pos);
         NRF_P1->PIN_CNF[9]  = (GPIO_PIN_CNF_DRIVE_H0H1 << GPIO_PIN_CNF_DRIVE_Pos) | (GPIO_PIN_CNF_INPUT_Connect << GPIO_PIN_CNF_INPUT_Pos) | (GPIO_PIN_CNF_DIR_Output << GPIO_PIN_CNF_DIR_Pos);
     #endif
+    SYSTEM_INIT_STEP(SYSTEM_INIT_STEP_TRACE);
     
     /* Workaround for Errata 36 "CLOCK: Some registers are not reset when expected" found at the Errata document
        for your device located at https://infocenter.nordicsemi.com/index.jsp  */
@@ -76,52 +150,35 @@ void SystemInit(void)
         NRF_CLOCK->EVENTS_CTTO = 0;
         NRF_CLOCK->CTIV = 0;
     }
-    
-    /* Workaround for Errata 66 "TEMP: Linearity specification not met with default settings" found at the Errata document
-       for your device located at https://infocenter.nordicsemi.com/index.jsp  */
-    if (nrf52_errata_66()){
-        NRF_TEMP->A0 = NRF_FICR->TEMP.A0;
-        NRF_TEMP->A1 = NRF_FICR->TEMP.A1;
-        NRF_TEMP->A2 = NRF_FICR->TEMP.A2;
-        NRF_TEMP->A3 = NRF_FICR->TEMP.A3;
-        NRF_TEMP->A4 = NRF_FICR->TEMP.A4;
-        NRF_TEMP->A5 = NRF_FICR->TEMP.A5;
-        NRF_TEMP->B0 = NRF_FICR->TEMP.B0;
-        NRF_TEMP->B1 = NRF_FICR->TEMP.B1;
-        NRF_TEMP->B2 = NRF_FICR->TEMP.B2;
-        NRF_TEMP->B3 = NRF_FICR->TEMP.B3;
-        NRF_TEMP->B4 = NRF_FICR->TEMP.B4;
-        NRF_TEMP->B5 = NRF_FICR->TEMP.B5;
-        NRF_TEMP->T0 = NRF_FICR->TEMP.T0;
-        NRF_TEMP->T1 = NRF_FICR->TEMP.T1;
-        NRF_TEMP->T2 = NRF_FICR->TEMP.T2;
-        NRF_TEMP->T3 = NRF_FICR->TEMP.T3;
-        NRF_TEMP->T4 = NRF_FICR->TEMP.T4;
-    }
-    
-    /* Workaround for Errata 98 "NFCT: Not able to communicate with the peer" found at the Errata document
-       for your device located at https://infocenter.nordicsemi.com/index.jsp  */
-    if (nrf52_errata_98()){
-        *(volatile uint32_t *)0x4000568Cul = 0x00038148ul;
-    }
+    SYSTEM_INIT_STEP(SYSTEM_INIT_STEP_ERRATA_36);
+
+    /* Workarounds for peripherals that may not be used by the application at all can be left to
+       their drivers, see SystemInitDeferred(). */
+    #if !defined (NRF52_DEFERRED_WORKAROUNDS)
+        errata_66_workaround();
+        SYSTEM_INIT_STEP(SYSTEM_INIT_STEP_ERRATA_66);
+        errata_98_workaround();
+        SYSTEM_INIT_STEP(SYSTEM_INIT_STEP_ERRATA_98);
+    #endif
     
     /* Workaround for Errata 103 "CCM: Wrong reset value of CCM MAXPACKETSIZE" found at the Errata document
        for your device located at https://infocenter.nordicsemi.com/index.jsp  */
     if (nrf52_errata_103()){
         NRF_CCM->MAXPACKETSIZE = 0xFBul;
     }
+    SYSTEM_INIT_STEP(SYSTEM_INIT_STEP_ERRATA_103);
     
     /* Workaround for Errata 115 "RAM: RAM content cannot be trusted upon waking up from System ON Idle or System OFF mode" found at the Errata document
        for your device located at https://infocenter.nordicsemi.com/index.jsp  */
     if (nrf52_errata_115()){
         *(volatile uint32_t *)0x40000EE4ul = (*(volatile uint32_t *)0x40000EE4ul & 0xFFFFFFF0ul) | (*(uint32_t *)0x10000258ul & 0x0000000Ful);
     }
-    
-    /* Workaround for Errata 120 "QSPI: Data read or written is corrupted" found at the Errata document
-       for your device located at https://infocenter.nordicsemi.com/index.jsp  */
-    if (nrf52_errata_120()){
-        *(volatile uint32_t *)0x40029640ul = 0x200ul;
-    }
+    SYSTEM_INIT_STEP(SYSTEM_INIT_STEP_ERRATA_115);
+
+    #if !defined (NRF52_DEFERRED_WORKAROUNDS)
+        errata_120_workaround();
+        SYSTEM_INIT_STEP(SYSTEM_INIT_STEP_ERRATA_120);
+    #endif
     
     /* Workaround for Errata 136 "System: Bits in RESETREAS are set when they should not be" found at the Errata document
        for your device located at https://infocenter.nordicsemi.com/index.jsp  */
@@ -130,6 +187,7 @@ void SystemInit(void)
             NRF_POWER->RESETREAS =  ~POWER_RESETREAS_RESETPIN_Msk;
         }
     }
+    SYSTEM_INIT_STEP(SYSTEM_INIT_STEP_ERRATA_136);
     
     /* Enable the FPU if the compiler used floating point unit instructions. __FPU_USED is a MACRO defined by the
      * compiler. Since the FPU consumes energy, remember to disable FPU use in the compiler if floating point unit
@@ -139,6 +197,7 @@ void SystemInit(void)
         __DSB();
         __ISB();
     #endif
+    SYSTEM_INIT_STEP(SYSTEM_INIT_STEP_FPU);
 
     /* Configure NFCT pins as GPIOs if NFCT is not to be used in your code. If CONFIG_NFCT_PINS_AS_GPIOS is not defined,
        two GPIOs (see Product Specification to see which ones) will be reserved for NFC and will not be available as
@@ -154,6 +213,7 @@ void SystemInit(void)
             NVIC_SystemReset();
         }
     #endif
+    SYSTEM_INIT_STEP(SYSTEM_INIT_STEP_NFCT_PINS);
 
     /* Configure GPIO pads as pPin Reset pin if Pin Reset capabilities desired. If CONFIG_GPIO_AS_PINRESET is not
       defined, pin reset will not be available. One GPIO (see Product Specification to see which one) will then be
@@ -172,8 +232,10 @@ void SystemInit(void)
             NVIC_SystemReset();
         }
     #endif
+    SYSTEM_INIT_STEP(SYSTEM_INIT_STEP_PIN_RESET);
 
     SystemCoreClockUpdate();
+    SYSTEM_INIT_STEP(SYSTEM_INIT_STEP_CLOCK_UPDATE);
 }
 
 /*lint --flb "Leave library region" */
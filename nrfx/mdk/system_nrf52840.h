@@ -54,6 +54,54 @@ extern void SystemInit (void);
  */
 extern void SystemCoreClockUpdate (void);
 
+#if defined (NRF52_DEFERRED_WORKAROUNDS)
+
+#define SYSTEM_DEFERRED_TEMP (1UL << 0) /*!< Errata 66 workaround, TEMP linearity coefficients. */
+#define SYSTEM_DEFERRED_NFCT (1UL << 1) /*!< Errata 98 workaround, NFCT communication.         */
+#define SYSTEM_DEFERRED_QSPI (1UL << 2) /*!< Errata 120 workaround, QSPI data corruption.      */
+
+/**
+ * Apply workarounds deferred by SystemInit()
+ *
+ * @param  peripherals  Mask of SYSTEM_DEFERRED_* values
+ * @return none
+ *
+ * @brief  When NRF52_DEFERRED_WORKAROUNDS is defined, SystemInit() only applies the
+ *         workarounds needed by every application. Workarounds for the peripherals
+ *         listed above must be applied with this function before the peripheral
+ *         is used. The nrfx drivers of these peripherals do this in their init
+ *         functions, other users of the peripherals must call it themselves.
+ */
+extern void SystemInitDeferred (uint32_t peripherals);
+
+#endif
+
+#if defined (NRF52_SYSTEMINIT_CYCLES)
+
+/* Steps of SystemInit(), indices into SystemInitCycles. */
+typedef enum {
+    SYSTEM_INIT_STEP_TRACE,
+    SYSTEM_INIT_STEP_ERRATA_36,
+    SYSTEM_INIT_STEP_ERRATA_66,
+    SYSTEM_INIT_STEP_ERRATA_98,
+    SYSTEM_INIT_STEP_ERRATA_103,
+    SYSTEM_INIT_STEP_ERRATA_115,
+    SYSTEM_INIT_STEP_ERRATA_120,
+    SYSTEM_INIT_STEP_ERRATA_136,
+    SYSTEM_INIT_STEP_FPU,
+    SYSTEM_INIT_STEP_NFCT_PINS,
+    SYSTEM_INIT_STEP_PIN_RESET,
+    SYSTEM_INIT_STEP_CLOCK_UPDATE,
+    SYSTEM_INIT_STEP_COUNT
+} system_init_step_t;
+
+/* Cycle count at the end of each step of SystemInit(), counted from its entry.
+   Steps that were skipped are left at 0. The values are only kept if SystemInit()
+   is called after RAM initialization, which is the case in Zephyr. */
+extern uint32_t SystemInitCycles[SYSTEM_INIT_STEP_COUNT];
+
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,470 @@
+/*
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NRFX_ATOMIC_H__
+#define NRFX_ATOMIC_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || \
+    defined(__ARM_ARCH_8M_MAIN__) || defined(__ARM_ARCH_8M_BASE__)
+    #include <nrf.h>
+    #define NRFX_ATOMIC_EXCLUSIVES_USED 1
+#elif defined(__ARM_ARCH_6M__)
+    #include <nrf.h>
+    #define NRFX_ATOMIC_PRIMASK_USED    1
+#else
+    #include <stdatomic.h>
+    #define NRFX_ATOMIC_C11_USED        1
+#endif
+
+#ifndef NRFX_STATIC_INLINE
+#ifdef NRFX_DECLARE_ONLY
+#define NRFX_STATIC_INLINE
+#else
+#define NRFX_STATIC_INLINE static inline
+#endif
+#endif // NRFX_STATIC_INLINE
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_atomic Atomic operations
+ * @{
+ * @ingroup nrfx
+ * @brief Lock-free operations on 32-bit words and bitmaps.
+ *
+ * On ARMv7-M and ARMv8-M the operations are built on the LDREX/STREX exclusive
+ * access instructions and never mask interrupts. On ARMv6-M (nRF51), which has
+ * no exclusive access instructions, each operation runs with interrupts masked
+ * for a few instructions. When built for a host, C11 atomics are used.
+ *
+ * Every operation is a full memory barrier, so the primitives can also be used
+ * on memory shared between the cores of a multi-core SoC.
+ *
+ * The header does not depend on the nrfx glue, so besides the nrfx drivers it
+ * is used by the 802.15.4 radio driver, which builds on the nrfx HAL.
+ */
+
+/** @brief Atomic 32-bit word. */
+#if NRFX_ATOMIC_C11_USED
+typedef _Atomic uint32_t nrfx_atomic_u32_t;
+#else
+typedef volatile uint32_t nrfx_atomic_u32_t;
+#endif
+
+/** @brief Macro for getting the number of words needed for a bitmap of the specified size. */
+#define NRFX_ATOMIC_BITMAP_WORDS(bits) (((bits) + 31) / 32)
+
+/**
+ * @brief Function for reading an atomic word.
+ *
+ * @param[in] p_data Pointer to the atomic word.
+ *
+ * @return Current value of the word.
+ */
+NRFX_STATIC_INLINE uint32_t nrfx_atomic_u32_load(nrfx_atomic_u32_t const * p_data);
+
+/**
+ * @brief Function for storing a value in an atomic word and returning its previous value.
+ *
+ * @param[in] p_data Pointer to the atomic word.
+ * @param[in] value  Value to store.
+ *
+ * @return Previous value of the word.
+ */
+NRFX_STATIC_INLINE uint32_t nrfx_atomic_u32_fetch_store(nrfx_atomic_u32_t * p_data,
+                                                        uint32_t            value);
+
+/**
+ * @brief Function for running a bitwise OR operation on an atomic word.
+ *
+ * @param[in] p_data Pointer to the atomic word.
+ * @param[in] value  Value of the second operand.
+ *
+ * @return Previous value of the word.
+ */
+NRFX_STATIC_INLINE uint32_t nrfx_atomic_u32_fetch_or(nrfx_atomic_u32_t * p_data,
+                                                     uint32_t            value);
+
+/**
+ * @brief Function for running a bitwise AND operation on an atomic word.
+ *
+ * @param[in] p_data Pointer to the atomic word.
+ * @param[in] value  Value of the second operand.
+ *
+ * @return Previous value of the word.
+ */
+NRFX_STATIC_INLINE uint32_t nrfx_atomic_u32_fetch_and(nrfx_atomic_u32_t * p_data,
+                                                      uint32_t            value);
+
+/**
+ * @brief Function for adding a value to an atomic word.
+ *
+ * @param[in] p_data Pointer to the atomic word.
+ * @param[in] value  Value to add. The addition wraps around on overflow.
+ *
+ * @return Previous value of the word.
+ */
+NRFX_STATIC_INLINE uint32_t nrfx_atomic_u32_fetch_add(nrfx_atomic_u32_t * p_data,
+                                                      uint32_t            value);
+
+/**
+ * @brief Function for subtracting a value from an atomic word.
+ *
+ * @param[in] p_data Pointer to the atomic word.
+ * @param[in] value  Value to subtract. The subtraction wraps around on underflow.
+ *
+ * @return Previous value of the word.
+ */
+NRFX_STATIC_INLINE uint32_t nrfx_atomic_u32_fetch_sub(nrfx_atomic_u32_t * p_data,
+                                                      uint32_t            value);
+
+/**
+ * @brief Function for storing a value in an atomic word if it holds the expected value.
+ *
+ * @param[in]     p_data     Pointer to the atomic word.
+ * @param[in,out] p_expected Pointer to the expected value. When the comparison fails,
+ *                           it is updated with the current value of the word.
+ * @param[in]     desired    Value to store.
+ *
+ * @retval true  The word held the expected value and was updated.
+ * @retval false The word held a different value and was not modified.
+ */
+NRFX_STATIC_INLINE bool nrfx_atomic_u32_cas(nrfx_atomic_u32_t * p_data,
+                                            uint32_t *          p_expected,
+                                            uint32_t            desired);
+
+/**
+ * @brief Function for setting a bit in an atomic bitmap.
+ *
+ * @param[in] p_bitmap Pointer to the bitmap.
+ * @param[in] bit      Index of the bit.
+ *
+ * @return Previous state of the bit.
+ */
+NRFX_STATIC_INLINE bool nrfx_atomic_bit_set(nrfx_atomic_u32_t * p_bitmap, size_t bit);
+
+/**
+ * @brief Function for clearing a bit in an atomic bitmap.
+ *
+ * @param[in] p_bitmap Pointer to the bitmap.
+ * @param[in] bit      Index of the bit.
+ *
+ * @return Previous state of the bit.
+ */
+NRFX_STATIC_INLINE bool nrfx_atomic_bit_clear(nrfx_atomic_u32_t * p_bitmap, size_t bit);
+
+/**
+ * @brief Function for checking a bit in an atomic bitmap.
+ *
+ * @param[in] p_bitmap Pointer to the bitmap.
+ * @param[in] bit      Index of the bit.
+ *
+ * @return Current state of the bit.
+ */
+NRFX_STATIC_INLINE bool nrfx_atomic_bit_check(nrfx_atomic_u32_t const * p_bitmap, size_t bit);
+
+/**
+ * @brief Function for finding the lowest set bit in an atomic bitmap.
+ *
+ * The bitmap is scanned one word at a time, so with concurrent modifications the
+ * result reflects the state of each word at the moment it was read.
+ *
+ * @param[in]  p_bitmap Pointer to the bitmap.
+ * @param[in]  bits     Size of the bitmap in bits.
+ * @param[out] p_bit    Index of the lowest set bit.
+ *
+ * @retval true  A set bit was found.
+ * @retval false All bits are cleared.
+ */
+NRFX_STATIC_INLINE bool nrfx_atomic_bitmap_first_set_get(nrfx_atomic_u32_t const * p_bitmap,
+                                                         size_t                    bits,
+                                                         size_t *                  p_bit);
+
+/**
+ * @brief Function for finding the lowest set bit in an atomic bitmap and clearing it.
+ *
+ * A given bit is returned to only one of the contexts that compete for it, which
+ * makes the function suitable for allocating slots marked as free in the bitmap.
+ *
+ * @param[in]  p_bitmap Pointer to the bitmap.
+ * @param[in]  bits     Size of the bitmap in bits.
+ * @param[out] p_bit    Index of the cleared bit.
+ *
+ * @retval true  A set bit was found and cleared.
+ * @retval false All bits are cleared.
+ */
+NRFX_STATIC_INLINE bool nrfx_atomic_bitmap_first_set_claim(nrfx_atomic_u32_t * p_bitmap,
+                                                           size_t              bits,
+                                                           size_t *            p_bit);
+
+/** @} */
+
+#ifndef NRFX_DECLARE_ONLY
+
+typedef enum
+{
+    NRFX_ATOMIC_OP_STORE,
+    NRFX_ATOMIC_OP_OR,
+    NRFX_ATOMIC_OP_AND,
+    NRFX_ATOMIC_OP_ADD,
+    NRFX_ATOMIC_OP_SUB,
+} nrfx_atomic_op_t;
+
+#if !NRFX_ATOMIC_C11_USED
+NRFX_STATIC_INLINE uint32_t nrfx_atomic_op_apply(nrfx_atomic_op_t op,
+                                                 uint32_t         old_value,
+                                                 uint32_t         value)
+{
+    switch (op)
+    {
+        case NRFX_ATOMIC_OP_OR:  return old_value | value;
+        case NRFX_ATOMIC_OP_AND: return old_value & value;
+        case NRFX_ATOMIC_OP_ADD: return old_value + value;
+        case NRFX_ATOMIC_OP_SUB: return old_value - value;
+        default:                 return value;
+    }
+}
+#endif
+
+NRFX_STATIC_INLINE uint32_t nrfx_atomic_rmw(nrfx_atomic_u32_t * p_data,
+                                            nrfx_atomic_op_t    op,
+                                            uint32_t            value)
+{
+#if NRFX_ATOMIC_EXCLUSIVES_USED
+    uint32_t old_value;
+
+    __DMB();
+    do
+    {
+        old_value = __LDREXW(p_data);
+    } while (__STREXW(nrfx_atomic_op_apply(op, old_value, value), p_data));
+    __DMB();
+
+    return old_value;
+#elif NRFX_ATOMIC_PRIMASK_USED
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    __DMB();
+    uint32_t old_value = *p_data;
+    *p_data = nrfx_atomic_op_apply(op, old_value, value);
+    __DMB();
+    __set_PRIMASK(primask);
+
+    return old_value;
+#else
+    switch (op)
+    {
+        case NRFX_ATOMIC_OP_OR:  return atomic_fetch_or(p_data, value);
+        case NRFX_ATOMIC_OP_AND: return atomic_fetch_and(p_data, value);
+        case NRFX_ATOMIC_OP_ADD: return atomic_fetch_add(p_data, value);
+        case NRFX_ATOMIC_OP_SUB: return atomic_fetch_sub(p_data, value);
+        default:                 return atomic_exchange(p_data, value);
+    }
+#endif
+}
+
+NRFX_STATIC_INLINE size_t nrfx_atomic_lowest_bit_get(uint32_t word)
+{
+#if defined(__GNUC__)
+    return (size_t)__builtin_ctz(word);
+#else
+    size_t bit = 0;
+    while (!(word & 1))
+    {
+        word >>= 1;
+        bit++;
+    }
+    return bit;
+#endif
+}
+
+NRFX_STATIC_INLINE uint32_t nrfx_atomic_u32_load(nrfx_atomic_u32_t const * p_data)
+{
+#if NRFX_ATOMIC_C11_USED
+    return atomic_load(p_data);
+#else
+    uint32_t value = *p_data;
+    __DMB();
+    return value;
+#endif
+}
+
+NRFX_STATIC_INLINE uint32_t nrfx_atomic_u32_fetch_store(nrfx_atomic_u32_t * p_data,
+                                                        uint32_t            value)
+{
+    return nrfx_atomic_rmw(p_data, NRFX_ATOMIC_OP_STORE, value);
+}
+
+NRFX_STATIC_INLINE uint32_t nrfx_atomic_u32_fetch_or(nrfx_atomic_u32_t * p_data,
+                                                     uint32_t            value)
+{
+    return nrfx_atomic_rmw(p_data, NRFX_ATOMIC_OP_OR, value);
+}
+
+NRFX_STATIC_INLINE uint32_t nrfx_atomic_u32_fetch_and(nrfx_atomic_u32_t * p_data,
+                                                      uint32_t            value)
+{
+    return nrfx_atomic_rmw(p_data, NRFX_ATOMIC_OP_AND, value);
+}
+
+NRFX_STATIC_INLINE uint32_t nrfx_atomic_u32_fetch_add(nrfx_atomic_u32_t * p_data,
+                                                      uint32_t            value)
+{
+    return nrfx_atomic_rmw(p_data, NRFX_ATOMIC_OP_ADD, value);
+}
+
+NRFX_STATIC_INLINE uint32_t nrfx_atomic_u32_fetch_sub(nrfx_atomic_u32_t * p_data,
+                                                      uint32_t            value)
+{
+    return nrfx_atomic_rmw(p_data, NRFX_ATOMIC_OP_SUB, value);
+}
+
+NRFX_STATIC_INLINE bool nrfx_atomic_u32_cas(nrfx_atomic_u32_t * p_data,
+                                            uint32_t *          p_expected,
+                                            uint32_t            desired)
+{
+#if NRFX_ATOMIC_EXCLUSIVES_USED
+    uint32_t current;
+    bool     stored = true;
+
+    __DMB();
+    do
+    {
+        current = __LDREXW(p_data);
+        if (current != *p_expected)
+        {
+            __CLREX();
+            stored = false;
+            break;
+        }
+    } while (__STREXW(desired, p_data));
+    __DMB();
+
+    *p_expected = current;
+    return stored;
+#elif NRFX_ATOMIC_PRIMASK_USED
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    __DMB();
+    uint32_t current = *p_data;
+    bool     stored  = (current == *p_expected);
+    if (stored)
+    {
+        *p_data = desired;
+    }
+    __DMB();
+    __set_PRIMASK(primask);
+
+    *p_expected = current;
+    return stored;
+#else
+    return atomic_compare_exchange_strong(p_data, p_expected, desired);
+#endif
+}
+
+NRFX_STATIC_INLINE bool nrfx_atomic_bit_set(nrfx_atomic_u32_t * p_bitmap, size_t bit)
+{
+    uint32_t mask = 1UL << (bit % 32);
+
+    return (nrfx_atomic_u32_fetch_or(&p_bitmap[bit / 32], mask) & mask) != 0;
+}
+
+NRFX_STATIC_INLINE bool nrfx_atomic_bit_clear(nrfx_atomic_u32_t * p_bitmap, size_t bit)
+{
+    uint32_t mask = 1UL << (bit % 32);
+
+    return (nrfx_atomic_u32_fetch_and(&p_bitmap[bit / 32], ~mask) & mask) != 0;
+}
+
+NRFX_STATIC_INLINE bool nrfx_atomic_bit_check(nrfx_atomic_u32_t const * p_bitmap, size_t bit)
+{
+    return (nrfx_atomic_u32_load(&p_bitmap[bit / 32]) & (1UL << (bit % 32))) != 0;
+}
+
+NRFX_STATIC_INLINE bool nrfx_atomic_bitmap_first_set_get(nrfx_atomic_u32_t const * p_bitmap,
+                                                         size_t                    bits,
+                                                         size_t *                  p_bit)
+{
+    for (size_t i = 0; i < NRFX_ATOMIC_BITMAP_WORDS(bits); i++)
+    {
+        uint32_t word = nrfx_atomic_u32_load(&p_bitmap[i]);
+        if (word != 0)
+        {
+            size_t bit = (i * 32) + nrfx_atomic_lowest_bit_get(word);
+            if (bit >= bits)
+            {
+                break;
+            }
+            *p_bit = bit;
+            return true;
+        }
+    }
+    return false;
+}
+
+NRFX_STATIC_INLINE bool nrfx_atomic_bitmap_first_set_claim(nrfx_atomic_u32_t * p_bitmap,
+                                                           size_t              bits,
+                                                           size_t *            p_bit)
+{
+    for (size_t i = 0; i < NRFX_ATOMIC_BITMAP_WORDS(bits); i++)
+    {
+        uint32_t word = nrfx_atomic_u32_load(&p_bitmap[i]);
+        while (word != 0)
+        {
+            size_t bit = nrfx_atomic_lowest_bit_get(word);
+            if ((i * 32) + bit >= bits)
+            {
+                return false;
+            }
+            // On failure the word is reloaded and the search repeated within it.
+            if (nrfx_atomic_u32_cas(&p_bitmap[i], &word, word & ~(1UL << bit)))
+            {
+                *p_bit = (i * 32) + bit;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+#endif // NRFX_DECLARE_ONLY
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_ATOMIC_H__
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <soc/nrfx_errata.h>
+
+#define ROM_PART_REG      (*(uint32_t const volatile *)0xF0000FE0ul)
+#define ROM_REVISION_REG  (*(uint32_t const volatile *)0xF0000FE8ul)
+#define FICR_PART_REG     (*(uint32_t const volatile *)0x10000130ul)
+#define FICR_REVISION_REG (*(uint32_t const volatile *)0x10000134ul)
+
+// The table is empty when building for parts that are not covered by nrf52_erratas.h,
+// so the terminating entry keeps the array from being zero-sized.
+static const nrfx_errata_row_t m_rows[] = {
+    NRFX_ERRATA_TABLE_ROWS
+    { 0xFF, 0xFF, 0xFF, { 0 } }
+};
+
+nrfx_errata_cache_t nrfx_errata_cache;
+
+void nrfx_errata_resolve(uint32_t p_errata[NRFX_ERRATA_WORDS])
+{
+    uint32_t part[3];
+    uint32_t revision[3];
+
+    part[NRFX_ERRATA_METHOD_ROM]     = ROM_PART_REG & 0x000000FFul;
+    revision[NRFX_ERRATA_METHOD_ROM] = (ROM_REVISION_REG & 0x000000F0ul) >> 4;
+    part[NRFX_ERRATA_METHOD_FICR]     = FICR_PART_REG;
+    revision[NRFX_ERRATA_METHOD_FICR] = FICR_REVISION_REG;
+    if (part[NRFX_ERRATA_METHOD_FICR] == 0xFFFFFFFF)
+    {
+        part[NRFX_ERRATA_METHOD_FICR_OR_ROM]     = part[NRFX_ERRATA_METHOD_ROM];
+        revision[NRFX_ERRATA_METHOD_FICR_OR_ROM] = revision[NRFX_ERRATA_METHOD_ROM];
+    }
+    else
+    {
+        part[NRFX_ERRATA_METHOD_FICR_OR_ROM]     = part[NRFX_ERRATA_METHOD_FICR];
+        revision[NRFX_ERRATA_METHOD_FICR_OR_ROM] = revision[NRFX_ERRATA_METHOD_FICR];
+    }
+
+    for (uint32_t w = 0; w < NRFX_ERRATA_WORDS; w++)
+    {
+        p_errata[w] = 0;
+    }
+
+    for (uint32_t i = 0; (i + 1) < NRFX_ARRAY_SIZE(m_rows); i++)
+    {
+        nrfx_errata_row_t const * p_row = &m_rows[i];
+
+        if ((part[p_row->method] == p_row->part) &&
+            (revision[p_row->method] == p_row->revision))
+        {
+            for (uint32_t w = 0; w < NRFX_ERRATA_WORDS; w++)
+            {
+                p_errata[w] |= p_row->errata[w];
+            }
+        }
+    }
+}
+
+void nrfx_errata_init(void)
+{
+    uint32_t errata[NRFX_ERRATA_WORDS];
+
+    // A check preempting this function may resolve the errata on its own. Every word
+    // is only ever written with its final value, so the result is the same either way.
+    nrfx_errata_resolve(errata);
+    for (uint32_t w = 0; w < NRFX_ERRATA_WORDS; w++)
+    {
+        nrfx_errata_cache.errata[w] = errata[w];
+    }
+    nrfx_errata_cache.resolved = true;
+}
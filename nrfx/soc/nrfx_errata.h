@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NRFX_ERRATA_H__
+#define NRFX_ERRATA_H__
+
+#include <nrfx.h>
+#include <soc/nrfx_errata_table.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_errata Errata cache
+ * @{
+ * @ingroup nrfx
+ * @brief Module for resolving the applicable nRF52 errata once instead of on every check.
+ *
+ * The MDK functions nrf52_errata_N() decode the part code and revision from FICR
+ * and walk a switch statement on every call. This module decodes them once and
+ * keeps the result as a bitset, so that checking an erratum is a single bit test.
+ * Errata that cannot affect any of the parts selected at build time are rejected
+ * at compile time without touching the bitset.
+ */
+
+/** @brief Methods of decoding the part code and revision, as used by the MDK. */
+typedef enum
+{
+    NRFX_ERRATA_METHOD_ROM,         ///< ROM table peripheral identification registers.
+    NRFX_ERRATA_METHOD_FICR,        ///< FICR part and revision registers.
+    NRFX_ERRATA_METHOD_FICR_OR_ROM, ///< FICR registers, or ROM table when FICR is not programmed.
+} nrfx_errata_method_t;
+
+/** @brief Errata that apply to one part revision, as decoded with the specified method. */
+typedef struct
+{
+    uint8_t  method;                     ///< Decoding method, see @ref nrfx_errata_method_t.
+    uint8_t  part;                       ///< Part code.
+    uint8_t  revision;                   ///< Revision code.
+    uint32_t errata[NRFX_ERRATA_WORDS];  ///< Bitset of errata that apply.
+} nrfx_errata_row_t;
+
+/** @brief Resolved errata. */
+typedef struct
+{
+    uint32_t      errata[NRFX_ERRATA_WORDS]; ///< Bitset of errata that apply to the running device.
+    volatile bool resolved;                  ///< True if @p errata holds the resolved bitset.
+} nrfx_errata_cache_t;
+
+/** @brief Errata cache. Use @ref nrfx_errata_check instead of accessing it directly. */
+extern nrfx_errata_cache_t nrfx_errata_cache;
+
+/**
+ * @brief Function for resolving the errata that apply to the running device.
+ *
+ * The function does not use any static data, so it can be called before RAM
+ * is initialized, for example from SystemInit().
+ *
+ * @param[out] p_errata Bitset to be filled with the errata that apply.
+ */
+void nrfx_errata_resolve(uint32_t p_errata[NRFX_ERRATA_WORDS]);
+
+/**
+ * @brief Function for filling the errata cache.
+ *
+ * Calling this function during startup is optional, the cache is otherwise filled
+ * on the first check. It must not be called before static data is initialized.
+ */
+void nrfx_errata_init(void);
+
+/**
+ * @brief Function for checking if the specified erratum applies to the running device.
+ *
+ * The result is identical to that of the corresponding nrf52_errata_N() function.
+ *
+ * @param[in] errata Erratum number.
+ *
+ * @retval true  The erratum applies.
+ * @retval false The erratum does not apply.
+ */
+NRFX_STATIC_INLINE bool nrfx_errata_check(uint32_t errata);
+
+#ifndef NRFX_DECLARE_ONLY
+
+NRFX_STATIC_INLINE bool nrfx_errata_check(uint32_t errata)
+{
+    uint32_t word = errata / 32;
+    uint32_t mask = 1UL << (errata % 32);
+
+    if ((errata > NRFX_ERRATA_MAX) || !(NRFX_ERRATA_POSSIBLE_MASK(word) & mask))
+    {
+        return false;
+    }
+
+    if (!nrfx_errata_cache.resolved)
+    {
+        nrfx_errata_init();
+    }
+    return (nrfx_errata_cache.errata[word] & mask) != 0;
+}
+
+#endif // NRFX_DECLARE_ONLY
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_ERRATA_H__
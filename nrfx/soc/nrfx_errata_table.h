@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * This file is generated by nrfx_errata_table_gen.py from nrf52_erratas.h.
+ * Do not edit it manually, regenerate it after updating the MDK instead.
+ */
+
+#ifndef NRFX_ERRATA_TABLE_H__
+#define NRFX_ERRATA_TABLE_H__
+
+#define NRFX_ERRATA_MAX    231
+#define NRFX_ERRATA_WORDS  8
+
+#if defined(NRF52832_XXAA) \
+ || defined(NRF52832_XXAB) \
+ || defined(DEVELOP_IN_NRF52832)
+#define NRFX_ERRATA_NRF52832_MASK(w) \
+    (((w) == 0) ? 0xFF939F9Eu : \
+     ((w) == 1) ? 0xC6CBDFFFu : \
+     ((w) == 2) ? 0x0BDAFFDFu : \
+     ((w) == 3) ? 0x00023C62u : \
+     ((w) == 4) ? 0x1864A510u : \
+     ((w) == 5) ? 0x00ED2008u : \
+     ((w) == 6) ? 0x1C341215u : 0u)
+#define NRFX_ERRATA_NRF52832_ROWS \
+    { NRFX_ERRATA_METHOD_ROM, 0x06, 0x03, { 0x7F830F9Eu, 0xC203DFEFu, 0x000002C2u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u } }, \
+    { NRFX_ERRATA_METHOD_ROM, 0x06, 0x04, { 0x00000000u, 0x80000000u, 0x000002C0u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u } }, \
+    { NRFX_ERRATA_METHOD_FICR, 0x06, 0x06, { 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00400000u, 0x00000000u, 0x00000000u } }, \
+    { NRFX_ERRATA_METHOD_FICR_OR_ROM, 0x06, 0x03, { 0x80109000u, 0x04000010u, 0x01D06519u, 0x00001002u, 0x00000100u, 0x00000000u, 0x00200000u, 0x00000000u } }, \
+    { NRFX_ERRATA_METHOD_FICR_OR_ROM, 0x06, 0x04, { 0x80109000u, 0x04C80010u, 0x03DAFD19u, 0x00001062u, 0x00040100u, 0x00000000u, 0x00200000u, 0x00000000u } }, \
+    { NRFX_ERRATA_METHOD_FICR_OR_ROM, 0x06, 0x05, { 0x80109000u, 0x04C80010u, 0x0BDAFD1Du, 0x00023C62u, 0x1864A510u, 0x00AD2008u, 0x1C341215u, 0x00000000u } }, \
+    { NRFX_ERRATA_METHOD_FICR_OR_ROM, 0x06, 0x06, { 0x80109000u, 0x04C80010u, 0x0BDAFD1Du, 0x00023022u, 0x1864A510u, 0x008D2000u, 0x1C341215u, 0x00000000u } }, \
+
+#else
+#define NRFX_ERRATA_NRF52832_MASK(w) 0u
+#define NRFX_ERRATA_NRF52832_ROWS
+#endif
+
+#if defined(NRF52840_XXAA) \
+ || defined(DEVELOP_IN_NRF52840)
+#define NRFX_ERRATA_NRF52840_MASK(w) \
+    (((w) == 0) ? 0x00108000u : \
+     ((w) == 1) ? 0x04C00010u : \
+     ((w) == 2) ? 0x428A4014u : \
+     ((w) == 3) ? 0x87FBC187u : \
+     ((w) == 4) ? 0x5ECBD1E9u : \
+     ((w) == 5) ? 0xEDB97C55u : \
+     ((w) == 6) ? 0x0DF717FFu : \
+     ((w) == 7) ? 0x00000010u : 0u)
+#define NRFX_ERRATA_NRF52840_ROWS \
+    { NRFX_ERRATA_METHOD_FICR, 0x08, 0x00, { 0x00000000u, 0x00000000u, 0x40000000u, 0x87F9C185u, 0x468B50E9u, 0x01100C55u, 0x01C30180u, 0x00000010u } }, \
+    { NRFX_ERRATA_METHOD_FICR, 0x08, 0x01, { 0x00000000u, 0x00000000u, 0x40000000u, 0x04000000u, 0x02000000u, 0xED005C40u, 0x01C304CAu, 0x00000010u } }, \
+    { NRFX_ERRATA_METHOD_FICR, 0x08, 0x02, { 0x00000000u, 0x00000000u, 0x00000000u, 0x04000000u, 0x02000000u, 0xC9005C40u, 0x01C304EAu, 0x00000010u } }, \
+    { NRFX_ERRATA_METHOD_FICR, 0x08, 0x03, { 0x00000000u, 0x00000000u, 0x00000000u, 0x04000000u, 0x02000000u, 0xC9005C40u, 0x01C300CAu, 0x00000010u } }, \
+    { NRFX_ERRATA_METHOD_FICR_OR_ROM, 0x08, 0x00, { 0x00108000u, 0x04C00010u, 0x028A4014u, 0x00020002u, 0x18408100u, 0x00A92000u, 0x08301215u, 0x00000000u } }, \
+    { NRFX_ERRATA_METHOD_FICR_OR_ROM, 0x08, 0x01, { 0x00100000u, 0x00800010u, 0x00824004u, 0x00000000u, 0x08000100u, 0x00892000u, 0x08201215u, 0x00000000u } }, \
+    { NRFX_ERRATA_METHOD_FICR_OR_ROM, 0x08, 0x02, { 0x00100000u, 0x00800010u, 0x00824004u, 0x00000000u, 0x08000100u, 0x00892000u, 0x0C341215u, 0x00000000u } }, \
+    { NRFX_ERRATA_METHOD_FICR_OR_ROM, 0x08, 0x03, { 0x00100000u, 0x00800010u, 0x00824004u, 0x00000000u, 0x08000100u, 0x00892000u, 0x0C341014u, 0x00000000u } }, \
+
+#else
+#define NRFX_ERRATA_NRF52840_MASK(w) 0u
+#define NRFX_ERRATA_NRF52840_ROWS
+#endif
+
+#if defined(NRF52810_XXAA) \
+ || defined(DEVELOP_IN_NRF52810)
+#define NRFX_ERRATA_NRF52810_MASK(w) \
+    (((w) == 0) ? 0x80108000u : \
+     ((w) == 1) ? 0x00000010u : \
+     ((w) == 2) ? 0x010A6014u : \
+     ((w) == 4) ? 0x18600100u : \
+     ((w) == 5) ? 0x01892000u : \
+     ((w) == 6) ? 0x0A341201u : \
+     ((w) == 7) ? 0x00000010u : 0u)
+#define NRFX_ERRATA_NRF52810_ROWS \
+    { NRFX_ERRATA_METHOD_FICR, 0x0A, 0x00, { 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x01000000u, 0x00000000u, 0x00000000u } }, \
+    { NRFX_ERRATA_METHOD_FICR, 0x0A, 0x01, { 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x01000000u, 0x02000000u, 0x00000010u } }, \
+    { NRFX_ERRATA_METHOD_FICR_OR_ROM, 0x0A, 0x00, { 0x80108000u, 0x00000010u, 0x010A6014u, 0x00000000u, 0x18400100u, 0x00892000u, 0x08341201u, 0x00000000u } }, \
+    { NRFX_ERRATA_METHOD_FICR_OR_ROM, 0x0A, 0x01, { 0x80108000u, 0x00000010u, 0x010A6014u, 0x00000000u, 0x18200100u, 0x00892000u, 0x08341000u, 0x00000000u } }, \
+
+#else
+#define NRFX_ERRATA_NRF52810_MASK(w) 0u
+#define NRFX_ERRATA_NRF52810_ROWS
+#endif
+
+#if defined(NRF52833_XXAA) \
+ || defined(DEVELOP_IN_NRF52833)
+#define NRFX_ERRATA_NRF52833_MASK(w) \
+    (((w) == 0) ? 0x00100000u : \
+     ((w) == 1) ? 0x00800010u : \
+     ((w) == 2) ? 0x00804004u : \
+     ((w) == 4) ? 0x02000100u : \
+     ((w) == 5) ? 0x49812400u : \
+     ((w) == 6) ? 0x0C140014u : \
+     ((w) == 7) ? 0x00000012u : 0u)
+#define NRFX_ERRATA_NRF52833_ROWS \
+    { NRFX_ERRATA_METHOD_FICR, 0x0D, 0x00, { 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x49000400u, 0x00000000u, 0x00000012u } }, \
+    { NRFX_ERRATA_METHOD_FICR, 0x0D, 0x01, { 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x02000000u, 0x49000400u, 0x00000000u, 0x00000012u } }, \
+    { NRFX_ERRATA_METHOD_FICR_OR_ROM, 0x0D, 0x00, { 0x00100000u, 0x00800010u, 0x00804004u, 0x00000000u, 0x00000100u, 0x00812000u, 0x0C140014u, 0x00000000u } }, \
+    { NRFX_ERRATA_METHOD_FICR_OR_ROM, 0x0D, 0x01, { 0x00100000u, 0x00800010u, 0x00804004u, 0x00000000u, 0x00000100u, 0x00812000u, 0x0C140014u, 0x00000000u } }, \
+
+#else
+#define NRFX_ERRATA_NRF52833_MASK(w) 0u
+#define NRFX_ERRATA_NRF52833_ROWS
+#endif
+
+#if defined(NRF52811_XXAA) \
+ || defined(DEVELOP_IN_NRF52811)
+#define NRFX_ERRATA_NRF52811_MASK(w) \
+    (((w) == 0) ? 0x80108000u : \
+     ((w) == 1) ? 0x00000010u : \
+     ((w) == 2) ? 0x010A6014u : \
+     ((w) == 4) ? 0x18200100u : \
+     ((w) == 5) ? 0x01892000u : \
+     ((w) == 6) ? 0x0A340000u : \
+     ((w) == 7) ? 0x00000010u : 0u)
+#define NRFX_ERRATA_NRF52811_ROWS \
+    { NRFX_ERRATA_METHOD_FICR, 0x0E, 0x00, { 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x01000000u, 0x02000000u, 0x00000010u } }, \
+    { NRFX_ERRATA_METHOD_FICR_OR_ROM, 0x0E, 0x00, { 0x80108000u, 0x00000010u, 0x010A6014u, 0x00000000u, 0x18200100u, 0x00892000u, 0x08340000u, 0x00000000u } }, \
+
+#else
+#define NRFX_ERRATA_NRF52811_MASK(w) 0u
+#define NRFX_ERRATA_NRF52811_ROWS
+#endif
+
+#if defined(NRF52805_XXAA) \
+ || defined(DEVELOP_IN_NRF52805)
+#define NRFX_ERRATA_NRF52805_MASK(w) \
+    (((w) == 0) ? 0x80108000u : \
+     ((w) == 1) ? 0x00000010u : \
+     ((w) == 2) ? 0x010A6014u : \
+     ((w) == 4) ? 0x18000100u : \
+     ((w) == 5) ? 0x01092000u : \
+     ((w) == 6) ? 0x0A140000u : 0u)
+#define NRFX_ERRATA_NRF52805_ROWS \
+    { NRFX_ERRATA_METHOD_FICR, 0x0F, 0x00, { 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x01000000u, 0x02000000u, 0x00000000u } }, \
+    { NRFX_ERRATA_METHOD_FICR_OR_ROM, 0x0F, 0x00, { 0x80108000u, 0x00000010u, 0x010A6014u, 0x00000000u, 0x18000100u, 0x00092000u, 0x08140000u, 0x00000000u } }, \
+
+#else
+#define NRFX_ERRATA_NRF52805_MASK(w) 0u
+#define NRFX_ERRATA_NRF52805_ROWS
+#endif
+
+#if defined(NRF52820_XXAA) \
+ || defined(DEVELOP_IN_NRF52820)
+#define NRFX_ERRATA_NRF52820_MASK(w) \
+    (((w) == 0) ? 0x00100000u : \
+     ((w) == 1) ? 0x00800010u : \
+     ((w) == 2) ? 0x00804004u : \
+     ((w) == 4) ? 0x02000100u : \
+     ((w) == 5) ? 0x49812400u : \
+     ((w) == 6) ? 0x0C140014u : \
+     ((w) == 7) ? 0x000000D2u : 0u)
+#define NRFX_ERRATA_NRF52820_ROWS \
+    { NRFX_ERRATA_METHOD_FICR, 0x10, 0x00, { 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x02000000u, 0x49000400u, 0x00000000u, 0x000000D2u } }, \
+    { NRFX_ERRATA_METHOD_FICR, 0x10, 0x01, { 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x02000000u, 0x49000400u, 0x00000000u, 0x00000012u } }, \
+    { NRFX_ERRATA_METHOD_FICR_OR_ROM, 0x10, 0x00, { 0x00100000u, 0x00800010u, 0x00804004u, 0x00000000u, 0x00000100u, 0x00812000u, 0x0C140014u, 0x00000000u } }, \
+    { NRFX_ERRATA_METHOD_FICR_OR_ROM, 0x10, 0x01, { 0x00100000u, 0x00800010u, 0x00804004u, 0x00000000u, 0x00000100u, 0x00812000u, 0x0C140014u, 0x00000000u } }, \
+
+#else
+#define NRFX_ERRATA_NRF52820_MASK(w) 0u
+#define NRFX_ERRATA_NRF52820_ROWS
+#endif
+
+#define NRFX_ERRATA_POSSIBLE_MASK(w) \
+    (NRFX_ERRATA_NRF52832_MASK(w) | \
+     NRFX_ERRATA_NRF52840_MASK(w) | \
+     NRFX_ERRATA_NRF52810_MASK(w) | \
+     NRFX_ERRATA_NRF52833_MASK(w) | \
+     NRFX_ERRATA_NRF52811_MASK(w) | \
+     NRFX_ERRATA_NRF52805_MASK(w) | \
+     NRFX_ERRATA_NRF52820_MASK(w))
+
+#define NRFX_ERRATA_TABLE_ROWS \
+    NRFX_ERRATA_NRF52832_ROWS \
+    NRFX_ERRATA_NRF52840_ROWS \
+    NRFX_ERRATA_NRF52810_ROWS \
+    NRFX_ERRATA_NRF52833_ROWS \
+    NRFX_ERRATA_NRF52811_ROWS \
+    NRFX_ERRATA_NRF52805_ROWS \
+    NRFX_ERRATA_NRF52820_ROWS
+
+#endif // NRFX_ERRATA_TABLE_H__
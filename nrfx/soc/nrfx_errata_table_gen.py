@@ -0,0 +1,153 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2020, Nordic Semiconductor ASA
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Generates nrfx_errata_table.h from the nrf52_erratas.h file shipped with the MDK.
+#
+# Every nrf52_errata_N() function in the MDK decodes the part code and revision
+# (var1 and var2) in one of three ways and then checks them against a list of
+# affected revisions. This script collects, for each of those decoding methods,
+# part code and revision, the set of errata that apply, so that the whole set can
+# be resolved once at runtime and then tested with a single bit lookup.
+#
+# Usage: nrfx_errata_table_gen.py <path to nrf52_erratas.h> <output file>
+
+import re
+import sys
+
+METHODS = ('NRFX_ERRATA_METHOD_ROM', 'NRFX_ERRATA_METHOD_FICR', 'NRFX_ERRATA_METHOD_FICR_OR_ROM')
+
+# Part code (var1) to the build-time symbols selecting the matching part.
+PARTS = {
+    0x06: ('NRF52832', ('NRF52832_XXAA', 'NRF52832_XXAB', 'DEVELOP_IN_NRF52832')),
+    0x08: ('NRF52840', ('NRF52840_XXAA', 'DEVELOP_IN_NRF52840')),
+    0x0A: ('NRF52810', ('NRF52810_XXAA', 'DEVELOP_IN_NRF52810')),
+    0x0D: ('NRF52833', ('NRF52833_XXAA', 'DEVELOP_IN_NRF52833')),
+    0x0E: ('NRF52811', ('NRF52811_XXAA', 'DEVELOP_IN_NRF52811')),
+    0x0F: ('NRF52805', ('NRF52805_XXAA', 'DEVELOP_IN_NRF52805')),
+    0x10: ('NRF52820', ('NRF52820_XXAA', 'DEVELOP_IN_NRF52820')),
+}
+
+FUNC_RE   = re.compile(r'static bool nrf52_errata_(\d+)\(void\)\n\{\n(.*?)\n\}\n', re.S)
+VAR1_RE   = re.compile(r'if \(var1 == (0x[0-9A-Fa-f]+)\)\s*\{\s*switch\(var2\)\s*\{(.*?)\}\s*\}', re.S)
+CASE_RE   = re.compile(r'case (0x[0-9A-Fa-f]+)ul:\s*return (true|false);')
+
+def method_get(body):
+    if 'if (*(uint32_t *)0x10000130ul == 0xFFFFFFFF)' in body:
+        return 2
+    if '0x10000130ul' in body:
+        return 1
+    if '0xF0000FE0ul' in body:
+        return 0
+    return None
+
+def main(src, dst):
+    text = open(src).read()
+    # (method, var1, var2) -> set of errata numbers
+    rows = {}
+    max_errata = 0
+    for num, body in FUNC_RE.findall(text):
+        num = int(num)
+        max_errata = max(max_errata, num)
+        method = method_get(body)
+        if method is None:
+            continue
+        for var1, cases in VAR1_RE.findall(body):
+            var1 = int(var1, 16)
+            if var1 not in PARTS:
+                sys.exit('Unknown part code 0x%02X in errata %d' % (var1, num))
+            for var2, result in CASE_RE.findall(cases):
+                key = (method, var1, int(var2, 16))
+                rows.setdefault(key, set())
+                if result == 'true':
+                    rows[key].add(num)
+
+    words = (max_errata + 32) // 32
+
+    def bitset(errata):
+        w = [0] * words
+        for n in errata:
+            w[n // 32] |= 1 << (n % 32)
+        return w
+
+    out = []
+    out.append(HEADER)
+    out.append('#define NRFX_ERRATA_MAX    %d\n' % max_errata)
+    out.append('#define NRFX_ERRATA_WORDS  %d\n\n' % words)
+
+    for var1 in sorted(PARTS):
+        name, symbols = PARTS[var1]
+        part_rows = sorted(k for k in rows if k[1] == var1 and rows[k])
+        mask = [0] * words
+        for k in part_rows:
+            mask = [a | b for a, b in zip(mask, bitset(rows[k]))]
+        cond = ' \\\n || '.join('defined(%s)' % s for s in symbols)
+        out.append('#if %s\n' % cond)
+        terms = ['((w) == %d) ? 0x%08Xu :' % (i, m) for i, m in enumerate(mask) if m]
+        out.append('#define NRFX_ERRATA_%s_MASK(w) \\\n    (%s 0u)\n' %
+                   (name, ' \\\n     '.join(terms)))
+        out.append('#define NRFX_ERRATA_%s_ROWS \\\n' % name)
+        for method, _, var2 in part_rows:
+            bits = ', '.join('0x%08Xu' % b for b in bitset(rows[(method, var1, var2)]))
+            out.append('    { %s, 0x%02X, 0x%02X, { %s } }, \\\n' %
+                       (METHODS[method], var1, var2, bits))
+        out.append('\n#else\n')
+        out.append('#define NRFX_ERRATA_%s_MASK(w) 0u\n' % name)
+        out.append('#define NRFX_ERRATA_%s_ROWS\n' % name)
+        out.append('#endif\n\n')
+
+    names = [PARTS[v][0] for v in sorted(PARTS)]
+    out.append('#define NRFX_ERRATA_POSSIBLE_MASK(w) \\\n    (%s)\n\n' %
+               ' | \\\n     '.join('NRFX_ERRATA_%s_MASK(w)' % n for n in names))
+    out.append('#define NRFX_ERRATA_TABLE_ROWS \\\n    %s\n\n' %
+               ' \\\n    '.join('NRFX_ERRATA_%s_ROWS' % n for n in names))
+    out.append('#endif // NRFX_ERRATA_TABLE_H__\n')
+
+    open(dst, 'w').write(''.join(out))
+
+HEADER = '''/*
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * This file is generated by nrfx_errata_table_gen.py from nrf52_erratas.h.
+ * Do not edit it manually, regenerate it after updating the MDK instead.
+ */
+
+#ifndef NRFX_ERRATA_TABLE_H__
+#define NRFX_ERRATA_TABLE_H__
+
+'''
+
+if __name__ == '__main__':
+    if len(sys.argv) != 3:
+        sys.exit('Usage: %s <nrf52_erratas.h> <output>' % sys.argv[0])
+    main(sys.argv[1], sys.argv[2])
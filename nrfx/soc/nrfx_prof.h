@@ -0,0 +1,320 @@
+/*
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NRFX_PROF_H__
+#define NRFX_PROF_H__
+
+#if defined(__arm__)
+    #include <nrfx.h>
+    #include <soc/nrfx_coredep.h>
+#else
+    #include <stdint.h>
+    #include <stdbool.h>
+    #include <stddef.h>
+    #include <time.h>
+    #ifndef NRFX_STATIC_INLINE
+    #define NRFX_STATIC_INLINE static inline
+    #endif
+    #ifndef NRFX_CHECK
+    #define NRFX_CHECK(module_enabled) (module_enabled)
+    #endif
+#endif
+
+#ifndef NRFX_PROF_ENABLED
+#define NRFX_PROF_ENABLED 0
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_prof Code region profiling
+ * @{
+ * @ingroup nrfx
+ * @brief Module for measuring the execution time of code regions.
+ *
+ * Each region is described by a static descriptor that accumulates the number
+ * of executions and the minimum, maximum, and total duration. The time source is
+ * the DWT cycle counter when the SoC has one, a TIMER instance otherwise, and
+ * @c clock_gettime when the code is built for a host.
+ *
+ * All macros compile to nothing unless @ref NRFX_PROF_ENABLED is set, so the
+ * annotations can be left in place in production code. A region must not be
+ * entered again before it is exited, so a region used in an interrupt handler
+ * must not be used in code that can be preempted by that handler.
+ */
+
+#if defined(__NRFX_DOXYGEN__)
+
+/** @brief Number of time source ticks per microsecond. */
+#define NRFX_PROF_TICKS_PER_US
+
+/**
+ * @brief Number of the TIMER instance used as the time source on SoCs without the DWT
+ *        cycle counter.
+ *
+ * The instance is configured as a 32-bit timer running at 16 MHz. There is no default,
+ * as every TIMER instance may be used by the application. This value must be specified
+ * externally when profiling is enabled on such SoCs, and the instance must not be used
+ * by any driver.
+ */
+#define NRFX_PROF_TIMER
+
+#elif !defined(__arm__)
+    #define NRFX_PROF_HOST_USED     1
+    #define NRFX_PROF_TICKS_PER_US  1000
+#elif NRFX_DELAY_DWT_PRESENT
+    #define NRFX_PROF_DWT_USED      1
+    #define NRFX_PROF_TICKS_PER_US  NRFX_DELAY_CPU_FREQ_MHZ
+#else
+    #define NRFX_PROF_TICKS_PER_US  16
+    #if defined(NRFX_PROF_TIMER)
+        #include <hal/nrf_timer.h>
+        #define NRFX_PROF_TIMER_USED    1
+        #define NRFX_PROF_TIMER_REG     NRFX_CONCAT_2(NRF_TIMER, NRFX_PROF_TIMER)
+    #elif NRFX_CHECK(NRFX_PROF_ENABLED)
+        #error "NRFX_PROF_TIMER must be set to the number of a TIMER instance not used otherwise."
+    #endif
+#endif
+
+/** @brief Profiled code region descriptor. */
+typedef struct
+{
+    char const * p_name; ///< Name of the region.
+    uint32_t     start;  ///< Time at which the region was last entered.
+    uint32_t     count;  ///< Number of completed executions.
+    uint32_t     min;    ///< Shortest execution, in ticks.
+    uint32_t     max;    ///< Longest execution, in ticks.
+    uint64_t     total;  ///< Sum of all executions, in ticks.
+} nrfx_prof_region_t;
+
+#if NRFX_CHECK(NRFX_PROF_ENABLED) || defined(__NRFX_DOXYGEN__)
+
+/**
+ * @brief Macro for defining a static region descriptor.
+ *
+ * @param _name Name of the descriptor variable. It is also used as the region name.
+ */
+#define NRFX_PROF_REGION_DEFINE(_name)  \
+    static nrfx_prof_region_t _name =   \
+    {                                   \
+        .p_name = #_name,               \
+        .min    = UINT32_MAX,           \
+    }
+
+/**
+ * @brief Macro for starting the time source.
+ *
+ * It is called once by the integration layer at startup, before any profiled code runs
+ * (see @ref NRFX_PROF_ENABLED in nrfx_glue.h). Drivers do not call it.
+ */
+#define NRFX_PROF_INIT()                nrfx_prof_init()
+
+/**
+ * @brief Macro for marking the beginning of a region.
+ *
+ * @param _name Name of the region descriptor.
+ */
+#define NRFX_PROF_BEGIN(_name)          nrfx_prof_region_begin(&(_name))
+
+/**
+ * @brief Macro for marking the end of a region.
+ *
+ * @param _name Name of the region descriptor.
+ */
+#define NRFX_PROF_END(_name)            nrfx_prof_region_end(&(_name))
+
+#else
+
+#define NRFX_PROF_REGION_DEFINE(_name)  struct nrfx_prof_unused_ ## _name
+#define NRFX_PROF_INIT()                do {} while (0)
+#define NRFX_PROF_BEGIN(_name)          do {} while (0)
+#define NRFX_PROF_END(_name)            do {} while (0)
+
+#endif // NRFX_CHECK(NRFX_PROF_ENABLED) || defined(__NRFX_DOXYGEN__)
+
+/**
+ * @brief Format of a report line describing one region.
+ *
+ * The line holds the tag @c nrfx_prof followed by the region name, the execution
+ * count, the minimum, maximum, and mean durations in ticks, and the number of ticks
+ * per microsecond, separated by commas. The arguments are provided by
+ * @ref NRFX_PROF_REPORT_ARGS, for example:
+ * @code
+ * printf(NRFX_PROF_REPORT_FMT "\n", NRFX_PROF_REPORT_ARGS(m_region));
+ * @endcode
+ * The lines can be collected from a host run or a target log and compared against
+ * a baseline with the @c scripts/nrfx_prof_compare.py script.
+ */
+#define NRFX_PROF_REPORT_FMT  "nrfx_prof,%s,%lu,%lu,%lu,%lu,%lu"
+
+/**
+ * @brief Macro for getting the arguments for @ref NRFX_PROF_REPORT_FMT.
+ *
+ * @param _name Name of the region descriptor.
+ */
+#define NRFX_PROF_REPORT_ARGS(_name)                         \
+    (_name).p_name,                                          \
+    (unsigned long)(_name).count,                            \
+    (unsigned long)((_name).count ? (_name).min : 0),        \
+    (unsigned long)(_name).max,                              \
+    (unsigned long)nrfx_prof_region_mean_get(&(_name)),      \
+    (unsigned long)NRFX_PROF_TICKS_PER_US
+
+/**
+ * @brief Function for starting the time source.
+ *
+ * With the DWT backend, the trace unit and the cycle counter are enabled. With the
+ * TIMER backend, @ref NRFX_PROF_TIMER is configured and started.
+ */
+NRFX_STATIC_INLINE void nrfx_prof_init(void);
+
+/**
+ * @brief Function for getting the current time.
+ *
+ * @return Current value of the time source, in ticks.
+ */
+NRFX_STATIC_INLINE uint32_t nrfx_prof_ticks_get(void);
+
+/**
+ * @brief Function for marking the beginning of a region.
+ *
+ * @param[in] p_region Pointer to the region descriptor.
+ */
+NRFX_STATIC_INLINE void nrfx_prof_region_begin(nrfx_prof_region_t * p_region);
+
+/**
+ * @brief Function for marking the end of a region and accumulating its duration.
+ *
+ * @param[in] p_region Pointer to the region descriptor.
+ */
+NRFX_STATIC_INLINE void nrfx_prof_region_end(nrfx_prof_region_t * p_region);
+
+/**
+ * @brief Function for getting the mean duration of a region.
+ *
+ * @param[in] p_region Pointer to the region descriptor.
+ *
+ * @return Mean duration in ticks, or 0 if the region was never completed.
+ */
+NRFX_STATIC_INLINE uint32_t nrfx_prof_region_mean_get(nrfx_prof_region_t const * p_region);
+
+/**
+ * @brief Function for clearing the statistics of a region.
+ *
+ * @param[in] p_region Pointer to the region descriptor.
+ */
+NRFX_STATIC_INLINE void nrfx_prof_region_reset(nrfx_prof_region_t * p_region);
+
+/** @} */
+
+#ifndef NRFX_DECLARE_ONLY
+
+NRFX_STATIC_INLINE void nrfx_prof_init(void)
+{
+#if NRFX_PROF_DWT_USED
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL        |= DWT_CTRL_CYCCNTENA_Msk;
+#elif NRFX_PROF_TIMER_USED
+    nrf_timer_mode_set(NRFX_PROF_TIMER_REG, NRF_TIMER_MODE_TIMER);
+    nrf_timer_bit_width_set(NRFX_PROF_TIMER_REG, NRF_TIMER_BIT_WIDTH_32);
+    nrf_timer_frequency_set(NRFX_PROF_TIMER_REG, NRF_TIMER_FREQ_16MHz);
+    nrf_timer_task_trigger(NRFX_PROF_TIMER_REG, NRF_TIMER_TASK_START);
+#endif
+}
+
+NRFX_STATIC_INLINE uint32_t nrfx_prof_ticks_get(void)
+{
+#if NRFX_PROF_DWT_USED
+    return DWT->CYCCNT;
+#elif NRFX_PROF_TIMER_USED
+    // The capture and the read must not be split by a handler that captures too.
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    nrf_timer_task_trigger(NRFX_PROF_TIMER_REG, NRF_TIMER_TASK_CAPTURE0);
+    uint32_t ticks = nrf_timer_cc_get(NRFX_PROF_TIMER_REG, NRF_TIMER_CC_CHANNEL0);
+    __set_PRIMASK(primask);
+    return ticks;
+#elif NRFX_PROF_HOST_USED
+    struct timespec ts;
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec);
+#else
+    return 0;
+#endif
+}
+
+NRFX_STATIC_INLINE void nrfx_prof_region_begin(nrfx_prof_region_t * p_region)
+{
+    p_region->start = nrfx_prof_ticks_get();
+}
+
+NRFX_STATIC_INLINE void nrfx_prof_region_end(nrfx_prof_region_t * p_region)
+{
+    uint32_t duration = nrfx_prof_ticks_get() - p_region->start;
+
+    if (duration < p_region->min)
+    {
+        p_region->min = duration;
+    }
+    if (duration > p_region->max)
+    {
+        p_region->max = duration;
+    }
+    p_region->total += duration;
+    p_region->count++;
+}
+
+NRFX_STATIC_INLINE uint32_t nrfx_prof_region_mean_get(nrfx_prof_region_t const * p_region)
+{
+    if (p_region->count == 0)
+    {
+        return 0;
+    }
+    return (uint32_t)(p_region->total / p_region->count);
+}
+
+NRFX_STATIC_INLINE void nrfx_prof_region_reset(nrfx_prof_region_t * p_region)
+{
+    p_region->count = 0;
+    p_region->min   = UINT32_MAX;
+    p_region->max   = 0;
+    p_region->total = 0;
+}
+
+#endif // NRFX_DECLARE_ONLY
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_PROF_H__
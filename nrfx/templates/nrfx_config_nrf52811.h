@@ -205,6 +205,84 @@
 
 // </e>
 
+// <e> NRFX_ECB_ENABLED - nrfx_ecb - ECB peripheral driver
+//==========================================================
+#ifndef NRFX_ECB_ENABLED
+#define NRFX_ECB_ENABLED 0
+#endif
+// <o> NRFX_ECB_DEFAULT_CONFIG_IRQ_PRIORITY  - Interrupt priority
+
+// <0=> 0 (highest)
+// <1=> 1
+// <2=> 2
+// <3=> 3
+// <4=> 4
+// <5=> 5
+// <6=> 6
+// <7=> 7
+
+#ifndef NRFX_ECB_DEFAULT_CONFIG_IRQ_PRIORITY
+#define NRFX_ECB_DEFAULT_CONFIG_IRQ_PRIORITY 7
+#endif
+
+// <o> NRFX_ECB_CONFIG_BATCH_BLOCKS - Number of blocks encrypted in one job by the CTR mode helper
+#ifndef NRFX_ECB_CONFIG_BATCH_BLOCKS
+#define NRFX_ECB_CONFIG_BATCH_BLOCKS 4
+#endif
+
+// <e> NRFX_ECB_CONFIG_LOG_ENABLED - Enables logging in the module.
+//==========================================================
+#ifndef NRFX_ECB_CONFIG_LOG_ENABLED
+#define NRFX_ECB_CONFIG_LOG_ENABLED 0
+#endif
+// <o> NRFX_ECB_CONFIG_LOG_LEVEL  - Default Severity level
+
+// <0=> Off
+// <1=> Error
+// <2=> Warning
+// <3=> Info
+// <4=> Debug
+
+#ifndef NRFX_ECB_CONFIG_LOG_LEVEL
+#define NRFX_ECB_CONFIG_LOG_LEVEL 3
+#endif
+
+// <o> NRFX_ECB_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+
+// <0=> Default
+// <1=> Black
+// <2=> Red
+// <3=> Green
+// <4=> Yellow
+// <5=> Blue
+// <6=> Magenta
+// <7=> Cyan
+// <8=> White
+
+#ifndef NRFX_ECB_CONFIG_INFO_COLOR
+#define NRFX_ECB_CONFIG_INFO_COLOR 0
+#endif
+
+// <o> NRFX_ECB_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+
+// <0=> Default
+// <1=> Black
+// <2=> Red
+// <3=> Green
+// <4=> Yellow
+// <5=> Blue
+// <6=> Magenta
+// <7=> Cyan
+// <8=> White
+
+#ifndef NRFX_ECB_CONFIG_DEBUG_COLOR
+#define NRFX_ECB_CONFIG_DEBUG_COLOR 0
+#endif
+
+// </e>
+
+// </e>
+
 // <e> NRFX_EGU_ENABLED - nrfx_egu - EGU peripheral driver.
 //==========================================================
 #ifndef NRFX_EGU_ENABLED
@@ -318,6 +396,14 @@
 
 // </e>
 
+// <e> NRFX_IDLE_ENABLED - nrfx_idle - Peripheral idle manager
+//==========================================================
+#ifndef NRFX_IDLE_ENABLED
+#define NRFX_IDLE_ENABLED 0
+#endif
+
+// </e>
+
 // <e> NRFX_NVMC_ENABLED - nrfx_nvmc - NVMC peripheral driver
 //==========================================================
 #ifndef NRFX_NVMC_ENABLED
@@ -873,6 +959,69 @@
 
 // </e>
 
+// <e> NRFX_RTC_TIMER_ENABLED - nrfx_rtc_timer - Software timers on RTC
+//==========================================================
+#ifndef NRFX_RTC_TIMER_ENABLED
+#define NRFX_RTC_TIMER_ENABLED 0
+#endif
+// <o> NRFX_RTC_TIMER_CONFIG_MAX_TIMERS - Maximum number of running timers
+#ifndef NRFX_RTC_TIMER_CONFIG_MAX_TIMERS
+#define NRFX_RTC_TIMER_CONFIG_MAX_TIMERS 32
+#endif
+
+// <e> NRFX_RTC_TIMER_CONFIG_LOG_ENABLED - Enables logging in the module.
+//==========================================================
+#ifndef NRFX_RTC_TIMER_CONFIG_LOG_ENABLED
+#define NRFX_RTC_TIMER_CONFIG_LOG_ENABLED 0
+#endif
+// <o> NRFX_RTC_TIMER_CONFIG_LOG_LEVEL  - Default Severity level
+
+// <0=> Off
+// <1=> Error
+// <2=> Warning
+// <3=> Info
+// <4=> Debug
+
+#ifndef NRFX_RTC_TIMER_CONFIG_LOG_LEVEL
+#define NRFX_RTC_TIMER_CONFIG_LOG_LEVEL 3
+#endif
+
+// <o> NRFX_RTC_TIMER_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+
+// <0=> Default
+// <1=> Black
+// <2=> Red
+// <3=> Green
+// <4=> Yellow
+// <5=> Blue
+// <6=> Magenta
+// <7=> Cyan
+// <8=> White
+
+#ifndef NRFX_RTC_TIMER_CONFIG_INFO_COLOR
+#define NRFX_RTC_TIMER_CONFIG_INFO_COLOR 0
+#endif
+
+// <o> NRFX_RTC_TIMER_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+
+// <0=> Default
+// <1=> Black
+// <2=> Red
+// <3=> Green
+// <4=> Yellow
+// <5=> Blue
+// <6=> Magenta
+// <7=> Cyan
+// <8=> White
+
+#ifndef NRFX_RTC_TIMER_CONFIG_DEBUG_COLOR
+#define NRFX_RTC_TIMER_CONFIG_DEBUG_COLOR 0
+#endif
+
+// </e>
+
+// </e>
+
 // <e> NRFX_SAADC_ENABLED - nrfx_saadc - SAADC peripheral driver
 //==========================================================
 #ifndef NRFX_SAADC_ENABLED
@@ -964,6 +1113,13 @@
 #define NRFX_SPIM1_ENABLED 0
 #endif
 
+// <q> NRFX_SPIM_BLOCKING_ENABLED  - Enable transfers without an event handler
+
+
+#ifndef NRFX_SPIM_BLOCKING_ENABLED
+#define NRFX_SPIM_BLOCKING_ENABLED 1
+#endif
+
 // <o> NRFX_SPIM_DEFAULT_CONFIG_IRQ_PRIORITY  - Interrupt priority
 
 // <0=> 0 (highest)
@@ -1337,6 +1493,13 @@
 #define NRFX_TWIM0_ENABLED 0
 #endif
 
+// <q> NRFX_TWIM_BLOCKING_ENABLED  - Enable transfers without an event handler
+
+
+#ifndef NRFX_TWIM_BLOCKING_ENABLED
+#define NRFX_TWIM_BLOCKING_ENABLED 1
+#endif
+
 // <o> NRFX_TWIM_DEFAULT_CONFIG_IRQ_PRIORITY  - Interrupt priority
 
 // <0=> 0 (highest)
@@ -1593,6 +1756,13 @@
 #define NRFX_UARTE0_ENABLED 0
 #endif
 
+// <q> NRFX_UARTE_BLOCKING_ENABLED  - Enable transfers without an event handler
+
+
+#ifndef NRFX_UARTE_BLOCKING_ENABLED
+#define NRFX_UARTE_BLOCKING_ENABLED 1
+#endif
+
 // <o> NRFX_UARTE_DEFAULT_CONFIG_IRQ_PRIORITY  - Interrupt priority
 
 // <0=> 0 (highest)
@@ -1830,6 +2000,69 @@
 
 // </e>
 
+// <e> NRFX_WDT_MONITOR_ENABLED - nrfx_wdt_monitor - WDT liveness monitor
+//==========================================================
+#ifndef NRFX_WDT_MONITOR_ENABLED
+#define NRFX_WDT_MONITOR_ENABLED 0
+#endif
+// <o> NRFX_WDT_MONITOR_CONFIG_STACK_WORDS - Number of stack words captured in the crash record
+#ifndef NRFX_WDT_MONITOR_CONFIG_STACK_WORDS
+#define NRFX_WDT_MONITOR_CONFIG_STACK_WORDS 32
+#endif
+
+// <e> NRFX_WDT_MONITOR_CONFIG_LOG_ENABLED - Enables logging in the module.
+//==========================================================
+#ifndef NRFX_WDT_MONITOR_CONFIG_LOG_ENABLED
+#define NRFX_WDT_MONITOR_CONFIG_LOG_ENABLED 0
+#endif
+// <o> NRFX_WDT_MONITOR_CONFIG_LOG_LEVEL  - Default Severity level
+
+// <0=> Off
+// <1=> Error
+// <2=> Warning
+// <3=> Info
+// <4=> Debug
+
+#ifndef NRFX_WDT_MONITOR_CONFIG_LOG_LEVEL
+#define NRFX_WDT_MONITOR_CONFIG_LOG_LEVEL 3
+#endif
+
+// <o> NRFX_WDT_MONITOR_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+
+// <0=> Default
+// <1=> Black
+// <2=> Red
+// <3=> Green
+// <4=> Yellow
+// <5=> Blue
+// <6=> Magenta
+// <7=> Cyan
+// <8=> White
+
+#ifndef NRFX_WDT_MONITOR_CONFIG_INFO_COLOR
+#define NRFX_WDT_MONITOR_CONFIG_INFO_COLOR 0
+#endif
+
+// <o> NRFX_WDT_MONITOR_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+
+// <0=> Default
+// <1=> Black
+// <2=> Red
+// <3=> Green
+// <4=> Yellow
+// <5=> Blue
+// <6=> Magenta
+// <7=> Cyan
+// <8=> White
+
+#ifndef NRFX_WDT_MONITOR_CONFIG_DEBUG_COLOR
+#define NRFX_WDT_MONITOR_CONFIG_DEBUG_COLOR 0
+#endif
+
+// </e>
+
+// </e>
+
 // </h>
 
 #endif // NRFX_CONFIG_NRF52811_H__
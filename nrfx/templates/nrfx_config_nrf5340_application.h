@@ -596,6 +596,14 @@
 
 // </e>
 
+// <e> NRFX_IDLE_ENABLED - nrfx_idle - Peripheral idle manager
+//==========================================================
+#ifndef NRFX_IDLE_ENABLED
+#define NRFX_IDLE_ENABLED 0
+#endif
+
+// </e>
+
 // <e> NRFX_LPCOMP_ENABLED - nrfx_lpcomp - LPCOMP peripheral driver
 //==========================================================
 #ifndef NRFX_LPCOMP_ENABLED
@@ -700,6 +708,21 @@
 #define NRFX_NFCT_CONFIG_TIMER_INSTANCE_ID 2
 #endif
 
+// <q> NRFX_NFCT_CONFIG_USE_RTC  - Use RTC instead of TIMER for workarounds in the driver.
+
+#ifndef NRFX_NFCT_CONFIG_USE_RTC
+#define NRFX_NFCT_CONFIG_USE_RTC 0
+#endif
+
+// <o> NRFX_NFCT_CONFIG_RTC_INSTANCE_ID - RTC instance used for workarounds in the driver.
+
+// <0=> 0
+// <1=> 1
+
+#ifndef NRFX_NFCT_CONFIG_RTC_INSTANCE_ID
+#define NRFX_NFCT_CONFIG_RTC_INSTANCE_ID 1
+#endif
+
 // <e> NRFX_NFCT_CONFIG_LOG_ENABLED - Enables logging in the module.
 //==========================================================
 #ifndef NRFX_NFCT_CONFIG_LOG_ENABLED
@@ -753,6 +776,73 @@
 
 // </e>
 
+// <e> NRFX_NFCT_T4T_ENABLED - nrfx_nfct_t4t - NFC Type 4 Tag emulation
+//==========================================================
+#ifndef NRFX_NFCT_T4T_ENABLED
+#define NRFX_NFCT_T4T_ENABLED 0
+#endif
+// <o> NRFX_NFCT_T4T_CONFIG_FRAME_SIZE - Maximum size of the ISO-DEP frame accepted by the tag <16-256>
+#ifndef NRFX_NFCT_T4T_CONFIG_FRAME_SIZE
+#define NRFX_NFCT_T4T_CONFIG_FRAME_SIZE 256
+#endif
+// <o> NRFX_NFCT_T4T_CONFIG_APDU_SIZE - Size of the buffer for command APDUs received in chained frames
+#ifndef NRFX_NFCT_T4T_CONFIG_APDU_SIZE
+#define NRFX_NFCT_T4T_CONFIG_APDU_SIZE 261
+#endif
+
+// <e> NRFX_NFCT_T4T_CONFIG_LOG_ENABLED - Enables logging in the module.
+//==========================================================
+#ifndef NRFX_NFCT_T4T_CONFIG_LOG_ENABLED
+#define NRFX_NFCT_T4T_CONFIG_LOG_ENABLED 0
+#endif
+// <o> NRFX_NFCT_T4T_CONFIG_LOG_LEVEL  - Default Severity level
+
+// <0=> Off
+// <1=> Error
+// <2=> Warning
+// <3=> Info
+// <4=> Debug
+
+#ifndef NRFX_NFCT_T4T_CONFIG_LOG_LEVEL
+#define NRFX_NFCT_T4T_CONFIG_LOG_LEVEL 3
+#endif
+
+// <o> NRFX_NFCT_T4T_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+
+// <0=> Default
+// <1=> Black
+// <2=> Red
+// <3=> Green
+// <4=> Yellow
+// <5=> Blue
+// <6=> Magenta
+// <7=> Cyan
+// <8=> White
+
+#ifndef NRFX_NFCT_T4T_CONFIG_INFO_COLOR
+#define NRFX_NFCT_T4T_CONFIG_INFO_COLOR 0
+#endif
+
+// <o> NRFX_NFCT_T4T_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+
+// <0=> Default
+// <1=> Black
+// <2=> Red
+// <3=> Green
+// <4=> Yellow
+// <5=> Blue
+// <6=> Magenta
+// <7=> Cyan
+// <8=> White
+
+#ifndef NRFX_NFCT_T4T_CONFIG_DEBUG_COLOR
+#define NRFX_NFCT_T4T_CONFIG_DEBUG_COLOR 0
+#endif
+
+// </e>
+
+// </e>
+
 // <e> NRFX_NVMC_ENABLED - nrfx_nvmc - NVMC peripheral driver
 //==========================================================
 #ifndef NRFX_NVMC_ENABLED
@@ -1236,6 +1326,69 @@
 
 // </e>
 
+// <e> NRFX_RTC_TIMER_ENABLED - nrfx_rtc_timer - Software timers on RTC
+//==========================================================
+#ifndef NRFX_RTC_TIMER_ENABLED
+#define NRFX_RTC_TIMER_ENABLED 0
+#endif
+// <o> NRFX_RTC_TIMER_CONFIG_MAX_TIMERS - Maximum number of running timers
+#ifndef NRFX_RTC_TIMER_CONFIG_MAX_TIMERS
+#define NRFX_RTC_TIMER_CONFIG_MAX_TIMERS 32
+#endif
+
+// <e> NRFX_RTC_TIMER_CONFIG_LOG_ENABLED - Enables logging in the module.
+//==========================================================
+#ifndef NRFX_RTC_TIMER_CONFIG_LOG_ENABLED
+#define NRFX_RTC_TIMER_CONFIG_LOG_ENABLED 0
+#endif
+// <o> NRFX_RTC_TIMER_CONFIG_LOG_LEVEL  - Default Severity level
+
+// <0=> Off
+// <1=> Error
+// <2=> Warning
+// <3=> Info
+// <4=> Debug
+
+#ifndef NRFX_RTC_TIMER_CONFIG_LOG_LEVEL
+#define NRFX_RTC_TIMER_CONFIG_LOG_LEVEL 3
+#endif
+
+// <o> NRFX_RTC_TIMER_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+
+// <0=> Default
+// <1=> Black
+// <2=> Red
+// <3=> Green
+// <4=> Yellow
+// <5=> Blue
+// <6=> Magenta
+// <7=> Cyan
+// <8=> White
+
+#ifndef NRFX_RTC_TIMER_CONFIG_INFO_COLOR
+#define NRFX_RTC_TIMER_CONFIG_INFO_COLOR 0
+#endif
+
+// <o> NRFX_RTC_TIMER_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+
+// <0=> Default
+// <1=> Black
+// <2=> Red
+// <3=> Green
+// <4=> Yellow
+// <5=> Blue
+// <6=> Magenta
+// <7=> Cyan
+// <8=> White
+
+#ifndef NRFX_RTC_TIMER_CONFIG_DEBUG_COLOR
+#define NRFX_RTC_TIMER_CONFIG_DEBUG_COLOR 0
+#endif
+
+// </e>
+
+// </e>
+
 // <e> NRFX_SAADC_ENABLED - nrfx_saadc - SAADC peripheral driver.
 //==========================================================
 #ifndef NRFX_SAADC_ENABLED
@@ -1357,6 +1510,13 @@
 #define NRFX_SPIM_EXTENDED_ENABLED 0
 #endif
 
+// <q> NRFX_SPIM_BLOCKING_ENABLED  - Enable transfers without an event handler
+
+
+#ifndef NRFX_SPIM_BLOCKING_ENABLED
+#define NRFX_SPIM_BLOCKING_ENABLED 1
+#endif
+
 // <o> NRFX_SPIM_DEFAULT_CONFIG_IRQ_PRIORITY  - Interrupt priority.
 
 // <0=> 0 (highest)
@@ -1660,6 +1820,13 @@
 #define NRFX_TWIM3_ENABLED 0
 #endif
 
+// <q> NRFX_TWIM_BLOCKING_ENABLED  - Enable transfers without an event handler
+
+
+#ifndef NRFX_TWIM_BLOCKING_ENABLED
+#define NRFX_TWIM_BLOCKING_ENABLED 1
+#endif
+
 // <o> NRFX_TWIM_DEFAULT_CONFIG_IRQ_PRIORITY  - Interrupt priority.
 
 // <0=> 0 (highest)
@@ -1867,6 +2034,13 @@
 #define NRFX_UARTE3_ENABLED 0
 #endif
 
+// <q> NRFX_UARTE_BLOCKING_ENABLED  - Enable transfers without an event handler
+
+
+#ifndef NRFX_UARTE_BLOCKING_ENABLED
+#define NRFX_UARTE_BLOCKING_ENABLED 1
+#endif
+
 // <o> NRFX_UARTE_DEFAULT_CONFIG_IRQ_PRIORITY  - Interrupt priority.
 
 // <0=> 0 (highest)
@@ -2150,6 +2324,69 @@
 
 // </e>
 
+// <e> NRFX_WDT_MONITOR_ENABLED - nrfx_wdt_monitor - WDT liveness monitor
+//==========================================================
+#ifndef NRFX_WDT_MONITOR_ENABLED
+#define NRFX_WDT_MONITOR_ENABLED 0
+#endif
+// <o> NRFX_WDT_MONITOR_CONFIG_STACK_WORDS - Number of stack words captured in the crash record
+#ifndef NRFX_WDT_MONITOR_CONFIG_STACK_WORDS
+#define NRFX_WDT_MONITOR_CONFIG_STACK_WORDS 32
+#endif
+
+// <e> NRFX_WDT_MONITOR_CONFIG_LOG_ENABLED - Enables logging in the module.
+//==========================================================
+#ifndef NRFX_WDT_MONITOR_CONFIG_LOG_ENABLED
+#define NRFX_WDT_MONITOR_CONFIG_LOG_ENABLED 0
+#endif
+// <o> NRFX_WDT_MONITOR_CONFIG_LOG_LEVEL  - Default Severity level
+
+// <0=> Off
+// <1=> Error
+// <2=> Warning
+// <3=> Info
+// <4=> Debug
+
+#ifndef NRFX_WDT_MONITOR_CONFIG_LOG_LEVEL
+#define NRFX_WDT_MONITOR_CONFIG_LOG_LEVEL 3
+#endif
+
+// <o> NRFX_WDT_MONITOR_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+
+// <0=> Default
+// <1=> Black
+// <2=> Red
+// <3=> Green
+// <4=> Yellow
+// <5=> Blue
+// <6=> Magenta
+// <7=> Cyan
+// <8=> White
+
+#ifndef NRFX_WDT_MONITOR_CONFIG_INFO_COLOR
+#define NRFX_WDT_MONITOR_CONFIG_INFO_COLOR 0
+#endif
+
+// <o> NRFX_WDT_MONITOR_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+
+// <0=> Default
+// <1=> Black
+// <2=> Red
+// <3=> Green
+// <4=> Yellow
+// <5=> Blue
+// <6=> Magenta
+// <7=> Cyan
+// <8=> White
+
+#ifndef NRFX_WDT_MONITOR_CONFIG_DEBUG_COLOR
+#define NRFX_WDT_MONITOR_CONFIG_DEBUG_COLOR 0
+#endif
+
+// </e>
+
+// </e>
+
 // </h>
 
 #endif // NRFX_CONFIG_NRF5340_APPLICATION_H__
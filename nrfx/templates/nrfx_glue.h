@@ -143,6 +143,18 @@ extern "C" {
  */
 #define NRFX_DELAY_DWT_BASED    0
 
+/**
+ * @brief When set to a non-zero value, this macro enables the code region
+ *        profiling provided by @ref nrfx_prof. Otherwise, the profiling macros
+ *        compile to nothing.
+ *
+ * @note When profiling is enabled, the integration layer must call NRFX_PROF_INIT()
+ *       once at startup, before any profiled code runs. On SoCs without the DWT
+ *       cycle counter, NRFX_PROF_TIMER must also be set to the number of a TIMER
+ *       instance that is not used otherwise.
+ */
+#define NRFX_PROF_ENABLED       0
+
 /**
  * @brief Macro for delaying the code execution for at least the specified time.
  *
@@ -56,6 +56,10 @@
 #define NRFX_DPPI_ENABLED 1
 #endif
 
+#ifdef CONFIG_NRFX_ECB
+#define NRFX_ECB_ENABLED 1
+#endif
+
 #ifdef CONFIG_NRFX_EGU
 #define NRFX_EGU_ENABLED 1
 #endif
@@ -81,11 +85,18 @@
 #ifdef CONFIG_NRFX_GPIOTE
 #define NRFX_GPIOTE_ENABLED 1
 #endif
+#ifdef CONFIG_NRFX_GPIOTE_IRQ_DIRECT
+#define NRFX_GPIOTE_IRQ_DIRECT 1
+#endif
 
 #ifdef CONFIG_NRFX_I2S
 #define NRFX_I2S_ENABLED 1
 #endif
 
+#ifdef CONFIG_NRFX_IDLE
+#define NRFX_IDLE_ENABLED 1
+#endif
+
 #ifdef CONFIG_NRFX_IPC
 #define NRFX_IPC_ENABLED 1
 #endif
@@ -98,6 +109,10 @@
 #define NRFX_NFCT_ENABLED 1
 #endif
 
+#ifdef CONFIG_NRFX_NFCT_T4T
+#define NRFX_NFCT_T4T_ENABLED 1
+#endif
+
 #ifdef CONFIG_NRFX_NVMC
 #define NRFX_NVMC_ENABLED 1
 #endif
@@ -173,6 +188,9 @@
 #ifdef CONFIG_NRFX_RTC2
 #define NRFX_RTC2_ENABLED 1
 #endif
+#ifdef CONFIG_NRFX_RTC_TIMER
+#define NRFX_RTC_TIMER_ENABLED 1
+#endif
 
 #ifdef CONFIG_NRFX_SAADC
 #define NRFX_SAADC_ENABLED 1
@@ -209,6 +227,9 @@
 #ifdef CONFIG_NRFX_SPIM4
 #define NRFX_SPIM4_ENABLED 1
 #endif
+#ifdef CONFIG_NRFX_SPIM_IRQ_DIRECT
+#define NRFX_SPIM_IRQ_DIRECT 1
+#endif
 #if defined(CONFIG_SPI_3_NRF_RX_DELAY) || defined(CONFIG_SPI_4_NRF_RX_DELAY)
 #define NRFX_SPIM_EXTENDED_ENABLED 1
 #endif
@@ -320,6 +341,9 @@
 #ifdef CONFIG_NRFX_UARTE3
 #define NRFX_UARTE3_ENABLED 1
 #endif
+#ifdef CONFIG_NRFX_UARTE_IRQ_DIRECT
+#define NRFX_UARTE_IRQ_DIRECT 1
+#endif
 
 #ifdef CONFIG_NRFX_USBD
 #define NRFX_USBD_ENABLED 1
@@ -338,6 +362,9 @@
 #ifdef CONFIG_NRFX_WDT1
 #define NRFX_WDT1_ENABLED 1
 #endif
+#ifdef CONFIG_NRFX_WDT_MONITOR
+#define NRFX_WDT_MONITOR_ENABLED 1
+#endif
 
 
 /*
@@ -6,6 +6,10 @@
 
 #include <nrfx.h>
 #include <kernel.h>
+#if NRFX_CHECK(NRFX_PROF_ENABLED)
+#include <init.h>
+#include <soc/nrfx_prof.h>
+#endif
 
 void nrfx_isr(void *irq_handler)
 {
@@ -17,6 +21,18 @@ void nrfx_busy_wait(uint32_t usec_to_wait)
 	k_busy_wait(usec_to_wait);
 }
 
+#if NRFX_CHECK(NRFX_PROF_ENABLED)
+static int nrfx_prof_glue_init(struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	NRFX_PROF_INIT();
+	return 0;
+}
+
+SYS_INIT(nrfx_prof_glue_init, PRE_KERNEL_1, 0);
+#endif
+
 char const *nrfx_error_string_get(nrfx_err_t code)
 { 
 	#define NRFX_ERROR_STRING_CASE(code)  case code: return #code
@@ -35,6 +35,7 @@
 #include <sys/__assert.h>
 #include <sys/atomic.h>
 #include <irq.h>
+#include <sys/util.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -140,6 +141,26 @@ extern "C" {
  */
 #define NRFX_DELAY_DWT_BASED    0
 
+/**
+ * @brief When set to a non-zero value, this macro enables the code region
+ *        profiling provided by @ref nrfx_prof. Otherwise, the profiling macros
+ *        compile to nothing.
+ */
+#ifdef CONFIG_NRFX_PROF
+#define NRFX_PROF_ENABLED       1
+#else
+#define NRFX_PROF_ENABLED       0
+#endif
+
+/**
+ * @brief Number of the TIMER instance used by @ref nrfx_prof on SoCs without
+ *        the DWT cycle counter. The time source is started from nrfx_glue.c
+ *        at the PRE_KERNEL_1 initialization level.
+ */
+#ifdef CONFIG_NRFX_PROF_TIMER
+#define NRFX_PROF_TIMER         CONFIG_NRFX_PROF_TIMER
+#endif
+
 /**
  * @brief Macro for delaying the code execution for at least the specified time.
  *
@@ -281,6 +302,89 @@ extern const uint32_t z_bt_ctlr_used_nrf_ppi_groups;
  */
 void nrfx_isr(void *irq_handler);
 
+/**
+ * @brief Macro for defining a direct ISR that calls the specified nrfx IRQ handler.
+ *
+ * The ISR is named after the nrfx IRQ handler with the @c _direct suffix and is
+ * meant to be connected with @ref NRFX_IRQ_DIRECT_CONNECT. The handler is then
+ * called straight from the interrupt vector, without going through the software
+ * ISR table and @ref nrfx_isr. After the handler returns, the kernel is given
+ * a chance to reschedule, so the event handlers of the driver can use kernel
+ * services as usual.
+ *
+ * The macro must be placed at file scope, for example:
+ * NRFX_IRQ_DIRECT_ISR_DEFINE(nrfx_gpiote_irq_handler)
+ *
+ * @param irq_handler nrfx IRQ handler to be called.
+ */
+#define NRFX_IRQ_DIRECT_ISR_DEFINE(irq_handler) \
+        ISR_DIRECT_DECLARE(irq_handler##_direct) \
+        {                                        \
+            irq_handler();                       \
+            ISR_DIRECT_PM();                     \
+            return 1;                            \
+        }
+
+/**
+ * @brief Macro for defining a zero-latency ISR that calls the specified nrfx IRQ handler.
+ *
+ * This macro works like @ref NRFX_IRQ_DIRECT_ISR_DEFINE, but the ISR does not
+ * notify the kernel in any way. It is intended for interrupts connected with
+ * the IRQ_ZERO_LATENCY flag, which are not masked by the kernel. The handler
+ * and the event handlers of the driver must not use any kernel services then.
+ *
+ * @param irq_handler nrfx IRQ handler to be called.
+ */
+#define NRFX_IRQ_ZERO_LATENCY_ISR_DEFINE(irq_handler) \
+        ISR_DIRECT_DECLARE(irq_handler##_direct)       \
+        {                                              \
+            irq_handler();                             \
+            return 0;                                  \
+        }
+
+/**
+ * @brief Macro for connecting an nrfx IRQ handler directly to the interrupt vector.
+ *
+ * This macro replaces IRQ_CONNECT(IRQ_NUM, IRQ_PRI, nrfx_isr, nrfx_..._irq_handler, 0)
+ * for interrupts whose entry latency matters. It removes one indirect call and
+ * the lookup in the software ISR table. The ISR must be defined with
+ * @ref NRFX_IRQ_DIRECT_ISR_DEFINE or, if @p flags contains IRQ_ZERO_LATENCY,
+ * with @ref NRFX_IRQ_ZERO_LATENCY_ISR_DEFINE. The choice is made separately
+ * for each driver, for example:
+ *
+ * NRFX_IRQ_DIRECT_CONNECT(UARTE0_UART0_IRQn, IRQ_PRI, nrfx_uarte_0_irq_handler, 0);
+ *
+ * @param irq_number  IRQ number.
+ * @param priority    Priority of the IRQ.
+ * @param irq_handler nrfx IRQ handler to be called.
+ * @param flags       Architecture-specific IRQ configuration flags.
+ */
+#define NRFX_IRQ_DIRECT_CONNECT(irq_number, priority, irq_handler, flags) \
+        IRQ_DIRECT_CONNECT(irq_number, priority, irq_handler##_direct, flags)
+
+/**
+ * @brief Macro for connecting an nrfx IRQ handler in the way selected for the driver.
+ *
+ * The handler is connected with @ref NRFX_IRQ_DIRECT_CONNECT if
+ * NRFX_<driver>_IRQ_DIRECT is set to 1, which is done with the
+ * CONFIG_NRFX_<driver>_IRQ_DIRECT Kconfig option, and through @ref nrfx_isr
+ * otherwise. The direct ISR must be defined with @ref NRFX_IRQ_DIRECT_ISR_DEFINE
+ * in both cases, for example:
+ *
+ * NRFX_IRQ_DIRECT_ISR_DEFINE(nrfx_gpiote_irq_handler)
+ * ...
+ * NRFX_IRQ_CONNECT(GPIOTE, GPIOTE_IRQn, IRQ_PRI, nrfx_gpiote_irq_handler);
+ *
+ * @param driver      Name of the driver in the NRFX_<driver>_IRQ_DIRECT symbol, for example UARTE.
+ * @param irq_number  IRQ number.
+ * @param priority    Priority of the IRQ.
+ * @param irq_handler nrfx IRQ handler to be called.
+ */
+#define NRFX_IRQ_CONNECT(driver, irq_number, priority, irq_handler)                   \
+        COND_CODE_1(NRFX_##driver##_IRQ_DIRECT,                                       \
+                    (NRFX_IRQ_DIRECT_CONNECT(irq_number, priority, irq_handler, 0)),  \
+                    (IRQ_CONNECT(irq_number, priority, nrfx_isr, irq_handler, 0)))
+
 /** @} */
 
 #ifdef __cplusplus
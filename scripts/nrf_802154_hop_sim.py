@@ -0,0 +1,114 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2020, Nordic Semiconductor ASA
+# SPDX-License-Identifier: BSD-3-Clause
+#
+"""Simulates the multi-channel listen of the 802.15.4 radio driver.
+
+A receiver cycles through a list of channels, spending the dwell time on each
+of them, as with nrf_802154_multichannel_listen_start(). A sender transmits a
+frame on a random channel of the list at a random time and, when the frame is
+not received, retransmits it after the ACK wait time and a random backoff, as
+a MAC layer with retries would.
+
+The receiver is deaf during the RX ramp-up that follows each channel change.
+A frame is received when the receiver listens on its channel from the point at
+which it needs to synchronize on the preamble until the driver locks onto the
+channel, which happens on the first BCMATCH, after the PHR and the Frame
+Control field.
+
+Usage:
+    nrf_802154_hop_sim.py [--channels 11,15,20,25] [--dwell 500,1000,2000]
+                          [--length 40] [--retries 3] [--trials 20000]
+
+For every dwell time, the probability of receiving the frame within all
+attempts and the mean and maximum time to detect it are printed.
+"""
+
+import argparse
+import random
+
+US_PER_OCTET = 32
+SHR_US = 5 * US_PER_OCTET          # Preamble and SFD.
+LOCK_US = 3 * US_PER_OCTET         # PHR and Frame Control field, up to BCMATCH.
+ACK_WAIT_US = 864                  # macAckWaitDuration.
+UNIT_BACKOFF_US = 320              # aUnitBackoffPeriod.
+MIN_BE = 3                         # macMinBe.
+
+
+def listening_channel(t, channels, dwell, phase, ramp_up):
+    """Returns the channel the receiver listens on at time t, or None while it ramps up."""
+    position = (t + phase) % (dwell * len(channels))
+    if position % dwell < ramp_up:
+        return None
+    return channels[int(position // dwell)]
+
+
+def is_received(start, channel, channels, dwell, phase, ramp_up, sync):
+    """Checks if the receiver listens on the channel for the whole detection window."""
+    window_start = start + SHR_US - sync
+    window_end = start + SHR_US + LOCK_US
+    t = window_start
+    while t <= window_end:
+        if listening_channel(t, channels, dwell, phase, ramp_up) != channel:
+            return False
+        t += 8
+    return listening_channel(window_end, channels, dwell, phase, ramp_up) == channel
+
+
+def simulate(args, dwell, rng):
+    frame_us = SHR_US + (1 + args.length + 2) * US_PER_OCTET
+    detected = 0
+    times = []
+
+    for _ in range(args.trials):
+        phase = rng.uniform(0, dwell * len(args.channels))
+        channel = rng.choice(args.channels)
+        start = 0.0
+
+        for _ in range(args.retries + 1):
+            if is_received(start, channel, args.channels, dwell, phase,
+                           args.ramp_up, args.sync):
+                detected += 1
+                times.append(start + SHR_US + LOCK_US)
+                break
+            backoff = rng.randrange(2 ** MIN_BE) * UNIT_BACKOFF_US
+            start += frame_us + ACK_WAIT_US + backoff
+
+    mean = sum(times) / len(times) if times else 0
+    high = max(times) if times else 0
+    return detected / args.trials, mean, high
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--channels', default='11,15,20,25',
+                        help='comma-separated list of channels')
+    parser.add_argument('--dwell', default='500,1000,2000,5000',
+                        help='comma-separated list of dwell times [us]')
+    parser.add_argument('--length', type=int, default=40,
+                        help='PSDU length without FCS [octets]')
+    parser.add_argument('--retries', type=int, default=3,
+                        help='number of retransmissions of the frame')
+    parser.add_argument('--ramp-up', type=int, default=40,
+                        help='RX ramp-up time after a channel change [us]')
+    parser.add_argument('--sync', type=int, default=64,
+                        help='part of the SHR needed to synchronize [us]')
+    parser.add_argument('--trials', type=int, default=20000)
+    parser.add_argument('--seed', type=int, default=1)
+    args = parser.parse_args()
+
+    args.channels = [int(c) for c in args.channels.split(',')]
+    rng = random.Random(args.seed)
+
+    print('channels: {}, PSDU: {} octets, retries: {}'.format(
+        args.channels, args.length, args.retries))
+    print('{:>10} {:>12} {:>14} {:>14}'.format(
+        'dwell[us]', 'P(detect)', 'mean TTD[us]', 'max TTD[us]'))
+    for dwell in (int(d) for d in args.dwell.split(',')):
+        probability, mean, high = simulate(args, dwell, rng)
+        print('{:>10} {:>12.3f} {:>14.0f} {:>14.0f}'.format(dwell, probability, mean, high))
+
+
+if __name__ == '__main__':
+    main()
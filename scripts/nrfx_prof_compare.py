@@ -0,0 +1,96 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2020, Nordic Semiconductor ASA
+# SPDX-License-Identifier: BSD-3-Clause
+#
+"""Compares nrfx_prof region reports against a baseline.
+
+Both inputs are logs containing report lines printed with NRFX_PROF_REPORT_FMT,
+collected from a host run or from the target console. Other lines are ignored,
+and when a region is reported more than once, the last report is used.
+
+Usage:
+    nrfx_prof_compare.py [--stat mean|min] [--report] <baseline log> <results log> [threshold]
+
+For every region, the duration per execution is converted from ticks to
+microseconds with the ticks per microsecond of its own report, so logs taken
+with different time sources (for example DWT and TIMER) can be compared. The
+mean is compared by default. The minimum is less sensitive to interrupts and
+to the host scheduler. Regions whose duration grew by more than the threshold
+(in percent, default 5) are marked, and the script then exits with status 1,
+unless --report is given, for comparisons that are not regression checks.
+"""
+
+import argparse
+
+REPORT_TAG = 'nrfx_prof'
+STATS = {'min': 1, 'mean': 3}
+
+def parse(path):
+    regions = {}
+    with open(path, errors='replace') as log:
+        for line in log:
+            start = line.find(REPORT_TAG + ',')
+            if start < 0:
+                continue
+            fields = line[start:].strip().split(',')
+            if len(fields) != 7:
+                continue
+            try:
+                count, low, high, mean, ticks_per_us = (int(f) for f in fields[2:])
+            except ValueError:
+                continue
+            if ticks_per_us == 0:
+                continue
+            regions[fields[1]] = (count, low, high, mean, ticks_per_us)
+    return regions
+
+def us(report, stat):
+    return report[STATS[stat]] / report[4]
+
+def compare(baseline, results, threshold, stat):
+    regressions = 0
+    print('%-24s %10s %12s %12s %8s' %
+          ('region', 'count', 'base [us]', stat + ' [us]', 'delta'))
+    for name in sorted(set(baseline) | set(results)):
+        if name not in results:
+            print('%-24s %10s %12.3f %12s %8s' %
+                  (name, '-', us(baseline[name], stat), '-', 'missing'))
+            continue
+        count = results[name][0]
+        value = us(results[name], stat)
+        if name not in baseline or us(baseline[name], stat) == 0:
+            print('%-24s %10d %12s %12.3f %8s' % (name, count, '-', value, 'new'))
+            continue
+        base = us(baseline[name], stat)
+        delta = (value - base) * 100.0 / base
+        mark = ''
+        if delta > threshold:
+            mark = '  <-- regression'
+            regressions += 1
+        print('%-24s %10d %12.3f %12.3f %+7.1f%%%s' %
+              (name, count, base, value, delta, mark))
+    return regressions
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--stat', choices=sorted(STATS), default='mean',
+                        help='duration compared (default: mean)')
+    parser.add_argument('--report', action='store_true',
+                        help='only print the comparison, whatever the slowdown')
+    parser.add_argument('baseline', help='log with the baseline reports')
+    parser.add_argument('results', help='log with the new reports')
+    parser.add_argument('threshold', nargs='?', type=float, default=5.0,
+                        help='slowdown in percent reported as a regression (default: 5)')
+    args = parser.parse_args()
+
+    baseline = parse(args.baseline)
+    results = parse(args.results)
+    if not results:
+        parser.exit(1, 'No region reports found in %s.\n' % args.results)
+    if compare(baseline, results, args.threshold, args.stat) and not args.report:
+        parser.exit(1)
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,460 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2020, Nordic Semiconductor ASA
+# SPDX-License-Identifier: BSD-3-Clause
+#
+"""Generates a host register model of an nRF SoC from its SVD file.
+
+The model replaces the peripheral address space with plain memory, so that
+nrfx drivers and HAL accessors can be built and exercised on a host:
+
+- every peripheral instance gets a backing store initialized with the reset
+  values from the SVD, and the NRF_<instance>_BASE macros of the device header
+  are redirected to it,
+- nrf_model_sync() applies the write semantics the memory itself cannot
+  express: tasks are self-clearing and generate the event paired with them,
+  and write-1-to-set/clear registers update the register they control,
+- static assertions check that the register layout in the device header
+  matches the SVD.
+
+Usage:
+    nrfx_svd_model_gen.py <device.svd> <device.h> <output directory>
+
+This produces nrf_model.h and nrf_model.c. The header has to be included after
+nrf.h, so for example it can be passed to the compiler with -include. The HAL and
+device headers assume 32-bit addresses, so the model is meant to be built for
+a 32-bit host target (for example with -m32 on x86-64).
+
+Alternatively, when NRF_MODEL_FIXED_ADDRESSES is defined, the backing stores are
+placed at the device base addresses and the NRF_<instance>_BASE macros are kept.
+The host environment must then map memory at these addresses before calling
+nrf_model_reset(). This allows using the model on a 64-bit host, as long as the
+memory is mapped below 4 GB, where the addresses survive the casts to uint32_t
+made by the HAL.
+"""
+
+import os
+import re
+import sys
+import xml.etree.ElementTree as ET
+
+# Register flags, must match NRF_MODEL_REG_* in the generated header.
+FLAG_READ_ONLY  = 0x01
+FLAG_WRITE_ONLY = 0x02
+FLAG_TASK       = 0x04
+FLAG_EVENT      = 0x08
+FLAG_W1S        = 0x10
+FLAG_W1C        = 0x20
+FLAG_HIDDEN     = 0x40
+
+# Suffixes of event registers that a task of the same name generates,
+# for example TASKS_START generates EVENTS_STARTED.
+EVENT_SUFFIXES = ('', 'ED', 'PED', 'D')
+
+def text(element, tag, default=None):
+    child = element.find(tag)
+    return child.text.strip() if child is not None and child.text else default
+
+def number(value):
+    value = value.strip().lower()
+    if value.startswith('#'):
+        return int(value[1:].replace('x', '0'), 2)
+    return int(value, 0)
+
+def dim_expand(element, name):
+    """Yields (name, index offset) pairs for a possibly dimensioned element."""
+    dim = text(element, 'dim')
+    if dim is None:
+        yield name, 0
+        return
+    increment = number(text(element, 'dimIncrement'))
+    index = text(element, 'dimIndex')
+    indices = index.split(',') if index and ',' in index else [str(i) for i in range(number(dim))]
+    for i, idx in enumerate(indices):
+        yield name.replace('%s', idx), i * increment
+
+class Register:
+    def __init__(self, name, offset, reset, flags, pointer):
+        self.name    = name
+        self.offset  = offset
+        self.reset   = reset
+        self.flags   = flags
+        self.pointer = pointer
+        self.pair    = None
+
+def registers_collect(parent, base_offset, prefix, defaults, out):
+    for element in parent:
+        if element.tag not in ('register', 'cluster'):
+            continue
+        access = text(element, 'access', defaults['access'])
+        reset  = number(text(element, 'resetValue', hex(defaults['reset'])))
+        size   = number(text(element, 'size', str(defaults['size'])))
+        offset = number(text(element, 'addressOffset'))
+        for name, step in dim_expand(element, text(element, 'name')):
+            if element.tag == 'cluster':
+                registers_collect(element, base_offset + offset + step, prefix + name + '.',
+                                  {'access': access, 'reset': reset, 'size': size}, out)
+                continue
+            if size != 32:
+                continue
+            flags = 0
+            if access == 'read-only':
+                flags |= FLAG_READ_ONLY
+            elif access == 'write-only':
+                flags |= FLAG_WRITE_ONLY
+            if name.startswith('TASKS_'):
+                flags |= FLAG_TASK
+            elif name.startswith('EVENTS_'):
+                flags |= FLAG_EVENT
+            for field in element.iter('field'):
+                modified = text(field, 'modifiedWriteValues', text(element, 'modifiedWriteValues'))
+                writes = [text(value, 'name')
+                          for values in field.iter('enumeratedValues')
+                          if text(values, 'usage') == 'write'
+                          for value in values.iter('enumeratedValue')]
+                if modified == 'oneToSet' or writes == ['Set']:
+                    flags |= FLAG_W1S
+                elif modified == 'oneToClear' or writes == ['Clear']:
+                    flags |= FLAG_W1C
+            pointer = '*' in text(element, 'dataType', '')
+            out.append(Register(prefix + name, base_offset + offset + step, reset, flags, pointer))
+
+def registers_pair(registers):
+    by_name = {r.name: r for r in registers}
+    for r in registers:
+        if r.flags & FLAG_TASK:
+            match = re.match(r'TASKS_(.*?)(\[\d+\])?$', r.name)
+            task, index = match.group(1), match.group(2) or ''
+            # TASKS_STARTRX generates EVENTS_RXSTARTED.
+            stems = [task]
+            if task.startswith('START') and len(task) > len('START'):
+                stems.append(task[len('START'):] + 'START')
+            for candidate in ('EVENTS_' + stem + suffix + index
+                              for stem in stems for suffix in EVENT_SUFFIXES):
+                if candidate in by_name:
+                    r.pair = by_name[candidate]
+                    break
+        elif r.flags & (FLAG_W1S | FLAG_W1C):
+            # INTENSET/INTENCLR control INTEN, OUTSET/OUTCLR control OUT, and so on.
+            # Without a separate target register, the state is kept in the SET register,
+            # or in the register itself if it has no SET/CLR counterpart (like GPIO LATCH).
+            match = re.match(r'(.*)(SET|CLR)(\[\d+\])?$', r.name)
+            if match:
+                r.pair = by_name.get(match.group(1) + (match.group(3) or ''))
+                if r.pair is None:
+                    r.pair = by_name.get(match.group(1) + 'SET' + (match.group(3) or ''))
+            if r.pair is None or r.pair.flags & (FLAG_W1S | FLAG_W1C):
+                r.pair = r.pair or r
+                r.flags |= FLAG_HIDDEN
+
+def instances_collect(device, header):
+    defaults = {
+        'access': text(device, 'access', 'read-write'),
+        'reset':  number(text(device, 'resetValue', '0')),
+        'size':   number(text(device, 'size', '32')),
+    }
+    structs = dict(re.findall(r'#define\s+NRF_(\w+)\s+\(\(NRF_(\w+)_Type\s*\*\)', header))
+    peripherals = {p.find('name').text: p for p in device.iter('peripheral')}
+    instances = []
+    for p in device.iter('peripheral'):
+        name = text(p, 'name')
+        if name not in structs:
+            continue
+        source = p
+        while source.find('registers') is None and source.get('derivedFrom'):
+            source = peripherals[source.get('derivedFrom')]
+        registers = []
+        if source.find('registers') is not None:
+            registers_collect(source.find('registers'), 0, '', defaults, registers)
+        registers_pair(registers)
+        block = source.find('addressBlock')
+        size = number(text(block, 'size')) if block is not None else 0x1000
+        instances.append((name, structs[name], number(text(p, 'baseAddress')), size, registers))
+    return instances
+
+HEADER = '''/*
+ * This file is generated by nrfx_svd_model_gen.py from {svd}.
+ * Do not edit it manually.
+ */
+
+#ifndef NRF_MODEL_H__
+#define NRF_MODEL_H__
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {{
+#endif
+
+#define NRF_MODEL_REG_READ_ONLY  0x{ro:02X}
+#define NRF_MODEL_REG_WRITE_ONLY 0x{wo:02X}
+#define NRF_MODEL_REG_TASK       0x{task:02X}
+#define NRF_MODEL_REG_EVENT      0x{event:02X}
+#define NRF_MODEL_REG_W1S        0x{w1s:02X}
+#define NRF_MODEL_REG_W1C        0x{w1c:02X}
+#define NRF_MODEL_REG_HIDDEN     0x{hidden:02X}
+
+/** @brief Register description. */
+typedef struct
+{{
+    uint16_t offset; ///< Offset from the peripheral base address.
+    uint16_t pair;   ///< Offset of the event generated by a task or of the state register of a SET/CLR register. 0xFFFF if none.
+    uint8_t  flags;  ///< Combination of NRF_MODEL_REG_* flags.
+    uint32_t reset;  ///< Reset value.
+}} nrf_model_reg_t;
+
+/** @brief Peripheral instance description. */
+typedef struct
+{{
+    char const *            p_name;    ///< Instance names, separated with slashes.
+    uint32_t                address;   ///< Base address on the device.
+    uint32_t *              p_mem;     ///< Backing store.
+    uint32_t *              p_shadow;  ///< Backing store content after the last synchronization.
+    uint32_t                size;      ///< Size of the backing store, in words.
+    nrf_model_reg_t const * p_regs;    ///< Register descriptions.
+    uint32_t                reg_count; ///< Number of registers.
+}} nrf_model_periph_t;
+
+/** @brief All peripherals. Instances sharing a base address are described by a single entry. */
+extern nrf_model_periph_t const nrf_model_periphs[];
+
+/** @brief Number of entries in @ref nrf_model_periphs. */
+extern uint32_t const nrf_model_periph_count;
+
+/** @brief Function for restoring reset values of all registers. */
+void nrf_model_reset(void);
+
+/**
+ * @brief Function for applying write semantics of the registers written since the last call.
+ *
+ * Must be called after the code under test accesses the peripherals, for example
+ * before each check made by a test. A write is detected as a change of the register
+ * content. SET/CLR registers are handled so that every effective write is detected,
+ * but a write-1-to-clear register that is not part of such a pair (for example
+ * POWER RESETREAS) keeps its content when written with exactly the value it holds.
+ */
+void nrf_model_sync(void);
+
+/**
+ * @brief Function for applying write semantics to a single peripheral.
+ *
+ * Same as @ref nrf_model_sync, but limited to the registers of @p p_periph.
+ */
+void nrf_model_periph_sync(nrf_model_periph_t const * p_periph);
+
+/**
+ * @brief Hook called by @ref nrf_model_sync for each triggered task.
+ *
+ * The default implementation generates the event paired with the task, if any.
+ * Tests can override it to model peripheral behavior.
+ */
+void nrf_model_task_triggered(nrf_model_periph_t const * p_periph, nrf_model_reg_t const * p_reg);
+
+'''
+
+def generate(svd_path, header_path, out_dir):
+    device = ET.parse(svd_path).getroot()
+    header = open(header_path).read()
+    instances = instances_collect(device, header)
+
+    # Instances sharing a base address (for example SPI0, SPIM0 and TWI0) share a backing
+    # store, and their registers are merged, so that each location is synchronized once.
+    stores = {}
+    for name, _, base, size, registers in instances:
+        store = stores.setdefault(base, {'names': [], 'size': 0, 'regs': {}})
+        store['names'].append(name)
+        store['size'] = max(store['size'], size)
+        for r in registers:
+            merged = store['regs'].setdefault(r.offset, r)
+            if merged.pair is None and r.pair is not None:
+                store['regs'][r.offset] = r
+    for store in stores.values():
+        store['name'] = store['names'][0]
+
+    h = [HEADER.format(svd=os.path.basename(svd_path), ro=FLAG_READ_ONLY, wo=FLAG_WRITE_ONLY,
+                       task=FLAG_TASK, event=FLAG_EVENT, w1s=FLAG_W1S, w1c=FLAG_W1C, hidden=FLAG_HIDDEN)]
+    h.append('#ifdef NRF_MODEL_FIXED_ADDRESSES\n')
+    for base in sorted(stores):
+        h.append('#define nrf_model_mem_%s ((uint32_t *)(uintptr_t)0x%08XUL)\n' %
+                 (stores[base]['name'], base))
+    h.append('#else\n')
+    for base in sorted(stores):
+        h.append('extern uint32_t nrf_model_mem_%s[%d];\n' %
+                 (stores[base]['name'], stores[base]['size'] // 4))
+    h.append('#endif // NRF_MODEL_FIXED_ADDRESSES\n')
+    h.append('\n#ifndef NRF_MODEL_FIXED_ADDRESSES\n')
+    for name, _, base, _, _ in instances:
+        h.append('#undef  NRF_%s_BASE\n' % name)
+        h.append('#define NRF_%s_BASE ((uintptr_t)nrf_model_mem_%s)\n' % (name, stores[base]['name']))
+    h.append('#endif // NRF_MODEL_FIXED_ADDRESSES\n')
+    h.append('\n#ifdef __cplusplus\n}\n#endif\n\n#endif // NRF_MODEL_H__\n')
+
+    c = ['/*\n * This file is generated by nrfx_svd_model_gen.py from %s.\n'
+         ' * Do not edit it manually.\n */\n\n' % os.path.basename(svd_path),
+         '#include <stddef.h>\n#include <nrf.h>\n#include "nrf_model.h"\n\n']
+    for base in sorted(stores):
+        name, size = stores[base]['name'], stores[base]['size']
+        c.append('#ifndef NRF_MODEL_FIXED_ADDRESSES\n')
+        c.append('uint32_t nrf_model_mem_%s[%d];\n' % (name, size // 4))
+        c.append('#endif\n')
+        c.append('static uint32_t m_shadow_%s[%d];\n' % (name, size // 4))
+    c.append('\n')
+
+    checks = []
+    if any(r.pointer for instance in instances for r in instance[4]):
+        checks.append('// Some registers are declared as pointers in the device header.\n'
+                      '_Static_assert(sizeof(void *) == 4, "The register model requires a 32-bit host.");\n')
+    for name, struct, base, size, registers in instances:
+        for r in registers:
+            checks.append('_Static_assert(offsetof(NRF_%s_Type, %s) == 0x%03X, "%s.%s");\n' %
+                          (struct, r.name, r.offset, name, r.name))
+
+    for base in sorted(stores):
+        store = stores[base]
+        c.append('static nrf_model_reg_t const m_regs_%s[] = {\n' % store['name'])
+        for offset in sorted(store['regs']):
+            r = store['regs'][offset]
+            c.append('    { 0x%03X, 0x%04X, 0x%02X, 0x%08XUL }, // %s\n' %
+                     (r.offset, r.pair.offset if r.pair else 0xFFFF, r.flags, r.reset, r.name))
+        c.append('};\n\n')
+
+    c.append('nrf_model_periph_t const nrf_model_periphs[] = {\n')
+    for base in sorted(stores):
+        store = stores[base]
+        c.append('    { "%s", 0x%08XUL, nrf_model_mem_%s, m_shadow_%s, %d, m_regs_%s, %d },\n' %
+                 ('/'.join(store['names']), base, store['name'], store['name'],
+                  store['size'] // 4, store['name'], len(store['regs'])))
+    c.append('};\n\n')
+    c.append('uint32_t const nrf_model_periph_count =\n'
+             '    sizeof(nrf_model_periphs) / sizeof(nrf_model_periphs[0]);\n\n')
+
+    # Layout checks are made against a single copy of each struct type.
+    seen = set()
+    for check in checks:
+        key = check.split(',')[0] + check.split(',')[1]
+        if key not in seen:
+            seen.add(key)
+            c.append(check)
+    c.append(SOURCE_TAIL)
+
+    with open(os.path.join(out_dir, 'nrf_model.h'), 'w') as f:
+        f.write(''.join(h))
+    with open(os.path.join(out_dir, 'nrf_model.c'), 'w') as f:
+        f.write(''.join(c))
+
+SOURCE_TAIL = '''
+__attribute__((weak))
+void nrf_model_task_triggered(nrf_model_periph_t const * p_periph, nrf_model_reg_t const * p_reg)
+{
+    if (p_reg->pair != 0xFFFF)
+    {
+        p_periph->p_mem[p_reg->pair / 4] = 1;
+    }
+}
+
+void nrf_model_reset(void)
+{
+    for (uint32_t i = 0; i < nrf_model_periph_count; i++)
+    {
+        nrf_model_periph_t const * p_periph = &nrf_model_periphs[i];
+
+        for (uint32_t j = 0; j < p_periph->reg_count; j++)
+        {
+            nrf_model_reg_t const * p_reg = &p_periph->p_regs[j];
+
+            p_periph->p_mem[p_reg->offset / 4]    = p_reg->reset;
+            p_periph->p_shadow[p_reg->offset / 4] = p_reg->reset;
+        }
+    }
+}
+
+static void state_update(nrf_model_periph_t const * p_periph,
+                         nrf_model_reg_t const *    p_reg,
+                         uint32_t                   value)
+{
+    uint32_t * p_mem    = p_periph->p_mem;
+    uint32_t * p_shadow = p_periph->p_shadow;
+    uint32_t   target   = p_reg->pair / 4;
+
+    // A hidden state is kept in the SET register itself, so only its shadow holds the state.
+    uint32_t state = (p_reg->flags & NRF_MODEL_REG_HIDDEN) ? p_shadow[target] : p_mem[target];
+
+    state = (p_reg->flags & NRF_MODEL_REG_W1S) ? (state | value) : (state & ~value);
+    p_mem[target]    = state;
+    p_shadow[target] = state;
+
+    // SET registers read back the state. CLR registers are kept at 0 instead, so that
+    // clearing exactly the bits that are set changes their content and is detected.
+    // The HAL never reads them back.
+    for (uint32_t k = 0; k < p_periph->reg_count; k++)
+    {
+        nrf_model_reg_t const * p_other = &p_periph->p_regs[k];
+
+        if ((p_other->flags & (NRF_MODEL_REG_W1S | NRF_MODEL_REG_W1C)) &&
+            (p_other->pair == p_reg->pair) && (p_other->offset != p_reg->pair))
+        {
+            uint32_t value = (p_other->flags & NRF_MODEL_REG_W1S) ? state : 0;
+
+            p_mem[p_other->offset / 4]    = value;
+            p_shadow[p_other->offset / 4] = value;
+        }
+    }
+}
+
+void nrf_model_periph_sync(nrf_model_periph_t const * p_periph)
+{
+    uint32_t * p_mem    = p_periph->p_mem;
+    uint32_t * p_shadow = p_periph->p_shadow;
+
+    for (uint32_t j = 0; j < p_periph->reg_count; j++)
+    {
+        nrf_model_reg_t const * p_reg = &p_periph->p_regs[j];
+        uint32_t idx = p_reg->offset / 4;
+
+        if (p_mem[idx] == p_shadow[idx])
+        {
+            continue;
+        }
+
+        if (p_reg->flags & NRF_MODEL_REG_TASK)
+        {
+            p_mem[idx]    = 0;
+            p_shadow[idx] = 0;
+            nrf_model_task_triggered(p_periph, p_reg);
+        }
+        else if (p_reg->flags & (NRF_MODEL_REG_W1S | NRF_MODEL_REG_W1C))
+        {
+            state_update(p_periph, p_reg, p_mem[idx]);
+        }
+        else
+        {
+            p_shadow[idx] = p_mem[idx];
+        }
+    }
+
+    // Registers written directly, like INTEN or OUT, are read back through their SET registers.
+    for (uint32_t j = 0; j < p_periph->reg_count; j++)
+    {
+        nrf_model_reg_t const * p_reg = &p_periph->p_regs[j];
+
+        if ((p_reg->flags & NRF_MODEL_REG_W1S) && !(p_reg->flags & NRF_MODEL_REG_HIDDEN))
+        {
+            p_mem[p_reg->offset / 4]    = p_mem[p_reg->pair / 4];
+            p_shadow[p_reg->offset / 4] = p_mem[p_reg->pair / 4];
+        }
+    }
+}
+
+void nrf_model_sync(void)
+{
+    for (uint32_t i = 0; i < nrf_model_periph_count; i++)
+    {
+        nrf_model_periph_sync(&nrf_model_periphs[i]);
+    }
+}
+'''
+
+if __name__ == '__main__':
+    if len(sys.argv) != 4:
+        sys.exit(__doc__)
+    generate(sys.argv[1], sys.argv[2], sys.argv[3])
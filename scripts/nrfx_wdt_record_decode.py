@@ -0,0 +1,110 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2020, Nordic Semiconductor ASA
+# SPDX-License-Identifier: BSD-3-Clause
+#
+"""Decodes the crash record captured by the nrfx WDT liveness monitor.
+
+The record is the nrfx_wdt_monitor_record_t structure placed at the start of
+the retained RAM region of the monitor. Dump it after the watchdog reset, for
+example with:
+
+    nrfjprog --readram dump.bin
+or
+    (gdb) dump binary value record.bin retained.record
+
+Usage:
+    nrfx_wdt_record_decode.py <dump> [offset] [stack words] [elf file]
+
+The offset is the address of the record within the dump (default 0), and the
+number of stack words is NRFX_WDT_MONITOR_CONFIG_STACK_WORDS of the firmware
+(default 32). When the ELF file is given, code addresses are resolved with
+arm-none-eabi-addr2line.
+"""
+
+import struct
+import subprocess
+import sys
+
+RECORD_MAGIC      = 0x4D544457
+CHANNEL_NUMBER    = 8
+NAME_SIZE         = 8
+HEADER_WORDS      = 10
+
+# Flags of the record, NRFX_WDT_MONITOR_RECORD_* in nrfx_wdt_monitor.h.
+FLAG_NO_FRAME           = 1 << 0
+FLAG_FRAME_OUT_OF_RANGE = 1 << 1
+CHANNEL_FORMAT    = '<%dsI' % NAME_SIZE
+
+def symbolize(elf, address):
+    if not elf or address == 0:
+        return ''
+    try:
+        out = subprocess.run(['arm-none-eabi-addr2line', '-f', '-C', '-e', elf,
+                              '0x%08x' % (address & ~1)],
+                             capture_output=True, text=True, check=True).stdout.split('\n')
+    except (OSError, subprocess.CalledProcessError):
+        return ''
+    return '  %s (%s)' % (out[0], out[1]) if len(out) > 1 else ''
+
+def decode(data, offset, stack_words, elf):
+    channel_size = struct.calcsize(CHANNEL_FORMAT)
+    size = (HEADER_WORDS + stack_words + 1) * 4 + CHANNEL_NUMBER * channel_size
+    record = data[offset:offset + size]
+    if len(record) != size:
+        sys.exit('Dump too short: %d bytes needed at offset %d.' % (size, offset))
+
+    words = struct.unpack_from('<%dI' % (size // 4 - 1), record)
+    checksum, = struct.unpack_from('<I', record, size - 4)
+    (magic, timestamp, stalled, channel_count,
+     pc, lr, xpsr, sp, valid_words, flags) = words[:HEADER_WORDS]
+
+    if magic != RECORD_MAGIC:
+        sys.exit('No crash record (magic 0x%08x).' % magic)
+    if (sum(words) & 0xFFFFFFFF) != checksum:
+        sys.exit('Crash record is corrupted (checksum mismatch).')
+
+    print('Watchdog timeout at %u' % timestamp)
+    print()
+    print('Channels:')
+    channels_offset = (HEADER_WORDS + stack_words) * 4
+    for i in range(min(channel_count, CHANNEL_NUMBER)):
+        name, last_feed = struct.unpack_from(CHANNEL_FORMAT, record,
+                                             channels_offset + i * channel_size)
+        name = name.split(b'\0', 1)[0].decode('ascii', 'replace')
+        state = 'STALLED' if stalled & (1 << i) else 'ok'
+        print('  %d %-8s %-7s last feed %u (%u before timeout)' %
+              (i, name, state, last_feed, (timestamp - last_feed) & 0xFFFFFFFF))
+    print()
+
+    if flags & FLAG_NO_FRAME:
+        print('Exception frame of the interrupted code was not passed to the monitor,')
+        print('check that the WDT interrupt is connected to nrfx_wdt_monitor_irq_handler.')
+        return
+    if flags & FLAG_FRAME_OUT_OF_RANGE:
+        print('Exception frame of the interrupted code at 0x%08x lies outside of the' % sp)
+        print('stack RAM given to the monitor, so it was not captured.')
+        return
+
+    print('Interrupted code:')
+    print('  PC   0x%08x%s' % (pc, symbolize(elf, pc)))
+    print('  LR   0x%08x%s' % (lr, symbolize(elf, lr)))
+    print('  xPSR 0x%08x%s' % (xpsr, '  (in interrupt %d)' % ((xpsr & 0x1FF) - 16)
+                                     if (xpsr & 0x1FF) >= 16 else ''))
+    print('  SP   0x%08x' % sp)
+    print()
+    print('Stack:')
+    for i in range(min(valid_words, stack_words)):
+        word = words[HEADER_WORDS + i]
+        print('  0x%08x: 0x%08x%s' % (sp + i * 4, word, symbolize(elf, word)
+                                      if word & 1 else ''))
+
+if __name__ == '__main__':
+    if not 2 <= len(sys.argv) <= 5:
+        sys.exit(__doc__)
+    with open(sys.argv[1], 'rb') as f:
+        dump = f.read()
+    decode(dump,
+           int(sys.argv[2], 0) if len(sys.argv) > 2 else 0,
+           int(sys.argv[3], 0) if len(sys.argv) > 3 else 32,
+           sys.argv[4] if len(sys.argv) > 4 else None)
@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Stress test of the nrfx_atomic primitives. Several threads modify the same
+ * words at the same time and the final state is checked against the sum of
+ * the operations. The program is built once with the C11 implementation and
+ * once with the LDREX/STREX implementation, which runs on the exclusive monitor
+ * emulated per thread by the host core stub.
+ */
+
+#include <pthread.h>
+#include <string.h>
+#include <soc/nrfx_atomic.h>
+#include "host_test.h"
+
+#define THREADS     8
+#define ITERATIONS  200000
+#define SLOTS       70 // Spans three words, the last one partially.
+
+static nrfx_atomic_u32_t m_counter;
+static nrfx_atomic_u32_t m_cas_counter;
+static nrfx_atomic_u32_t m_bits;
+static nrfx_atomic_u32_t m_free[NRFX_ATOMIC_BITMAP_WORDS(SLOTS)];
+static nrfx_atomic_u32_t m_owner[SLOTS];
+static uint32_t          m_claims[THREADS];
+static nrfx_atomic_u32_t m_mutex;
+static uint32_t          m_protected;
+
+static void threads_run(void * (* p_fn)(void *))
+{
+    pthread_t threads[THREADS];
+
+    for (uintptr_t i = 0; i < THREADS; i++)
+    {
+        TEST_ASSERT_EQUAL(0, pthread_create(&threads[i], NULL, p_fn, (void *)i));
+    }
+    for (size_t i = 0; i < THREADS; i++)
+    {
+        TEST_ASSERT_EQUAL(0, pthread_join(threads[i], NULL));
+    }
+}
+
+static void * arith_thread(void * p_arg)
+{
+    (void)p_arg;
+    for (uint32_t i = 0; i < ITERATIONS; i++)
+    {
+        (void)nrfx_atomic_u32_fetch_add(&m_counter, 3);
+        (void)nrfx_atomic_u32_fetch_sub(&m_counter, 1);
+
+        uint32_t expected = nrfx_atomic_u32_load(&m_cas_counter);
+        while (!nrfx_atomic_u32_cas(&m_cas_counter, &expected, expected + 1))
+        {}
+    }
+    return NULL;
+}
+
+static void test_arithmetic(void)
+{
+    m_counter     = 0;
+    m_cas_counter = 0;
+    threads_run(arith_thread);
+    TEST_ASSERT_EQUAL(THREADS * ITERATIONS * 2, nrfx_atomic_u32_load(&m_counter));
+    TEST_ASSERT_EQUAL(THREADS * ITERATIONS, nrfx_atomic_u32_load(&m_cas_counter));
+}
+
+/* Each thread owns four bits of the word and toggles them, so any lost update
+ * of a neighbouring thread shows up as a wrong previous value. */
+static void * bits_thread(void * p_arg)
+{
+    size_t   first = (uintptr_t)p_arg * 4;
+    uint32_t mask  = 0xFUL << first;
+
+    for (uint32_t i = 0; i < ITERATIONS; i++)
+    {
+        size_t bit = first + (i % 4);
+
+        TEST_ASSERT(!nrfx_atomic_bit_set(&m_bits, bit));
+        TEST_ASSERT(nrfx_atomic_bit_check(&m_bits, bit));
+        TEST_ASSERT(nrfx_atomic_bit_clear(&m_bits, bit));
+
+        TEST_ASSERT_EQUAL(0, nrfx_atomic_u32_fetch_or(&m_bits, mask) & mask);
+        TEST_ASSERT_EQUAL(mask, nrfx_atomic_u32_fetch_and(&m_bits, ~mask) & mask);
+    }
+    return NULL;
+}
+
+static void test_bits(void)
+{
+    m_bits = 0;
+    threads_run(bits_thread);
+    TEST_ASSERT_EQUAL(0, nrfx_atomic_u32_load(&m_bits));
+}
+
+/* Slots are claimed from the free bitmap and given back. A slot must never be
+ * held by two threads at a time. */
+static void * claim_thread(void * p_arg)
+{
+    uint32_t id = (uint32_t)(uintptr_t)p_arg + 1;
+
+    for (uint32_t i = 0; i < ITERATIONS / 4; i++)
+    {
+        size_t slot;
+
+        if (!nrfx_atomic_bitmap_first_set_claim(m_free, SLOTS, &slot))
+        {
+            continue;
+        }
+        TEST_ASSERT(slot < SLOTS);
+        TEST_ASSERT_EQUAL(0, nrfx_atomic_u32_fetch_store(&m_owner[slot], id));
+        m_claims[id - 1]++;
+        TEST_ASSERT_EQUAL(id, nrfx_atomic_u32_fetch_store(&m_owner[slot], 0));
+        TEST_ASSERT(!nrfx_atomic_bit_set(m_free, slot));
+    }
+    return NULL;
+}
+
+static void test_bitmap_claim(void)
+{
+    size_t bit;
+
+    memset((void *)m_free, 0, sizeof(m_free));
+    memset((void *)m_owner, 0, sizeof(m_owner));
+    memset(m_claims, 0, sizeof(m_claims));
+    TEST_ASSERT(!nrfx_atomic_bitmap_first_set_get(m_free, SLOTS, &bit));
+    for (size_t i = 0; i < SLOTS; i++)
+    {
+        TEST_ASSERT(!nrfx_atomic_bit_set(m_free, i));
+    }
+
+    threads_run(claim_thread);
+
+    // Every slot is free again, and no bit beyond the bitmap size was touched.
+    for (size_t i = 0; i < SLOTS; i++)
+    {
+        TEST_ASSERT(nrfx_atomic_bit_check(m_free, i));
+    }
+    TEST_ASSERT_EQUAL((1UL << (SLOTS % 32)) - 1, nrfx_atomic_u32_load(&m_free[SLOTS / 32]));
+    for (size_t i = 0; i < THREADS; i++)
+    {
+        TEST_ASSERT(m_claims[i] > 0);
+    }
+
+    // The lowest free slot is found in a later word once the first words are taken.
+    m_free[0] = 0;
+    m_free[1] = 0;
+    TEST_ASSERT(nrfx_atomic_bitmap_first_set_get(m_free, SLOTS, &bit));
+    TEST_ASSERT_EQUAL(64, bit);
+    TEST_ASSERT(nrfx_atomic_bitmap_first_set_claim(m_free, SLOTS, &bit));
+    TEST_ASSERT_EQUAL(64, bit);
+    TEST_ASSERT(!nrfx_atomic_bit_check(m_free, 64));
+}
+
+/* The trylock pattern used by the 802.15.4 radio driver schedulers. */
+static void * mutex_thread(void * p_arg)
+{
+    (void)p_arg;
+    for (uint32_t i = 0; i < ITERATIONS; i++)
+    {
+        while (nrfx_atomic_u32_fetch_store(&m_mutex, 1) != 0)
+        {}
+        m_protected++;
+        (void)nrfx_atomic_u32_fetch_store(&m_mutex, 0);
+    }
+    return NULL;
+}
+
+static void test_mutex(void)
+{
+    m_mutex     = 0;
+    m_protected = 0;
+    threads_run(mutex_thread);
+    TEST_ASSERT_EQUAL(THREADS * ITERATIONS, m_protected);
+}
+
+int main(void)
+{
+#if NRFX_ATOMIC_EXCLUSIVES_USED
+    printf("LDREX/STREX implementation\n");
+#else
+    printf("C11 implementation\n");
+#endif
+    TEST_RUN(test_arithmetic);
+    TEST_RUN(test_bits);
+    TEST_RUN(test_bitmap_claim);
+    TEST_RUN(test_mutex);
+    return 0;
+}
@@ -0,0 +1,280 @@
+/*
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Host benchmark of the transfer paths of the nrfx drivers. Every scenario
+ * runs a complete operation, from the driver call through its interrupt to the
+ * user event, for several transfer sizes or channel counts. The results are
+ * printed as nrfx_prof report lines, see host_bench.h.
+ *
+ * The program is built with one instance of each driver (drivers_bench) and with
+ * several (drivers_multi_bench), so the bench_instances target compares the drivers
+ * specialized for a single instance with their generic, indexed build.
+ */
+
+#include <stddef.h>
+#include <nrfx_saadc.h>
+#include <nrfx_spim.h>
+#include <nrfx_twim.h>
+#include <nrfx_uarte.h>
+#include "host_bench.h"
+#include "host_test.h"
+
+#define SPIM1_IRQn  SPIM1_SPIS1_TWIM1_TWIS1_SPI1_TWI1_IRQn
+#define TWIM0_IRQn  SPIM0_SPIS0_TWIM0_TWIS0_SPI0_TWI0_IRQn
+#define UARTE0_IRQn UARTE0_UART0_IRQn
+#define ITERATIONS  2000
+#define BUF_SIZE    255
+
+static nrfx_spim_t const   m_spim  = NRFX_SPIM_INSTANCE(1);
+static nrfx_twim_t const   m_twim  = NRFX_TWIM_INSTANCE(0);
+static nrfx_uarte_t const  m_uarte = NRFX_UARTE_INSTANCE(0);
+static uint8_t *           mp_tx_buf;
+static uint8_t *           mp_rx_buf;
+static nrf_saadc_value_t * mp_samples;
+static uint32_t            m_done_count;
+
+/* Every task ends immediately with its final event, so the measured time is that
+ * of the driver only. */
+void nrf_model_task_triggered(nrf_model_periph_t const * p_periph, nrf_model_reg_t const * p_reg)
+{
+    static const struct
+    {
+        uint32_t base;
+        uint16_t task;
+        uint16_t event;
+    } ends[] =
+    {
+        { NRF_SPIM1_BASE,  offsetof(NRF_SPIM_Type, TASKS_START),    offsetof(NRF_SPIM_Type, EVENTS_END)        },
+        { NRF_TWIM0_BASE,  offsetof(NRF_TWIM_Type, TASKS_STARTTX),  offsetof(NRF_TWIM_Type, EVENTS_STOPPED)    },
+        { NRF_UARTE0_BASE, offsetof(NRF_UARTE_Type, TASKS_STARTTX), offsetof(NRF_UARTE_Type, EVENTS_ENDTX)     },
+        { NRF_UARTE0_BASE, offsetof(NRF_UARTE_Type, TASKS_STOPTX),  offsetof(NRF_UARTE_Type, EVENTS_TXSTOPPED) },
+        { NRF_UARTE0_BASE, offsetof(NRF_UARTE_Type, TASKS_STARTRX), offsetof(NRF_UARTE_Type, EVENTS_ENDRX)     },
+        { NRF_UARTE0_BASE, offsetof(NRF_UARTE_Type, TASKS_STOPRX),  offsetof(NRF_UARTE_Type, EVENTS_RXTO)      },
+        { NRF_SAADC_BASE,  offsetof(NRF_SAADC_Type, TASKS_START),   offsetof(NRF_SAADC_Type, EVENTS_STARTED)   },
+        { NRF_SAADC_BASE,  offsetof(NRF_SAADC_Type, TASKS_SAMPLE),  offsetof(NRF_SAADC_Type, EVENTS_END)       },
+    };
+
+    if (p_reg->pair != 0xFFFF)
+    {
+        p_periph->p_mem[p_reg->pair / 4] = 1;
+    }
+    for (size_t i = 0; i < NRFX_ARRAY_SIZE(ends); i++)
+    {
+        if ((p_periph->address == ends[i].base) && (p_reg->offset == ends[i].task))
+        {
+            p_periph->p_mem[ends[i].event / 4] = 1;
+        }
+    }
+    // The TWIM driver checks that the whole buffer was sent.
+    if ((p_periph->address == NRF_TWIM0_BASE) &&
+        (p_reg->offset == offsetof(NRF_TWIM_Type, TASKS_STARTTX)))
+    {
+        p_periph->p_mem[offsetof(NRF_TWIM_Type, TXD.AMOUNT) / 4] =
+            p_periph->p_mem[offsetof(NRF_TWIM_Type, TXD.MAXCNT) / 4];
+    }
+}
+
+static void buffers_alloc(void)
+{
+    mp_tx_buf = host_ram_alloc(BUF_SIZE);
+    mp_rx_buf = host_ram_alloc(BUF_SIZE);
+}
+
+static void spim_handler(nrfx_spim_evt_t const * p_event, void * p_context)
+{
+    (void)p_context;
+    if (p_event->type == NRFX_SPIM_EVENT_DONE)
+    {
+        m_done_count++;
+    }
+}
+
+static void spim_setup(uint32_t size)
+{
+    nrfx_spim_config_t config = NRFX_SPIM_DEFAULT_CONFIG(3, 4, 5, NRFX_SPIM_PIN_NOT_USED);
+
+    (void)size;
+    buffers_alloc();
+    TEST_ASSERT_EQUAL(NRFX_SUCCESS, nrfx_spim_init(&m_spim, &config, spim_handler, NULL));
+}
+
+static void spim_xfer(uint32_t size)
+{
+    nrfx_spim_xfer_desc_t desc = NRFX_SPIM_XFER_TRX(mp_tx_buf, size, mp_rx_buf, size);
+    uint32_t              done = m_done_count;
+
+    TEST_ASSERT_EQUAL(NRFX_SUCCESS, nrfx_spim_xfer(&m_spim, &desc, 0));
+    host_bench_sync();
+    host_irq_call(SPIM1_IRQn, nrfx_spim_1_irq_handler);
+    host_bench_sync();
+    TEST_ASSERT_EQUAL(done + 1, m_done_count);
+}
+
+static void spim_teardown(uint32_t size)
+{
+    (void)size;
+    nrfx_spim_uninit(&m_spim);
+}
+
+static void twim_handler(nrfx_twim_evt_t const * p_event, void * p_context)
+{
+    (void)p_context;
+    if (p_event->type == NRFX_TWIM_EVT_DONE)
+    {
+        m_done_count++;
+    }
+}
+
+static void twim_setup(uint32_t size)
+{
+    nrfx_twim_config_t config = NRFX_TWIM_DEFAULT_CONFIG(26, 27);
+
+    (void)size;
+    buffers_alloc();
+    TEST_ASSERT_EQUAL(NRFX_SUCCESS, nrfx_twim_init(&m_twim, &config, twim_handler, NULL));
+    nrfx_twim_enable(&m_twim);
+}
+
+static void twim_tx(uint32_t size)
+{
+    nrfx_twim_xfer_desc_t desc = NRFX_TWIM_XFER_DESC_TX(0x50, mp_tx_buf, size);
+    uint32_t              done = m_done_count;
+
+    TEST_ASSERT_EQUAL(NRFX_SUCCESS, nrfx_twim_xfer(&m_twim, &desc, 0));
+    host_bench_sync();
+    host_irq_call(TWIM0_IRQn, nrfx_twim_0_irq_handler);
+    host_bench_sync();
+    TEST_ASSERT_EQUAL(done + 1, m_done_count);
+}
+
+static void twim_teardown(uint32_t size)
+{
+    (void)size;
+    nrfx_twim_uninit(&m_twim);
+}
+
+static void uarte_handler(nrfx_uarte_event_t const * p_event, void * p_context)
+{
+    (void)p_context;
+    if ((p_event->type == NRFX_UARTE_EVT_TX_DONE) || (p_event->type == NRFX_UARTE_EVT_RX_DONE))
+    {
+        m_done_count++;
+    }
+}
+
+static void uarte_setup(uint32_t size)
+{
+    nrfx_uarte_config_t config = NRFX_UARTE_DEFAULT_CONFIG(6, 8);
+
+    (void)size;
+    buffers_alloc();
+    TEST_ASSERT_EQUAL(NRFX_SUCCESS, nrfx_uarte_init(&m_uarte, &config, uarte_handler));
+}
+
+static void uarte_tx(uint32_t size)
+{
+    uint32_t done = m_done_count;
+
+    TEST_ASSERT_EQUAL(NRFX_SUCCESS, nrfx_uarte_tx(&m_uarte, mp_tx_buf, size));
+    host_bench_sync();
+    host_irq_call(UARTE0_IRQn, nrfx_uarte_0_irq_handler);
+    host_bench_sync();
+    TEST_ASSERT_EQUAL(done + 1, m_done_count);
+}
+
+static void uarte_rx(uint32_t size)
+{
+    uint32_t done = m_done_count;
+
+    TEST_ASSERT_EQUAL(NRFX_SUCCESS, nrfx_uarte_rx(&m_uarte, mp_rx_buf, size));
+    host_bench_sync();
+    host_irq_call(UARTE0_IRQn, nrfx_uarte_0_irq_handler);
+    host_bench_sync();
+    TEST_ASSERT_EQUAL(done + 1, m_done_count);
+}
+
+static void uarte_teardown(uint32_t size)
+{
+    (void)size;
+    nrfx_uarte_uninit(&m_uarte);
+}
+
+static void saadc_handler(nrfx_saadc_evt_t const * p_event)
+{
+    if (p_event->type == NRFX_SAADC_EVT_DONE)
+    {
+        m_done_count++;
+    }
+}
+
+static void saadc_setup(uint32_t channels)
+{
+    nrfx_saadc_channel_t config[SAADC_CH_NUM];
+
+    mp_samples = host_ram_alloc(SAADC_CH_NUM * sizeof(nrf_saadc_value_t));
+    TEST_ASSERT_EQUAL(NRFX_SUCCESS, nrfx_saadc_init(NRFX_SAADC_DEFAULT_CONFIG_IRQ_PRIORITY));
+    for (uint32_t i = 0; i < channels; i++)
+    {
+        config[i] = (nrfx_saadc_channel_t)NRFX_SAADC_DEFAULT_CHANNEL_SE(NRF_SAADC_INPUT_AIN0 + i, i);
+    }
+    TEST_ASSERT_EQUAL(NRFX_SUCCESS, nrfx_saadc_channels_config(config, channels));
+    TEST_ASSERT_EQUAL(NRFX_SUCCESS, nrfx_saadc_simple_mode_set((1UL << channels) - 1,
+                                                               NRF_SAADC_RESOLUTION_12BIT,
+                                                               NRF_SAADC_OVERSAMPLE_DISABLED,
+                                                               saadc_handler));
+}
+
+static void saadc_sample(uint32_t channels)
+{
+    uint32_t done = m_done_count;
+
+    TEST_ASSERT_EQUAL(NRFX_SUCCESS, nrfx_saadc_buffer_set(mp_samples, channels));
+    TEST_ASSERT_EQUAL(NRFX_SUCCESS, nrfx_saadc_mode_trigger());
+    host_bench_sync();
+    // STARTED triggers the sampling, END completes it.
+    host_irq_call(SAADC_IRQn, nrfx_saadc_irq_handler);
+    host_bench_sync();
+    host_irq_call(SAADC_IRQn, nrfx_saadc_irq_handler);
+    host_bench_sync();
+    TEST_ASSERT_EQUAL(done + 1, m_done_count);
+}
+
+static void saadc_teardown(uint32_t channels)
+{
+    (void)channels;
+    nrfx_saadc_uninit();
+}
+
+#define SPIM_XFER(_size)     { "spim_xfer", spim_setup, spim_xfer, spim_teardown, _size, ITERATIONS }
+#define TWIM_TX(_size)       { "twim_tx", twim_setup, twim_tx, twim_teardown, _size, ITERATIONS }
+#define UARTE_TX(_size)      { "uarte_tx", uarte_setup, uarte_tx, uarte_teardown, _size, ITERATIONS }
+#define UARTE_RX(_size)      { "uarte_rx", uarte_setup, uarte_rx, uarte_teardown, _size, ITERATIONS }
+#define SAADC_SAMPLE(_count) { "saadc_sample", saadc_setup, saadc_sample, saadc_teardown, _count, ITERATIONS }
+
+static host_bench_scenario_t const m_scenarios[] =
+{
+    SPIM_XFER(1),
+    SPIM_XFER(16),
+    SPIM_XFER(255),
+    TWIM_TX(1),
+    TWIM_TX(16),
+    TWIM_TX(255),
+    UARTE_TX(1),
+    UARTE_TX(16),
+    UARTE_TX(255),
+    UARTE_RX(1),
+    UARTE_RX(16),
+    UARTE_RX(255),
+    SAADC_SAMPLE(1),
+    SAADC_SAMPLE(4),
+    SAADC_SAMPLE(8),
+};
+
+int main(void)
+{
+    host_bench_run(m_scenarios, NRFX_ARRAY_SIZE(m_scenarios));
+    return 0;
+}
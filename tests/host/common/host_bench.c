@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdio.h>
+#include <soc/nrfx_prof.h>
+#include "host_bench.h"
+#include "host_periph.h"
+
+#define WARMUP_RUNS 16
+
+static nrfx_prof_region_t * mp_region;
+
+static void scenario_run(host_bench_scenario_t const * p_scenario)
+{
+    char               name[48];
+    nrfx_prof_region_t region = { .p_name = name };
+
+    snprintf(name, sizeof(name), "%s_%lu", p_scenario->p_name, (unsigned long)p_scenario->param);
+    nrfx_prof_region_reset(&region);
+
+    host_periph_reset();
+    p_scenario->setup(p_scenario->param);
+    host_periph_trap_enable(false);
+    for (uint32_t i = 0; i < WARMUP_RUNS; i++)
+    {
+        p_scenario->op(p_scenario->param);
+    }
+    mp_region = &region;
+    for (uint32_t i = 0; i < p_scenario->iterations; i++)
+    {
+        nrfx_prof_region_begin(&region);
+        p_scenario->op(p_scenario->param);
+        nrfx_prof_region_end(&region);
+    }
+    mp_region = NULL;
+    host_periph_trap_enable(true);
+    if (p_scenario->teardown)
+    {
+        p_scenario->teardown(p_scenario->param);
+    }
+
+    printf(NRFX_PROF_REPORT_FMT "\n", NRFX_PROF_REPORT_ARGS(region));
+}
+
+void host_bench_run(host_bench_scenario_t const * p_scenarios, size_t count)
+{
+    host_periph_init();
+    nrfx_prof_init();
+    for (size_t i = 0; i < count; i++)
+    {
+        scenario_run(&p_scenarios[i]);
+    }
+}
+
+void host_bench_sync(void)
+{
+    uint32_t start = nrfx_prof_ticks_get();
+
+    nrf_model_sync();
+    if (mp_region)
+    {
+        mp_region->start += nrfx_prof_ticks_get() - start;
+    }
+}
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef HOST_BENCH_H__
+#define HOST_BENCH_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Benchmark harness of the host tests.
+ *
+ * A scenario is one operation of a driver, for example a transfer with its
+ * interrupt, run with a given parameter, for example the transfer size. Every
+ * run of the operation is measured as an nrfx_prof region named after the
+ * scenario and its parameter, and the region is printed as a report line, so
+ * the results can be compared against a baseline with
+ * scripts/nrfx_prof_compare.py.
+ *
+ * The write trap of the peripheral memory is disabled during the measured
+ * runs, as its cost would hide that of the drivers. Operations call
+ * host_bench_sync() wherever the hardware has to act on the register writes,
+ * for example after a task is triggered, and the time spent in the register
+ * model is left out of the measurement. The time is still that of the host
+ * CPU, so only the changes relative to a baseline taken on the same machine
+ * are meaningful.
+ */
+
+/** @brief Operation of a scenario, called with the parameter of the scenario. */
+typedef void (* host_bench_op_t)(uint32_t param);
+
+/** @brief Benchmark scenario. */
+typedef struct
+{
+    char const *    p_name;     ///< Name of the scenario, used as the region name with the parameter.
+    host_bench_op_t setup;      ///< Called once before the runs, on peripherals in their reset state.
+    host_bench_op_t op;         ///< Measured operation.
+    host_bench_op_t teardown;   ///< Called once after the runs. Can be NULL.
+    uint32_t        param;      ///< Parameter passed to the functions.
+    uint32_t        iterations; ///< Number of measured runs.
+} host_bench_scenario_t;
+
+/** @brief Function for running the scenarios and printing their reports. */
+void host_bench_run(host_bench_scenario_t const * p_scenarios, size_t count);
+
+/**
+ * @brief Function for applying the register writes to the model, outside of the measured time.
+ *
+ * The tasks written since the last call trigger their events, see nrf_model_sync().
+ */
+void host_bench_sync(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HOST_BENCH_H__
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdlib.h>
+#include <kernel.h>
+#include "host_periph.h"
+
+/*
+ * Cortex-M core and Zephyr kernel services used by nrfx, modeled on the host.
+ * Interrupts never preempt the code under test; tests call the handlers
+ * explicitly with host_irq_call(), or register them with
+ * host_irq_handler_set() to have them taken as soon as they are pending
+ * and not masked.
+ */
+
+#define IRQ_COUNT 64
+
+DWT_Type       host_dwt;
+CoreDebug_Type host_core_debug;
+SCB_Type       host_scb;
+SysTick_Type   host_systick;
+
+__thread uint32_t          host_excl_value;
+__thread volatile void *   host_excl_addr;
+
+uint32_t host_primask;
+uint32_t host_basepri;
+
+static uint32_t m_ipsr;
+static bool     m_irq_enabled[IRQ_COUNT];
+static bool     m_irq_pending[IRQ_COUNT];
+static uint8_t  m_irq_priority[IRQ_COUNT];
+static void  (* m_irq_handler[IRQ_COUNT])(void);
+
+static uint32_t irq_index(IRQn_Type irq_number)
+{
+    if ((irq_number < 0) || (irq_number >= IRQ_COUNT))
+    {
+        abort();
+    }
+    return (uint32_t)irq_number;
+}
+
+static void irqs_take(void);
+
+uint32_t __get_PRIMASK(void)                 { return host_primask; }
+void     __set_PRIMASK(uint32_t primask)     { host_primask = primask & 1U; irqs_take(); }
+uint32_t __get_BASEPRI(void)                 { return host_basepri; }
+void     __set_BASEPRI(uint32_t basepri)     { host_basepri = basepri & 0xFFU; irqs_take(); }
+uint32_t __get_IPSR(void)                    { return m_ipsr; }
+uint32_t __get_MSP(void)                     { return 0; }
+uint32_t __get_PSP(void)                     { return 0; }
+void     __disable_irq(void)                 { host_primask = 1; }
+void     __enable_irq(void)                  { host_primask = 0; irqs_take(); }
+
+void __set_BASEPRI_MAX(uint32_t basepri)
+{
+    basepri &= 0xFFU;
+    if ((basepri != 0) && ((host_basepri == 0) || (basepri < host_basepri)))
+    {
+        host_basepri = basepri;
+    }
+}
+
+void     NVIC_EnableIRQ(IRQn_Type irqn)       { m_irq_enabled[irq_index(irqn)] = true; irqs_take(); }
+void     NVIC_DisableIRQ(IRQn_Type irqn)      { m_irq_enabled[irq_index(irqn)] = false; }
+uint32_t NVIC_GetEnableIRQ(IRQn_Type irqn)    { return m_irq_enabled[irq_index(irqn)]; }
+void     NVIC_SetPendingIRQ(IRQn_Type irqn)   { m_irq_pending[irq_index(irqn)] = true; irqs_take(); }
+void     NVIC_ClearPendingIRQ(IRQn_Type irqn) { m_irq_pending[irq_index(irqn)] = false; }
+uint32_t NVIC_GetPendingIRQ(IRQn_Type irqn)   { return m_irq_pending[irq_index(irqn)]; }
+uint32_t NVIC_GetPriority(IRQn_Type irqn)     { return m_irq_priority[irq_index(irqn)]; }
+void     NVIC_SystemReset(void)               { abort(); }
+
+void NVIC_SetPriority(IRQn_Type irqn, uint32_t priority)
+{
+    m_irq_priority[irq_index(irqn)] = (uint8_t)priority;
+}
+
+unsigned int irq_lock(void)
+{
+    unsigned int key = host_primask;
+
+    host_primask = 1;
+    return key;
+}
+
+void irq_unlock(unsigned int key)
+{
+    host_primask = key;
+    irqs_take();
+}
+
+void irq_enable(unsigned int irq)
+{
+    NVIC_EnableIRQ((IRQn_Type)irq);
+}
+
+void irq_disable(unsigned int irq)
+{
+    NVIC_DisableIRQ((IRQn_Type)irq);
+}
+
+int irq_is_enabled(unsigned int irq)
+{
+    return (int)NVIC_GetEnableIRQ((IRQn_Type)irq);
+}
+
+void k_busy_wait(uint32_t usec_to_wait)
+{
+    (void)usec_to_wait;
+}
+
+void host_irq_call(IRQn_Type irq_number, void (*handler)(void))
+{
+    uint32_t ipsr = m_ipsr;
+    uint32_t icsr = host_scb.ICSR;
+
+    m_irq_pending[irq_index(irq_number)] = false;
+    m_ipsr        = (uint32_t)irq_number + 16U;
+    host_scb.ICSR = (icsr & ~SCB_ICSR_VECTACTIVE_Msk) | m_ipsr;
+    handler();
+    m_ipsr        = ipsr;
+    host_scb.ICSR = icsr;
+}
+
+bool host_irq_is_pending(IRQn_Type irq_number)
+{
+    return m_irq_pending[irq_index(irq_number)];
+}
+
+void host_irq_handler_set(IRQn_Type irq_number, void (*handler)(void))
+{
+    m_irq_handler[irq_index(irq_number)] = handler;
+    irqs_take();
+}
+
+// Checks if a pending interrupt preempts the current context, like the NVIC does.
+static bool irq_is_taken(uint32_t irq)
+{
+    uint32_t priority = m_irq_priority[irq];
+
+    if (!m_irq_pending[irq] || !m_irq_enabled[irq] || (m_irq_handler[irq] == NULL) ||
+        (host_primask != 0))
+    {
+        return false;
+    }
+    if ((host_basepri != 0) && ((priority << (8U - __NVIC_PRIO_BITS)) >= host_basepri))
+    {
+        return false;
+    }
+    return (m_ipsr < 16U) || (priority < m_irq_priority[m_ipsr - 16U]);
+}
+
+static void irqs_take(void)
+{
+    // Interrupts pended by a handler of the same or a lower priority are taken when it returns.
+    for (uint32_t irq = 0; irq < IRQ_COUNT; irq++)
+    {
+        if (irq_is_taken(irq))
+        {
+            host_irq_call((IRQn_Type)irq, m_irq_handler[irq]);
+            irq = (uint32_t)-1;
+        }
+    }
+}
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stddef.h>
+#include <string.h>
+#include "host_ecb.h"
+#include "host_periph.h"
+
+#define AES_BLOCK_SIZE 16
+#define AES_ROUNDS     10
+
+static const uint8_t m_sbox[256] =
+{
+    0x63, 0x7c, 0x77, 0x7b, 0xf2, 0x6b, 0x6f, 0xc5, 0x30, 0x01, 0x67, 0x2b, 0xfe, 0xd7, 0xab, 0x76,
+    0xca, 0x82, 0xc9, 0x7d, 0xfa, 0x59, 0x47, 0xf0, 0xad, 0xd4, 0xa2, 0xaf, 0x9c, 0xa4, 0x72, 0xc0,
+    0xb7, 0xfd, 0x93, 0x26, 0x36, 0x3f, 0xf7, 0xcc, 0x34, 0xa5, 0xe5, 0xf1, 0x71, 0xd8, 0x31, 0x15,
+    0x04, 0xc7, 0x23, 0xc3, 0x18, 0x96, 0x05, 0x9a, 0x07, 0x12, 0x80, 0xe2, 0xeb, 0x27, 0xb2, 0x75,
+    0x09, 0x83, 0x2c, 0x1a, 0x1b, 0x6e, 0x5a, 0xa0, 0x52, 0x3b, 0xd6, 0xb3, 0x29, 0xe3, 0x2f, 0x84,
+    0x53, 0xd1, 0x00, 0xed, 0x20, 0xfc, 0xb1, 0x5b, 0x6a, 0xcb, 0xbe, 0x39, 0x4a, 0x4c, 0x58, 0xcf,
+    0xd0, 0xef, 0xaa, 0xfb, 0x43, 0x4d, 0x33, 0x85, 0x45, 0xf9, 0x02, 0x7f, 0x50, 0x3c, 0x9f, 0xa8,
+    0x51, 0xa3, 0x40, 0x8f, 0x92, 0x9d, 0x38, 0xf5, 0xbc, 0xb6, 0xda, 0x21, 0x10, 0xff, 0xf3, 0xd2,
+    0xcd, 0x0c, 0x13, 0xec, 0x5f, 0x97, 0x44, 0x17, 0xc4, 0xa7, 0x7e, 0x3d, 0x64, 0x5d, 0x19, 0x73,
+    0x60, 0x81, 0x4f, 0xdc, 0x22, 0x2a, 0x90, 0x88, 0x46, 0xee, 0xb8, 0x14, 0xde, 0x5e, 0x0b, 0xdb,
+    0xe0, 0x32, 0x3a, 0x0a, 0x49, 0x06, 0x24, 0x5c, 0xc2, 0xd3, 0xac, 0x62, 0x91, 0x95, 0xe4, 0x79,
+    0xe7, 0xc8, 0x37, 0x6d, 0x8d, 0xd5, 0x4e, 0xa9, 0x6c, 0x56, 0xf4, 0xea, 0x65, 0x7a, 0xae, 0x08,
+    0xba, 0x78, 0x25, 0x2e, 0x1c, 0xa6, 0xb4, 0xc6, 0xe8, 0xdd, 0x74, 0x1f, 0x4b, 0xbd, 0x8b, 0x8a,
+    0x70, 0x3e, 0xb5, 0x66, 0x48, 0x03, 0xf6, 0x0e, 0x61, 0x35, 0x57, 0xb9, 0x86, 0xc1, 0x1d, 0x9e,
+    0xe1, 0xf8, 0x98, 0x11, 0x69, 0xd9, 0x8e, 0x94, 0x9b, 0x1e, 0x87, 0xe9, 0xce, 0x55, 0x28, 0xdf,
+    0x8c, 0xa1, 0x89, 0x0d, 0xbf, 0xe6, 0x42, 0x68, 0x41, 0x99, 0x2d, 0x0f, 0xb0, 0x54, 0xbb, 0x16,
+};
+
+static uint32_t m_error_count;
+static uint32_t m_start_count;
+
+// Multiplication by x in GF(2^8).
+static uint8_t xtime(uint8_t value)
+{
+    return (uint8_t)((value << 1) ^ ((value & 0x80) ? 0x1b : 0x00));
+}
+
+static void key_expand(uint8_t const * p_key, uint8_t round_keys[AES_ROUNDS + 1][AES_BLOCK_SIZE])
+{
+    uint8_t rcon = 0x01;
+
+    memcpy(round_keys[0], p_key, AES_BLOCK_SIZE);
+    for (uint32_t round = 1; round <= AES_ROUNDS; round++)
+    {
+        uint8_t const * p_prev = round_keys[round - 1];
+        uint8_t *       p_next = round_keys[round];
+
+        // RotWord, SubWord and Rcon on the last word of the previous round key.
+        p_next[0] = p_prev[0] ^ m_sbox[p_prev[13]] ^ rcon;
+        p_next[1] = p_prev[1] ^ m_sbox[p_prev[14]];
+        p_next[2] = p_prev[2] ^ m_sbox[p_prev[15]];
+        p_next[3] = p_prev[3] ^ m_sbox[p_prev[12]];
+        for (uint32_t i = 4; i < AES_BLOCK_SIZE; i++)
+        {
+            p_next[i] = p_prev[i] ^ p_next[i - 4];
+        }
+        rcon = xtime(rcon);
+    }
+}
+
+void host_ecb_aes128_encrypt(uint8_t const * p_key,
+                             uint8_t const * p_cleartext,
+                             uint8_t *       p_ciphertext)
+{
+    uint8_t round_keys[AES_ROUNDS + 1][AES_BLOCK_SIZE];
+    uint8_t state[AES_BLOCK_SIZE];
+
+    key_expand(p_key, round_keys);
+    for (uint32_t i = 0; i < AES_BLOCK_SIZE; i++)
+    {
+        state[i] = p_cleartext[i] ^ round_keys[0][i];
+    }
+
+    for (uint32_t round = 1; round <= AES_ROUNDS; round++)
+    {
+        uint8_t shifted[AES_BLOCK_SIZE];
+
+        // SubBytes and ShiftRows. The state is stored column by column.
+        for (uint32_t col = 0; col < 4; col++)
+        {
+            for (uint32_t row = 0; row < 4; row++)
+            {
+                shifted[col * 4 + row] = m_sbox[state[((col + row) % 4) * 4 + row]];
+            }
+        }
+
+        // MixColumns, except in the last round.
+        for (uint32_t col = 0; (col < 4) && (round < AES_ROUNDS); col++)
+        {
+            uint8_t * p_col = &shifted[col * 4];
+            uint8_t   all   = p_col[0] ^ p_col[1] ^ p_col[2] ^ p_col[3];
+            uint8_t   first = p_col[0];
+
+            p_col[0] ^= all ^ xtime(p_col[0] ^ p_col[1]);
+            p_col[1] ^= all ^ xtime(p_col[1] ^ p_col[2]);
+            p_col[2] ^= all ^ xtime(p_col[2] ^ p_col[3]);
+            p_col[3] ^= all ^ xtime(p_col[3] ^ first);
+        }
+
+        for (uint32_t i = 0; i < AES_BLOCK_SIZE; i++)
+        {
+            state[i] = shifted[i] ^ round_keys[round][i];
+        }
+    }
+
+    memcpy(p_ciphertext, state, AES_BLOCK_SIZE);
+}
+
+void host_ecb_error_inject(uint32_t count)
+{
+    m_error_count = count;
+}
+
+uint32_t host_ecb_start_count_get(void)
+{
+    uint32_t count = m_start_count;
+
+    m_start_count = 0;
+    return count;
+}
+
+void nrf_model_task_triggered(nrf_model_periph_t const * p_periph, nrf_model_reg_t const * p_reg)
+{
+    uint32_t * p_mem = p_periph->p_mem;
+    uint32_t   event;
+    uint32_t   int_mask;
+
+    if ((p_periph->address != NRF_ECB_BASE) ||
+        (p_reg->offset != offsetof(NRF_ECB_Type, TASKS_STARTECB)))
+    {
+        if (p_reg->pair != 0xFFFF)
+        {
+            p_mem[p_reg->pair / 4] = 1;
+        }
+        return;
+    }
+
+    m_start_count++;
+    if (m_error_count > 0)
+    {
+        m_error_count--;
+        event    = offsetof(NRF_ECB_Type, EVENTS_ERRORECB);
+        int_mask = ECB_INTENSET_ERRORECB_Msk;
+    }
+    else
+    {
+        // The data structure holds the key, the cleartext and the ciphertext, see the HAL.
+        uint8_t * p_data = (uint8_t *)(uintptr_t)p_mem[offsetof(NRF_ECB_Type, ECBDATAPTR) / 4];
+
+        host_ecb_aes128_encrypt(&p_data[0], &p_data[AES_BLOCK_SIZE], &p_data[2 * AES_BLOCK_SIZE]);
+        event    = offsetof(NRF_ECB_Type, EVENTS_ENDECB);
+        int_mask = ECB_INTENSET_ENDECB_Msk;
+    }
+
+    p_mem[event / 4] = 1;
+    if (p_mem[offsetof(NRF_ECB_Type, INTENSET) / 4] & int_mask)
+    {
+        NVIC_SetPendingIRQ(ECB_IRQn);
+    }
+}
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef HOST_ECB_H__
+#define HOST_ECB_H__
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Simulated ECB peripheral.
+ *
+ * The block pointed to by ECBDATAPTR is encrypted with a software AES-128 as
+ * soon as STARTECB is triggered, then ENDECB is generated and the interrupt is
+ * pended in the modeled NVIC if enabled. Register the driver interrupt handler
+ * with host_irq_handler_set() to have it taken. The model provides
+ * nrf_model_task_triggered(), so tests using it cannot override that function.
+ */
+
+/**
+ * @brief Function for encrypting a block with the software AES-128 of the model.
+ *
+ * @param[in]  p_key        Pointer to the 16-byte key.
+ * @param[in]  p_cleartext  Pointer to the block to encrypt.
+ * @param[out] p_ciphertext Pointer to the buffer for the encrypted block.
+ */
+void host_ecb_aes128_encrypt(uint8_t const * p_key,
+                             uint8_t const * p_cleartext,
+                             uint8_t *       p_ciphertext);
+
+/**
+ * @brief Function for making the next blocks end with ERRORECB.
+ *
+ * This models CCM or AAR taking the AES core. The block is left unchanged.
+ *
+ * @param[in] count Number of blocks to abort.
+ */
+void host_ecb_error_inject(uint32_t count);
+
+/** @brief Function for getting the number of blocks started since the last call. */
+uint32_t host_ecb_start_count_get(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HOST_ECB_H__
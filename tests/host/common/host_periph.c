@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#define _GNU_SOURCE
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ucontext.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include "host_periph.h"
+
+#if !defined(__x86_64__)
+#error "The write trap single-steps the faulting instruction, which is implemented for x86-64 only."
+#endif
+
+#define TRAP_FLAG   0x100UL
+#define WINDOWS_MAX 16
+
+// Data RAM, for buffers that EasyDMA peripherals must find in the RAM region.
+#define RAM_START   0x20000000UL
+#define RAM_SIZE    0x40000UL
+
+typedef struct
+{
+    uintptr_t start;
+    size_t    size;
+} window_t;
+
+static window_t  m_windows[WINDOWS_MAX];
+static size_t    m_window_count;
+static bool      m_trap_enabled;
+static uintptr_t m_fault_address;
+static size_t    m_ram_used;
+
+static void windows_protect(int prot)
+{
+    for (size_t i = 0; i < m_window_count; i++)
+    {
+        if (mprotect((void *)m_windows[i].start, m_windows[i].size, prot) != 0)
+        {
+            abort();
+        }
+    }
+}
+
+static void page_protect(uintptr_t address, int prot)
+{
+    uintptr_t page = (uintptr_t)sysconf(_SC_PAGESIZE);
+
+    if (mprotect((void *)(address & ~(page - 1)), page, prot) != 0)
+    {
+        abort();
+    }
+}
+
+static bool window_contains(uintptr_t address)
+{
+    for (size_t i = 0; i < m_window_count; i++)
+    {
+        if ((address >= m_windows[i].start) &&
+            (address <  m_windows[i].start + m_windows[i].size))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void segv_handler(int signal, siginfo_t * p_info, void * p_context)
+{
+    ucontext_t * p_uc = (ucontext_t *)p_context;
+
+    if (!m_trap_enabled || !window_contains((uintptr_t)p_info->si_addr))
+    {
+        // Not a peripheral access, let the default action report it.
+        struct sigaction action = { .sa_handler = SIG_DFL };
+        sigaction(signal, &action, NULL);
+        return;
+    }
+
+    // Let the write complete and stop right after it.
+    m_fault_address = (uintptr_t)p_info->si_addr;
+    page_protect(m_fault_address, PROT_READ | PROT_WRITE);
+    p_uc->uc_mcontext.gregs[REG_EFL] |= TRAP_FLAG;
+}
+
+static void trap_handler(int signal, siginfo_t * p_info, void * p_context)
+{
+    ucontext_t * p_uc = (ucontext_t *)p_context;
+
+    (void)signal;
+    (void)p_info;
+    // A task hook called from the synchronization may write another peripheral,
+    // which nests a trap and changes the fault address.
+    uintptr_t address = m_fault_address;
+
+    p_uc->uc_mcontext.gregs[REG_EFL] &= ~TRAP_FLAG;
+
+    // Only the written peripheral needs to be synchronized. Backing stores of instances
+    // sharing a page, like GPIO P0 and P1, may overlap, so all containing ones are.
+    for (uint32_t i = 0; i < nrf_model_periph_count; i++)
+    {
+        nrf_model_periph_t const * p_periph = &nrf_model_periphs[i];
+
+        if ((address >= p_periph->address) &&
+            (address <  p_periph->address + p_periph->size * sizeof(uint32_t)))
+        {
+            nrf_model_periph_sync(p_periph);
+        }
+    }
+    page_protect(address, PROT_READ);
+}
+
+static void window_add(uintptr_t start, uintptr_t end)
+{
+    for (size_t i = 0; i < m_window_count; i++)
+    {
+        window_t * p_window = &m_windows[i];
+
+        if ((start <= p_window->start + p_window->size) && (end >= p_window->start))
+        {
+            uintptr_t new_start = (start < p_window->start) ? start : p_window->start;
+            uintptr_t new_end   = (end > p_window->start + p_window->size) ?
+                                  end : p_window->start + p_window->size;
+            p_window->start = new_start;
+            p_window->size  = new_end - new_start;
+            return;
+        }
+    }
+    if (m_window_count == WINDOWS_MAX)
+    {
+        abort();
+    }
+    m_windows[m_window_count++] = (window_t){ start, end - start };
+}
+
+void host_periph_init(void)
+{
+    uintptr_t page = (uintptr_t)sysconf(_SC_PAGESIZE);
+
+    if (m_window_count != 0)
+    {
+        return;
+    }
+
+    for (uint32_t i = 0; i < nrf_model_periph_count; i++)
+    {
+        nrf_model_periph_t const * p_periph = &nrf_model_periphs[i];
+        uintptr_t start = p_periph->address & ~(page - 1);
+        uintptr_t end   = (p_periph->address + p_periph->size * sizeof(uint32_t) + page - 1) &
+                          ~(page - 1);
+        window_add(start, end);
+    }
+
+    for (size_t i = 0; i < m_window_count; i++)
+    {
+        void * p_mem = mmap((void *)m_windows[i].start, m_windows[i].size,
+                            PROT_READ | PROT_WRITE,
+                            MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+        if (p_mem != (void *)m_windows[i].start)
+        {
+            fprintf(stderr, "Cannot map peripheral memory at 0x%08lx.\n",
+                    (unsigned long)m_windows[i].start);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    if (mmap((void *)RAM_START, RAM_SIZE, PROT_READ | PROT_WRITE,
+             MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0) != (void *)RAM_START)
+    {
+        fprintf(stderr, "Cannot map data RAM at 0x%08lx.\n", RAM_START);
+        exit(EXIT_FAILURE);
+    }
+
+    struct sigaction action = { .sa_flags = SA_SIGINFO | SA_NODEFER };
+    sigemptyset(&action.sa_mask);
+    action.sa_sigaction = segv_handler;
+    sigaction(SIGSEGV, &action, NULL);
+    action.sa_sigaction = trap_handler;
+    sigaction(SIGTRAP, &action, NULL);
+
+    nrf_model_reset();
+    host_periph_trap_enable(true);
+}
+
+void host_periph_reset(void)
+{
+    host_periph_init();
+    windows_protect(PROT_READ | PROT_WRITE);
+    nrf_model_reset();
+    m_ram_used = 0;
+    if (m_trap_enabled)
+    {
+        windows_protect(PROT_READ);
+    }
+}
+
+void host_periph_trap_enable(bool enable)
+{
+    if (enable && !m_trap_enabled)
+    {
+        nrf_model_sync();
+    }
+    m_trap_enabled = enable;
+    windows_protect(enable ? PROT_READ : (PROT_READ | PROT_WRITE));
+}
+
+void * host_ram_alloc(size_t size)
+{
+    void * p_mem = (void *)(RAM_START + m_ram_used);
+
+    m_ram_used += (size + 3) & ~(size_t)3;
+    if (m_ram_used > RAM_SIZE)
+    {
+        abort();
+    }
+    memset(p_mem, 0, size);
+    return p_mem;
+}
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef HOST_PERIPH_H__
+#define HOST_PERIPH_H__
+
+#include <stdbool.h>
+#include <nrfx.h>
+#include "nrf_model.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Peripherals of the host environment.
+ *
+ * The register model generated by nrfx_svd_model_gen.py is placed at the device
+ * addresses, so the NRF_* pointers of the MDK can be used unchanged. Writes to
+ * the peripheral memory are trapped and every write is followed by
+ * nrf_model_sync(), so tasks trigger their events and SET/CLR registers behave
+ * like on the device, whatever the order of accesses made by the code under
+ * test. Peripheral behavior beyond that is modeled by the tests, for example
+ * by overriding nrf_model_task_triggered() or by setting events and calling
+ * the driver interrupt handler with host_irq_call().
+ */
+
+/** @brief Function for mapping the peripheral memory and restoring its reset state. */
+void host_periph_init(void);
+
+/** @brief Function for restoring the reset state of all peripherals. */
+void host_periph_reset(void);
+
+/**
+ * @brief Function for enabling or disabling the write trap.
+ *
+ * Without the trap, the peripheral memory behaves like plain memory, which
+ * keeps the trap overhead out of the measurements made by benchmarks.
+ * nrf_model_sync() can then be called explicitly.
+ */
+void host_periph_trap_enable(bool enable);
+
+/**
+ * @brief Function for allocating zeroed, word-aligned memory in the data RAM region.
+ *
+ * Buffers passed to EasyDMA must be allocated here, as the drivers check that
+ * they are in RAM. The memory is released by @ref host_periph_reset.
+ */
+void * host_ram_alloc(size_t size);
+
+/**
+ * @brief Function for calling an interrupt handler in the interrupt context.
+ *
+ * While the handler runs, IPSR and the VECTACTIVE field of ICSR report
+ * the exception number of @p irq_number.
+ */
+void host_irq_call(IRQn_Type irq_number, void (*handler)(void));
+
+/**
+ * @brief Function for registering the handler the modeled NVIC takes an interrupt with.
+ *
+ * From then on, the interrupt is taken as soon as it is pending, enabled, not masked by
+ * PRIMASK or BASEPRI and of a higher priority than the running handler, for example when
+ * a peripheral model pends it from a task or when the code under test leaves a critical
+ * section. Interrupts without a handler are only called with @ref host_irq_call.
+ *
+ * @param[in] irq_number Interrupt number.
+ * @param[in] handler    Interrupt handler, or NULL to stop taking the interrupt.
+ */
+void host_irq_handler_set(IRQn_Type irq_number, void (*handler)(void));
+
+/** @brief Function for checking if an interrupt is pending in the modeled NVIC. */
+bool host_irq_is_pending(IRQn_Type irq_number);
+
+/** @brief Current PRIMASK and BASEPRI of the modeled core. */
+extern uint32_t host_primask;
+extern uint32_t host_basepri;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HOST_PERIPH_H__
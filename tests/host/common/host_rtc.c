@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "host_rtc.h"
+#include "host_periph.h"
+
+#define COUNTER_RANGE (RTC_COUNTER_COUNTER_Msk + 1UL)
+
+static uint32_t pending_irqs_get(host_rtc_t const * p_rtc)
+{
+    NRF_RTC_Type * p_reg  = p_rtc->p_reg;
+    uint32_t       events = 0;
+
+    if (p_reg->EVENTS_OVRFLW)
+    {
+        events |= NRF_RTC_INT_OVERFLOW_MASK;
+    }
+    for (uint32_t i = 0; i < p_rtc->cc_count; i++)
+    {
+        if (p_reg->EVENTS_COMPARE[i])
+        {
+            events |= RTC_CHANNEL_INT_MASK(i);
+        }
+    }
+    return events & p_reg->INTENSET;
+}
+
+static void irq_process(host_rtc_t * p_rtc)
+{
+    // A level interrupt, the handler is called again until the enabled events are cleared.
+    while (pending_irqs_get(p_rtc))
+    {
+        p_rtc->irq_count++;
+        host_irq_call(p_rtc->irq, p_rtc->handler);
+    }
+}
+
+void host_rtc_advance(host_rtc_t * p_rtc, uint64_t ticks)
+{
+    NRF_RTC_Type * p_reg = p_rtc->p_reg;
+
+    irq_process(p_rtc);
+    while (ticks > 0)
+    {
+        uint32_t counter = p_reg->COUNTER;
+        uint64_t step    = COUNTER_RANGE - counter;
+
+        for (uint32_t i = 0; i < p_rtc->cc_count; i++)
+        {
+            uint64_t distance = (p_reg->CC[i] - counter - 1) % COUNTER_RANGE + 1;
+            step = (distance < step) ? distance : step;
+        }
+        step = (ticks < step) ? ticks : step;
+        ticks -= step;
+
+        counter = (uint32_t)((counter + step) % COUNTER_RANGE);
+        // COUNTER is read-only for the software, the simulation drives it.
+        *(volatile uint32_t *)&p_reg->COUNTER = counter;
+        if (counter == 0)
+        {
+            p_reg->EVENTS_OVRFLW = 1;
+        }
+        for (uint32_t i = 0; i < p_rtc->cc_count; i++)
+        {
+            if (p_reg->CC[i] == counter)
+            {
+                p_reg->EVENTS_COMPARE[i] = 1;
+            }
+        }
+        irq_process(p_rtc);
+    }
+}
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef HOST_RTC_H__
+#define HOST_RTC_H__
+
+#include <hal/nrf_rtc.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Simulated RTC instance. */
+typedef struct
+{
+    NRF_RTC_Type * p_reg;          ///< Registers of the instance.
+    IRQn_Type      irq;            ///< Interrupt of the instance.
+    void        (* handler)(void); ///< Interrupt handler, for example nrfx_rtc_0_irq_handler.
+    uint32_t       cc_count;       ///< Number of compare channels.
+    uint32_t       irq_count;      ///< Number of interrupts raised so far.
+} host_rtc_t;
+
+/**
+ * @brief Function for advancing the counter of a simulated RTC.
+ *
+ * The counter is moved in steps from one compare match or overflow to the next.
+ * After each step, the matching events are generated and the interrupt handler
+ * is called if any of them has its interrupt enabled, as long as such events
+ * stay pending.
+ *
+ * @param[in] p_rtc Simulated RTC instance.
+ * @param[in] ticks Number of ticks to advance the counter by.
+ */
+void host_rtc_advance(host_rtc_t * p_rtc, uint64_t ticks);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HOST_RTC_H__
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef HOST_TEST_H__
+#define HOST_TEST_H__
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+#include "host_periph.h"
+
+/* Minimal assertions for the host tests. A failed check ends the test program. */
+
+#define TEST_ASSERT(cond)                                                      \
+    do {                                                                       \
+        if (!(cond))                                                           \
+        {                                                                      \
+            fprintf(stderr, "%s:%d: check failed: %s\n",                       \
+                    __FILE__, __LINE__, #cond);                                \
+            exit(EXIT_FAILURE);                                                \
+        }                                                                      \
+    } while (0)
+
+#define TEST_ASSERT_EQUAL(expected, actual)                                    \
+    do {                                                                       \
+        int64_t _e = (int64_t)(expected);                                      \
+        int64_t _a = (int64_t)(actual);                                        \
+        if (_e != _a)                                                          \
+        {                                                                      \
+            fprintf(stderr, "%s:%d: %s: expected %" PRId64 ", got %" PRId64 "\n", \
+                    __FILE__, __LINE__, #actual, _e, _a);                      \
+            exit(EXIT_FAILURE);                                                \
+        }                                                                      \
+    } while (0)
+
+/* Runs a test case on peripherals in their reset state. */
+#define TEST_RUN(test)                                                         \
+    do {                                                                       \
+        host_periph_reset();                                                   \
+        test();                                                                \
+        printf("PASS %s\n", #test);                                            \
+    } while (0)
+
+#endif // HOST_TEST_H__
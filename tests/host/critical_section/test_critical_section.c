@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Checks the nesting of the 802.15.4 radio driver critical sections. The
+ * program is built once with the interrupts masked in NVIC and once with
+ * the interrupts masked with BASEPRI. The Radio Scheduler and the low power
+ * timer are replaced by the stubs below.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "nrf_802154_config.h"
+#include "nrf_802154_critical_section.h"
+#include "rsch/nrf_802154_rsch.h"
+#include "platform/lp_timer/nrf_802154_lp_timer.h"
+#include "host_test.h"
+
+#if NRF_802154_CRITICAL_SECTION_BASEPRI_ENABLED
+#define DRIVER_BASEPRI (NRF_802154_IRQ_PRIORITY << (8 - __NVIC_PRIO_BITS))
+#endif
+
+#define DRIVER_IRQn    SWI0_EGU0_IRQn // Interrupt at the priority of the driver.
+#define HIGHER_IRQn    SWI1_EGU1_IRQn // Interrupt that preempts the driver.
+
+static uint32_t m_rsch_enter_count;
+static uint32_t m_rsch_exit_count;
+static uint32_t m_rsch_pending_events;
+static bool     m_lp_timer_masked;
+static bool     m_nested_result;
+
+bool nrf_802154_rsch_prec_is_approved(rsch_prec_t prec, rsch_prio_t prio)
+{
+    (void)prec;
+    (void)prio;
+    return true;
+}
+
+void nrf_802154_critical_section_rsch_enter(void)
+{
+    m_rsch_enter_count++;
+}
+
+void nrf_802154_critical_section_rsch_exit(void)
+{
+    m_rsch_exit_count++;
+}
+
+bool nrf_802154_critical_section_rsch_event_is_pending(void)
+{
+    if (m_rsch_pending_events > 0)
+    {
+        m_rsch_pending_events--;
+        return true;
+    }
+    return false;
+}
+
+void nrf_802154_lp_timer_critical_section_enter(void)
+{
+    m_lp_timer_masked = true;
+}
+
+void nrf_802154_lp_timer_critical_section_exit(void)
+{
+    m_lp_timer_masked = false;
+}
+
+static void state_reset(void)
+{
+    nrf_802154_critical_section_init();
+    m_rsch_enter_count    = 0;
+    m_rsch_exit_count     = 0;
+    m_rsch_pending_events = 0;
+    m_lp_timer_masked     = false;
+    host_basepri          = 0;
+    NVIC_SetPriority(DRIVER_IRQn, NRF_802154_IRQ_PRIORITY);
+    NVIC_SetPriority(HIGHER_IRQn, 0);
+    NVIC_EnableIRQ(RADIO_IRQn);
+}
+
+/* Checks if the interrupts of the driver are masked. */
+static void assert_masked(bool masked)
+{
+#if NRF_802154_CRITICAL_SECTION_BASEPRI_ENABLED
+    TEST_ASSERT_EQUAL(masked ? DRIVER_BASEPRI : 0, host_basepri);
+    TEST_ASSERT(NVIC_GetEnableIRQ(RADIO_IRQn));
+    TEST_ASSERT(!m_lp_timer_masked);
+#else
+    TEST_ASSERT_EQUAL(!masked, NVIC_GetEnableIRQ(RADIO_IRQn));
+    TEST_ASSERT_EQUAL(masked, m_lp_timer_masked);
+#endif
+}
+
+static void test_outermost(void)
+{
+    state_reset();
+    TEST_ASSERT(nrf_802154_critical_section_enter());
+    assert_masked(true);
+    TEST_ASSERT(!nrf_802154_critical_section_is_nested());
+    TEST_ASSERT_EQUAL(1, m_rsch_enter_count);
+
+    nrf_802154_critical_section_exit();
+    assert_masked(false);
+    TEST_ASSERT_EQUAL(1, m_rsch_exit_count);
+}
+
+static void test_nesting_denied(void)
+{
+    state_reset();
+    TEST_ASSERT(nrf_802154_critical_section_enter());
+
+    // Without nesting allowed, a second enter fails and leaves the outer section untouched.
+    TEST_ASSERT(!nrf_802154_critical_section_enter());
+    TEST_ASSERT(!nrf_802154_critical_section_is_nested());
+    assert_masked(true);
+
+    // A forced enter nests, and only the outermost exit unmasks the interrupts.
+    nrf_802154_critical_section_forcefully_enter();
+    TEST_ASSERT(nrf_802154_critical_section_is_nested());
+    assert_masked(true);
+    nrf_802154_critical_section_exit();
+    assert_masked(true);
+    TEST_ASSERT_EQUAL(0, m_rsch_exit_count);
+    nrf_802154_critical_section_exit();
+    assert_masked(false);
+    TEST_ASSERT_EQUAL(1, m_rsch_exit_count);
+}
+
+static void higher_irq_handler(void)
+{
+    m_nested_result = nrf_802154_critical_section_enter();
+    if (m_nested_result)
+    {
+        nrf_802154_critical_section_exit();
+    }
+}
+
+static void driver_irq_handler(void)
+{
+    TEST_ASSERT(nrf_802154_critical_section_enter());
+    nrf_802154_critical_section_nesting_allow();
+
+    // A notification called from the section may enter it again in the same context.
+    TEST_ASSERT(nrf_802154_critical_section_enter());
+    TEST_ASSERT(nrf_802154_critical_section_is_nested());
+    assert_masked(true);
+
+    // An interrupt of another priority may not.
+    host_irq_call(HIGHER_IRQn, higher_irq_handler);
+    TEST_ASSERT(!m_nested_result);
+
+    nrf_802154_critical_section_exit();
+    nrf_802154_critical_section_nesting_deny();
+    TEST_ASSERT(!nrf_802154_critical_section_enter());
+    nrf_802154_critical_section_exit();
+}
+
+static void test_nesting_allowed(void)
+{
+    state_reset();
+    host_irq_call(DRIVER_IRQn, driver_irq_handler);
+    assert_masked(false);
+    TEST_ASSERT_EQUAL(2, m_rsch_enter_count);
+    TEST_ASSERT_EQUAL(1, m_rsch_exit_count);
+
+    // Outside of any section, every context may enter.
+    host_irq_call(HIGHER_IRQn, higher_irq_handler);
+    TEST_ASSERT(m_nested_result);
+}
+
+static void test_exit_reenters_on_rsch_event(void)
+{
+    state_reset();
+    TEST_ASSERT(nrf_802154_critical_section_enter());
+
+    // Events notified by RSCH during the exit are handled by entering and exiting again.
+    m_rsch_pending_events = 2;
+    nrf_802154_critical_section_exit();
+    TEST_ASSERT_EQUAL(3, m_rsch_enter_count);
+    TEST_ASSERT_EQUAL(3, m_rsch_exit_count);
+    TEST_ASSERT(!nrf_802154_critical_section_is_nested());
+    assert_masked(false);
+}
+
+#if NRF_802154_CRITICAL_SECTION_BASEPRI_ENABLED
+
+static void test_basepri_preserved(void)
+{
+    // A BASEPRI of higher priority set by the application is kept and restored.
+    state_reset();
+    host_basepri = DRIVER_BASEPRI - (1 << (8 - __NVIC_PRIO_BITS));
+    TEST_ASSERT(nrf_802154_critical_section_enter());
+    TEST_ASSERT_EQUAL(DRIVER_BASEPRI - (1 << (8 - __NVIC_PRIO_BITS)), host_basepri);
+    nrf_802154_critical_section_exit();
+    TEST_ASSERT_EQUAL(DRIVER_BASEPRI - (1 << (8 - __NVIC_PRIO_BITS)), host_basepri);
+
+    // A BASEPRI of lower priority is raised and restored.
+    host_basepri = DRIVER_BASEPRI + (1 << (8 - __NVIC_PRIO_BITS));
+    TEST_ASSERT(nrf_802154_critical_section_enter());
+    TEST_ASSERT_EQUAL(DRIVER_BASEPRI, host_basepri);
+    nrf_802154_critical_section_exit();
+    TEST_ASSERT_EQUAL(DRIVER_BASEPRI + (1 << (8 - __NVIC_PRIO_BITS)), host_basepri);
+}
+
+#endif // NRF_802154_CRITICAL_SECTION_BASEPRI_ENABLED
+
+int main(void)
+{
+#if NRF_802154_CRITICAL_SECTION_BASEPRI_ENABLED
+    printf("BASEPRI critical sections\n");
+#else
+    printf("NVIC critical sections\n");
+#endif
+    TEST_RUN(test_outermost);
+    TEST_RUN(test_nesting_denied);
+    TEST_RUN(test_nesting_allowed);
+    TEST_RUN(test_exit_reenters_on_rsch_event);
+#if NRF_802154_CRITICAL_SECTION_BASEPRI_ENABLED
+    TEST_RUN(test_basepri_preserved);
+#endif
+    return 0;
+}
@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Checks the duplicate frame rejection of the 802.15.4 radio driver on frames
+ * built by the test, with the time of the timer scheduler and the PAN ID of
+ * the PIB replaced by stubs.
+ */
+
+#include <string.h>
+#include "nrf_802154_const.h"
+#include "nrf_802154_pib.h"
+#include "mac_features/nrf_802154_dup_filter.h"
+#include "timer_scheduler/nrf_802154_timer_sched.h"
+#include "host_test.h"
+
+#define PAN_A          0xabcd
+#define PAN_B          0x1111
+#define FRAME_DATA     0x01
+#define FRAME_COMMAND  0x03
+#define PANID_COMPR    0x40
+#define FRAME_SIZE     (MAX_PACKET_SIZE + PHR_SIZE)
+
+static uint32_t      m_now;
+static const uint8_t m_pib_pan_id[PAN_ID_SIZE] = { (uint8_t)PAN_A, (uint8_t)(PAN_A >> 8) };
+
+uint32_t nrf_802154_timer_sched_time_get(void)
+{
+    return m_now;
+}
+
+const uint8_t * nrf_802154_pib_pan_id_get(void)
+{
+    return m_pib_pan_id;
+}
+
+static uint8_t * u16_put(uint8_t * p_buf, uint16_t value)
+{
+    p_buf[0] = (uint8_t)value;
+    p_buf[1] = (uint8_t)(value >> 8);
+    return p_buf + 2;
+}
+
+/* Sets the PHR of a frame ending at p_end, including the FCS. */
+static void phr_set(uint8_t * p_frame, uint8_t * p_end)
+{
+    p_frame[PHR_OFFSET] = (uint8_t)(p_end - p_frame - PHR_SIZE + FCS_SIZE);
+}
+
+/*
+ * 2006 frame from a short address to the short address 0x0001. Without a source PAN ID,
+ * the PAN ID compression is set and the source PAN is that of the destination.
+ */
+static void short_frame_build(uint8_t        * p_frame,
+                              uint8_t          type,
+                              uint8_t          dsn,
+                              uint16_t         dst_pan,
+                              const uint16_t * p_src_pan,
+                              uint16_t         src)
+{
+    uint8_t * p = p_frame + PHR_SIZE;
+
+    *p++ = type | ((p_src_pan == NULL) ? PANID_COMPR : 0);
+    *p++ = 0x98;
+    *p++ = dsn;
+    p    = u16_put(p, dst_pan);
+    p    = u16_put(p, 0x0001);
+    if (p_src_pan != NULL)
+    {
+        p = u16_put(p, *p_src_pan);
+    }
+    p    = u16_put(p, src);
+    *p++ = 0x55;
+    phr_set(p_frame, p);
+}
+
+/* 2006 data frame from an extended address, with both PAN IDs. */
+static void extended_frame_build(uint8_t * p_frame, uint8_t dsn, uint16_t src_pan, uint8_t src)
+{
+    uint8_t * p = p_frame + PHR_SIZE;
+
+    *p++ = FRAME_DATA;
+    *p++ = 0xd8;
+    *p++ = dsn;
+    p    = u16_put(p, src_pan);
+    p    = u16_put(p, 0x0001);
+    p    = u16_put(p, src_pan);
+    for (uint32_t i = 0; i < EXTENDED_ADDRESS_SIZE; i++)
+    {
+        *p++ = src + i;
+    }
+    *p++ = 0x55;
+    phr_set(p_frame, p);
+}
+
+static void test_retransmission(void)
+{
+    static uint8_t                frame[FRAME_SIZE];
+    nrf_802154_dup_filter_stats_t stats;
+    uint16_t                      src_pan = PAN_A;
+
+    nrf_802154_dup_filter_init();
+    short_frame_build(frame, FRAME_DATA, 7, PAN_A, NULL, 0x1234);
+    TEST_ASSERT(!nrf_802154_dup_filter_check(frame));
+    TEST_ASSERT(nrf_802154_dup_filter_check(frame));
+
+    // The compressed source PAN is the destination PAN.
+    short_frame_build(frame, FRAME_DATA, 7, PAN_A, &src_pan, 0x1234);
+    TEST_ASSERT(nrf_802154_dup_filter_check(frame));
+
+    // Another sequence number or frame type is a new frame.
+    short_frame_build(frame, FRAME_DATA, 8, PAN_A, NULL, 0x1234);
+    TEST_ASSERT(!nrf_802154_dup_filter_check(frame));
+    short_frame_build(frame, FRAME_COMMAND, 8, PAN_A, NULL, 0x1234);
+    TEST_ASSERT(!nrf_802154_dup_filter_check(frame));
+    TEST_ASSERT(nrf_802154_dup_filter_check(frame));
+
+    nrf_802154_dup_filter_stats_get(&stats);
+    TEST_ASSERT_EQUAL(6, stats.checked);
+    TEST_ASSERT_EQUAL(3, stats.hits);
+}
+
+static void test_lifetime(void)
+{
+    static uint8_t frame[FRAME_SIZE];
+
+    nrf_802154_dup_filter_init();
+    short_frame_build(frame, FRAME_DATA, 1, PAN_A, NULL, 0x1234);
+    TEST_ASSERT(!nrf_802154_dup_filter_check(frame));
+    m_now += NRF_802154_DUP_FILTER_LIFETIME - 1;
+    TEST_ASSERT(nrf_802154_dup_filter_check(frame));
+
+    // Every retransmission restarts the lifetime.
+    m_now += NRF_802154_DUP_FILTER_LIFETIME - 1;
+    TEST_ASSERT(nrf_802154_dup_filter_check(frame));
+    m_now += NRF_802154_DUP_FILTER_LIFETIME;
+    TEST_ASSERT(!nrf_802154_dup_filter_check(frame));
+
+    // The table works across the wrap-around of the time.
+    m_now = UINT32_MAX - NRF_802154_DUP_FILTER_LIFETIME / 2;
+    short_frame_build(frame, FRAME_DATA, 2, PAN_A, NULL, 0x1234);
+    TEST_ASSERT(!nrf_802154_dup_filter_check(frame));
+    m_now += NRF_802154_DUP_FILTER_LIFETIME - 1;
+    TEST_ASSERT(nrf_802154_dup_filter_check(frame));
+}
+
+static void test_collision(void)
+{
+    static uint8_t frame_a[FRAME_SIZE];
+    static uint8_t frame_b[FRAME_SIZE];
+    uint16_t       src_b;
+
+    nrf_802154_dup_filter_init();
+    short_frame_build(frame_a, FRAME_DATA, 1, PAN_A, NULL, 0x1234);
+    TEST_ASSERT(!nrf_802154_dup_filter_check(frame_a));
+
+    // Look for a source that takes the entry of the first one.
+    for (src_b = 0x1235; src_b != 0x1234; src_b++)
+    {
+        short_frame_build(frame_b, FRAME_DATA, 1, PAN_A, NULL, src_b);
+        TEST_ASSERT(!nrf_802154_dup_filter_check(frame_b));
+        if (!nrf_802154_dup_filter_check(frame_a))
+        {
+            break;
+        }
+    }
+    TEST_ASSERT(src_b != 0x1234);
+
+    // The most recent frame evicts the other source, whose retransmission passes.
+    TEST_ASSERT(!nrf_802154_dup_filter_check(frame_b));
+    TEST_ASSERT(nrf_802154_dup_filter_check(frame_b));
+    TEST_ASSERT(!nrf_802154_dup_filter_check(frame_a));
+    TEST_ASSERT(nrf_802154_dup_filter_check(frame_a));
+}
+
+static void test_pan(void)
+{
+    static uint8_t frame_a[FRAME_SIZE];
+    static uint8_t frame_b[FRAME_SIZE];
+    uint16_t       src_pan = PAN_B;
+
+    nrf_802154_dup_filter_init();
+
+    // The same short address in another PAN is another device.
+    short_frame_build(frame_a, FRAME_DATA, 3, PAN_A, NULL, 0x1234);
+    short_frame_build(frame_b, FRAME_DATA, 3, PAN_B, NULL, 0x1234);
+    TEST_ASSERT(!nrf_802154_dup_filter_check(frame_a));
+    TEST_ASSERT(!nrf_802154_dup_filter_check(frame_b));
+    TEST_ASSERT(nrf_802154_dup_filter_check(frame_b));
+
+    // Without compression, the source PAN counts, not the destination PAN.
+    short_frame_build(frame_b, FRAME_DATA, 3, PAN_A, &src_pan, 0x1234);
+    TEST_ASSERT(nrf_802154_dup_filter_check(frame_b));
+
+    // An extended address identifies the device in any PAN.
+    extended_frame_build(frame_a, 4, PAN_A, 0x10);
+    extended_frame_build(frame_b, 4, PAN_B, 0x10);
+    TEST_ASSERT(!nrf_802154_dup_filter_check(frame_a));
+    TEST_ASSERT(nrf_802154_dup_filter_check(frame_b));
+}
+
+static void test_not_checked(void)
+{
+    // 2015 data frame with the sequence number suppressed.
+    static const uint8_t          no_dsn[] =
+    {
+        11, 0x41, 0xa9, 0xcd, 0xab, 0x01, 0x00, 0x34, 0x12, 0x55, 0x00, 0x00
+    };
+    // 2006 data frame without a source address.
+    static const uint8_t          no_src[] =
+    {
+        10, 0x01, 0x18, 0x05, 0xcd, 0xab, 0x01, 0x00, 0x55, 0x00, 0x00
+    };
+    nrf_802154_dup_filter_stats_t stats;
+
+    nrf_802154_dup_filter_init();
+    for (uint32_t i = 0; i < 2; i++)
+    {
+        TEST_ASSERT(!nrf_802154_dup_filter_check(no_dsn));
+        TEST_ASSERT(!nrf_802154_dup_filter_check(no_src));
+    }
+
+    nrf_802154_dup_filter_stats_get(&stats);
+    TEST_ASSERT_EQUAL(0, stats.checked);
+    TEST_ASSERT_EQUAL(0, stats.hits);
+}
+
+int main(void)
+{
+    TEST_RUN(test_retransmission);
+    TEST_RUN(test_lifetime);
+    TEST_RUN(test_collision);
+    TEST_RUN(test_pan);
+    TEST_RUN(test_not_checked);
+    return 0;
+}
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Host benchmark of the ECB driver, in blocks per second, on the simulated
+ * peripheral. The software AES-128 of the model alone gives the upper bound,
+ * the difference with the driver helpers is the cost of the driver, of the
+ * interrupt and of the register model, which traps every register write.
+ * The times are those of the host CPU, so only the ratios are meaningful.
+ */
+
+#include <pthread.h>
+#include <string.h>
+#include <time.h>
+#include <nrfx_ecb.h>
+#include "host_ecb.h"
+#include "host_test.h"
+
+#define STACK_SIZE  0x10000
+#define RUNS        4096
+#define CTR_SIZE    (64 * NRFX_ECB_BLOCK_SIZE)
+#define JOB_BLOCKS  16
+
+static uint8_t         m_key[NRFX_ECB_BLOCK_SIZE];
+static uint8_t         m_block[NRFX_ECB_BLOCK_SIZE];
+static nrfx_ecb_job_t  m_job;
+static volatile bool   m_job_done;
+
+static uint64_t ns_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static void report(char const * p_name, uint64_t blocks, uint64_t t_start)
+{
+    double seconds = (double)(ns_now() - t_start) / 1e9;
+
+    printf("%-22s: %10.0f blocks/s\n", p_name, (double)blocks / seconds);
+}
+
+static void job_handler(nrfx_ecb_job_t * p_job, nrfx_err_t result)
+{
+    (void)p_job;
+    TEST_ASSERT_EQUAL(NRFX_SUCCESS, result);
+    m_job_done = true;
+}
+
+static void bench_body(void)
+{
+    nrfx_ecb_config_t config = NRFX_ECB_DEFAULT_CONFIG;
+    uint8_t           counter[NRFX_ECB_BLOCK_SIZE] = {0};
+    uint8_t           data[CTR_SIZE]               = {0};
+    uint64_t          t;
+
+    TEST_ASSERT_EQUAL(NRFX_SUCCESS, nrfx_ecb_init(&config));
+    host_irq_handler_set(ECB_IRQn, nrfx_ecb_irq_handler);
+
+    t = ns_now();
+    for (uint32_t i = 0; i < RUNS; i++)
+    {
+        host_ecb_aes128_encrypt(m_key, m_block, m_block);
+    }
+    report("software AES", RUNS, t);
+
+    t = ns_now();
+    for (uint32_t i = 0; i < RUNS; i++)
+    {
+        TEST_ASSERT_EQUAL(NRFX_SUCCESS, nrfx_ecb_encrypt(m_key, m_block, m_block));
+    }
+    report("nrfx_ecb_encrypt", RUNS, t);
+
+    t = ns_now();
+    for (uint32_t i = 0; i < RUNS / JOB_BLOCKS; i++)
+    {
+        m_job_done = false;
+        TEST_ASSERT_EQUAL(NRFX_SUCCESS, nrfx_ecb_job_submit(&m_job));
+        TEST_ASSERT(m_job_done);
+    }
+    report("nrfx_ecb_job_submit", RUNS / JOB_BLOCKS * JOB_BLOCKS, t);
+
+    t = ns_now();
+    for (uint32_t i = 0; i < RUNS / (CTR_SIZE / NRFX_ECB_BLOCK_SIZE); i++)
+    {
+        TEST_ASSERT_EQUAL(NRFX_SUCCESS, nrfx_ecb_ctr_crypt(m_key, counter, data, data, CTR_SIZE));
+    }
+    report("nrfx_ecb_ctr_crypt", RUNS / (CTR_SIZE / NRFX_ECB_BLOCK_SIZE) *
+                                 (CTR_SIZE / NRFX_ECB_BLOCK_SIZE), t);
+
+    t = ns_now();
+    for (uint32_t i = 0; i < RUNS / (CTR_SIZE / NRFX_ECB_BLOCK_SIZE); i++)
+    {
+        TEST_ASSERT_EQUAL(NRFX_SUCCESS, nrfx_ecb_cmac(m_key, data, CTR_SIZE, m_block));
+    }
+    // The subkey derivation adds one block to each MAC.
+    report("nrfx_ecb_cmac", RUNS / (CTR_SIZE / NRFX_ECB_BLOCK_SIZE) *
+                            (CTR_SIZE / NRFX_ECB_BLOCK_SIZE + 1), t);
+
+    nrfx_ecb_uninit();
+    host_irq_handler_set(ECB_IRQn, NULL);
+}
+
+static void * bench_entry(void * p_arg)
+{
+    (void)p_arg;
+    bench_body();
+    return NULL;
+}
+
+int main(void)
+{
+    pthread_attr_t attr;
+    pthread_t      thread;
+
+    host_periph_reset();
+    m_job.p_blocks = host_ram_alloc(JOB_BLOCKS * sizeof(nrfx_ecb_data_t));
+    m_job.count    = JOB_BLOCKS;
+    m_job.handler  = job_handler;
+
+    // The blocking helpers hand blocks on their stack to EasyDMA, which must be in data RAM.
+    TEST_ASSERT(pthread_attr_init(&attr) == 0);
+    TEST_ASSERT(pthread_attr_setstack(&attr, host_ram_alloc(STACK_SIZE), STACK_SIZE) == 0);
+    TEST_ASSERT(pthread_create(&thread, &attr, bench_entry, NULL) == 0);
+    TEST_ASSERT(pthread_join(thread, NULL) == 0);
+    pthread_attr_destroy(&attr);
+    return 0;
+}
@@ -0,0 +1,421 @@
+/*
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Checks the ECB driver on the simulated peripheral, whose software AES-128
+ * and the driver helpers are compared against OpenSSL on the FIPS-197,
+ * SP 800-38A and RFC 4493 test vectors and on random data. The blocking
+ * helpers hand blocks on their stack to EasyDMA, so the tests run on a stack
+ * allocated in the data RAM region.
+ */
+
+#include <pthread.h>
+#include <string.h>
+#include <openssl/evp.h>
+#include <openssl/params.h>
+#include <nrfx_ecb.h>
+#include "host_ecb.h"
+#include "host_test.h"
+
+#define STACK_SIZE    0x10000
+#define RANDOM_RUNS   200
+#define DATA_SIZE_MAX 200
+
+static uint32_t         m_state = 0x12345678;
+static nrfx_ecb_job_t * m_done_jobs[8];
+static nrfx_err_t       m_done_results[8];
+static uint32_t         m_done_count;
+static nrfx_ecb_job_t * m_chained_job;
+
+static uint32_t rand_next(void)
+{
+    // xorshift32, so that the runs are the same on every host.
+    m_state ^= m_state << 13;
+    m_state ^= m_state >> 17;
+    m_state ^= m_state << 5;
+    return m_state;
+}
+
+static void rand_fill(uint8_t * p_data, size_t length)
+{
+    for (size_t i = 0; i < length; i++)
+    {
+        p_data[i] = (uint8_t)rand_next();
+    }
+}
+
+static void hex_parse(char const * p_hex, uint8_t * p_data)
+{
+    for (size_t i = 0; p_hex[2 * i] != '\0'; i++)
+    {
+        unsigned int byte;
+
+        TEST_ASSERT(sscanf(&p_hex[2 * i], "%2x", &byte) == 1);
+        p_data[i] = (uint8_t)byte;
+    }
+}
+
+static void openssl_cipher(EVP_CIPHER const * p_cipher,
+                           uint8_t const *    p_key,
+                           uint8_t const *    p_iv,
+                           uint8_t const *    p_in,
+                           uint8_t *          p_out,
+                           size_t             length)
+{
+    EVP_CIPHER_CTX * p_ctx = EVP_CIPHER_CTX_new();
+    int              out_length;
+
+    TEST_ASSERT(p_ctx != NULL);
+    TEST_ASSERT(EVP_EncryptInit_ex(p_ctx, p_cipher, NULL, p_key, p_iv) == 1);
+    EVP_CIPHER_CTX_set_padding(p_ctx, 0);
+    TEST_ASSERT(EVP_EncryptUpdate(p_ctx, p_out, &out_length, p_in, (int)length) == 1);
+    TEST_ASSERT_EQUAL(length, out_length);
+    EVP_CIPHER_CTX_free(p_ctx);
+}
+
+static void openssl_cmac(uint8_t const * p_key, uint8_t const * p_data, size_t length,
+                         uint8_t * p_mac)
+{
+    EVP_MAC *     p_mac_alg = EVP_MAC_fetch(NULL, "CMAC", NULL);
+    EVP_MAC_CTX * p_ctx;
+    size_t        mac_length;
+    OSSL_PARAM    params[] =
+    {
+        OSSL_PARAM_construct_utf8_string("cipher", "AES-128-CBC", 0),
+        OSSL_PARAM_construct_end(),
+    };
+
+    TEST_ASSERT(p_mac_alg != NULL);
+    p_ctx = EVP_MAC_CTX_new(p_mac_alg);
+    TEST_ASSERT(p_ctx != NULL);
+    TEST_ASSERT(EVP_MAC_init(p_ctx, p_key, NRFX_ECB_BLOCK_SIZE, params) == 1);
+    TEST_ASSERT(EVP_MAC_update(p_ctx, p_data, length) == 1);
+    TEST_ASSERT(EVP_MAC_final(p_ctx, p_mac, &mac_length, NRFX_ECB_BLOCK_SIZE) == 1);
+    TEST_ASSERT_EQUAL(NRFX_ECB_BLOCK_SIZE, mac_length);
+    EVP_MAC_CTX_free(p_ctx);
+    EVP_MAC_free(p_mac_alg);
+}
+
+static void * ram_stack_entry(void * p_body)
+{
+    ((void (*)(void))p_body)();
+    return NULL;
+}
+
+/* Runs the test body on a stack in the data RAM region, on peripherals in their reset state. */
+static void ram_stack_run(void (* body)(void))
+{
+    pthread_attr_t attr;
+    pthread_t      thread;
+
+    TEST_ASSERT(pthread_attr_init(&attr) == 0);
+    TEST_ASSERT(pthread_attr_setstack(&attr, host_ram_alloc(STACK_SIZE), STACK_SIZE) == 0);
+    TEST_ASSERT(pthread_create(&thread, &attr, ram_stack_entry, (void *)body) == 0);
+    TEST_ASSERT(pthread_join(thread, NULL) == 0);
+    pthread_attr_destroy(&attr);
+}
+
+static void driver_init(void)
+{
+    nrfx_ecb_config_t config = NRFX_ECB_DEFAULT_CONFIG;
+
+    TEST_ASSERT_EQUAL(NRFX_SUCCESS, nrfx_ecb_init(&config));
+    host_irq_handler_set(ECB_IRQn, nrfx_ecb_irq_handler);
+    host_ecb_error_inject(0);
+    (void)host_ecb_start_count_get();
+    m_done_count  = 0;
+    m_chained_job = NULL;
+}
+
+static void driver_uninit(void)
+{
+    nrfx_ecb_uninit();
+    host_irq_handler_set(ECB_IRQn, NULL);
+}
+
+static void job_handler(nrfx_ecb_job_t * p_job, nrfx_err_t result)
+{
+    TEST_ASSERT(m_done_count < sizeof(m_done_jobs) / sizeof(m_done_jobs[0]));
+    TEST_ASSERT(!nrfx_ecb_job_is_pending(p_job));
+    m_done_jobs[m_done_count]    = p_job;
+    m_done_results[m_done_count] = result;
+    m_done_count++;
+
+    if (m_chained_job != NULL)
+    {
+        nrfx_ecb_job_t * p_next = m_chained_job;
+
+        m_chained_job = NULL;
+        TEST_ASSERT_EQUAL(NRFX_SUCCESS, nrfx_ecb_job_submit(p_next));
+    }
+}
+
+static void job_prepare(nrfx_ecb_job_t * p_job, size_t count)
+{
+    memset(p_job, 0, sizeof(*p_job));
+    p_job->p_blocks = host_ram_alloc(count * sizeof(nrfx_ecb_data_t));
+    p_job->count    = count;
+    p_job->handler  = job_handler;
+    for (size_t i = 0; i < count; i++)
+    {
+        rand_fill(p_job->p_blocks[i].key, NRFX_ECB_BLOCK_SIZE);
+        rand_fill(p_job->p_blocks[i].cleartext, NRFX_ECB_BLOCK_SIZE);
+    }
+}
+
+static void job_check(nrfx_ecb_job_t const * p_job)
+{
+    for (size_t i = 0; i < p_job->count; i++)
+    {
+        nrfx_ecb_data_t const * p_block = &p_job->p_blocks[i];
+        uint8_t                 expected[NRFX_ECB_BLOCK_SIZE];
+
+        openssl_cipher(EVP_aes_128_ecb(), p_block->key, NULL, p_block->cleartext, expected,
+                       NRFX_ECB_BLOCK_SIZE);
+        TEST_ASSERT(memcmp(expected, p_block->ciphertext, NRFX_ECB_BLOCK_SIZE) == 0);
+    }
+}
+
+static void test_software_aes(void)
+{
+    uint8_t key[NRFX_ECB_BLOCK_SIZE];
+    uint8_t cleartext[NRFX_ECB_BLOCK_SIZE];
+    uint8_t ciphertext[NRFX_ECB_BLOCK_SIZE];
+    uint8_t expected[NRFX_ECB_BLOCK_SIZE];
+
+    // FIPS-197, appendix C.1.
+    hex_parse("000102030405060708090a0b0c0d0e0f", key);
+    hex_parse("00112233445566778899aabbccddeeff", cleartext);
+    hex_parse("69c4e0d86a7b0430d8cdb78070b4c55a", expected);
+    host_ecb_aes128_encrypt(key, cleartext, ciphertext);
+    TEST_ASSERT(memcmp(expected, ciphertext, NRFX_ECB_BLOCK_SIZE) == 0);
+
+    for (uint32_t i = 0; i < RANDOM_RUNS; i++)
+    {
+        rand_fill(key, sizeof(key));
+        rand_fill(cleartext, sizeof(cleartext));
+        host_ecb_aes128_encrypt(key, cleartext, ciphertext);
+        openssl_cipher(EVP_aes_128_ecb(), key, NULL, cleartext, expected, sizeof(expected));
+        TEST_ASSERT(memcmp(expected, ciphertext, NRFX_ECB_BLOCK_SIZE) == 0);
+    }
+}
+
+static void encrypt_body(void)
+{
+    uint8_t key[NRFX_ECB_BLOCK_SIZE];
+    uint8_t cleartext[NRFX_ECB_BLOCK_SIZE];
+    uint8_t ciphertext[NRFX_ECB_BLOCK_SIZE];
+    uint8_t expected[NRFX_ECB_BLOCK_SIZE];
+
+    driver_init();
+    for (uint32_t i = 0; i < RANDOM_RUNS; i++)
+    {
+        rand_fill(key, sizeof(key));
+        rand_fill(cleartext, sizeof(cleartext));
+        TEST_ASSERT_EQUAL(NRFX_SUCCESS, nrfx_ecb_encrypt(key, cleartext, ciphertext));
+        openssl_cipher(EVP_aes_128_ecb(), key, NULL, cleartext, expected, sizeof(expected));
+        TEST_ASSERT(memcmp(expected, ciphertext, NRFX_ECB_BLOCK_SIZE) == 0);
+    }
+    TEST_ASSERT_EQUAL(RANDOM_RUNS, host_ecb_start_count_get());
+    driver_uninit();
+}
+
+static void test_encrypt(void)
+{
+    ram_stack_run(encrypt_body);
+}
+
+static void ctr_body(void)
+{
+    uint8_t key[NRFX_ECB_BLOCK_SIZE];
+    uint8_t counter[NRFX_ECB_BLOCK_SIZE];
+    uint8_t iv[NRFX_ECB_BLOCK_SIZE];
+    uint8_t in[4 * NRFX_ECB_BLOCK_SIZE];
+    uint8_t out[DATA_SIZE_MAX];
+    uint8_t expected[DATA_SIZE_MAX];
+
+    driver_init();
+
+    // SP 800-38A, F.5.1 CTR-AES128.Encrypt.
+    hex_parse("2b7e151628aed2a6abf7158809cf4f3c", key);
+    hex_parse("f0f1f2f3f4f5f6f7f8f9fafbfcfdfeff", counter);
+    hex_parse("6bc1bee22e409f96e93d7e117393172a"
+              "ae2d8a571e03ac9c9eb76fac45af8e51"
+              "30c81c46a35ce411e5fbc1191a0a52ef"
+              "f69f2445df4f9b17ad2b417be66c3710", in);
+    hex_parse("874d6191b620e3261bef6864990db6ce"
+              "9806f66b7970fdff8617187bb9fffdff"
+              "5ae4df3edbd5d35e5b4f09020db03eab"
+              "1e031dda2fbe03d1792170a0f3009cee", expected);
+    TEST_ASSERT_EQUAL(NRFX_SUCCESS, nrfx_ecb_ctr_crypt(key, counter, in, out, sizeof(in)));
+    TEST_ASSERT(memcmp(expected, out, sizeof(in)) == 0);
+    hex_parse("f0f1f2f3f4f5f6f7f8f9fafbfcfdff03", expected);
+    TEST_ASSERT(memcmp(expected, counter, NRFX_ECB_BLOCK_SIZE) == 0);
+
+    for (uint32_t i = 0; i < RANDOM_RUNS; i++)
+    {
+        uint8_t data[DATA_SIZE_MAX];
+        size_t  length = rand_next() % (DATA_SIZE_MAX + 1);
+        size_t  split  = (rand_next() % (length / NRFX_ECB_BLOCK_SIZE + 1)) * NRFX_ECB_BLOCK_SIZE;
+
+        rand_fill(key, sizeof(key));
+        rand_fill(iv, sizeof(iv));
+        rand_fill(data, length);
+        if (i % 4 == 0)
+        {
+            // The counter carries across the 64-bit halves.
+            memset(&iv[4], 0xff, 12);
+        }
+        memcpy(counter, iv, sizeof(counter));
+        openssl_cipher(EVP_aes_128_ctr(), key, iv, data, expected, length);
+
+        // A message processed in two calls, in place.
+        TEST_ASSERT_EQUAL(NRFX_SUCCESS, nrfx_ecb_ctr_crypt(key, counter, data, data, split));
+        TEST_ASSERT_EQUAL(NRFX_SUCCESS, nrfx_ecb_ctr_crypt(key, counter, &data[split],
+                                                           &data[split], length - split));
+        TEST_ASSERT(memcmp(expected, data, length) == 0);
+    }
+    driver_uninit();
+}
+
+static void test_ctr(void)
+{
+    ram_stack_run(ctr_body);
+}
+
+static void cmac_body(void)
+{
+    static char const * const messages[] =
+    {
+        "",
+        "6bc1bee22e409f96e93d7e117393172a",
+        "6bc1bee22e409f96e93d7e117393172aae2d8a571e03ac9c9eb76fac45af8e5130c81c46a35ce411",
+        "6bc1bee22e409f96e93d7e117393172aae2d8a571e03ac9c9eb76fac45af8e51"
+        "30c81c46a35ce411e5fbc1191a0a52eff69f2445df4f9b17ad2b417be66c3710",
+    };
+    static char const * const macs[] =
+    {
+        "bb1d6929e95937287fa37d129b756746",
+        "070a16b46b4d4144f79bdd9dd04a287c",
+        "dfa66747de9ae63030ca32611497c827",
+        "51f0bebf7e3b9d92fc49741779363cfe",
+    };
+
+    uint8_t key[NRFX_ECB_BLOCK_SIZE];
+    uint8_t data[DATA_SIZE_MAX];
+    uint8_t mac[NRFX_ECB_BLOCK_SIZE];
+    uint8_t expected[NRFX_ECB_BLOCK_SIZE];
+
+    driver_init();
+
+    // RFC 4493, section 4.
+    hex_parse("2b7e151628aed2a6abf7158809cf4f3c", key);
+    for (size_t i = 0; i < sizeof(messages) / sizeof(messages[0]); i++)
+    {
+        hex_parse(messages[i], data);
+        hex_parse(macs[i], expected);
+        TEST_ASSERT_EQUAL(NRFX_SUCCESS, nrfx_ecb_cmac(key, data, strlen(messages[i]) / 2, mac));
+        TEST_ASSERT(memcmp(expected, mac, sizeof(mac)) == 0);
+    }
+
+    for (uint32_t i = 0; i < RANDOM_RUNS; i++)
+    {
+        size_t length = rand_next() % (DATA_SIZE_MAX + 1);
+
+        rand_fill(key, sizeof(key));
+        rand_fill(data, length);
+        TEST_ASSERT_EQUAL(NRFX_SUCCESS, nrfx_ecb_cmac(key, data, length, mac));
+        openssl_cmac(key, data, length, expected);
+        TEST_ASSERT(memcmp(expected, mac, sizeof(mac)) == 0);
+    }
+    driver_uninit();
+}
+
+static void test_cmac(void)
+{
+    ram_stack_run(cmac_body);
+}
+
+static void test_queue(void)
+{
+    nrfx_ecb_job_t jobs[3];
+
+    driver_init();
+    job_prepare(&jobs[0], 3);
+    job_prepare(&jobs[1], 1);
+    job_prepare(&jobs[2], 2);
+
+    // Jobs submitted with the interrupt masked are queued behind the first one.
+    unsigned int key = irq_lock();
+
+    TEST_ASSERT_EQUAL(NRFX_SUCCESS, nrfx_ecb_job_submit(&jobs[0]));
+    TEST_ASSERT_EQUAL(NRFX_SUCCESS, nrfx_ecb_job_submit(&jobs[1]));
+    TEST_ASSERT_EQUAL(NRFX_ERROR_BUSY, nrfx_ecb_job_submit(&jobs[1]));
+    TEST_ASSERT(nrfx_ecb_job_is_pending(&jobs[0]));
+    TEST_ASSERT(nrfx_ecb_job_is_pending(&jobs[1]));
+    TEST_ASSERT_EQUAL(1, host_ecb_start_count_get());
+    TEST_ASSERT_EQUAL(0, m_done_count);
+
+    // A job submitted from a handler is appended to the queue.
+    m_chained_job = &jobs[2];
+    irq_unlock(key);
+
+    TEST_ASSERT_EQUAL(3, m_done_count);
+    TEST_ASSERT_EQUAL(5, host_ecb_start_count_get());
+    for (size_t i = 0; i < 3; i++)
+    {
+        TEST_ASSERT(m_done_jobs[i] == &jobs[i]);
+        TEST_ASSERT_EQUAL(NRFX_SUCCESS, m_done_results[i]);
+        TEST_ASSERT_EQUAL(NRFX_SUCCESS, jobs[i].result);
+        TEST_ASSERT(!nrfx_ecb_job_is_pending(&jobs[i]));
+        job_check(&jobs[i]);
+    }
+    driver_uninit();
+}
+
+static void test_error_retries(void)
+{
+    nrfx_ecb_job_t jobs[2];
+
+    driver_init();
+    job_prepare(&jobs[0], 2);
+    job_prepare(&jobs[1], 1);
+
+    // A block aborted three times in a row is restarted each time.
+    host_ecb_error_inject(3);
+    TEST_ASSERT_EQUAL(NRFX_SUCCESS, nrfx_ecb_job_submit(&jobs[0]));
+    TEST_ASSERT_EQUAL(1, m_done_count);
+    TEST_ASSERT_EQUAL(NRFX_SUCCESS, m_done_results[0]);
+    TEST_ASSERT_EQUAL(5, host_ecb_start_count_get());
+    job_check(&jobs[0]);
+
+    // A fourth abort fails the job, and the next job in the queue is still processed.
+    unsigned int key = irq_lock();
+
+    host_ecb_error_inject(4);
+    TEST_ASSERT_EQUAL(NRFX_SUCCESS, nrfx_ecb_job_submit(&jobs[0]));
+    TEST_ASSERT_EQUAL(NRFX_SUCCESS, nrfx_ecb_job_submit(&jobs[1]));
+    irq_unlock(key);
+
+    TEST_ASSERT_EQUAL(3, m_done_count);
+    TEST_ASSERT(m_done_jobs[1] == &jobs[0]);
+    TEST_ASSERT_EQUAL(NRFX_ERROR_INTERNAL, m_done_results[1]);
+    TEST_ASSERT(m_done_jobs[2] == &jobs[1]);
+    TEST_ASSERT_EQUAL(NRFX_SUCCESS, m_done_results[2]);
+    TEST_ASSERT_EQUAL(5, host_ecb_start_count_get());
+    job_check(&jobs[1]);
+    driver_uninit();
+}
+
+int main(void)
+{
+    TEST_RUN(test_software_aes);
+    TEST_RUN(test_encrypt);
+    TEST_RUN(test_ctr);
+    TEST_RUN(test_cmac);
+    TEST_RUN(test_queue);
+    TEST_RUN(test_error_retries);
+    return 0;
+}
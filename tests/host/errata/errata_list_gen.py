@@ -0,0 +1,21 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2020, Nordic Semiconductor ASA
+# SPDX-License-Identifier: BSD-3-Clause
+#
+"""Lists the nrf52_errata_N() functions of the MDK as X(N) macro invocations.
+
+Usage:
+    errata_list_gen.py <nrf52_erratas.h> <output file>
+"""
+
+import re
+import sys
+
+if len(sys.argv) != 3:
+    sys.exit(__doc__)
+
+numbers = sorted(set(int(n) for n in
+                     re.findall(r'bool nrf52_errata_(\d+)\(void\)', open(sys.argv[1]).read())))
+with open(sys.argv[2], 'w') as f:
+    f.write(''.join('X(%d)\n' % n for n in numbers))
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Checks that the errata cache gives the same answers as the MDK functions
+ * nrf52_errata_N() for every part and revision code found in the table, plus
+ * unknown and unprogrammed ones.
+ */
+
+#include <sys/mman.h>
+#include <soc/nrfx_errata.h>
+#include <nrf_erratas.h>
+#include "host_test.h"
+
+#define ROM_TABLE_PAGE    0xF0000000UL
+#define ROM_PART_REG      (*(uint32_t volatile *)0xF0000FE0UL)
+#define ROM_REVISION_REG  (*(uint32_t volatile *)0xF0000FE8UL)
+#define FICR_PART_REG     (*(uint32_t volatile *)0x10000130UL)
+#define FICR_REVISION_REG (*(uint32_t volatile *)0x10000134UL)
+
+static nrfx_errata_row_t const m_rows[] = {
+    NRFX_ERRATA_TABLE_ROWS
+};
+
+typedef struct
+{
+    uint32_t number;
+    bool  (* check)(void);
+} mdk_errata_t;
+
+// The list of errata functions is extracted from nrf52_erratas.h at build time.
+#define X(n) { n, nrf52_errata_##n },
+static mdk_errata_t const m_mdk_errata[] = {
+#include "nrf52_errata_list.h"
+};
+#undef X
+
+static uint32_t m_combinations;
+
+static void check_device(uint32_t rom_part, uint32_t rom_rev, uint32_t ficr_part, uint32_t ficr_rev)
+{
+    uint32_t errata[NRFX_ERRATA_WORDS];
+
+    ROM_PART_REG      = rom_part;
+    ROM_REVISION_REG  = rom_rev << 4;
+    FICR_PART_REG     = ficr_part;
+    FICR_REVISION_REG = ficr_rev;
+
+    nrfx_errata_resolve(errata);
+    nrfx_errata_cache.resolved = false;
+
+    for (size_t i = 0; i < NRFX_ARRAY_SIZE(m_mdk_errata); i++)
+    {
+        uint32_t n        = m_mdk_errata[i].number;
+        bool     expected = m_mdk_errata[i].check();
+
+        if ((expected != nrfx_errata_check(n)) ||
+            (expected != ((errata[n / 32] >> (n % 32)) & 1)))
+        {
+            fprintf(stderr, "Erratum %u differs for ROM part 0x%02x rev %u, FICR part 0x%x rev 0x%x\n",
+                    n, rom_part, rom_rev, ficr_part, ficr_rev);
+            exit(EXIT_FAILURE);
+        }
+    }
+    m_combinations++;
+}
+
+static void test_errata_match_mdk(void)
+{
+    uint32_t parts[NRFX_ARRAY_SIZE(m_rows) + 2];
+    size_t   part_count = 0;
+
+    // Part codes from the table, and codes of no known part.
+    parts[part_count++] = 0x00;
+    parts[part_count++] = 0xFF;
+    for (size_t i = 0; i < NRFX_ARRAY_SIZE(m_rows); i++)
+    {
+        bool found = false;
+        for (size_t j = 0; j < part_count; j++)
+        {
+            found = found || (parts[j] == m_rows[i].part);
+        }
+        if (!found)
+        {
+            parts[part_count++] = m_rows[i].part;
+        }
+    }
+
+    for (size_t rp = 0; rp < part_count; rp++)
+    {
+        for (uint32_t rr = 0; rr < 16; rr++)
+        {
+            // FICR not programmed, then programmed with every known part.
+            for (uint32_t fr = 0; fr < 16; fr++)
+            {
+                check_device(parts[rp], rr, 0xFFFFFFFF, fr);
+            }
+            check_device(parts[rp], rr, 0xFFFFFFFF, 0xFFFFFFFF);
+            for (size_t fp = 0; fp < part_count; fp++)
+            {
+                for (uint32_t fr = 0; fr < 16; fr++)
+                {
+                    check_device(parts[rp], rr, parts[fp], fr);
+                }
+            }
+        }
+    }
+    printf("%zu errata checked for %u part and revision combinations\n",
+           NRFX_ARRAY_SIZE(m_mdk_errata), m_combinations);
+}
+
+int main(void)
+{
+    host_periph_init();
+    if (mmap((void *)ROM_TABLE_PAGE, 0x1000, PROT_READ | PROT_WRITE,
+             MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0) != (void *)ROM_TABLE_PAGE)
+    {
+        return EXIT_FAILURE;
+    }
+
+    // FICR has no write semantics to model.
+    host_periph_trap_enable(false);
+    test_errata_match_mdk();
+    printf("PASS test_errata_match_mdk\n");
+    return 0;
+}
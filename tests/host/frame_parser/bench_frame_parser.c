@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Host benchmark of the Header IE access of the 802.15.4 frame parser on
+ * Thread 1.2 frames. For each frame, it compares looking up the CSL,
+ * Rendezvous Time, Time Correction and vendor IEs one by one, building the
+ * index of all of them in one pass, and getting the index cached in the
+ * receive buffer. The times are those of the host CPU.
+ */
+
+#include <string.h>
+#include <time.h>
+#include "mac_features/nrf_802154_frame_parser.h"
+#include "nrf_802154_rx_buffer.h"
+#include "thread_frames.h"
+#include "host_test.h"
+
+#define RUNS 1000000
+
+static volatile uint32_t m_sink;
+
+static uint64_t ns_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static void ies_find(const uint8_t * p_frame)
+{
+    static const uint8_t ids[] =
+    {
+        IE_CSL_ID, IE_RENDEZVOUS_TIME_ID, IE_TIME_CORRECTION_ID, IE_VENDOR_ID
+    };
+
+    nrf_802154_frame_parser_ie_t ie;
+
+    for (size_t i = 0; i < sizeof(ids); i++)
+    {
+        if (nrf_802154_frame_parser_ie_find(p_frame, ids[i], &ie))
+        {
+            m_sink += ie.length;
+        }
+    }
+}
+
+static void index_build(const uint8_t * p_frame)
+{
+    nrf_802154_frame_parser_ie_index_t index;
+
+    nrf_802154_frame_parser_ie_index_build(p_frame, &index);
+    m_sink += index.csl.length;
+}
+
+static void index_get(const uint8_t * p_frame)
+{
+    nrf_802154_frame_parser_ie_index_t index;
+
+    nrf_802154_rx_buffer_ie_index_get(p_frame, &index);
+    m_sink += index.csl.length;
+}
+
+static double bench(void (* p_fn)(const uint8_t *), const uint8_t * p_frame)
+{
+    uint64_t t = ns_now();
+
+    for (uint32_t i = 0; i < RUNS; i++)
+    {
+        p_fn(p_frame);
+    }
+    return (double)(ns_now() - t) / RUNS;
+}
+
+static void bench_frame(const char * p_name, const uint8_t * p_frame)
+{
+    rx_buffer_t * p_buffer;
+    uint8_t     * p_data;
+
+    nrf_802154_rx_buffer_init();
+    p_buffer = nrf_802154_rx_buffer_free_find();
+    memcpy(p_buffer->data, p_frame, PHR_SIZE + p_frame[PHR_OFFSET]);
+    p_data = nrf_802154_rx_buffer_frame_take(p_buffer);
+
+    printf("%-12s: %5.1f ns for 4 lookups, %5.1f ns to build the index, "
+           "%5.1f ns to get the cached index\n",
+           p_name, bench(ies_find, p_data), bench(index_build, p_data), bench(index_get, p_data));
+
+    (void)nrf_802154_rx_buffer_release(p_data);
+}
+
+int main(void)
+{
+    bench_frame("Enh-ACK", m_enh_ack);
+    bench_frame("CSL data", m_csl_data);
+    bench_frame("Enh-Beacon", m_beacon);
+    bench_frame("2006 data", m_data_2006);
+    return 0;
+}
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Fuzz test of the Header IE parsing of the 802.15.4 frame parser. Random
+ * mutations of Thread 1.2 frames and random frames are parsed, and every IE
+ * returned by the iterator, the lookup and the index must lie within the MAC
+ * payload of the frame. Each frame is copied to a buffer of the size given by
+ * its PHR, so that the program, built with AddressSanitizer, catches any read
+ * past the frame.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "mac_features/nrf_802154_frame_parser.h"
+#include "nrf_802154_const.h"
+#include "thread_frames.h"
+#include "host_test.h"
+
+#define RUNS 500000
+
+static const uint8_t * const m_seeds[] = { m_enh_ack, m_csl_data, m_beacon, m_data_2006 };
+
+static uint32_t m_state = 0x12345678;
+static uint32_t m_ie_count;
+
+static uint32_t rand_next(void)
+{
+    // xorshift32, so that the runs are the same on every host.
+    m_state ^= m_state << 13;
+    m_state ^= m_state >> 17;
+    m_state ^= m_state << 5;
+    return m_state;
+}
+
+static void position_check(const uint8_t                               * p_frame,
+                           const nrf_802154_frame_parser_ie_position_t * p_position)
+{
+    if (p_position->offset != 0)
+    {
+        TEST_ASSERT(p_position->offset + p_position->length <=
+                    PHR_SIZE + p_frame[PHR_OFFSET] - FCS_SIZE);
+    }
+}
+
+static void frame_parse(const uint8_t * p_frame)
+{
+    nrf_802154_frame_parser_ie_iterator_t iterator;
+    nrf_802154_frame_parser_ie_index_t    index;
+    nrf_802154_frame_parser_ie_t          ie;
+    const uint8_t                       * p_end = &p_frame[PHR_SIZE + p_frame[PHR_OFFSET] - FCS_SIZE];
+    uint32_t                              count = 0;
+
+    if (nrf_802154_frame_parser_ie_iterator_init(p_frame, &iterator))
+    {
+        while (nrf_802154_frame_parser_ie_iterator_next(&iterator, &ie))
+        {
+            TEST_ASSERT(ie.p_content > p_frame);
+            TEST_ASSERT(&ie.p_content[ie.length] <= p_end);
+            TEST_ASSERT(++count <= MAX_PACKET_SIZE / IE_DESCRIPTOR_SIZE);
+        }
+        m_ie_count += count;
+    }
+
+    nrf_802154_frame_parser_ie_index_build(p_frame, &index);
+    position_check(p_frame, &index.csl);
+    position_check(p_frame, &index.rendezvous_time);
+    position_check(p_frame, &index.time_correction);
+    position_check(p_frame, &index.vendor);
+    position_check(p_frame, &index.link_metrics);
+
+    // The lookup and the index agree.
+    if (nrf_802154_frame_parser_ie_find(p_frame, IE_CSL_ID, &ie))
+    {
+        TEST_ASSERT_EQUAL(index.csl.offset, ie.p_content - p_frame);
+        TEST_ASSERT_EQUAL(index.csl.length, ie.length);
+    }
+    else
+    {
+        TEST_ASSERT_EQUAL(0, index.csl.offset);
+    }
+}
+
+int main(void)
+{
+    uint8_t frame[MAX_PACKET_SIZE + 1];
+
+    for (uint32_t i = 0; i < RUNS; i++)
+    {
+        const uint8_t * p_seed = m_seeds[i % (sizeof(m_seeds) / sizeof(m_seeds[0]))];
+        uint8_t       * p_frame;
+        size_t          size;
+
+        // Every fourth frame is random, the others are seeds with a few bytes changed.
+        if (i % 4 == 3)
+        {
+            for (size_t j = 0; j < sizeof(frame); j++)
+            {
+                frame[j] = (uint8_t)rand_next();
+            }
+            frame[PHR_OFFSET] &= 0x7f;
+        }
+        else
+        {
+            memset(frame, 0, sizeof(frame));
+            memcpy(frame, p_seed, PHR_SIZE + p_seed[PHR_OFFSET]);
+            for (uint32_t j = rand_next() % 4; j > 0; j--)
+            {
+                frame[rand_next() % (PHR_SIZE + p_seed[PHR_OFFSET])] = (uint8_t)rand_next();
+            }
+            frame[PHR_OFFSET] &= 0x7f;
+        }
+
+        size    = PHR_SIZE + frame[PHR_OFFSET];
+        p_frame = malloc(size);
+        TEST_ASSERT(p_frame != NULL);
+        memcpy(p_frame, frame, size);
+        frame_parse(p_frame);
+        free(p_frame);
+    }
+
+    printf("%u frames parsed, %" PRIu32 " IEs found\n", RUNS, m_ie_count);
+    return 0;
+}
@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Checks the Header IE iterator, lookup and index of the 802.15.4 frame parser
+ * on Thread 1.2 frames and on malformed frames, and the check of the IE data
+ * set for ACK frames, which uses the iterator.
+ */
+
+#include <string.h>
+#include "mac_features/nrf_802154_frame_parser.h"
+#include "mac_features/ack_generator/nrf_802154_ack_data.h"
+#include "nrf_802154_const.h"
+#include "thread_frames.h"
+#include "host_test.h"
+
+static uint8_t m_frame[MAX_PACKET_SIZE + 1];
+
+bool nrf_802154_indirect_tx_pending_check(const uint8_t * p_frame)
+{
+    (void)p_frame;
+    return false;
+}
+
+static uint8_t * frame_copy(const uint8_t * p_frame, size_t size)
+{
+    memset(m_frame, 0, sizeof(m_frame));
+    memcpy(m_frame, p_frame, size);
+    return m_frame;
+}
+
+/* Iterates over the frame and checks the Element IDs and content offsets of its IEs. */
+static void ies_check(const uint8_t  * p_frame,
+                      const uint8_t  * p_ids,
+                      const uint8_t  * p_offsets,
+                      size_t           count,
+                      bool             end_reached)
+{
+    nrf_802154_frame_parser_ie_iterator_t iterator;
+    nrf_802154_frame_parser_ie_t          ie;
+    size_t                                i = 0;
+
+    TEST_ASSERT(nrf_802154_frame_parser_ie_iterator_init(p_frame, &iterator));
+    while (nrf_802154_frame_parser_ie_iterator_next(&iterator, &ie))
+    {
+        TEST_ASSERT(i < count);
+        TEST_ASSERT_EQUAL(p_ids[i], ie.id);
+        TEST_ASSERT_EQUAL(p_offsets[i], ie.p_content - p_frame);
+        i++;
+    }
+    TEST_ASSERT_EQUAL(count, i);
+    TEST_ASSERT_EQUAL(end_reached, nrf_802154_frame_parser_ie_iterator_end_reached(&iterator));
+
+    // The iterator does not restart once it has ended.
+    TEST_ASSERT(!nrf_802154_frame_parser_ie_iterator_next(&iterator, &ie));
+}
+
+static void test_enh_ack(void)
+{
+    static const uint8_t ids[]     = { IE_CSL_ID, IE_VENDOR_ID };
+    static const uint8_t offsets[] = { ENH_ACK_CSL_OFFSET, ENH_ACK_LINK_METRICS_OFFSET };
+
+    nrf_802154_frame_parser_ie_index_t index;
+    nrf_802154_frame_parser_ie_t       ie;
+
+    ies_check(m_enh_ack, ids, offsets, 2, true);
+
+    TEST_ASSERT(nrf_802154_frame_parser_ie_find(m_enh_ack, IE_CSL_ID, &ie));
+    TEST_ASSERT_EQUAL(4, ie.length);
+    TEST_ASSERT_EQUAL(1000, ie.p_content[2] | (ie.p_content[3] << 8));
+    TEST_ASSERT(!nrf_802154_frame_parser_ie_find(m_enh_ack, IE_TIME_CORRECTION_ID, &ie));
+
+    nrf_802154_frame_parser_ie_index_build(m_enh_ack, &index);
+    TEST_ASSERT_EQUAL(ENH_ACK_CSL_OFFSET, index.csl.offset);
+    TEST_ASSERT_EQUAL(4, index.csl.length);
+    TEST_ASSERT_EQUAL(ENH_ACK_LINK_METRICS_OFFSET, index.vendor.offset);
+    TEST_ASSERT_EQUAL(ENH_ACK_LINK_METRICS_OFFSET, index.link_metrics.offset);
+    TEST_ASSERT_EQUAL(5, index.link_metrics.length);
+    TEST_ASSERT_EQUAL(0, index.rendezvous_time.offset);
+    TEST_ASSERT_EQUAL(0, index.time_correction.offset);
+}
+
+static void test_csl_data(void)
+{
+    static const uint8_t ids[]     = { IE_RENDEZVOUS_TIME_ID, IE_CSL_ID };
+    static const uint8_t offsets[] = { CSL_DATA_RENDEZVOUS_OFFSET, CSL_DATA_CSL_OFFSET };
+
+    nrf_802154_frame_parser_ie_index_t index;
+
+    // The iteration stops on the Header Termination IE, before the payload.
+    ies_check(m_csl_data, ids, offsets, 2, false);
+
+    nrf_802154_frame_parser_ie_index_build(m_csl_data, &index);
+    TEST_ASSERT_EQUAL(CSL_DATA_RENDEZVOUS_OFFSET, index.rendezvous_time.offset);
+    TEST_ASSERT_EQUAL(CSL_DATA_CSL_OFFSET, index.csl.offset);
+    TEST_ASSERT_EQUAL(0, index.vendor.offset);
+    TEST_ASSERT_EQUAL(0, index.link_metrics.offset);
+}
+
+static void test_beacon(void)
+{
+    static const uint8_t ids[]     = { IE_TIME_CORRECTION_ID, IE_VENDOR_ID, IE_CSL_ID };
+    static const uint8_t offsets[] =
+    {
+        BEACON_TIME_CORRECTION_OFFSET, BEACON_VENDOR_OFFSET, BEACON_CSL_OFFSET
+    };
+
+    nrf_802154_frame_parser_ie_index_t index;
+
+    ies_check(m_beacon, ids, offsets, 3, true);
+
+    // A vendor IE of another OUI is not taken for Link Metrics.
+    nrf_802154_frame_parser_ie_index_build(m_beacon, &index);
+    TEST_ASSERT_EQUAL(BEACON_TIME_CORRECTION_OFFSET, index.time_correction.offset);
+    TEST_ASSERT_EQUAL(BEACON_VENDOR_OFFSET, index.vendor.offset);
+    TEST_ASSERT_EQUAL(0, index.link_metrics.offset);
+    TEST_ASSERT_EQUAL(BEACON_CSL_OFFSET, index.csl.offset);
+}
+
+static void test_no_ies(void)
+{
+    nrf_802154_frame_parser_ie_iterator_t iterator;
+    nrf_802154_frame_parser_ie_index_t    index;
+    nrf_802154_frame_parser_ie_t          ie;
+
+    TEST_ASSERT(!nrf_802154_frame_parser_ie_iterator_init(m_data_2006, &iterator));
+    TEST_ASSERT(!nrf_802154_frame_parser_ie_iterator_next(&iterator, &ie));
+    TEST_ASSERT(!nrf_802154_frame_parser_ie_find(m_data_2006, IE_CSL_ID, &ie));
+
+    memset(&index, 0xff, sizeof(index));
+    nrf_802154_frame_parser_ie_index_build(m_data_2006, &index);
+    TEST_ASSERT_EQUAL(0, index.csl.offset);
+    TEST_ASSERT_EQUAL(0, index.vendor.offset);
+}
+
+static void test_malformed(void)
+{
+    static const uint8_t       ids[]     = { IE_CSL_ID };
+    static const uint8_t       offsets[] = { ENH_ACK_CSL_OFFSET };
+    nrf_802154_frame_parser_ie_iterator_t iterator;
+    nrf_802154_frame_parser_ie_index_t    index;
+    uint8_t                             * p_frame;
+
+    // The Link Metrics IE does not fit in a frame cut by 2 bytes.
+    p_frame             = frame_copy(m_enh_ack, sizeof(m_enh_ack));
+    p_frame[PHR_OFFSET] = sizeof(m_enh_ack) - PHR_SIZE - 2;
+    ies_check(p_frame, ids, offsets, 1, false);
+    nrf_802154_frame_parser_ie_index_build(p_frame, &index);
+    TEST_ASSERT_EQUAL(ENH_ACK_CSL_OFFSET, index.csl.offset);
+    TEST_ASSERT_EQUAL(0, index.vendor.offset);
+    TEST_ASSERT_EQUAL(0, index.link_metrics.offset);
+
+    // A single byte after the CSL IE is not a descriptor.
+    p_frame[PHR_OFFSET] = ENH_ACK_CSL_OFFSET + 4 - PHR_SIZE + 1 + FCS_SIZE;
+    ies_check(p_frame, ids, offsets, 1, false);
+
+    // The frame ends right after the CSL IE.
+    p_frame[PHR_OFFSET] = ENH_ACK_CSL_OFFSET + 4 - PHR_SIZE + FCS_SIZE;
+    ies_check(p_frame, ids, offsets, 1, true);
+
+    // A length that runs past the frame.
+    p_frame                                            = frame_copy(m_enh_ack, sizeof(m_enh_ack));
+    p_frame[ENH_ACK_CSL_OFFSET - IE_DESCRIPTOR_SIZE] = IE_HEADER_LENGTH_MASK;
+    ies_check(p_frame, ids, offsets, 0, false);
+
+    // A Payload IE descriptor among the Header IEs.
+    p_frame = frame_copy(m_enh_ack, sizeof(m_enh_ack));
+    p_frame[ENH_ACK_LINK_METRICS_OFFSET - 1] |= IE_TYPE_BIT >> 8;
+    ies_check(p_frame, ids, offsets, 1, false);
+
+    // The IEs start past the end of the frame, or the frame is shorter than the FCS.
+    p_frame             = frame_copy(m_enh_ack, sizeof(m_enh_ack));
+    p_frame[PHR_OFFSET] = ENH_ACK_CSL_OFFSET - IE_DESCRIPTOR_SIZE - PHR_SIZE;
+    TEST_ASSERT(!nrf_802154_frame_parser_ie_iterator_init(p_frame, &iterator));
+    p_frame[PHR_OFFSET] = 1;
+    TEST_ASSERT(!nrf_802154_frame_parser_ie_iterator_init(p_frame, &iterator));
+}
+
+static void test_duplicate(void)
+{
+    nrf_802154_frame_parser_ie_index_t index;
+    nrf_802154_frame_parser_ie_t       ie;
+    uint8_t                          * p_frame;
+
+    // Only the first of two CSL IEs is used.
+    p_frame = frame_copy(m_beacon, sizeof(m_beacon));
+    p_frame[BEACON_TIME_CORRECTION_OFFSET - 1] = (IE_CSL_ID << IE_HEADER_ELEMENT_ID_SHIFT) >> 8;
+    p_frame[BEACON_TIME_CORRECTION_OFFSET - 2] = 2 | (uint8_t)(IE_CSL_ID << IE_HEADER_ELEMENT_ID_SHIFT);
+    nrf_802154_frame_parser_ie_index_build(p_frame, &index);
+    TEST_ASSERT_EQUAL(BEACON_TIME_CORRECTION_OFFSET, index.csl.offset);
+    TEST_ASSERT_EQUAL(2, index.csl.length);
+    TEST_ASSERT(nrf_802154_frame_parser_ie_find(p_frame, IE_CSL_ID, &ie));
+    TEST_ASSERT_EQUAL(BEACON_TIME_CORRECTION_OFFSET, ie.p_content - p_frame);
+}
+
+static void test_ack_data(void)
+{
+    static const uint8_t addr[SHORT_ADDRESS_SIZE] = { 0x00, 0x20 };
+    static const uint8_t csl_ie[]                 = { 0x04, 0x0d, 0x10, 0x00, 0xe8, 0x03 };
+    static const uint8_t probing_ie[]             = { 0x05, 0x00, 0x9b, 0xb8, 0xea, 0x00, 0x7f };
+    static const uint8_t two_ies[]                = { 0x02, 0x0f, 0x00, 0x00, 0x00, 0x0f };
+    static const uint8_t cut_ie[]                 = { 0x04, 0x0d, 0x10, 0x00, 0xe8 };
+    static const uint8_t ht2_ie[]                 = { 0x80, 0x3f };
+    static const uint8_t long_ie[]                = { 0x07, 0x00, 1, 2, 3, 4, 5, 6, 7 };
+
+    const uint8_t * p_ie;
+    uint8_t         length;
+
+    nrf_802154_ack_data_init();
+
+    // Well-formed lists of Header IEs are stored.
+    TEST_ASSERT(nrf_802154_ack_data_for_addr_set(addr, false, NRF_802154_ACK_DATA_IE,
+                                                 csl_ie, sizeof(csl_ie)));
+    p_ie = nrf_802154_ack_data_ie_get(addr, false, &length);
+    TEST_ASSERT_EQUAL(sizeof(csl_ie), length);
+    TEST_ASSERT_EQUAL(0, memcmp(p_ie, csl_ie, length));
+    TEST_ASSERT(nrf_802154_ack_data_for_addr_set(addr, false, NRF_802154_ACK_DATA_IE,
+                                                 probing_ie, sizeof(probing_ie)));
+    TEST_ASSERT(nrf_802154_ack_data_for_addr_set(addr, false, NRF_802154_ACK_DATA_IE,
+                                                 two_ies, sizeof(two_ies)));
+
+    // Malformed or too long IE data is refused and the data set before is kept.
+    TEST_ASSERT(!nrf_802154_ack_data_for_addr_set(addr, false, NRF_802154_ACK_DATA_IE,
+                                                  cut_ie, sizeof(cut_ie)));
+    TEST_ASSERT(!nrf_802154_ack_data_for_addr_set(addr, false, NRF_802154_ACK_DATA_IE,
+                                                  ht2_ie, sizeof(ht2_ie)));
+    TEST_ASSERT(!nrf_802154_ack_data_for_addr_set(addr, false, NRF_802154_ACK_DATA_IE,
+                                                  two_ies, 1));
+    TEST_ASSERT(sizeof(long_ie) > NRF_802154_MAX_ACK_IE_SIZE);
+    TEST_ASSERT(!nrf_802154_ack_data_for_addr_set(addr, false, NRF_802154_ACK_DATA_IE,
+                                                  long_ie, sizeof(long_ie)));
+    p_ie = nrf_802154_ack_data_ie_get(addr, false, &length);
+    TEST_ASSERT_EQUAL(sizeof(two_ies), length);
+    TEST_ASSERT_EQUAL(0, memcmp(p_ie, two_ies, length));
+}
+
+int main(void)
+{
+    TEST_RUN(test_enh_ack);
+    TEST_RUN(test_csl_data);
+    TEST_RUN(test_beacon);
+    TEST_RUN(test_no_ies);
+    TEST_RUN(test_malformed);
+    TEST_RUN(test_duplicate);
+    TEST_RUN(test_ack_data);
+    return 0;
+}
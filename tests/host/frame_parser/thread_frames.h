@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef THREAD_FRAMES_H__
+#define THREAD_FRAMES_H__
+
+#include <stdint.h>
+
+/*
+ * Frames of a Thread 1.2 network, used by the tests and the benchmark of the
+ * frame parser. Each frame starts with the PHR and ends with a zero FCS.
+ */
+
+/* Enhanced ACK sent by a CSL receiver to a Link Metrics initiator: CSL IE and
+ * Thread Enhanced-ACK Probing IE. */
+#define ENH_ACK_CSL_OFFSET          16
+#define ENH_ACK_LINK_METRICS_OFFSET 22
+static const uint8_t m_enh_ack[] =
+{
+    28,
+    0x02, 0x2e,                                     // FCF: Enh-ACK, IE present, dst extended
+    0x55,                                           // Sequence number
+    0xce, 0xfa,                                     // Destination PAN ID
+    0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, // Destination address
+    0x04, 0x0d, 0x10, 0x00, 0xe8, 0x03,             // CSL IE: phase 16, period 1000
+    0x05, 0x00, 0x9b, 0xb8, 0xea, 0x00, 0x7f,       // Thread Enhanced-ACK Probing IE
+    0x00, 0x00,                                     // FCS
+};
+
+/* Data frame of a CSL transmitter: Rendezvous Time IE, CSL IE, Header
+ * Termination 2 IE and payload. */
+#define CSL_DATA_RENDEZVOUS_OFFSET  12
+#define CSL_DATA_CSL_OFFSET         18
+static const uint8_t m_csl_data[] =
+{
+    28,
+    0x41, 0xaa,                         // FCF: data, PAN ID compression, IE present, short addresses
+    0x12,                               // Sequence number
+    0xce, 0xfa,                         // Destination PAN ID
+    0x00, 0x10,                         // Destination address
+    0x00, 0x20,                         // Source address
+    0x84, 0x0e, 0x20, 0x00, 0x10, 0x00, // Rendezvous Time IE
+    0x04, 0x0d, 0x30, 0x00, 0xe8, 0x03, // CSL IE
+    0x80, 0x3f,                         // Header Termination 2 IE
+    0xaa, 0xbb, 0xcc,                   // Payload
+    0x00, 0x00,                         // FCS
+};
+
+/* Enhanced Beacon with a Time Correction IE, a vendor IE of another OUI and a
+ * CSL IE. */
+#define BEACON_TIME_CORRECTION_OFFSET 16
+#define BEACON_VENDOR_OFFSET          20
+#define BEACON_CSL_OFFSET             27
+static const uint8_t m_beacon[] =
+{
+    32,
+    0x00, 0xe2,                                     // FCF: beacon, IE present, src extended
+    0x33,                                           // Sequence number
+    0xce, 0xfa,                                     // Source PAN ID
+    0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, // Source address
+    0x02, 0x0f, 0x00, 0x00,                         // Time Correction IE
+    0x05, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,       // Vendor IE of another OUI
+    0x04, 0x0d, 0x40, 0x00, 0xe8, 0x03,             // CSL IE
+    0x00, 0x00,                                     // FCS
+};
+
+/* IEEE 802.15.4-2006 data frame, without IEs. */
+static const uint8_t m_data_2006[] =
+{
+    13,
+    0x41, 0x88,             // FCF: data, PAN ID compression, short addresses
+    0x34,                   // Sequence number
+    0xce, 0xfa,             // Destination PAN ID
+    0x00, 0x10,             // Destination address
+    0x00, 0x20,             // Source address
+    0xaa, 0xbb,             // Payload
+    0x00, 0x00,             // FCS
+};
+
+#endif // THREAD_FRAMES_H__
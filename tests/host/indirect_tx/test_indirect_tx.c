@@ -0,0 +1,409 @@
+/*
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Checks the indirect transmission queue of the 802.15.4 radio driver. The
+ * timer scheduler, the request and the notification modules are replaced by
+ * stubs, and the timers are fired by the test. A frame removed by the higher
+ * layer while its data request is dispatched must be either removed or
+ * transmitted, never both, which several threads check like the interrupt
+ * contexts of the device.
+ */
+
+#include <pthread.h>
+#include <string.h>
+#include <soc/nrfx_atomic.h>
+#include "nrf_802154_const.h"
+#include "mac_features/nrf_802154_indirect_tx.h"
+#include "nrf_802154_request.h"
+#include "timer_scheduler/nrf_802154_timer_sched.h"
+#include "host_test.h"
+
+#define TIMERS         4
+#define TIMEOUT        1000
+#define RACE_RUNS      20000
+#define DATA_FRAME_LEN 12
+
+static pthread_mutex_t       m_timer_mutex = PTHREAD_MUTEX_INITIALIZER;
+static nrf_802154_timer_t  * mp_timers[TIMERS];
+static uint32_t              m_now;
+static volatile bool         m_transmit_result;
+static nrfx_atomic_u32_t     m_transmit_count;
+static const uint8_t       * mp_transmitted;
+static const uint8_t       * mp_failed;
+static nrf_802154_tx_error_t m_failed_error;
+static uint32_t              m_failed_count;
+
+uint32_t nrf_802154_timer_sched_time_get(void)
+{
+    return m_now;
+}
+
+bool nrf_802154_timer_sched_time_is_in_future(uint32_t now, uint32_t t0, uint32_t dt)
+{
+    return (int32_t)(t0 + dt - now) > 0;
+}
+
+void nrf_802154_timer_sched_add(nrf_802154_timer_t * p_timer, bool round_up)
+{
+    (void)round_up;
+    pthread_mutex_lock(&m_timer_mutex);
+    for (size_t i = 0; i < TIMERS; i++)
+    {
+        if ((mp_timers[i] == NULL) || (mp_timers[i] == p_timer))
+        {
+            mp_timers[i] = p_timer;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&m_timer_mutex);
+}
+
+void nrf_802154_timer_sched_remove(nrf_802154_timer_t * p_timer, bool * p_was_running)
+{
+    bool running = false;
+
+    pthread_mutex_lock(&m_timer_mutex);
+    for (size_t i = 0; i < TIMERS; i++)
+    {
+        if (mp_timers[i] == p_timer)
+        {
+            mp_timers[i] = NULL;
+            running      = true;
+        }
+    }
+    pthread_mutex_unlock(&m_timer_mutex);
+    if (p_was_running != NULL)
+    {
+        *p_was_running = running;
+    }
+}
+
+bool nrf_802154_request_transmit(nrf_802154_term_t              term_lvl,
+                                 req_originator_t               req_orig,
+                                 const uint8_t                * p_data,
+                                 bool                           cca,
+                                 nrf_802154_tx_power_t          tx_power,
+                                 bool                           immediate,
+                                 nrf_802154_notification_func_t notify_function)
+{
+    (void)term_lvl;
+    (void)cca;
+    (void)tx_power;
+    (void)notify_function;
+    TEST_ASSERT_EQUAL(REQ_ORIG_INDIRECT_TX, req_orig);
+    TEST_ASSERT(immediate);
+    if (m_transmit_result)
+    {
+        (void)nrfx_atomic_u32_fetch_add(&m_transmit_count, 1);
+        mp_transmitted = p_data;
+    }
+    return m_transmit_result;
+}
+
+void nrf_802154_notify_transmit_failed(const uint8_t * p_frame, nrf_802154_tx_error_t error)
+{
+    mp_failed      = p_frame;
+    m_failed_error = error;
+    m_failed_count++;
+}
+
+/* Returns the running timer with the given context, the dispatch timer takes the frame. */
+static nrf_802154_timer_t * timer_find(void * p_context)
+{
+    nrf_802154_timer_t * p_timer = NULL;
+
+    pthread_mutex_lock(&m_timer_mutex);
+    for (size_t i = 0; i < TIMERS; i++)
+    {
+        if ((mp_timers[i] != NULL) && (mp_timers[i]->p_context == p_context))
+        {
+            p_timer = mp_timers[i];
+        }
+    }
+    pthread_mutex_unlock(&m_timer_mutex);
+    return p_timer;
+}
+
+/* Fires the timers that expired at the current time, like the timer scheduler. */
+static void timers_fire(void)
+{
+    for (size_t i = 0; i < TIMERS; i++)
+    {
+        nrf_802154_timer_t * p_timer = mp_timers[i];
+
+        if ((p_timer != NULL) &&
+            !nrf_802154_timer_sched_time_is_in_future(m_now, p_timer->t0, p_timer->dt))
+        {
+            mp_timers[i] = NULL;
+            p_timer->callback(p_timer->p_context);
+        }
+    }
+}
+
+/* Data frame with PAN ID compression, a short destination and a short source address. */
+static void data_frame_build(uint8_t * p_frame, uint16_t dst, uint8_t dsn)
+{
+    const uint8_t frame[] =
+    {
+        DATA_FRAME_LEN, 0x41, 0x98, dsn, 0xcd, 0xab, (uint8_t)dst, (uint8_t)(dst >> 8),
+        0x01, 0x00, 0x55, 0xaa, 0x00
+    };
+
+    memcpy(p_frame, frame, sizeof(frame));
+}
+
+/* Data request command from a short source address, with PAN ID compression. */
+static void data_request_build(uint8_t * p_frame, uint16_t src)
+{
+    const uint8_t frame[] =
+    {
+        12, 0x63, 0x98, 0x10, 0xcd, 0xab, 0x01, 0x00, (uint8_t)src, (uint8_t)(src >> 8),
+        MAC_CMD_DATA_REQ, 0x00, 0x00
+    };
+
+    memcpy(p_frame, frame, sizeof(frame));
+}
+
+static const uint8_t m_ack_pending[]    = { 5, ACK_HEADER_WITH_PENDING, 0x00, 0x10, 0x00, 0x00 };
+static const uint8_t m_ack_no_pending[] = { 5, ACK_HEADER_WITHOUT_PENDING, 0x00, 0x10, 0x00, 0x00 };
+
+static void stubs_reset(void)
+{
+    memset(mp_timers, 0, sizeof(mp_timers));
+    m_now             = 0x10000;
+    m_transmit_result = true;
+    m_transmit_count  = 0;
+    mp_transmitted    = NULL;
+    mp_failed         = NULL;
+    m_failed_count    = 0;
+    nrf_802154_indirect_tx_init();
+}
+
+static void test_add_poll_dispatch(void)
+{
+    static uint8_t                 frame[MAX_PACKET_SIZE + PHR_SIZE];
+    static uint8_t                 request[MAX_PACKET_SIZE + PHR_SIZE];
+    nrf_802154_indirect_tx_stats_t stats;
+
+    stubs_reset();
+    data_frame_build(frame, 0x1234, 1);
+    data_request_build(request, 0x1234);
+    TEST_ASSERT(nrf_802154_indirect_tx_add(frame, TIMEOUT));
+
+    // The transmission is requested from the timer, not from the ACK handler.
+    nrf_802154_indirect_tx_ack_sent(request, m_ack_pending);
+    TEST_ASSERT_EQUAL(0, m_transmit_count);
+    TEST_ASSERT(timer_find(frame) != NULL);
+    timers_fire();
+    TEST_ASSERT_EQUAL(1, m_transmit_count);
+    TEST_ASSERT(mp_transmitted == frame);
+
+    // The frame is not queued anymore, and the expiry timer was stopped with it.
+    TEST_ASSERT(!nrf_802154_indirect_tx_pending_check(request));
+    TEST_ASSERT(!nrf_802154_indirect_tx_remove(frame));
+    m_now += 2 * TIMEOUT;
+    timers_fire();
+    TEST_ASSERT_EQUAL(0, m_failed_count);
+
+    nrf_802154_indirect_tx_stats_get(&stats);
+    TEST_ASSERT_EQUAL(1, stats.queued);
+    TEST_ASSERT_EQUAL(1, stats.polls);
+    TEST_ASSERT_EQUAL(1, stats.dispatched);
+    TEST_ASSERT_EQUAL(0, stats.dispatch_failed);
+    TEST_ASSERT_EQUAL(0, stats.expired);
+}
+
+static void test_pending_check(void)
+{
+    static uint8_t frames[NRF_802154_INDIRECT_TX_QUEUE_SIZE + 1][MAX_PACKET_SIZE + PHR_SIZE];
+    static uint8_t request[MAX_PACKET_SIZE + PHR_SIZE];
+
+    stubs_reset();
+    data_request_build(request, 0x1234);
+    TEST_ASSERT(!nrf_802154_indirect_tx_pending_check(request));
+
+    data_frame_build(frames[0], 0x1234, 1);
+    TEST_ASSERT(nrf_802154_indirect_tx_add(frames[0], TIMEOUT));
+    TEST_ASSERT(nrf_802154_indirect_tx_pending_check(request));
+    data_request_build(request, 0x4321);
+    TEST_ASSERT(!nrf_802154_indirect_tx_pending_check(request));
+
+    // Without the pending bit in the ACK, the frame waits for the next data request.
+    nrf_802154_indirect_tx_ack_sent(request, m_ack_no_pending);
+    data_request_build(request, 0x1234);
+    nrf_802154_indirect_tx_ack_sent(request, m_ack_no_pending);
+    TEST_ASSERT(timer_find(frames[0]) == NULL);
+
+    // Frames for other destinations fill the queue.
+    for (uint32_t i = 1; i < NRF_802154_INDIRECT_TX_QUEUE_SIZE; i++)
+    {
+        data_frame_build(frames[i], 0x2000 + i, (uint8_t)i);
+        TEST_ASSERT(nrf_802154_indirect_tx_add(frames[i], TIMEOUT));
+    }
+    data_frame_build(frames[NRF_802154_INDIRECT_TX_QUEUE_SIZE], 0x3000, 0);
+    TEST_ASSERT(!nrf_802154_indirect_tx_add(frames[NRF_802154_INDIRECT_TX_QUEUE_SIZE], TIMEOUT));
+
+    TEST_ASSERT(nrf_802154_indirect_tx_remove(frames[0]));
+    TEST_ASSERT(!nrf_802154_indirect_tx_pending_check(request));
+    data_request_build(request, 0x2001);
+    TEST_ASSERT(nrf_802154_indirect_tx_pending_check(request));
+}
+
+static void test_dispatch_radio_busy(void)
+{
+    static uint8_t                 frame[MAX_PACKET_SIZE + PHR_SIZE];
+    static uint8_t                 request[MAX_PACKET_SIZE + PHR_SIZE];
+    nrf_802154_indirect_tx_stats_t stats;
+
+    stubs_reset();
+    data_frame_build(frame, 0x1234, 1);
+    data_request_build(request, 0x1234);
+    TEST_ASSERT(nrf_802154_indirect_tx_add(frame, TIMEOUT));
+
+    // The frame stays queued for the next data request.
+    m_transmit_result = false;
+    nrf_802154_indirect_tx_ack_sent(request, m_ack_pending);
+    timers_fire();
+    TEST_ASSERT(nrf_802154_indirect_tx_pending_check(request));
+
+    m_transmit_result = true;
+    nrf_802154_indirect_tx_ack_sent(request, m_ack_pending);
+    timers_fire();
+    TEST_ASSERT(mp_transmitted == frame);
+
+    nrf_802154_indirect_tx_stats_get(&stats);
+    TEST_ASSERT_EQUAL(2, stats.polls);
+    TEST_ASSERT_EQUAL(1, stats.dispatch_failed);
+    TEST_ASSERT_EQUAL(1, stats.dispatched);
+}
+
+static void test_expiry(void)
+{
+    static uint8_t                 frames[2][MAX_PACKET_SIZE + PHR_SIZE];
+    static uint8_t                 request[MAX_PACKET_SIZE + PHR_SIZE];
+    nrf_802154_indirect_tx_stats_t stats;
+
+    stubs_reset();
+    data_frame_build(frames[0], 0x1234, 1);
+    data_frame_build(frames[1], 0x1234, 2);
+    TEST_ASSERT(nrf_802154_indirect_tx_add(frames[0], TIMEOUT));
+    m_now += TIMEOUT / 2;
+    TEST_ASSERT(nrf_802154_indirect_tx_add(frames[1], TIMEOUT));
+
+    m_now += TIMEOUT / 2 - 1;
+    timers_fire();
+    TEST_ASSERT_EQUAL(0, m_failed_count);
+
+    // The oldest frame expires first, and the timer is armed again for the other one.
+    m_now += 1;
+    timers_fire();
+    TEST_ASSERT_EQUAL(1, m_failed_count);
+    TEST_ASSERT(mp_failed == frames[0]);
+    TEST_ASSERT_EQUAL(NRF_802154_TX_ERROR_EXPIRED, m_failed_error);
+
+    data_request_build(request, 0x1234);
+    TEST_ASSERT(nrf_802154_indirect_tx_pending_check(request));
+    m_now += TIMEOUT / 2;
+    timers_fire();
+    TEST_ASSERT_EQUAL(2, m_failed_count);
+    TEST_ASSERT(mp_failed == frames[1]);
+    TEST_ASSERT(!nrf_802154_indirect_tx_pending_check(request));
+
+    // An expired frame is not dispatched anymore.
+    nrf_802154_indirect_tx_ack_sent(request, m_ack_pending);
+    timers_fire();
+    TEST_ASSERT_EQUAL(0, m_transmit_count);
+
+    nrf_802154_indirect_tx_stats_get(&stats);
+    TEST_ASSERT_EQUAL(2, stats.queued);
+    TEST_ASSERT_EQUAL(2, stats.expired);
+    TEST_ASSERT_EQUAL(0, stats.polls);
+}
+
+static pthread_barrier_t    m_barrier;
+static nrf_802154_timer_t * mp_race_timer;
+static uint8_t            * mp_race_frame;
+static volatile bool        m_race_removed;
+
+static void * dispatch_thread(void * p_arg)
+{
+    (void)p_arg;
+    for (uint32_t i = 0; i < RACE_RUNS; i++)
+    {
+        pthread_barrier_wait(&m_barrier);
+        mp_race_timer->callback(mp_race_timer->p_context);
+        pthread_barrier_wait(&m_barrier);
+    }
+    return NULL;
+}
+
+static void * remove_thread(void * p_arg)
+{
+    (void)p_arg;
+    for (uint32_t i = 0; i < RACE_RUNS; i++)
+    {
+        pthread_barrier_wait(&m_barrier);
+        m_race_removed = nrf_802154_indirect_tx_remove(mp_race_frame);
+        pthread_barrier_wait(&m_barrier);
+    }
+    return NULL;
+}
+
+static void test_remove_dispatch_race(void)
+{
+    static uint8_t                 frames[2][MAX_PACKET_SIZE + PHR_SIZE];
+    static uint8_t                 request[MAX_PACKET_SIZE + PHR_SIZE];
+    pthread_t                      threads[2];
+    uint32_t                       removed = 0;
+    nrf_802154_indirect_tx_stats_t stats;
+
+    stubs_reset();
+    data_request_build(request, 0x1234);
+    TEST_ASSERT_EQUAL(0, pthread_barrier_init(&m_barrier, NULL, 3));
+    TEST_ASSERT_EQUAL(0, pthread_create(&threads[0], NULL, dispatch_thread, NULL));
+    TEST_ASSERT_EQUAL(0, pthread_create(&threads[1], NULL, remove_thread, NULL));
+
+    for (uint32_t i = 0; i < RACE_RUNS; i++)
+    {
+        uint32_t transmitted = m_transmit_count;
+
+        // Alternate frames, so the entry of the last one can be reused for the next.
+        mp_race_frame = frames[i % 2];
+        data_frame_build(mp_race_frame, 0x1234, (uint8_t)i);
+        TEST_ASSERT(nrf_802154_indirect_tx_add(mp_race_frame, TIMEOUT));
+        nrf_802154_indirect_tx_ack_sent(request, m_ack_pending);
+        mp_race_timer = timer_find(mp_race_frame);
+        TEST_ASSERT(mp_race_timer != NULL);
+
+        pthread_barrier_wait(&m_barrier);
+        pthread_barrier_wait(&m_barrier);
+
+        TEST_ASSERT_EQUAL(1, (m_transmit_count - transmitted) + (m_race_removed ? 1 : 0));
+        TEST_ASSERT(!nrf_802154_indirect_tx_pending_check(request));
+        removed += m_race_removed ? 1 : 0;
+    }
+
+    TEST_ASSERT_EQUAL(0, pthread_join(threads[0], NULL));
+    TEST_ASSERT_EQUAL(0, pthread_join(threads[1], NULL));
+    pthread_barrier_destroy(&m_barrier);
+
+    nrf_802154_indirect_tx_stats_get(&stats);
+    TEST_ASSERT_EQUAL(RACE_RUNS, stats.queued);
+    TEST_ASSERT_EQUAL(RACE_RUNS, stats.polls);
+    TEST_ASSERT_EQUAL(RACE_RUNS - removed, stats.dispatched);
+    TEST_ASSERT_EQUAL(RACE_RUNS - removed, m_transmit_count);
+    printf("%" PRIu32 " of %u frames removed before their dispatch\n", removed, RACE_RUNS);
+}
+
+int main(void)
+{
+    TEST_RUN(test_add_poll_dispatch);
+    TEST_RUN(test_pending_check);
+    TEST_RUN(test_dispatch_radio_busy);
+    TEST_RUN(test_expiry);
+    TEST_RUN(test_remove_dispatch_race);
+    return 0;
+}
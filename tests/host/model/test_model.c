@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Checks of the register model generated by nrfx_svd_model_gen.py. The layout
+ * of the device header is checked against the SVD when nrf_model.c is built.
+ */
+
+#include <hal/nrf_rtc.h>
+#include <hal/nrf_gpio.h>
+#include <hal/nrf_timer.h>
+#include "host_test.h"
+
+static void test_reset_values(void)
+{
+    // Reset values come from the SVD.
+    TEST_ASSERT_EQUAL(0xFFFFFFFF, NRF_UICR->PSELRESET[0]);
+    TEST_ASSERT_EQUAL(GPIO_PIN_CNF_INPUT_Disconnect << GPIO_PIN_CNF_INPUT_Pos,
+                      NRF_P0->PIN_CNF[0]);
+    TEST_ASSERT_EQUAL(0, nrf_rtc_counter_get(NRF_RTC0));
+}
+
+static void test_set_clear_registers(void)
+{
+    nrf_rtc_int_enable(NRF_RTC0, NRF_RTC_INT_COMPARE0_MASK | NRF_RTC_INT_OVERFLOW_MASK);
+    nrf_rtc_int_disable(NRF_RTC0, NRF_RTC_INT_OVERFLOW_MASK);
+    nrf_rtc_int_enable(NRF_RTC0, NRF_RTC_INT_COMPARE1_MASK);
+    TEST_ASSERT_EQUAL(NRF_RTC_INT_COMPARE0_MASK | NRF_RTC_INT_COMPARE1_MASK,
+                      nrf_rtc_int_enable_check(NRF_RTC0, UINT32_MAX));
+    TEST_ASSERT_EQUAL(NRF_RTC_INT_COMPARE0_MASK | NRF_RTC_INT_COMPARE1_MASK,
+                      NRF_RTC0->INTENSET);
+
+    // Clearing exactly the bits that are set is a write as well.
+    nrf_rtc_int_disable(NRF_RTC0, NRF_RTC_INT_COMPARE0_MASK | NRF_RTC_INT_COMPARE1_MASK);
+    TEST_ASSERT_EQUAL(0, nrf_rtc_int_enable_check(NRF_RTC0, UINT32_MAX));
+
+    // Registers with an own state register.
+    nrf_gpio_pin_set(NRF_GPIO_PIN_MAP(0, 3));
+    nrf_gpio_pin_set(NRF_GPIO_PIN_MAP(1, 5));
+    nrf_gpio_pin_clear(NRF_GPIO_PIN_MAP(0, 3));
+    TEST_ASSERT_EQUAL(0, NRF_P0->OUT);
+    TEST_ASSERT_EQUAL(1UL << 5, NRF_P1->OUT);
+}
+
+static void test_tasks(void)
+{
+    nrf_timer_event_clear(NRF_TIMER1, NRF_TIMER_EVENT_COMPARE0);
+    nrf_timer_task_trigger(NRF_TIMER1, NRF_TIMER_TASK_START);
+    TEST_ASSERT_EQUAL(0, NRF_TIMER1->TASKS_START);
+
+    // A task without a paired event generates nothing.
+    TEST_ASSERT(!nrf_timer_event_check(NRF_TIMER1, NRF_TIMER_EVENT_COMPARE0));
+
+    // Triggering a task twice generates the event twice.
+    NRF_SPIM1->EVENTS_STARTED = 0;
+    NRF_SPIM1->TASKS_START = 1;
+    TEST_ASSERT_EQUAL(1, NRF_SPIM1->EVENTS_STARTED);
+    NRF_SPIM1->EVENTS_STARTED = 0;
+    NRF_SPIM1->TASKS_START = 1;
+    TEST_ASSERT_EQUAL(1, NRF_SPIM1->EVENTS_STARTED);
+}
+
+int main(void)
+{
+    host_periph_init();
+
+    TEST_RUN(test_reset_values);
+    TEST_RUN(test_set_clear_registers);
+    TEST_RUN(test_tasks);
+    return 0;
+}
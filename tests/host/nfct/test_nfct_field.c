@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Checks the timing of the NFC field detection workarounds running on RTC.
+ * The program is built once with the anomaly 190 workaround, which delays
+ * the activation after the field is detected, and once with the anomaly 79
+ * workaround, which polls the field state to detect that it is lost.
+ */
+
+#include <stddef.h>
+#include <string.h>
+#include <nrfx_nfct.h>
+#include <nrfx_rtc.h>
+#include "host_test.h"
+#include "host_rtc.h"
+
+#define RTC_FREQUENCY 32768UL
+#define FIELD_ON      (NFCT_FIELDPRESENT_FIELDPRESENT_Msk | NFCT_FIELDPRESENT_LOCKDETECT_Msk)
+#define POLLS_MAX     20000
+
+static void rtc_irq_handler(void);
+
+static host_rtc_t m_rtc =
+{
+    .p_reg    = NRF_RTC2,
+    .irq      = RTC2_IRQn,
+    .handler  = rtc_irq_handler,
+    .cc_count = 4,
+};
+
+static uint32_t m_evt_count[NRFX_NFCT_EVT_ERROR + 1];
+static uint32_t m_activate_count;
+static uint32_t m_irq_ticks[POLLS_MAX];
+static uint32_t m_irq_count;
+
+void nrf_model_task_triggered(nrf_model_periph_t const * p_periph, nrf_model_reg_t const * p_reg)
+{
+    if (p_reg->pair != 0xFFFF)
+    {
+        p_periph->p_mem[p_reg->pair / 4] = 1;
+    }
+    if ((p_periph->address == NRF_NFCT_BASE) &&
+        (p_reg->offset == offsetof(NRF_NFCT_Type, TASKS_ACTIVATE)))
+    {
+        m_activate_count++;
+    }
+}
+
+static void rtc_irq_handler(void)
+{
+    TEST_ASSERT(m_irq_count < POLLS_MAX);
+    m_irq_ticks[m_irq_count++] = NRF_RTC2->COUNTER;
+    nrfx_rtc_2_irq_handler();
+}
+
+static void nfct_handler(nrfx_nfct_evt_t const * p_event)
+{
+    m_evt_count[p_event->evt_id]++;
+}
+
+static void field_set(uint32_t state)
+{
+    *(volatile uint32_t *)&NRF_NFCT->FIELDPRESENT = state;
+}
+
+static void field_detect(void)
+{
+    field_set(FIELD_ON);
+    NRF_NFCT->EVENTS_FIELDDETECTED = 1;
+    host_irq_call(NFCT_IRQn, nrfx_nfct_irq_handler);
+    TEST_ASSERT_EQUAL(1, m_evt_count[NRFX_NFCT_EVT_FIELD_DETECTED]);
+}
+
+static void nfct_start(void)
+{
+    nrfx_nfct_config_t config =
+    {
+        .rxtx_int_mask = NRFX_NFCT_EVT_RX_FRAMEEND | NRFX_NFCT_EVT_TX_FRAMEEND,
+        .cb            = nfct_handler,
+    };
+
+    memset(m_evt_count, 0, sizeof(m_evt_count));
+    m_activate_count = 0;
+    m_irq_count      = 0;
+    TEST_ASSERT_EQUAL(NRFX_SUCCESS, nrfx_nfct_init(&config));
+    nrfx_nfct_enable();
+    // The RTC was started at init. It is moved away from zero to check wrapping of the counter.
+    host_rtc_advance(&m_rtc, RTC_COUNTER_COUNTER_Msk - 50);
+}
+
+#if NRFX_CHECK(USE_WORKAROUND_FOR_ANOMALY_190)
+
+// 1000 us is 32.768 ticks, rounded up and extended by one tick for the phase of the counter.
+#define DELAY_TICKS 34UL
+
+static void test_delay_bounds(void)
+{
+    uint64_t min_us = (DELAY_TICKS - 1) * 1000000ULL / RTC_FREQUENCY;
+    uint64_t max_us = DELAY_TICKS * 1000000ULL / RTC_FREQUENCY;
+
+    // Whatever the phase of the counter, the delay is not shorter than 1000 us and is extended by less than two ticks.
+    TEST_ASSERT(min_us >= 1000);
+    TEST_ASSERT(max_us < 1000 + 2 * 1000000ULL / RTC_FREQUENCY);
+}
+
+static void test_activation_delay(void)
+{
+    nfct_start();
+    field_detect();
+
+    // HFCLK is running, but the field is not considered stable yet.
+    nrfx_nfct_state_force(NRFX_NFCT_STATE_ACTIVATED);
+    host_rtc_advance(&m_rtc, DELAY_TICKS - 1);
+    TEST_ASSERT_EQUAL(0, m_activate_count);
+
+    host_rtc_advance(&m_rtc, 1);
+    TEST_ASSERT_EQUAL(1, m_activate_count);
+    TEST_ASSERT_EQUAL(1, m_irq_count);
+
+    // The field is validated after the same delay.
+    host_rtc_advance(&m_rtc, DELAY_TICKS);
+    TEST_ASSERT_EQUAL(2, m_irq_count);
+    TEST_ASSERT_EQUAL(0, m_evt_count[NRFX_NFCT_EVT_FIELD_LOST]);
+
+    // The compare channel is not armed any more.
+    host_rtc_advance(&m_rtc, 10 * DELAY_TICKS);
+    TEST_ASSERT_EQUAL(2, m_irq_count);
+
+    field_set(0);
+    NRF_NFCT->EVENTS_FIELDLOST = 1;
+    host_irq_call(NFCT_IRQn, nrfx_nfct_irq_handler);
+    TEST_ASSERT_EQUAL(1, m_evt_count[NRFX_NFCT_EVT_FIELD_LOST]);
+    nrfx_nfct_uninit();
+}
+
+static void test_field_lost_during_validation(void)
+{
+    nfct_start();
+    field_detect();
+    nrfx_nfct_state_force(NRFX_NFCT_STATE_ACTIVATED);
+    host_rtc_advance(&m_rtc, DELAY_TICKS);
+    TEST_ASSERT_EQUAL(1, m_activate_count);
+
+    field_set(0);
+    host_rtc_advance(&m_rtc, DELAY_TICKS);
+    TEST_ASSERT_EQUAL(1, m_evt_count[NRFX_NFCT_EVT_FIELD_LOST]);
+    nrfx_nfct_uninit();
+}
+
+#elif NRFX_CHECK(USE_WORKAROUND_FOR_ANOMALY_79)
+
+#define POLL_PERIOD_US 100UL
+
+static void test_poll_period(void)
+{
+    uint32_t start;
+
+    nfct_start();
+    start = NRF_RTC2->COUNTER;
+    field_detect();
+
+    // One second of polls with the field present.
+    host_rtc_advance(&m_rtc, RTC_FREQUENCY);
+    TEST_ASSERT_EQUAL(1000000UL / POLL_PERIOD_US, m_irq_count);
+    TEST_ASSERT_EQUAL(0, m_evt_count[NRFX_NFCT_EVT_FIELD_LOST]);
+
+    // Each poll is within one tick of the nominal time, so the period does not drift.
+    for (uint32_t i = 0; i < m_irq_count; i++)
+    {
+        uint64_t nominal = (uint64_t)(i + 1) * POLL_PERIOD_US * RTC_FREQUENCY;
+        uint64_t actual  = (uint64_t)((m_irq_ticks[i] - start) & RTC_COUNTER_COUNTER_Msk) * 1000000UL;
+
+        TEST_ASSERT(actual + 1000000UL > nominal);
+        TEST_ASSERT(actual < nominal + 1000000UL);
+    }
+
+    field_set(0);
+    host_rtc_advance(&m_rtc, RTC_FREQUENCY / 1000);
+    TEST_ASSERT_EQUAL(1, m_evt_count[NRFX_NFCT_EVT_FIELD_LOST]);
+    nrfx_nfct_uninit();
+}
+
+static void test_field_lost(void)
+{
+    nfct_start();
+    field_detect();
+    host_rtc_advance(&m_rtc, 100);
+
+    // The field is lost at the 8th poll without the field, that is, 800 us later.
+    field_set(0);
+    m_irq_count = 0;
+    while (m_evt_count[NRFX_NFCT_EVT_FIELD_LOST] == 0)
+    {
+        TEST_ASSERT(m_irq_count <= 8);
+        host_rtc_advance(&m_rtc, 1);
+    }
+    TEST_ASSERT_EQUAL(8, m_irq_count);
+
+    // Polling stops until the field is detected again.
+    host_rtc_advance(&m_rtc, RTC_FREQUENCY);
+    TEST_ASSERT_EQUAL(8, m_irq_count);
+    nrfx_nfct_uninit();
+}
+
+#endif
+
+int main(void)
+{
+#if NRFX_CHECK(USE_WORKAROUND_FOR_ANOMALY_190)
+    TEST_RUN(test_delay_bounds);
+    TEST_RUN(test_activation_delay);
+    TEST_RUN(test_field_lost_during_validation);
+#elif NRFX_CHECK(USE_WORKAROUND_FOR_ANOMALY_79)
+    TEST_RUN(test_poll_period);
+    TEST_RUN(test_field_lost);
+#endif
+    return 0;
+}
@@ -0,0 +1,405 @@
+/*
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Checks the ISO-DEP and Type 4 Tag state machine of the NFCT Type 4 Tag
+ * emulation against a simulated reader. Frames sent by the reader are placed
+ * in the RX buffer of NFCT, and frames sent by the tag are captured when
+ * the STARTTX task is triggered. The tag is built with 32-byte frames.
+ */
+
+#include <stddef.h>
+#include <string.h>
+#include <nrfx_nfct_t4t.h>
+#include "host_test.h"
+
+#define FRAME_MAX 256
+
+static uint8_t  m_tag_frame[FRAME_MAX];
+static size_t   m_tag_frame_size;
+static bool     m_rx_enabled;
+static bool     m_sleep;
+
+static uint32_t m_evt_count[NRFX_NFCT_T4T_EVT_APDU + 1];
+static uint8_t  m_apdu[FRAME_MAX];
+static size_t   m_apdu_size;
+static uint8_t const * m_p_user_resp;
+static uint16_t m_user_resp_size;
+
+static uint8_t const m_ndef[] =
+{
+    0xD1, 0x01, 0x2C, 0x55, 0x04, 'n', 'o', 'r', 'd', 'i', 'c', 's', 'e', 'm', 'i',
+    '.', 'c', 'o', 'm', '/', 'p', 'r', 'o', 'd', 'u', 'c', 't', 's', '/', 'n', 'r',
+    'f', '5', '2', '8', '4', '0', '/', 't', 'y', 'p', 'e', '-', '4', '-', 't', 'a',
+    'g',
+};
+
+static uint8_t const m_select_app[] =
+{
+    0x00, 0xA4, 0x04, 0x00, 0x07, 0xD2, 0x76, 0x00, 0x00, 0x85, 0x01, 0x01, 0x00,
+};
+
+void nrf_model_task_triggered(nrf_model_periph_t const * p_periph, nrf_model_reg_t const * p_reg)
+{
+    if (p_reg->pair != 0xFFFF)
+    {
+        p_periph->p_mem[p_reg->pair / 4] = 1;
+    }
+    if (p_periph->address != NRF_NFCT_BASE)
+    {
+        return;
+    }
+
+    switch (p_reg->offset)
+    {
+        case offsetof(NRF_NFCT_Type, TASKS_STARTTX):
+            // The frame is sent at once, CRC is added by the peripheral.
+            m_tag_frame_size = (NRF_NFCT->TXD.AMOUNT & (NFCT_TXD_AMOUNT_TXDATABYTES_Msk |
+                                                        NFCT_TXD_AMOUNT_TXDATABITS_Msk)) >> 3;
+            TEST_ASSERT(m_tag_frame_size <= sizeof(m_tag_frame));
+            memcpy(m_tag_frame, (void *)(uintptr_t)NRF_NFCT->PACKETPTR, m_tag_frame_size);
+            p_periph->p_mem[offsetof(NRF_NFCT_Type, EVENTS_TXFRAMEEND) / 4] = 1;
+            break;
+        case offsetof(NRF_NFCT_Type, TASKS_ENABLERXDATA):
+            m_rx_enabled = true;
+            break;
+        case offsetof(NRF_NFCT_Type, TASKS_GOSLEEP):
+            m_sleep = true;
+            break;
+        default:
+            break;
+    }
+}
+
+static void t4t_handler(nrfx_nfct_t4t_evt_t const * p_event)
+{
+    m_evt_count[p_event->evt_id]++;
+    if (p_event->evt_id == NRFX_NFCT_T4T_EVT_APDU)
+    {
+        memcpy(m_apdu, p_event->apdu.p_data, p_event->apdu.data_size);
+        m_apdu_size = p_event->apdu.data_size;
+        if (m_p_user_resp)
+        {
+            TEST_ASSERT_EQUAL(NRFX_SUCCESS,
+                              nrfx_nfct_t4t_response_set(m_p_user_resp, m_user_resp_size));
+        }
+    }
+}
+
+static void nfct_irq(void)
+{
+    host_irq_call(NFCT_IRQn, nrfx_nfct_irq_handler);
+}
+
+/* Sends the frame to the tag and returns the size of the answer, 0 if the tag did not answer. */
+static size_t transceive(uint8_t const * p_frame, size_t size)
+{
+    TEST_ASSERT(m_rx_enabled);
+    TEST_ASSERT(size + 2 <= NRF_NFCT->MAXLEN);
+
+    memcpy((void *)(uintptr_t)NRF_NFCT->PACKETPTR, p_frame, size);
+    *(volatile uint32_t *)&NRF_NFCT->RXD.AMOUNT = (uint32_t)((size + 2) * 8);
+    m_rx_enabled     = false;
+    m_tag_frame_size = 0;
+    NRF_NFCT->EVENTS_RXFRAMEEND = 1;
+    nfct_irq();
+
+    // The end of the answer may be handled in the same interrupt.
+    if (NRF_NFCT->EVENTS_TXFRAMEEND)
+    {
+        nfct_irq();
+    }
+    TEST_ASSERT(!NRF_NFCT->EVENTS_TXFRAMEEND);
+    return m_tag_frame_size;
+}
+
+static void frame_check(uint8_t const * p_expected, size_t size)
+{
+    TEST_ASSERT_EQUAL(size, m_tag_frame_size);
+    TEST_ASSERT(memcmp(p_expected, m_tag_frame, size) == 0);
+}
+
+/* Sends the APDU in one I-block and checks the status word of the unchained response. */
+static void apdu_check(uint8_t pcb, uint8_t const * p_apdu, size_t size, uint16_t sw)
+{
+    uint8_t frame[FRAME_MAX];
+
+    frame[0] = pcb;
+    memcpy(&frame[1], p_apdu, size);
+    TEST_ASSERT(transceive(frame, size + 1) >= 3);
+    TEST_ASSERT_EQUAL(pcb, m_tag_frame[0]);
+    TEST_ASSERT_EQUAL(sw, (m_tag_frame[m_tag_frame_size - 2] << 8) |
+                          m_tag_frame[m_tag_frame_size - 1]);
+}
+
+static void t4t_start(void)
+{
+    nrfx_nfct_t4t_config_t config = NRFX_NFCT_T4T_DEFAULT_CONFIG(m_ndef, sizeof(m_ndef),
+                                                                 t4t_handler);
+
+    memset(m_evt_count, 0, sizeof(m_evt_count));
+    m_p_user_resp = NULL;
+    m_rx_enabled  = false;
+    m_sleep       = false;
+    TEST_ASSERT_EQUAL(NRFX_SUCCESS, nrfx_nfct_t4t_init(&config));
+    nrfx_nfct_t4t_enable();
+
+    NRF_NFCT->EVENTS_SELECTED = 1;
+    nfct_irq();
+}
+
+static void t4t_stop(void)
+{
+    nrfx_nfct_t4t_disable();
+    nrfx_nfct_t4t_uninit();
+}
+
+/* Activates ISO-DEP with the given FSDI and checks the ATS. */
+static void activate(uint8_t fsdi)
+{
+    uint8_t const rats[] = { 0xE0, (uint8_t)(fsdi << 4) };
+    // FSCI 2 for 32-byte frames, FWI 7, no CID and NAD.
+    uint8_t const ats[]  = { 0x05, 0x72, 0x00, 0x70, 0x00 };
+
+    TEST_ASSERT(transceive(rats, sizeof(rats)));
+    frame_check(ats, sizeof(ats));
+    TEST_ASSERT_EQUAL(1, m_evt_count[NRFX_NFCT_T4T_EVT_ACTIVATED]);
+}
+
+static void test_ndef_read(void)
+{
+    uint8_t const select_cc[]   = { 0x00, 0xA4, 0x00, 0x0C, 0x02, 0xE1, 0x03 };
+    uint8_t const select_ndef[] = { 0x00, 0xA4, 0x00, 0x0C, 0x02, 0xE1, 0x04 };
+    uint8_t const read_cc[]     = { 0x00, 0xB0, 0x00, 0x00, 0x0F };
+    uint8_t const cc[] =
+    {
+        0x02, 0x00, 0x0F, 0x20, 0x00, 0xFF, 0x00, 0xFF, 0x04, 0x06,
+        0xE1, 0x04, 0x00, sizeof(m_ndef) + 2, 0x00, 0xFF, 0x90, 0x00,
+    };
+    uint8_t pcb = 0x02;
+
+    t4t_start();
+    activate(8);
+
+    apdu_check(pcb, m_select_app, sizeof(m_select_app), 0x9000);
+    pcb ^= 1;
+    apdu_check(pcb, select_cc, sizeof(select_cc), 0x9000);
+    pcb ^= 1;
+    apdu_check(pcb, read_cc, sizeof(read_cc), 0x9000);
+    frame_check(cc, sizeof(cc));
+    pcb ^= 1;
+    apdu_check(pcb, select_ndef, sizeof(select_ndef), 0x9000);
+
+    // NLEN, then the message in chunks smaller than MLe.
+    uint8_t ndef[sizeof(m_ndef) + 2];
+    size_t  offset = 0;
+
+    while (offset < sizeof(ndef))
+    {
+        uint8_t chunk = (uint8_t)((sizeof(ndef) - offset) < 20 ? (sizeof(ndef) - offset) : 20);
+        uint8_t read[] = { 0x00, 0xB0, (uint8_t)(offset >> 8), (uint8_t)offset, chunk };
+
+        TEST_ASSERT_EQUAL(0, m_evt_count[NRFX_NFCT_T4T_EVT_NDEF_READ]);
+        pcb ^= 1;
+        apdu_check(pcb, read, sizeof(read), 0x9000);
+        TEST_ASSERT_EQUAL(chunk + 3, m_tag_frame_size);
+        memcpy(&ndef[offset], &m_tag_frame[1], chunk);
+        offset += chunk;
+    }
+    TEST_ASSERT_EQUAL(0, ndef[0]);
+    TEST_ASSERT_EQUAL(sizeof(m_ndef), ndef[1]);
+    TEST_ASSERT(memcmp(&ndef[2], m_ndef, sizeof(m_ndef)) == 0);
+    TEST_ASSERT_EQUAL(1, m_evt_count[NRFX_NFCT_T4T_EVT_NDEF_READ]);
+
+    // Reading past the end of the file.
+    pcb ^= 1;
+    apdu_check(pcb, (uint8_t[]){ 0x00, 0xB0, 0x00, sizeof(ndef) + 1, 0x01 }, 5, 0x6B00);
+    t4t_stop();
+}
+
+static void test_response_chaining(void)
+{
+    uint8_t const select_cc[] = { 0x00, 0xA4, 0x00, 0x0C, 0x02, 0xE1, 0x03 };
+
+    t4t_start();
+    // 16-byte frames leave 13 bytes of the response in each block.
+    activate(0);
+    apdu_check(0x02, m_select_app, sizeof(m_select_app), 0x9000);
+    apdu_check(0x03, select_cc, sizeof(select_cc), 0x9000);
+
+    TEST_ASSERT_EQUAL(14, transceive((uint8_t[]){ 0x02, 0x00, 0xB0, 0x00, 0x00, 0x0F }, 6));
+    TEST_ASSERT_EQUAL(0x12, m_tag_frame[0]);
+    TEST_ASSERT_EQUAL(0x0F, m_tag_frame[2]);
+
+    // Rule 11: R(NAK) with the current block number repeats the last block.
+    TEST_ASSERT_EQUAL(14, transceive((uint8_t[]){ 0xB2 }, 1));
+    TEST_ASSERT_EQUAL(0x12, m_tag_frame[0]);
+
+    // Rule 13: R(ACK) with the other block number continues chaining.
+    TEST_ASSERT_EQUAL(5, transceive((uint8_t[]){ 0xA3 }, 1));
+    frame_check((uint8_t[]){ 0x03, 0x00, 0xFF, 0x90, 0x00 }, 5);
+
+    // Rule 12: R(NAK) with the other block number is answered with R(ACK).
+    TEST_ASSERT_EQUAL(1, transceive((uint8_t[]){ 0xB2 }, 1));
+    frame_check((uint8_t[]){ 0xA3 }, 1);
+
+    // R(ACK) outside of chaining is ignored.
+    TEST_ASSERT_EQUAL(0, transceive((uint8_t[]){ 0xA2 }, 1));
+    TEST_ASSERT(m_rx_enabled);
+    t4t_stop();
+}
+
+static void test_command_chaining(void)
+{
+    uint8_t const resp[] = { 0xCA, 0xFE, 0x90, 0x00 };
+    uint8_t       apdu[60];
+    uint8_t       frame[31];
+
+    for (size_t i = 0; i < sizeof(apdu); i++)
+    {
+        apdu[i] = (uint8_t)(0x80 + i);
+    }
+    apdu[4] = sizeof(apdu) - 5;
+
+    t4t_start();
+    activate(8);
+    m_p_user_resp    = resp;
+    m_user_resp_size = sizeof(resp);
+
+    // Blocks of at most 30 bytes fit the 32-byte frame with CRC.
+    frame[0] = 0x12;
+    memcpy(&frame[1], &apdu[0], 29);
+    TEST_ASSERT_EQUAL(1, transceive(frame, 30));
+    frame_check((uint8_t[]){ 0xA2 }, 1);
+
+    frame[0] = 0x13;
+    memcpy(&frame[1], &apdu[29], 29);
+    TEST_ASSERT_EQUAL(1, transceive(frame, 30));
+    frame_check((uint8_t[]){ 0xA3 }, 1);
+
+    // A lost R(ACK) is repeated.
+    TEST_ASSERT_EQUAL(1, transceive((uint8_t[]){ 0xB3 }, 1));
+    frame_check((uint8_t[]){ 0xA3 }, 1);
+
+    frame[0] = 0x02;
+    memcpy(&frame[1], &apdu[58], 2);
+    TEST_ASSERT_EQUAL(5, transceive(frame, 3));
+    frame_check((uint8_t[]){ 0x02, 0xCA, 0xFE, 0x90, 0x00 }, 5);
+
+    TEST_ASSERT_EQUAL(1, m_evt_count[NRFX_NFCT_T4T_EVT_APDU]);
+    TEST_ASSERT_EQUAL(sizeof(apdu), m_apdu_size);
+    TEST_ASSERT(memcmp(apdu, m_apdu, sizeof(apdu)) == 0);
+    t4t_stop();
+}
+
+static void test_wtx(void)
+{
+    uint8_t const resp[] = { 0x6A, 0x82 };
+    uint8_t const wtx[]  = { 0xF2, 0x01 };
+
+    t4t_start();
+    activate(8);
+
+    // Another application, passed to the user, who does not answer at once.
+    TEST_ASSERT_EQUAL(2, transceive((uint8_t[]){ 0x02, 0x00, 0xA4, 0x04, 0x00, 0x02, 0xA0, 0x00 }, 8));
+    frame_check(wtx, sizeof(wtx));
+    TEST_ASSERT_EQUAL(1, m_evt_count[NRFX_NFCT_T4T_EVT_APDU]);
+
+    TEST_ASSERT_EQUAL(2, transceive(wtx, sizeof(wtx)));
+    frame_check(wtx, sizeof(wtx));
+
+    TEST_ASSERT_EQUAL(NRFX_SUCCESS, nrfx_nfct_t4t_response_set(resp, sizeof(resp)));
+    TEST_ASSERT_EQUAL(NRFX_ERROR_INVALID_STATE, nrfx_nfct_t4t_response_set(resp, sizeof(resp)));
+    TEST_ASSERT_EQUAL(3, transceive(wtx, sizeof(wtx)));
+    frame_check((uint8_t[]){ 0x02, 0x6A, 0x82 }, 3);
+    TEST_ASSERT_EQUAL(NRFX_ERROR_INVALID_STATE, nrfx_nfct_t4t_response_set(resp, sizeof(resp)));
+    t4t_stop();
+}
+
+static void test_status_words(void)
+{
+    uint8_t select_app[sizeof(m_select_app)];
+    uint8_t pcb = 0x02;
+
+    memcpy(select_app, m_select_app, sizeof(select_app));
+
+    t4t_start();
+    activate(8);
+
+    // The NDEF application is selected as the first or only occurrence only.
+    select_app[3] = 0x02;
+    apdu_check(pcb, select_app, sizeof(select_app), 0x6A86);
+    pcb ^= 1;
+    // Data longer than Lc and Le.
+    apdu_check(pcb, (uint8_t[]){ 0x00, 0xA4, 0x00, 0x0C, 0x02, 0xE1, 0x03, 0x00, 0x00 }, 9, 0x6700);
+    pcb ^= 1;
+    apdu_check(pcb, m_select_app, sizeof(m_select_app), 0x9000);
+    pcb ^= 1;
+    apdu_check(pcb, (uint8_t[]){ 0x00, 0xB0, 0x00, 0x00, 0x0F }, 5, 0x6A82);
+    pcb ^= 1;
+    apdu_check(pcb, (uint8_t[]){ 0x00, 0xA4, 0x00, 0x0C, 0x02, 0xE1, 0x05 }, 7, 0x6A82);
+    pcb ^= 1;
+    apdu_check(pcb, (uint8_t[]){ 0x90, 0xB0, 0x00, 0x00, 0x0F }, 5, 0x6E00);
+    pcb ^= 1;
+    apdu_check(pcb, (uint8_t[]){ 0x00, 0xCA, 0x00, 0x00, 0x00 }, 5, 0x6D00);
+    pcb ^= 1;
+    apdu_check(pcb, (uint8_t[]){ 0x00, 0xD6, 0x00, 0x00, 0x01, 0x00 }, 6, 0x6982);
+    pcb ^= 1;
+    apdu_check(pcb, (uint8_t[]){ 0x00, 0xB0 }, 2, 0x6700);
+    TEST_ASSERT_EQUAL(0, m_evt_count[NRFX_NFCT_T4T_EVT_APDU]);
+    t4t_stop();
+}
+
+static void test_invalid_frames(void)
+{
+    t4t_start();
+
+    // RATS with the RFU CID 15 and other frames are not answered before activation.
+    TEST_ASSERT_EQUAL(0, transceive((uint8_t[]){ 0xE0, 0x8F }, 2));
+    TEST_ASSERT_EQUAL(0, transceive((uint8_t[]){ 0x02, 0x00 }, 2));
+    TEST_ASSERT_EQUAL(0, m_evt_count[NRFX_NFCT_T4T_EVT_ACTIVATED]);
+    activate(8);
+
+    // Neither CID nor NAD is supported, and RATS is not answered after activation.
+    TEST_ASSERT_EQUAL(0, transceive((uint8_t[]){ 0x0A, 0x00, 0x00, 0xA4, 0x04, 0x00 }, 6));
+    TEST_ASSERT_EQUAL(0, transceive((uint8_t[]){ 0x06, 0x00, 0x00, 0xA4, 0x04, 0x00 }, 6));
+    TEST_ASSERT_EQUAL(0, transceive((uint8_t[]){ 0xE0, 0x80 }, 2));
+    TEST_ASSERT(m_rx_enabled);
+
+    // The block number still starts from the activation.
+    apdu_check(0x02, m_select_app, sizeof(m_select_app), 0x9000);
+    t4t_stop();
+}
+
+static void test_deselect(void)
+{
+    t4t_start();
+    activate(8);
+
+    TEST_ASSERT_EQUAL(1, transceive((uint8_t[]){ 0xC2 }, 1));
+    frame_check((uint8_t[]){ 0xC2 }, 1);
+    TEST_ASSERT(m_sleep);
+    TEST_ASSERT_EQUAL(1, m_evt_count[NRFX_NFCT_T4T_EVT_DESELECTED]);
+
+    // The reader selects the tag again and activates it with a new RATS.
+    NRF_NFCT->EVENTS_SELECTED = 1;
+    nfct_irq();
+    m_evt_count[NRFX_NFCT_T4T_EVT_ACTIVATED] = 0;
+    activate(8);
+    apdu_check(0x02, m_select_app, sizeof(m_select_app), 0x9000);
+    t4t_stop();
+}
+
+int main(void)
+{
+    TEST_RUN(test_ndef_read);
+    TEST_RUN(test_response_chaining);
+    TEST_RUN(test_command_chaining);
+    TEST_RUN(test_wtx);
+    TEST_RUN(test_status_words);
+    TEST_RUN(test_invalid_frames);
+    TEST_RUN(test_deselect);
+    return 0;
+}
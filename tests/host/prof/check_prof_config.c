@@ -0,0 +1,13 @@
+/*
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Only compiled. The profiling configuration checks of the 802.15.4 radio
+ * driver are evaluated when its peripheral and debug headers are included.
+ */
+
+#include "nrf_802154_peripherals.h"
+
+nrf_802154_prof_region_define(m_prof_check);
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Checks the region statistics of nrfx_prof on the host time source, and that
+ * the interrupt handlers of SPIM instances are accounted in separate regions.
+ * The driver source is included to reach its static region descriptors.
+ */
+
+#include <string.h>
+#include "../../../nrfx/drivers/src/nrfx_spim.c"
+#include "host_test.h"
+
+#define SPIM1_IRQn SPIM1_SPIS1_TWIM1_TWIS1_SPI1_TWI1_IRQn
+#define SPIM2_IRQn SPIM2_SPIS2_SPI2_IRQn
+
+NRFX_PROF_REGION_DEFINE(m_region);
+
+static void spin_us(uint32_t us)
+{
+    uint32_t start = nrfx_prof_ticks_get();
+
+    while ((nrfx_prof_ticks_get() - start) < us * NRFX_PROF_TICKS_PER_US)
+    {}
+}
+
+static void test_region(void)
+{
+    char line[128];
+
+    nrfx_prof_region_reset(&m_region);
+    TEST_ASSERT_EQUAL(0, nrfx_prof_region_mean_get(&m_region));
+
+    NRFX_PROF_BEGIN(m_region);
+    spin_us(100);
+    NRFX_PROF_END(m_region);
+    NRFX_PROF_BEGIN(m_region);
+    spin_us(300);
+    NRFX_PROF_END(m_region);
+
+    TEST_ASSERT_EQUAL(2, m_region.count);
+    TEST_ASSERT(m_region.min >= 100 * NRFX_PROF_TICKS_PER_US);
+    TEST_ASSERT(m_region.max >= 300 * NRFX_PROF_TICKS_PER_US);
+    TEST_ASSERT(m_region.min < m_region.max);
+    TEST_ASSERT_EQUAL((m_region.min + m_region.max) / 2, nrfx_prof_region_mean_get(&m_region));
+
+    snprintf(line, sizeof(line), NRFX_PROF_REPORT_FMT, NRFX_PROF_REPORT_ARGS(m_region));
+    TEST_ASSERT(strncmp(line, "nrfx_prof,m_region,2,", strlen("nrfx_prof,m_region,2,")) == 0);
+    TEST_ASSERT(strcmp(strrchr(line, ',') + 1, "1000") == 0);
+
+    nrfx_prof_region_reset(&m_region);
+    TEST_ASSERT_EQUAL(0, m_region.count);
+    TEST_ASSERT_EQUAL(UINT32_MAX, m_region.min);
+}
+
+static void test_spim_instances(void)
+{
+    // The handlers run with no event pending and leave the instances untouched.
+    host_irq_call(SPIM1_IRQn, nrfx_spim_1_irq_handler);
+    host_irq_call(SPIM1_IRQn, nrfx_spim_1_irq_handler);
+    host_irq_call(SPIM2_IRQn, nrfx_spim_2_irq_handler);
+
+    TEST_ASSERT_EQUAL(2, m_prof_spim1_irq.count);
+    TEST_ASSERT_EQUAL(1, m_prof_spim2_irq.count);
+    TEST_ASSERT(strcmp("m_prof_spim1_irq", m_prof_spim1_irq.p_name) == 0);
+    TEST_ASSERT(strcmp("m_prof_spim2_irq", m_prof_spim2_irq.p_name) == 0);
+}
+
+int main(void)
+{
+    host_periph_init();
+    NRFX_PROF_INIT();
+
+    TEST_RUN(test_region);
+    TEST_RUN(test_spim_instances);
+    return 0;
+}
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Host benchmark of the software timer service. It measures the cost of the
+ * heap operations with thousands of running timers. The absolute numbers are
+ * those of the host CPU and only the scaling with the number of timers carries
+ * over to the device.
+ */
+
+#include <time.h>
+#include <nrfx_rtc_timer.h>
+#include "host_rtc.h"
+#include "host_test.h"
+
+#define TIMERS_MAX NRFX_RTC_TIMER_CONFIG_MAX_TIMERS
+#define SPAN       (1UL << 20)
+
+static host_rtc_t       m_rtc;
+static nrfx_rtc_timer_t m_timers[TIMERS_MAX];
+static uint32_t         m_expirations;
+
+static void timer_handler(void * p_context)
+{
+    (void)p_context;
+    m_expirations++;
+}
+
+static uint64_t ns_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static void service_init(uint32_t tolerance)
+{
+    nrfx_rtc_timer_config_t config = {
+        .rtc        = NRFX_RTC_INSTANCE(0),
+        .rtc_config = NRFX_RTC_DEFAULT_CONFIG,
+        .channel    = 0,
+        .tolerance  = tolerance,
+    };
+
+    m_rtc = (host_rtc_t){
+        .p_reg    = NRF_RTC0,
+        .irq      = RTC0_IRQn,
+        .handler  = nrfx_rtc_0_irq_handler,
+        .cc_count = NRF_RTC_CC_CHANNEL_COUNT(0),
+    };
+    m_expirations = 0;
+    TEST_ASSERT_EQUAL(NRFX_SUCCESS, nrfx_rtc_timer_init(&config));
+    for (size_t i = 0; i < TIMERS_MAX; i++)
+    {
+        nrfx_rtc_timer_setup(&m_timers[i], timer_handler, NULL);
+    }
+}
+
+static void bench(uint32_t count)
+{
+    uint64_t start_ns, restart_ns, expire_ns, t;
+
+    // All timers expire in one interrupt, so the expiration measures the heap only.
+    host_periph_reset();
+    service_init(SPAN);
+    srand(count);
+
+    // Register writes are not trapped while the heap operations are measured.
+    host_periph_trap_enable(false);
+    t = ns_now();
+    for (uint32_t i = 0; i < count; i++)
+    {
+        nrfx_rtc_timer_start(&m_timers[i], 1000 + (uint64_t)(rand() % SPAN), 0);
+    }
+    start_ns = ns_now() - t;
+
+    t = ns_now();
+    for (uint32_t i = 0; i < count; i++)
+    {
+        nrfx_rtc_timer_start(&m_timers[rand() % count], 1000 + (uint64_t)(rand() % SPAN), 0);
+    }
+    restart_ns = ns_now() - t;
+
+    // The untrapped register writes left the model out of sync. Restarting the earliest
+    // timer rearms the compare channel with the trap enabled.
+    host_periph_trap_enable(true);
+    nrfx_rtc_timer_t * p_first = &m_timers[0];
+    for (uint32_t i = 1; i < count; i++)
+    {
+        p_first = (m_timers[i].deadline < p_first->deadline) ? &m_timers[i] : p_first;
+    }
+    nrfx_rtc_timer_start(p_first, p_first->deadline, 0);
+
+    // The expiration only clears events, which needs no trap either.
+    host_periph_trap_enable(false);
+    t = ns_now();
+    host_rtc_advance(&m_rtc, 1000 + SPAN);
+    expire_ns = ns_now() - t;
+    host_periph_trap_enable(true);
+    TEST_ASSERT_EQUAL(count, m_expirations);
+    TEST_ASSERT_EQUAL(1, m_rtc.irq_count);
+    nrfx_rtc_timer_uninit();
+
+    printf("%5u timers: start %6.1f ns, restart %6.1f ns, expire %6.1f ns per timer\n",
+           count, (double)start_ns / count, (double)restart_ns / count,
+           (double)expire_ns / count);
+}
+
+static void bench_periodic(uint32_t count)
+{
+    uint64_t const duration = 2 * 32768;
+
+    // Periodic timers with periods of 10 ms to 1 s, expiring in batches of 1 ms. The time
+    // spent here is dominated by the register trap, so only the batching is reported.
+    host_periph_reset();
+    service_init(32);
+    srand(count);
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        nrfx_rtc_timer_start(&m_timers[i], 100, 327 + (uint32_t)(rand() % 32441));
+    }
+    host_rtc_advance(&m_rtc, duration);
+    nrfx_rtc_timer_uninit();
+
+    printf("%5u periodic timers: %u expirations in %u interrupts over 2 s, "
+           "%.2f expirations per interrupt\n",
+           count, m_expirations, m_rtc.irq_count, (double)m_expirations / m_rtc.irq_count);
+}
+
+int main(void)
+{
+    host_periph_init();
+
+    for (uint32_t count = 256; count <= TIMERS_MAX; count *= 4)
+    {
+        bench(count);
+    }
+    bench_periodic(TIMERS_MAX);
+    return 0;
+}
@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <nrfx_rtc_timer.h>
+#include "host_rtc.h"
+#include "host_test.h"
+
+#define CHANNEL   1
+#define TOLERANCE 4
+#define TIMERS    NRFX_RTC_TIMER_CONFIG_MAX_TIMERS
+
+typedef struct
+{
+    nrfx_rtc_timer_t timer;
+    uint32_t         expirations;
+    uint64_t         last_time;
+} test_timer_t;
+
+static host_rtc_t   m_rtc;
+static test_timer_t m_timers[TIMERS];
+static uint64_t     m_last_deadline;
+static bool         m_in_order;
+
+static void timer_handler(void * p_context)
+{
+    test_timer_t * p_test = p_context;
+    uint64_t       now    = nrfx_rtc_timer_now();
+
+    p_test->expirations++;
+    p_test->last_time = now;
+
+    // Timers expire in the order of their deadlines, never earlier than the tolerance allows.
+    if (p_test->timer.period == 0)
+    {
+        TEST_ASSERT(p_test->timer.deadline <= now + TOLERANCE);
+        m_in_order = m_in_order && (p_test->timer.deadline >= m_last_deadline);
+        m_last_deadline = p_test->timer.deadline;
+    }
+}
+
+static void service_init(void)
+{
+    nrfx_rtc_timer_config_t config = {
+        .rtc        = NRFX_RTC_INSTANCE(0),
+        .rtc_config = NRFX_RTC_DEFAULT_CONFIG,
+        .channel    = CHANNEL,
+        .tolerance  = TOLERANCE,
+    };
+
+    m_rtc = (host_rtc_t){
+        .p_reg    = NRF_RTC0,
+        .irq      = RTC0_IRQn,
+        .handler  = nrfx_rtc_0_irq_handler,
+        .cc_count = NRF_RTC_CC_CHANNEL_COUNT(0),
+    };
+    m_last_deadline = 0;
+    m_in_order      = true;
+
+    TEST_ASSERT_EQUAL(NRFX_SUCCESS, nrfx_rtc_timer_init(&config));
+    for (size_t i = 0; i < TIMERS; i++)
+    {
+        m_timers[i] = (test_timer_t){ 0 };
+        nrfx_rtc_timer_setup(&m_timers[i].timer, timer_handler, &m_timers[i]);
+    }
+}
+
+static void test_single_shot(void)
+{
+    service_init();
+
+    TEST_ASSERT_EQUAL(NRFX_SUCCESS, nrfx_rtc_timer_start(&m_timers[0].timer, 1000, 0));
+    TEST_ASSERT(nrfx_rtc_timer_is_running(&m_timers[0].timer));
+
+    host_rtc_advance(&m_rtc, 999 - TOLERANCE - 1);
+    TEST_ASSERT_EQUAL(0, m_timers[0].expirations);
+    host_rtc_advance(&m_rtc, 10);
+    TEST_ASSERT_EQUAL(1, m_timers[0].expirations);
+    TEST_ASSERT_EQUAL(1000, m_timers[0].last_time);
+    TEST_ASSERT(!nrfx_rtc_timer_is_running(&m_timers[0].timer));
+
+    // A deadline in the past expires as soon as possible.
+    TEST_ASSERT_EQUAL(NRFX_SUCCESS, nrfx_rtc_timer_start(&m_timers[0].timer, 10, 0));
+    host_rtc_advance(&m_rtc, 10);
+    TEST_ASSERT_EQUAL(2, m_timers[0].expirations);
+
+    nrfx_rtc_timer_uninit();
+}
+
+static void test_order_and_batching(void)
+{
+    service_init();
+    srand(1);
+
+    for (size_t i = 0; i < TIMERS; i++)
+    {
+        uint64_t deadline = 100 + (uint64_t)(rand() % 100000);
+        TEST_ASSERT_EQUAL(NRFX_SUCCESS, nrfx_rtc_timer_start(&m_timers[i].timer, deadline, 0));
+    }
+    TEST_ASSERT_EQUAL(NRFX_ERROR_NO_MEM,
+                      nrfx_rtc_timer_start(&(nrfx_rtc_timer_t){ .handler = timer_handler,
+                                                                .heap_idx =
+                                                                    NRFX_RTC_TIMER_IDX_INVALID },
+                                           1, 0));
+
+    host_rtc_advance(&m_rtc, 200000);
+    for (size_t i = 0; i < TIMERS; i++)
+    {
+        TEST_ASSERT_EQUAL(1, m_timers[i].expirations);
+    }
+    TEST_ASSERT(m_in_order);
+
+    // Timers due within the tolerance window share an interrupt. With the deadlines
+    // spread over 100000 ticks, there are far fewer interrupts than timers.
+    printf("%u timers expired in %u interrupts\n", TIMERS, m_rtc.irq_count);
+    TEST_ASSERT(m_rtc.irq_count < TIMERS);
+
+    nrfx_rtc_timer_uninit();
+}
+
+static void test_batch_within_tolerance(void)
+{
+    service_init();
+
+    for (size_t i = 0; i <= TOLERANCE; i++)
+    {
+        nrfx_rtc_timer_start(&m_timers[i].timer, 500 + i, 0);
+    }
+    nrfx_rtc_timer_start(&m_timers[TOLERANCE + 1].timer, 500 + 2 * TOLERANCE + 2, 0);
+
+    host_rtc_advance(&m_rtc, 500);
+    for (size_t i = 0; i <= TOLERANCE; i++)
+    {
+        TEST_ASSERT_EQUAL(1, m_timers[i].expirations);
+        TEST_ASSERT_EQUAL(m_timers[0].last_time, m_timers[i].last_time);
+    }
+    TEST_ASSERT_EQUAL(0, m_timers[TOLERANCE + 1].expirations);
+
+    nrfx_rtc_timer_uninit();
+}
+
+static void test_periodic_without_drift(void)
+{
+    uint32_t const period = 327;
+
+    service_init();
+
+    TEST_ASSERT_EQUAL(NRFX_SUCCESS, nrfx_rtc_timer_start(&m_timers[0].timer, 1000, period));
+    for (uint32_t n = 1; n <= 1000; n++)
+    {
+        host_rtc_advance(&m_rtc, (n == 1) ? 1000 : period);
+        TEST_ASSERT_EQUAL(n, m_timers[0].expirations);
+        TEST_ASSERT_EQUAL(1000 + (uint64_t)n * period, m_timers[0].timer.deadline);
+    }
+
+    // A periodic timer handled late skips the missed periods and keeps its phase.
+    nrfx_rtc_timer_stop(&m_timers[0].timer);
+    uint64_t deadline = m_timers[0].timer.deadline;
+    host_rtc_advance(&m_rtc, 10 * period + 5);
+    nrfx_rtc_timer_start(&m_timers[0].timer, deadline, period);
+    host_rtc_advance(&m_rtc, TOLERANCE);
+    TEST_ASSERT_EQUAL(1001, m_timers[0].expirations);
+    TEST_ASSERT_EQUAL(deadline + 10 * (uint64_t)period, m_timers[0].timer.deadline);
+
+    nrfx_rtc_timer_uninit();
+}
+
+static void test_long_deadlines(void)
+{
+    // Deadlines beyond the range of the 24-bit hardware counter.
+    uint64_t const far = 3 * (uint64_t)(RTC_COUNTER_COUNTER_Msk + 1) + 12345;
+
+    service_init();
+
+    nrfx_rtc_timer_start(&m_timers[0].timer, far, 0);
+    nrfx_rtc_timer_start(&m_timers[1].timer, far + RTC_COUNTER_COUNTER_Msk, 0);
+    host_rtc_advance(&m_rtc, far - 2 * TOLERANCE);
+    TEST_ASSERT_EQUAL(0, m_timers[0].expirations);
+    host_rtc_advance(&m_rtc, 2 * TOLERANCE);
+    TEST_ASSERT_EQUAL(1, m_timers[0].expirations);
+    TEST_ASSERT_EQUAL(far, m_timers[0].last_time);
+    host_rtc_advance(&m_rtc, RTC_COUNTER_COUNTER_Msk);
+    TEST_ASSERT_EQUAL(1, m_timers[1].expirations);
+    TEST_ASSERT_EQUAL(far + RTC_COUNTER_COUNTER_Msk, m_timers[1].last_time);
+
+    nrfx_rtc_timer_uninit();
+}
+
+static void test_stop_and_restart(void)
+{
+    service_init();
+
+    nrfx_rtc_timer_start(&m_timers[0].timer, 100, 0);
+    nrfx_rtc_timer_start(&m_timers[1].timer, 200, 0);
+    nrfx_rtc_timer_stop(&m_timers[0].timer);
+    TEST_ASSERT(!nrfx_rtc_timer_is_running(&m_timers[0].timer));
+
+    // Restarting the earliest timer with a later deadline rearms the compare channel.
+    nrfx_rtc_timer_start(&m_timers[1].timer, 300, 0);
+    host_rtc_advance(&m_rtc, 250);
+    TEST_ASSERT_EQUAL(0, m_timers[0].expirations);
+    TEST_ASSERT_EQUAL(0, m_timers[1].expirations);
+    host_rtc_advance(&m_rtc, 50);
+    TEST_ASSERT_EQUAL(1, m_timers[1].expirations);
+
+    nrfx_rtc_timer_uninit();
+}
+
+int main(void)
+{
+    host_periph_init();
+
+    TEST_RUN(test_single_shot);
+    TEST_RUN(test_order_and_batching);
+    TEST_RUN(test_batch_within_tolerance);
+    TEST_RUN(test_periodic_without_drift);
+    TEST_RUN(test_long_deadlines);
+    TEST_RUN(test_stop_and_restart);
+    return 0;
+}
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Host benchmark of the receive buffers of the 802.15.4 radio driver. It
+ * reports how many frames of a typical mix can be queued per kilobyte of
+ * buffer RAM, and the cost of taking and releasing a frame, which includes
+ * the copy to a short buffer. The program is built with full-size buffers
+ * only and with short buffers, for about the same RAM. The RAM figures carry
+ * over to the device, the times are those of the host CPU.
+ */
+
+#include <time.h>
+#include "../../../drivers/nrf_radio_802154/nrf_802154_rx_buffer.c"
+#include "host_test.h"
+
+#define RUNS 1000000
+
+/* PSDU lengths of the frame mix: 60% ACKs, 20% data requests, 10% short MAC commands
+ * and 10% data frames. */
+static const uint8_t m_mix[] = { 5, 5, 5, 5, 5, 5, 18, 18, 12, 90 };
+
+static uint64_t ns_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static size_t ram_size(void)
+{
+    size_t size = sizeof(nrf_802154_rx_buffers);
+#if NRF_802154_RX_SHORT_BUFFERS > 0
+    size += sizeof(m_rx_short_buffers);
+#endif
+    return size;
+}
+
+static uint8_t * frame_receive(rx_buffer_t * p_buffer, uint8_t psdu_length)
+{
+    p_buffer->data[PHR_OFFSET] = psdu_length;
+    return nrf_802154_rx_buffer_frame_take(p_buffer);
+}
+
+/* Frames are received until no buffer is left for the next one. */
+static void bench_queue(void)
+{
+    uint32_t      frames = 0;
+    rx_buffer_t * p_buffer;
+
+    nrf_802154_rx_buffer_init();
+    while ((p_buffer = nrf_802154_rx_buffer_free_find()) != NULL)
+    {
+        (void)frame_receive(p_buffer, m_mix[frames % sizeof(m_mix)]);
+        frames++;
+    }
+
+    printf("%u full-size and %u short buffers of %u bytes: %zu bytes, "
+           "%u frames of the mix queued, %.1f frames per KB\n",
+           NRF_802154_RX_BUFFERS, NRF_802154_RX_SHORT_BUFFERS, NRF_802154_RX_SHORT_BUFFER_SIZE,
+           ram_size(), frames, frames * 1024.0 / ram_size());
+}
+
+static void bench_take(uint8_t psdu_length)
+{
+    uint64_t t;
+
+    nrf_802154_rx_buffer_init();
+    t = ns_now();
+    for (uint32_t i = 0; i < RUNS; i++)
+    {
+        rx_buffer_t * p_buffer = nrf_802154_rx_buffer_free_find();
+
+        (void)nrf_802154_rx_buffer_release(frame_receive(p_buffer, psdu_length));
+    }
+    t = ns_now() - t;
+
+    printf("PSDU of %3u bytes: %5.1f ns per frame taken and released, %.1f Mframes/s\n",
+           psdu_length, (double)t / RUNS, RUNS * 1000.0 / t);
+}
+
+int main(void)
+{
+    bench_queue();
+    bench_take(IMM_ACK_LENGTH);
+    bench_take(NRF_802154_RX_SHORT_BUFFER_SIZE - PHR_SIZE);
+    bench_take(MAX_PACKET_SIZE);
+    return 0;
+}
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Checks the receive buffers of the 802.15.4 radio driver. The program is built
+ * with full-size buffers only, and with short buffers to which short frames are
+ * moved when they are taken, and once without the cache of the IE index.
+ */
+
+#include <string.h>
+#include "nrf_802154_rx_buffer.h"
+#include "../frame_parser/thread_frames.h"
+#include "host_test.h"
+
+static rx_buffer_t * frame_receive(uint8_t psdu_length)
+{
+    rx_buffer_t * p_buffer = nrf_802154_rx_buffer_free_find();
+
+    TEST_ASSERT(p_buffer);
+    p_buffer->data[PHR_OFFSET] = psdu_length;
+    for (uint32_t i = 1; i <= psdu_length; i++)
+    {
+        p_buffer->data[i] = (uint8_t)(psdu_length + i);
+    }
+    return p_buffer;
+}
+
+static void frame_check(const uint8_t * p_data, uint8_t psdu_length)
+{
+    TEST_ASSERT_EQUAL(psdu_length, p_data[PHR_OFFSET]);
+    for (uint32_t i = 1; i <= psdu_length; i++)
+    {
+        TEST_ASSERT_EQUAL((uint8_t)(psdu_length + i), p_data[i]);
+    }
+}
+
+static void test_long_frame(void)
+{
+    nrf_802154_rx_buffer_init();
+
+    rx_buffer_t * p_buffer = frame_receive(MAX_PACKET_SIZE);
+    uint8_t *     p_data   = nrf_802154_rx_buffer_frame_take(p_buffer);
+
+    // Long frames stay in the buffer they were received to.
+    TEST_ASSERT(p_data == p_buffer->data);
+    TEST_ASSERT(!p_buffer->free);
+    TEST_ASSERT(nrf_802154_rx_buffer_is_taken(p_data));
+    frame_check(p_data, MAX_PACKET_SIZE);
+
+    TEST_ASSERT(nrf_802154_rx_buffer_release(p_data) == p_buffer);
+    TEST_ASSERT(p_buffer->free);
+    TEST_ASSERT(!nrf_802154_rx_buffer_is_taken(p_data));
+}
+
+#if NRF_802154_RX_SHORT_BUFFERS > 0
+
+static void test_short_frame(void)
+{
+    uint8_t psdu_length = NRF_802154_RX_SHORT_BUFFER_SIZE - PHR_SIZE;
+
+    nrf_802154_rx_buffer_init();
+
+    rx_buffer_t * p_buffer = frame_receive(psdu_length);
+    uint8_t *     p_data   = nrf_802154_rx_buffer_frame_take(p_buffer);
+
+    // The frame was moved and the full-size buffer can receive the next frame.
+    TEST_ASSERT(p_data != p_buffer->data);
+    TEST_ASSERT(p_buffer->free);
+    TEST_ASSERT(nrf_802154_rx_buffer_free_find() == p_buffer);
+    TEST_ASSERT(nrf_802154_rx_buffer_is_taken(p_data));
+    frame_check(p_data, psdu_length);
+
+    TEST_ASSERT(nrf_802154_rx_buffer_release(p_data) == NULL);
+    TEST_ASSERT(!nrf_802154_rx_buffer_is_taken(p_data));
+
+    // One byte longer does not fit.
+    p_buffer = frame_receive(psdu_length + 1);
+    p_data   = nrf_802154_rx_buffer_frame_take(p_buffer);
+    TEST_ASSERT(p_data == p_buffer->data);
+    TEST_ASSERT(nrf_802154_rx_buffer_release(p_data) == p_buffer);
+}
+
+static void test_short_buffers_exhausted(void)
+{
+    uint8_t * p_frames[NRF_802154_RX_SHORT_BUFFERS + 1];
+
+    nrf_802154_rx_buffer_init();
+
+    // All short frames share one full-size buffer until the short buffers run out.
+    rx_buffer_t * p_first = nrf_802154_rx_buffer_free_find();
+    for (uint32_t i = 0; i < NRF_802154_RX_SHORT_BUFFERS; i++)
+    {
+        p_frames[i] = nrf_802154_rx_buffer_frame_take(frame_receive(IMM_ACK_LENGTH));
+        TEST_ASSERT(nrf_802154_rx_buffer_free_find() == p_first);
+    }
+    p_frames[NRF_802154_RX_SHORT_BUFFERS] =
+        nrf_802154_rx_buffer_frame_take(frame_receive(IMM_ACK_LENGTH));
+    TEST_ASSERT(p_frames[NRF_802154_RX_SHORT_BUFFERS] == p_first->data);
+    TEST_ASSERT(nrf_802154_rx_buffer_free_find() != p_first);
+
+    for (uint32_t i = 0; i <= NRF_802154_RX_SHORT_BUFFERS; i++)
+    {
+        frame_check(p_frames[i], IMM_ACK_LENGTH);
+        (void)nrf_802154_rx_buffer_release(p_frames[i]);
+    }
+    TEST_ASSERT(nrf_802154_rx_buffer_free_find() == p_first);
+}
+
+#endif // NRF_802154_RX_SHORT_BUFFERS > 0
+
+static void test_all_buffers_taken(void)
+{
+    uint8_t * p_frames[NRF_802154_RX_BUFFERS];
+
+    nrf_802154_rx_buffer_init();
+    for (uint32_t i = 0; i < NRF_802154_RX_BUFFERS; i++)
+    {
+        p_frames[i] = nrf_802154_rx_buffer_frame_take(frame_receive(MAX_PACKET_SIZE));
+    }
+    TEST_ASSERT(nrf_802154_rx_buffer_free_find() == NULL);
+
+    (void)nrf_802154_rx_buffer_release(p_frames[2]);
+    TEST_ASSERT(nrf_802154_rx_buffer_free_find() == (rx_buffer_t *)p_frames[2]);
+}
+
+static void ie_index_check(const uint8_t * p_data, uint8_t csl_offset, uint8_t time_correction_offset)
+{
+    nrf_802154_frame_parser_ie_index_t index;
+
+    nrf_802154_rx_buffer_ie_index_get(p_data, &index);
+    TEST_ASSERT_EQUAL(csl_offset, index.csl.offset);
+    TEST_ASSERT_EQUAL(time_correction_offset, index.time_correction.offset);
+    TEST_ASSERT_EQUAL(ENH_ACK_LINK_METRICS_OFFSET, index.link_metrics.offset);
+}
+
+static void ie_index_test(uint8_t psdu_length)
+{
+    nrf_802154_rx_buffer_init();
+
+    rx_buffer_t * p_buffer = nrf_802154_rx_buffer_free_find();
+    uint8_t *     p_data;
+
+    memset(p_buffer->data, 0, sizeof(p_buffer->data));
+    memcpy(p_buffer->data, m_enh_ack, sizeof(m_enh_ack));
+    p_buffer->data[PHR_OFFSET] = psdu_length;
+    p_data                     = nrf_802154_rx_buffer_frame_take(p_buffer);
+    ie_index_check(p_data, ENH_ACK_CSL_OFFSET, 0);
+
+    // The CSL IE is changed to a Time Correction IE. The index is only built again without
+    // the cache.
+    p_data[ENH_ACK_CSL_OFFSET - 1] = (IE_TIME_CORRECTION_ID << IE_HEADER_ELEMENT_ID_SHIFT) >> 8;
+#if NRF_802154_RX_IE_INDEX_CACHE_ENABLED
+    ie_index_check(p_data, ENH_ACK_CSL_OFFSET, 0);
+#else
+    ie_index_check(p_data, 0, ENH_ACK_CSL_OFFSET);
+#endif
+
+    // The next frame taken to the buffer is indexed again.
+    (void)nrf_802154_rx_buffer_release(p_data);
+    p_buffer = nrf_802154_rx_buffer_free_find();
+    p_buffer->data[ENH_ACK_CSL_OFFSET - 1] = (IE_TIME_CORRECTION_ID << IE_HEADER_ELEMENT_ID_SHIFT) >> 8;
+    p_data = nrf_802154_rx_buffer_frame_take(p_buffer);
+    ie_index_check(p_data, 0, ENH_ACK_CSL_OFFSET);
+    (void)nrf_802154_rx_buffer_release(p_data);
+}
+
+static void test_ie_index(void)
+{
+    // The Enhanced ACK fits in a short buffer. It is also padded to stay in the full-size buffer.
+    ie_index_test(m_enh_ack[PHR_OFFSET]);
+    ie_index_test(MAX_PACKET_SIZE);
+}
+
+int main(void)
+{
+    TEST_RUN(test_long_frame);
+#if NRF_802154_RX_SHORT_BUFFERS > 0
+    TEST_RUN(test_short_frame);
+    TEST_RUN(test_short_buffers_exhausted);
+#endif
+    TEST_RUN(test_all_buffers_taken);
+    TEST_RUN(test_ie_index);
+    return 0;
+}
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Checks that the idle manager disables SPIM between transfers, but keeps it
+ * enabled after transfers that are to be restarted through (D)PPI.
+ */
+
+#include <stddef.h>
+#include <nrfx_spim.h>
+#include <nrfx_idle.h>
+#include "host_test.h"
+
+#define SPIM_IRQn SPIM1_SPIS1_TWIM1_TWIS1_SPI1_TWI1_IRQn
+
+static nrfx_spim_t const m_spim = NRFX_SPIM_INSTANCE(1);
+static uint32_t          m_time;
+static uint32_t          m_xfer_done;
+
+// Transfers complete as soon as they are started.
+void nrf_model_task_triggered(nrf_model_periph_t const * p_periph, nrf_model_reg_t const * p_reg)
+{
+    if (p_reg->pair != 0xFFFF)
+    {
+        p_periph->p_mem[p_reg->pair / 4] = 1;
+    }
+    if ((p_periph->address == NRF_SPIM1_BASE) &&
+        (p_reg->offset == offsetof(NRF_SPIM_Type, TASKS_START)))
+    {
+        p_periph->p_mem[offsetof(NRF_SPIM_Type, EVENTS_END) / 4] = 1;
+    }
+}
+
+static uint32_t time_get(void)
+{
+    return m_time;
+}
+
+static void spim_handler(nrfx_spim_evt_t const * p_event, void * p_context)
+{
+    (void)p_context;
+    if (p_event->type == NRFX_SPIM_EVENT_DONE)
+    {
+        m_xfer_done++;
+    }
+}
+
+static nrfx_spim_xfer_desc_t xfer_desc(void)
+{
+    uint8_t * p_buf = host_ram_alloc(8);
+
+    return (nrfx_spim_xfer_desc_t)NRFX_SPIM_XFER_TRX(p_buf, 4, p_buf + 4, 4);
+}
+
+static void spim_init(nrfx_spim_evt_handler_t handler)
+{
+    nrfx_spim_config_t config = NRFX_SPIM_DEFAULT_CONFIG(3, 4, 5, NRFX_SPIM_PIN_NOT_USED);
+
+    // With no threshold, the peripheral is disabled after every transfer that allows it.
+    nrfx_idle_init(time_get, 0);
+    m_xfer_done = 0;
+    TEST_ASSERT_EQUAL(NRFX_SUCCESS, nrfx_spim_init(&m_spim, &config, handler, NULL));
+}
+
+static bool spim_enabled(void)
+{
+    return NRF_SPIM1->ENABLE == (SPIM_ENABLE_ENABLE_Enabled << SPIM_ENABLE_ENABLE_Pos);
+}
+
+static void end_irq(void)
+{
+    TEST_ASSERT(NRF_SPIM1->EVENTS_END);
+    host_irq_call(SPIM_IRQn, nrfx_spim_1_irq_handler);
+}
+
+static void test_disable_after_transfer(void)
+{
+    nrfx_spim_xfer_desc_t desc = xfer_desc();
+
+    spim_init(spim_handler);
+    TEST_ASSERT_EQUAL(NRFX_SUCCESS, nrfx_spim_xfer(&m_spim, &desc, 0));
+    TEST_ASSERT(spim_enabled());
+    end_irq();
+    TEST_ASSERT_EQUAL(1, m_xfer_done);
+    TEST_ASSERT(!spim_enabled());
+
+    // The next transfer enables the peripheral again.
+    m_time += 100;
+    TEST_ASSERT_EQUAL(NRFX_SUCCESS, nrfx_spim_xfer(&m_spim, &desc, 0));
+    TEST_ASSERT(spim_enabled());
+    end_irq();
+    TEST_ASSERT(!spim_enabled());
+    nrfx_spim_uninit(&m_spim);
+}
+
+static void test_keep_enabled_after_held_transfer(void)
+{
+    nrfx_spim_xfer_desc_t desc = xfer_desc();
+
+    spim_init(spim_handler);
+    TEST_ASSERT_EQUAL(NRFX_SUCCESS, nrfx_spim_xfer(&m_spim, &desc, NRFX_SPIM_FLAG_HOLD_XFER));
+    TEST_ASSERT(!NRF_SPIM1->EVENTS_END);
+
+    // Started through PPI, possibly several times.
+    for (int i = 1; i <= 3; i++)
+    {
+        NRF_SPIM1->TASKS_START = 1;
+        end_irq();
+        TEST_ASSERT_EQUAL(i, m_xfer_done);
+        TEST_ASSERT(spim_enabled());
+    }
+
+    // A regular transfer lets the peripheral be disabled again.
+    TEST_ASSERT_EQUAL(NRFX_SUCCESS, nrfx_spim_xfer(&m_spim, &desc, 0));
+    end_irq();
+    TEST_ASSERT(!spim_enabled());
+    nrfx_spim_uninit(&m_spim);
+}
+
+static void test_blocking_repeated_transfer(void)
+{
+    nrfx_spim_xfer_desc_t desc = xfer_desc();
+
+    spim_init(NULL);
+    TEST_ASSERT_EQUAL(NRFX_SUCCESS,
+                      nrfx_spim_xfer(&m_spim, &desc, NRFX_SPIM_FLAG_REPEATED_XFER));
+    TEST_ASSERT(spim_enabled());
+    TEST_ASSERT_EQUAL(NRFX_SUCCESS, nrfx_spim_xfer(&m_spim, &desc, 0));
+    TEST_ASSERT(!spim_enabled());
+    nrfx_spim_uninit(&m_spim);
+}
+
+int main(void)
+{
+    host_periph_init();
+
+    TEST_RUN(test_disable_after_transfer);
+    TEST_RUN(test_keep_enabled_after_held_transfer);
+    TEST_RUN(test_blocking_repeated_transfer);
+    return 0;
+}
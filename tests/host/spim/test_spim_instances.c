@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Checks the transfer paths of SPIM that are resolved at build time. The program
+ * is built with a single instance, for which the registers and the control block
+ * are folded, with two instances, for which they are taken from the instance
+ * structure, and with the blocking mode disabled.
+ */
+
+#include <stddef.h>
+#include <string.h>
+#include <nrfx_spim.h>
+#include "host_test.h"
+
+#define SPIM1_IRQn SPIM1_SPIS1_TWIM1_TWIS1_SPI1_TWI1_IRQn
+#define SPIM2_IRQn SPIM2_SPIS2_SPI2_IRQn
+
+static nrfx_spim_t const m_spim1 = NRFX_SPIM_INSTANCE(1);
+#if NRFX_CHECK(NRFX_SPIM2_ENABLED)
+static nrfx_spim_t const m_spim2 = NRFX_SPIM_INSTANCE(2);
+#endif
+static uint32_t          m_start_count[3];
+static uint32_t          m_xfer_done[3];
+
+// Transfers complete as soon as they are started.
+void nrf_model_task_triggered(nrf_model_periph_t const * p_periph, nrf_model_reg_t const * p_reg)
+{
+    if (p_reg->pair != 0xFFFF)
+    {
+        p_periph->p_mem[p_reg->pair / 4] = 1;
+    }
+    if (p_reg->offset == offsetof(NRF_SPIM_Type, TASKS_START))
+    {
+        if (p_periph->address == NRF_SPIM1_BASE)
+        {
+            m_start_count[1]++;
+        }
+        else if (p_periph->address == NRF_SPIM2_BASE)
+        {
+            m_start_count[2]++;
+        }
+        else
+        {
+            return;
+        }
+        p_periph->p_mem[offsetof(NRF_SPIM_Type, EVENTS_END) / 4] = 1;
+    }
+}
+
+static void spim_handler(nrfx_spim_evt_t const * p_event, void * p_context)
+{
+    if (p_event->type == NRFX_SPIM_EVENT_DONE)
+    {
+        m_xfer_done[(uintptr_t)p_context]++;
+    }
+}
+
+static nrfx_spim_xfer_desc_t xfer_desc(void)
+{
+    uint8_t * p_buf = host_ram_alloc(8);
+
+    return (nrfx_spim_xfer_desc_t)NRFX_SPIM_XFER_TRX(p_buf, 4, p_buf + 4, 4);
+}
+
+static nrfx_err_t spim_init(nrfx_spim_t const * p_spim, nrfx_spim_evt_handler_t handler)
+{
+    nrfx_spim_config_t config = NRFX_SPIM_DEFAULT_CONFIG(3, 4, 5, NRFX_SPIM_PIN_NOT_USED);
+
+    memset(m_start_count, 0, sizeof(m_start_count));
+    memset(m_xfer_done, 0, sizeof(m_xfer_done));
+    return nrfx_spim_init(p_spim, &config, handler, (void *)(uintptr_t)p_spim->drv_inst_idx);
+}
+
+static void test_handler_transfer(void)
+{
+    nrfx_spim_xfer_desc_t desc = xfer_desc();
+
+    TEST_ASSERT_EQUAL(NRFX_SUCCESS, spim_init(&m_spim1, spim_handler));
+    TEST_ASSERT_EQUAL(NRFX_SUCCESS, nrfx_spim_xfer(&m_spim1, &desc, 0));
+    TEST_ASSERT_EQUAL(1, m_start_count[1]);
+    TEST_ASSERT_EQUAL((uint32_t)(uintptr_t)desc.p_tx_buffer, NRF_SPIM1->TXD.PTR);
+    TEST_ASSERT_EQUAL(NRF_SPIM_INT_END_MASK, NRF_SPIM1->INTENSET & NRF_SPIM_INT_END_MASK);
+
+    // The transfer is in progress until the END interrupt.
+    TEST_ASSERT_EQUAL(NRFX_ERROR_BUSY, nrfx_spim_xfer(&m_spim1, &desc, 0));
+    host_irq_call(SPIM1_IRQn, nrfx_spim_1_irq_handler);
+    TEST_ASSERT_EQUAL(1, m_xfer_done[m_spim1.drv_inst_idx]);
+    TEST_ASSERT_EQUAL(NRFX_SUCCESS, nrfx_spim_xfer(&m_spim1, &desc, 0));
+    host_irq_call(SPIM1_IRQn, nrfx_spim_1_irq_handler);
+    TEST_ASSERT_EQUAL(2, m_xfer_done[m_spim1.drv_inst_idx]);
+
+    TEST_ASSERT_EQUAL(nrf_spim_task_address_get(NRF_SPIM1, NRF_SPIM_TASK_START),
+                      nrfx_spim_start_task_get(&m_spim1));
+    TEST_ASSERT_EQUAL(nrf_spim_event_address_get(NRF_SPIM1, NRF_SPIM_EVENT_END),
+                      nrfx_spim_end_event_get(&m_spim1));
+    nrfx_spim_uninit(&m_spim1);
+}
+
+#if NRFX_CHECK(NRFX_SPIM_BLOCKING_ENABLED)
+
+static void test_blocking_transfer(void)
+{
+    nrfx_spim_xfer_desc_t desc = xfer_desc();
+
+    TEST_ASSERT_EQUAL(NRFX_SUCCESS, spim_init(&m_spim1, NULL));
+    TEST_ASSERT_EQUAL(NRFX_SUCCESS, nrfx_spim_xfer(&m_spim1, &desc, 0));
+    TEST_ASSERT_EQUAL(1, m_start_count[1]);
+    // The transfer was polled and no interrupt is used.
+    TEST_ASSERT_EQUAL(0, NRF_SPIM1->INTENSET & NRF_SPIM_INT_END_MASK);
+    TEST_ASSERT_EQUAL(NRFX_SUCCESS, nrfx_spim_xfer(&m_spim1, &desc, 0));
+    TEST_ASSERT_EQUAL(2, m_start_count[1]);
+    nrfx_spim_uninit(&m_spim1);
+}
+
+#else
+
+static void test_blocking_not_supported(void)
+{
+    TEST_ASSERT_EQUAL(NRFX_ERROR_NOT_SUPPORTED, spim_init(&m_spim1, NULL));
+    // The instance was not taken.
+    TEST_ASSERT_EQUAL(NRFX_SUCCESS, spim_init(&m_spim1, spim_handler));
+    nrfx_spim_uninit(&m_spim1);
+}
+
+#endif // NRFX_CHECK(NRFX_SPIM_BLOCKING_ENABLED)
+
+#if NRFX_CHECK(NRFX_SPIM2_ENABLED)
+
+static void test_two_instances(void)
+{
+    nrfx_spim_xfer_desc_t desc1 = xfer_desc();
+    nrfx_spim_xfer_desc_t desc2 = xfer_desc();
+
+    TEST_ASSERT_EQUAL(NRFX_SUCCESS, spim_init(&m_spim1, spim_handler));
+    TEST_ASSERT_EQUAL(NRFX_SUCCESS, spim_init(&m_spim2, spim_handler));
+
+    // Each transfer goes to the registers and the control block of its instance.
+    TEST_ASSERT_EQUAL(NRFX_SUCCESS, nrfx_spim_xfer(&m_spim2, &desc2, 0));
+    TEST_ASSERT_EQUAL(0, m_start_count[1]);
+    TEST_ASSERT_EQUAL(1, m_start_count[2]);
+    TEST_ASSERT_EQUAL((uint32_t)(uintptr_t)desc2.p_tx_buffer, NRF_SPIM2->TXD.PTR);
+    TEST_ASSERT_EQUAL(NRFX_SUCCESS, nrfx_spim_xfer(&m_spim1, &desc1, 0));
+    TEST_ASSERT_EQUAL(1, m_start_count[1]);
+    TEST_ASSERT_EQUAL((uint32_t)(uintptr_t)desc1.p_tx_buffer, NRF_SPIM1->TXD.PTR);
+
+    host_irq_call(SPIM2_IRQn, nrfx_spim_2_irq_handler);
+    TEST_ASSERT_EQUAL(0, m_xfer_done[m_spim1.drv_inst_idx]);
+    TEST_ASSERT_EQUAL(1, m_xfer_done[m_spim2.drv_inst_idx]);
+    TEST_ASSERT_EQUAL(NRFX_ERROR_BUSY, nrfx_spim_xfer(&m_spim1, &desc1, 0));
+    host_irq_call(SPIM1_IRQn, nrfx_spim_1_irq_handler);
+    TEST_ASSERT_EQUAL(1, m_xfer_done[m_spim1.drv_inst_idx]);
+
+    nrfx_spim_uninit(&m_spim1);
+    nrfx_spim_uninit(&m_spim2);
+}
+
+#endif // NRFX_CHECK(NRFX_SPIM2_ENABLED)
+
+int main(void)
+{
+    host_periph_init();
+
+    TEST_RUN(test_handler_transfer);
+#if NRFX_CHECK(NRFX_SPIM_BLOCKING_ENABLED)
+    TEST_RUN(test_blocking_transfer);
+#else
+    TEST_RUN(test_blocking_not_supported);
+#endif
+#if NRFX_CHECK(NRFX_SPIM2_ENABLED)
+    TEST_RUN(test_two_instances);
+#endif
+    return 0;
+}
@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Minimal replacement of the CMSIS Cortex-M core header for host builds.
+ * Core registers are plain objects defined in host_cmsis.c, the interrupt
+ * controller is modeled by the nvic_* state there.
+ */
+
+#ifndef CORE_CM4_H__
+#define CORE_CM4_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define __CORTEX_M 4U
+
+#define __I   volatile const
+#define __O   volatile
+#define __IO  volatile
+#define __IM  volatile const
+#define __OM  volatile
+#define __IOM volatile
+
+#define __ASM                  __asm__
+#define __INLINE               inline
+#define __STATIC_INLINE        static inline
+#define __STATIC_FORCEINLINE   static inline __attribute__((always_inline))
+#define __WEAK                 __attribute__((weak))
+#define __ALIGNED(x)           __attribute__((aligned(x)))
+#define __PACKED               __attribute__((packed))
+#define __UNUSED               __attribute__((unused))
+
+#define __NOP() do {} while (0)
+#define __WFE() do {} while (0)
+#define __WFI() do {} while (0)
+#define __SEV() do {} while (0)
+#define __DSB() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#define __DMB() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#define __ISB() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#define __COMPILER_BARRIER() __ASM volatile("" ::: "memory")
+
+static inline uint32_t __CLZ(uint32_t value)
+{
+    return value ? (uint32_t)__builtin_clz(value) : 32U;
+}
+
+static inline uint32_t __RBIT(uint32_t value)
+{
+    uint32_t result = 0;
+    for (int i = 0; i < 32; i++)
+    {
+        result = (result << 1) | ((value >> i) & 1U);
+    }
+    return result;
+}
+
+/*
+ * Exclusive accesses. The host has no exclusive monitor, so the reservation
+ * is a thread local copy of the loaded value and the store is a
+ * compare-and-swap against it. This keeps the retry loops written for
+ * LDREX/STREX correct when the tests run them from several threads.
+ */
+extern __thread uint32_t host_excl_value;
+extern __thread volatile void * host_excl_addr;
+
+static inline uint32_t __LDREXW(volatile uint32_t * p_addr)
+{
+    host_excl_addr  = p_addr;
+    host_excl_value = __atomic_load_n(p_addr, __ATOMIC_SEQ_CST);
+    return host_excl_value;
+}
+
+static inline uint32_t __STREXW(uint32_t value, volatile uint32_t * p_addr)
+{
+    uint32_t expected = host_excl_value;
+
+    if (host_excl_addr != p_addr)
+    {
+        return 1;
+    }
+    host_excl_addr = NULL;
+    return __atomic_compare_exchange_n(p_addr, &expected, value, false,
+                                       __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST) ? 0 : 1;
+}
+
+static inline uint8_t __LDREXB(volatile uint8_t * p_addr)
+{
+    host_excl_addr  = p_addr;
+    host_excl_value = __atomic_load_n(p_addr, __ATOMIC_SEQ_CST);
+    return (uint8_t)host_excl_value;
+}
+
+static inline uint32_t __STREXB(uint8_t value, volatile uint8_t * p_addr)
+{
+    uint8_t expected = (uint8_t)host_excl_value;
+
+    if (host_excl_addr != p_addr)
+    {
+        return 1;
+    }
+    host_excl_addr = NULL;
+    return __atomic_compare_exchange_n(p_addr, &expected, value, false,
+                                       __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST) ? 0 : 1;
+}
+
+static inline void __CLREX(void)
+{
+    host_excl_addr = NULL;
+}
+
+/* Interrupt masking, see host_cmsis.c. */
+uint32_t __get_PRIMASK(void);
+void     __set_PRIMASK(uint32_t primask);
+uint32_t __get_BASEPRI(void);
+void     __set_BASEPRI(uint32_t basepri);
+void     __set_BASEPRI_MAX(uint32_t basepri);
+uint32_t __get_IPSR(void);
+uint32_t __get_MSP(void);
+uint32_t __get_PSP(void);
+void     __disable_irq(void);
+void     __enable_irq(void);
+
+void     NVIC_EnableIRQ(IRQn_Type irqn);
+void     NVIC_DisableIRQ(IRQn_Type irqn);
+uint32_t NVIC_GetEnableIRQ(IRQn_Type irqn);
+void     NVIC_SetPendingIRQ(IRQn_Type irqn);
+void     NVIC_ClearPendingIRQ(IRQn_Type irqn);
+uint32_t NVIC_GetPendingIRQ(IRQn_Type irqn);
+void     NVIC_SetPriority(IRQn_Type irqn, uint32_t priority);
+uint32_t NVIC_GetPriority(IRQn_Type irqn);
+void     NVIC_SystemReset(void);
+
+typedef struct
+{
+    __IOM uint32_t CTRL;
+    __IOM uint32_t CYCCNT;
+} DWT_Type;
+
+typedef struct
+{
+    __IOM uint32_t DHCSR;
+    __IOM uint32_t DEMCR;
+} CoreDebug_Type;
+
+typedef struct
+{
+    __IOM uint32_t ICSR;
+    __IOM uint32_t VTOR;
+    __IOM uint32_t AIRCR;
+    __IOM uint32_t SCR;
+    __IOM uint32_t CCR;
+    __IOM uint32_t SHCSR;
+    __IOM uint32_t CFSR;
+    __IOM uint32_t HFSR;
+    __IOM uint32_t MMFAR;
+    __IOM uint32_t BFAR;
+    __IOM uint32_t CPACR;
+} SCB_Type;
+
+typedef struct
+{
+    __IOM uint32_t CTRL;
+    __IOM uint32_t LOAD;
+    __IOM uint32_t VAL;
+    __IM  uint32_t CALIB;
+} SysTick_Type;
+
+extern DWT_Type       host_dwt;
+extern CoreDebug_Type host_core_debug;
+extern SCB_Type       host_scb;
+extern SysTick_Type   host_systick;
+
+#define DWT       (&host_dwt)
+#define CoreDebug (&host_core_debug)
+#define SCB       (&host_scb)
+#define SysTick   (&host_systick)
+
+#define DWT_CTRL_CYCCNTENA_Msk      (1UL << 0)
+#define CoreDebug_DEMCR_TRCENA_Msk  (1UL << 24)
+#define SCB_SCR_SLEEPDEEP_Msk       (1UL << 2)
+#define SCB_SCR_SEVONPEND_Msk       (1UL << 4)
+#define SCB_ICSR_VECTACTIVE_Pos     0U
+#define SCB_ICSR_VECTACTIVE_Msk     (0x1FFUL)
+#define SCB_VTOR_TBLOFF_Msk         (0xFFFFFF80UL)
+#define SysTick_CTRL_ENABLE_Msk     (1UL << 0)
+#define SysTick_CTRL_TICKINT_Msk    (1UL << 1)
+#define SysTick_CTRL_CLKSOURCE_Msk  (1UL << 2)
+#define SysTick_CTRL_COUNTFLAG_Msk  (1UL << 16)
+#define SysTick_LOAD_RELOAD_Msk     (0xFFFFFFUL)
+#define SysTick_VAL_CURRENT_Msk     (0xFFFFFFUL)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CORE_CM4_H__
@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/* Host replacement of the Zephyr interrupt API used by nrfx_glue. */
+
+#ifndef IRQ_H__
+#define IRQ_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+unsigned int irq_lock(void);
+void         irq_unlock(unsigned int key);
+void         irq_enable(unsigned int irq);
+void         irq_disable(unsigned int irq);
+int          irq_is_enabled(unsigned int irq);
+
+#define ISR_DIRECT_DECLARE(name) \
+    static inline int name##_body(void); \
+    void name(void) { (void)name##_body(); } \
+    static inline int name##_body(void)
+#define ISR_DIRECT_PM() do {} while (0)
+
+#endif // IRQ_H__
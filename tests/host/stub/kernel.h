@@ -0,0 +1,15 @@
+/*
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/* Host replacement of the Zephyr kernel API used by nrfx_glue. */
+
+#ifndef KERNEL_H__
+#define KERNEL_H__
+
+#include <irq.h>
+
+void k_busy_wait(uint32_t usec_to_wait);
+
+#endif // KERNEL_H__
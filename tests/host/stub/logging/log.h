@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/* Host replacement of the Zephyr logging API. Logs are discarded. */
+
+#ifndef LOGGING_LOG_H__
+#define LOGGING_LOG_H__
+
+#define LOG_LEVEL_NONE 0
+#define LOG_LEVEL_ERR  1
+#define LOG_LEVEL_WRN  2
+#define LOG_LEVEL_INF  3
+#define LOG_LEVEL_DBG  4
+
+#define _DO_CONCAT(x, y) x ## y
+#define _CONCAT(x, y)    _DO_CONCAT(x, y)
+
+#define _XXXX1 _YYYY,
+#define Z_IS_ENABLED1(config_macro)      Z_IS_ENABLED2(_XXXX##config_macro)
+#define Z_IS_ENABLED2(one_or_two_args)   Z_IS_ENABLED3(one_or_two_args 1, 0)
+#define Z_IS_ENABLED3(ignore_this, val, ...) val
+#define IS_ENABLED(config_macro)         Z_IS_ENABLED1(config_macro)
+
+#define LOG_MODULE_REGISTER(...) extern int log_module_unused
+
+#define LOG_ERR(...)         ((void)0)
+#define LOG_WRN(...)         ((void)0)
+#define LOG_INF(...)         ((void)0)
+#define LOG_DBG(...)         ((void)0)
+#define LOG_HEXDUMP_ERR(...) ((void)0)
+#define LOG_HEXDUMP_WRN(...) ((void)0)
+#define LOG_HEXDUMP_INF(...) ((void)0)
+#define LOG_HEXDUMP_DBG(...) ((void)0)
+
+#endif // LOGGING_LOG_H__
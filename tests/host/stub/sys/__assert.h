@@ -0,0 +1,17 @@
+/*
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/* Host replacement of the Zephyr assertions, mapped to the C library ones. */
+
+#ifndef SYS___ASSERT_H__
+#define SYS___ASSERT_H__
+
+#include <assert.h>
+
+#define __ASSERT_NO_MSG(test) assert(test)
+#define __ASSERT(test, ...)   assert(test)
+#define BUILD_ASSERT(expr, ...) _Static_assert(expr, "" __VA_ARGS__)
+
+#endif // SYS___ASSERT_H__
@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/* Host replacement of the Zephyr utility macros used by the glue layer. */
+
+#ifndef SYS_UTIL_H__
+#define SYS_UTIL_H__
+
+/*
+ * Expands to if_1_code when flag is defined as 1, and to else_code otherwise.
+ * Both codes must be enclosed in parentheses, as with Zephyr.
+ */
+#define COND_CODE_1(flag, if_1_code, else_code) \
+    Z_COND_CODE_1(flag, if_1_code, else_code)
+
+#define Z_XXXX1 Z_YYYY,
+#define Z_COND_CODE_1(flag, if_1_code, else_code) \
+    Z_COND_CODE(Z_XXXX##flag, if_1_code, else_code)
+#define Z_COND_CODE(one_or_two_args, if_code, else_code) \
+    Z_GET_ARG2_DEBRACKET(one_or_two_args if_code, else_code)
+#define Z_GET_ARG2_DEBRACKET(ignore_this, val, ...) Z_DEBRACKET val
+#define Z_DEBRACKET(...) __VA_ARGS__
+
+#endif // SYS_UTIL_H__
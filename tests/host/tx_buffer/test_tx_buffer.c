@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Checks the pool of transmit buffers lent to the higher layer by the 802.15.4
+ * radio driver. Several threads allocate and release buffers at the same time,
+ * like the thread and interrupt contexts of the device, and a buffer must never
+ * be lent twice. The pool spans more than one bitmap word.
+ */
+
+#include <pthread.h>
+#include <string.h>
+#include "nrf_802154_const.h"
+#include "nrf_802154_tx_buffer.h"
+#include "host_test.h"
+
+#define THREADS    8
+#define ITERATIONS 100000
+
+static void * lend_thread(void * p_arg)
+{
+    uint8_t mark = (uint8_t)(uintptr_t)p_arg;
+
+    for (uint32_t i = 0; i < ITERATIONS; i++)
+    {
+        uint8_t * p_buffer = nrf_802154_tx_buffer_alloc();
+
+        if (p_buffer == NULL)
+        {
+            continue;
+        }
+        TEST_ASSERT(nrf_802154_tx_buffer_is_allocated(p_buffer));
+        // A buffer lent twice would have its frame overwritten by the other owner.
+        memset(p_buffer, mark, PHR_SIZE + MAX_PACKET_SIZE);
+        for (uint32_t j = 0; j < PHR_SIZE + MAX_PACKET_SIZE; j += 16)
+        {
+            TEST_ASSERT_EQUAL(mark, p_buffer[j]);
+        }
+        nrf_802154_tx_buffer_release(p_buffer);
+    }
+    return NULL;
+}
+
+static void test_concurrent(void)
+{
+    pthread_t threads[THREADS];
+
+    nrf_802154_tx_buffer_init();
+    for (uintptr_t i = 0; i < THREADS; i++)
+    {
+        TEST_ASSERT_EQUAL(0, pthread_create(&threads[i], NULL, lend_thread, (void *)(i + 1)));
+    }
+    for (size_t i = 0; i < THREADS; i++)
+    {
+        TEST_ASSERT_EQUAL(0, pthread_join(threads[i], NULL));
+    }
+    // Every buffer was given back.
+    for (uint32_t i = 0; i < NRF_802154_TX_BUFFERS; i++)
+    {
+        TEST_ASSERT(nrf_802154_tx_buffer_alloc() != NULL);
+    }
+    TEST_ASSERT(nrf_802154_tx_buffer_alloc() == NULL);
+}
+
+static void test_exhausted(void)
+{
+    uint8_t * p_buffers[NRF_802154_TX_BUFFERS];
+
+    nrf_802154_tx_buffer_init();
+    for (uint32_t i = 0; i < NRF_802154_TX_BUFFERS; i++)
+    {
+        p_buffers[i] = nrf_802154_tx_buffer_alloc();
+        TEST_ASSERT(p_buffers[i]);
+        for (uint32_t j = 0; j < i; j++)
+        {
+            TEST_ASSERT(p_buffers[i] != p_buffers[j]);
+        }
+    }
+    TEST_ASSERT(nrf_802154_tx_buffer_alloc() == NULL);
+
+    // The released buffer is the one lent next, also from the last bitmap word.
+    nrf_802154_tx_buffer_release(p_buffers[NRF_802154_TX_BUFFERS - 1]);
+    TEST_ASSERT(!nrf_802154_tx_buffer_is_allocated(p_buffers[NRF_802154_TX_BUFFERS - 1]));
+    TEST_ASSERT(nrf_802154_tx_buffer_alloc() == p_buffers[NRF_802154_TX_BUFFERS - 1]);
+
+    // Pointers that are not at the start of a buffer are not transmit buffers.
+    TEST_ASSERT(!nrf_802154_tx_buffer_is_allocated(p_buffers[0] + 1));
+}
+
+int main(void)
+{
+    TEST_RUN(test_concurrent);
+    TEST_RUN(test_exhausted);
+    return 0;
+}
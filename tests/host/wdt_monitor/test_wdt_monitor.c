@@ -0,0 +1,287 @@
+/*
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Checks the crash record captured by the WDT liveness monitor. The exception
+ * entry is simulated by calling nrfx_wdt_monitor_irq_handle with the frame and
+ * the EXC_RETURN value that nrfx_wdt_monitor_irq_handler passes on the device.
+ * The program is built once with the stack snapshot bounded by the initial MSP
+ * and once with the stack RAM given in the configuration.
+ */
+
+#include <string.h>
+#include <nrfx_wdt_monitor.h>
+#include "host_test.h"
+
+#define STACK_WORDS        128
+#define EXC_RETURN_HANDLER 0xFFFFFFF1UL // Return to handler mode, main stack.
+#define EXC_RETURN_MSP     0xFFFFFFF9UL // Return to thread mode, main stack.
+#define EXC_RETURN_PSP     0xFFFFFFFDUL // Return to thread mode, process stack.
+
+// Stacks of threads are placed below and above the main stack. The stack RAM given
+// in the configuration starts at the main stack and ends a few words before the
+// end of the upper thread stack.
+#define m_thread_stack      (&m_ram[0])
+#define m_main_stack        (&m_ram[STACK_WORDS])
+#define m_thread_stack_high (&m_ram[2 * STACK_WORDS])
+#define RAM_WORDS           (3 * STACK_WORDS)
+#define STACK_RAM_END       (&m_ram[RAM_WORDS - 4])
+
+static nrfx_wdt_t const            m_wdt = NRFX_WDT_INSTANCE(0);
+static nrfx_wdt_monitor_retained_t m_retained;
+static uint32_t                    m_ram[RAM_WORDS];
+static nrfx_wdt_channel_id         m_ch_idle;
+static uint32_t                    m_vectors[32] __attribute__((aligned(128)));
+static uint32_t                    m_time;
+static uint32_t                    m_handler_count;
+
+static uint32_t time_get(void)
+{
+    return m_time;
+}
+
+static void monitor_handler(void)
+{
+    m_handler_count++;
+}
+
+/* Builds an exception frame at the given word of the stack. The words below it look like
+ * EXC_RETURN values and frames, so any search of the stack would find them first. */
+static uint32_t * frame_build(uint32_t * p_stack, size_t index, uint32_t pc)
+{
+    uint32_t * p_frame = &p_stack[index];
+
+    for (size_t i = 0; i < index; i++)
+    {
+        p_stack[i] = (i % 2) ? EXC_RETURN_MSP : 0x01000000UL;
+    }
+    for (size_t i = 0; i < 5; i++)
+    {
+        p_frame[i] = 0xA0 + i; // R0-R3, R12
+    }
+    p_frame[5] = 0x00001235UL; // LR
+    p_frame[6] = pc;
+    p_frame[7] = 0x01000000UL; // xPSR with the Thumb bit
+    for (size_t i = index + 8; i < STACK_WORDS; i++)
+    {
+        p_stack[i] = 0x5A000000UL + i;
+    }
+    return p_frame;
+}
+
+/* The monitor is initialized once, as the watchdog cannot be stopped. */
+static void monitor_init(void)
+{
+    nrfx_wdt_config_t         wdt_config = NRFX_WDT_DEFAULT_CONFIG;
+    nrfx_wdt_monitor_config_t config =
+    {
+        .p_retained = &m_retained,
+        .time_get   = time_get,
+        .handler    = monitor_handler,
+#if WDT_MONITOR_STACK_RAM
+        .ram_start  = (uintptr_t)m_main_stack,
+        .ram_end    = (uintptr_t)STACK_RAM_END,
+#endif
+    };
+    nrfx_wdt_channel_id ch_radio;
+
+    memset(&m_retained, 0xFF, sizeof(m_retained));
+    m_time = 100;
+    TEST_ASSERT_EQUAL(NRFX_SUCCESS, nrfx_wdt_monitor_init(&m_wdt, &wdt_config, &config));
+    TEST_ASSERT(nrfx_wdt_monitor_record_get() == NULL);
+    TEST_ASSERT_EQUAL(NRFX_SUCCESS, nrfx_wdt_monitor_channel_alloc("idle", &m_ch_idle));
+    TEST_ASSERT_EQUAL(NRFX_SUCCESS, nrfx_wdt_monitor_channel_alloc("radio_thread", &ch_radio));
+    nrfx_wdt_monitor_enable();
+}
+
+static void monitor_start(void)
+{
+    // Without the stack RAM configured, the initial MSP at the top of the main stack bounds
+    // the stack snapshot.
+    m_vectors[0] = (uint32_t)(uintptr_t)&m_main_stack[STACK_WORDS];
+    SCB->VTOR    = (uint32_t)(uintptr_t)m_vectors;
+
+    nrfx_wdt_monitor_record_clear();
+    m_handler_count = 0;
+    m_time          = 200;
+    nrfx_wdt_monitor_feed(m_ch_idle);
+}
+
+/* Raises the TIMEOUT event with the radio channel not fed and enters the interrupt. */
+static nrfx_wdt_monitor_record_t const * timeout(uint32_t const * p_frame, uint32_t exc_return)
+{
+    nrfx_wdt_monitor_record_t const * p_record;
+
+    m_time = 300;
+    *(volatile uint32_t *)&NRF_WDT->REQSTATUS = 1UL << 1;
+    NRF_WDT->EVENTS_TIMEOUT = 1;
+    nrfx_wdt_monitor_irq_handle(p_frame, exc_return);
+    TEST_ASSERT_EQUAL(1, m_handler_count);
+    TEST_ASSERT_EQUAL(0, NRF_WDT->EVENTS_TIMEOUT);
+
+    p_record = nrfx_wdt_monitor_record_get();
+    TEST_ASSERT(p_record);
+    TEST_ASSERT_EQUAL(300, p_record->timestamp);
+    TEST_ASSERT_EQUAL(2, p_record->channel_count);
+    TEST_ASSERT_EQUAL(1UL << 1, p_record->stalled_mask);
+    TEST_ASSERT(strcmp("idle", p_record->channels[0].name) == 0);
+    TEST_ASSERT_EQUAL(200, p_record->channels[0].last_feed);
+    // The name is truncated, and the channel was last fed when it was allocated.
+    TEST_ASSERT(strcmp("radio_t", p_record->channels[1].name) == 0);
+    TEST_ASSERT_EQUAL(100, p_record->channels[1].last_feed);
+    return p_record;
+}
+
+static void test_no_exc_return(void)
+{
+    // Entered through a wrapper, LR is an ordinary return address.
+    uint32_t const * p_frame = frame_build(m_main_stack, 100, 0x00002468UL);
+
+    monitor_start();
+    nrfx_wdt_monitor_record_t const * p_record = timeout(p_frame, 0x00005679UL);
+
+    TEST_ASSERT_EQUAL(0, p_record->pc);
+    TEST_ASSERT_EQUAL(0, p_record->sp);
+    TEST_ASSERT_EQUAL(0, p_record->stack_words);
+    TEST_ASSERT_EQUAL(NRFX_WDT_MONITOR_RECORD_NO_FRAME, p_record->flags);
+}
+
+#if WDT_MONITOR_STACK_RAM
+
+static void test_stack_ram_bounds(void)
+{
+    // A thread stack linked above the main stack, as on Zephyr, is within the stack RAM.
+    uint32_t const * p_frame = frame_build(m_thread_stack_high, 110, 0x00005000UL);
+
+    frame_build(m_main_stack, 120, 0x0000DEADUL);
+    monitor_start();
+    nrfx_wdt_monitor_record_t const * p_record = timeout(p_frame, EXC_RETURN_PSP);
+
+    TEST_ASSERT_EQUAL(0x00005000UL, p_record->pc);
+    TEST_ASSERT_EQUAL((uint32_t)(uintptr_t)p_frame, p_record->sp);
+    TEST_ASSERT_EQUAL(0, p_record->flags);
+    // The snapshot is bounded by the end of the stack RAM, not by the initial MSP.
+    TEST_ASSERT_EQUAL(STACK_WORDS - 4 - 110, p_record->stack_words);
+    TEST_ASSERT(memcmp(p_frame, p_record->stack, (STACK_WORDS - 4 - 110) * sizeof(uint32_t)) == 0);
+}
+
+static void test_frame_below_stack_ram(void)
+{
+    uint32_t const * p_frame = frame_build(m_thread_stack, 64, 0x00004000UL);
+
+    monitor_start();
+    nrfx_wdt_monitor_record_t const * p_record = timeout(p_frame, EXC_RETURN_PSP);
+
+    TEST_ASSERT_EQUAL(NRFX_WDT_MONITOR_RECORD_FRAME_OUT_OF_RANGE, p_record->flags);
+    TEST_ASSERT_EQUAL((uint32_t)(uintptr_t)p_frame, p_record->sp);
+    TEST_ASSERT_EQUAL(0, p_record->pc);
+    TEST_ASSERT_EQUAL(0, p_record->stack_words);
+}
+
+static void test_frame_past_stack_ram(void)
+{
+    // The frame does not fit below the end of the stack RAM.
+    uint32_t const * p_frame = frame_build(m_thread_stack_high, STACK_WORDS - 8, 0x00004000UL);
+
+    monitor_start();
+    nrfx_wdt_monitor_record_t const * p_record = timeout(p_frame, EXC_RETURN_PSP);
+
+    TEST_ASSERT_EQUAL(NRFX_WDT_MONITOR_RECORD_FRAME_OUT_OF_RANGE, p_record->flags);
+    TEST_ASSERT_EQUAL(0, p_record->stack_words);
+}
+
+#else
+
+static void test_main_stack(void)
+{
+    uint32_t const * p_frame = frame_build(m_main_stack, 100, 0x00002468UL);
+
+    monitor_start();
+    nrfx_wdt_monitor_record_t const * p_record = timeout(p_frame, EXC_RETURN_MSP);
+
+    TEST_ASSERT_EQUAL(0x00002468UL, p_record->pc);
+    TEST_ASSERT_EQUAL(0x00001235UL, p_record->lr);
+    TEST_ASSERT_EQUAL(0x01000000UL, p_record->xpsr);
+    TEST_ASSERT_EQUAL((uint32_t)(uintptr_t)p_frame, p_record->sp);
+    // The snapshot ends at the top of the main stack.
+    TEST_ASSERT_EQUAL(STACK_WORDS - 100, p_record->stack_words);
+    TEST_ASSERT(memcmp(p_frame, p_record->stack, (STACK_WORDS - 100) * sizeof(uint32_t)) == 0);
+
+    nrfx_wdt_monitor_record_clear();
+    TEST_ASSERT(nrfx_wdt_monitor_record_get() == NULL);
+}
+
+static void test_nested_handler(void)
+{
+    uint32_t const * p_frame = frame_build(m_main_stack, 40, 0x00003000UL);
+
+    monitor_start();
+    nrfx_wdt_monitor_record_t const * p_record = timeout(p_frame, EXC_RETURN_HANDLER);
+
+    TEST_ASSERT_EQUAL(0x00003000UL, p_record->pc);
+    TEST_ASSERT_EQUAL(NRFX_WDT_MONITOR_CONFIG_STACK_WORDS, p_record->stack_words);
+}
+
+static void test_process_stack(void)
+{
+    // The main stack holds only values that look like a frame, the thread runs on the process stack.
+    uint32_t const * p_frame = frame_build(m_thread_stack, 64, 0x00004000UL);
+
+    frame_build(m_main_stack, 120, 0x0000DEADUL);
+    monitor_start();
+    nrfx_wdt_monitor_record_t const * p_record = timeout(p_frame, EXC_RETURN_PSP);
+
+    TEST_ASSERT_EQUAL(0x00004000UL, p_record->pc);
+    TEST_ASSERT_EQUAL((uint32_t)(uintptr_t)p_frame, p_record->sp);
+}
+
+static void test_frame_out_of_stack(void)
+{
+    // A frame that does not fit below the top of the main stack is not trusted.
+    uint32_t const * p_frame = frame_build(m_main_stack, STACK_WORDS - 8, 0x00002468UL);
+
+    monitor_start();
+    m_vectors[0] = (uint32_t)(uintptr_t)&m_main_stack[STACK_WORDS - 4];
+    nrfx_wdt_monitor_record_t const * p_record = timeout(p_frame, EXC_RETURN_MSP);
+
+    TEST_ASSERT_EQUAL(0, p_record->pc);
+    TEST_ASSERT_EQUAL(0, p_record->stack_words);
+    TEST_ASSERT_EQUAL((uint32_t)(uintptr_t)p_frame, p_record->sp);
+    TEST_ASSERT_EQUAL(NRFX_WDT_MONITOR_RECORD_FRAME_OUT_OF_RANGE, p_record->flags);
+}
+
+static void test_thread_above_main_stack(void)
+{
+    // Without the stack RAM configured, a thread stack above the initial MSP is out of range.
+    uint32_t const * p_frame = frame_build(m_thread_stack_high, 64, 0x00005000UL);
+
+    monitor_start();
+    nrfx_wdt_monitor_record_t const * p_record = timeout(p_frame, EXC_RETURN_PSP);
+
+    TEST_ASSERT_EQUAL(NRFX_WDT_MONITOR_RECORD_FRAME_OUT_OF_RANGE, p_record->flags);
+    TEST_ASSERT_EQUAL((uint32_t)(uintptr_t)p_frame, p_record->sp);
+    TEST_ASSERT_EQUAL(0, p_record->pc);
+}
+
+#endif // WDT_MONITOR_STACK_RAM
+
+int main(void)
+{
+    host_periph_reset();
+    monitor_init();
+    TEST_RUN(test_no_exc_return);
+#if WDT_MONITOR_STACK_RAM
+    TEST_RUN(test_stack_ram_bounds);
+    TEST_RUN(test_frame_below_stack_ram);
+    TEST_RUN(test_frame_past_stack_ram);
+#else
+    TEST_RUN(test_main_stack);
+    TEST_RUN(test_nested_handler);
+    TEST_RUN(test_process_stack);
+    TEST_RUN(test_frame_out_of_stack);
+    TEST_RUN(test_thread_above_main_stack);
+#endif
+    return 0;
+}
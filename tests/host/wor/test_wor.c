@@ -0,0 +1,407 @@
+/*
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Checks the wake-on-radio listen of the 802.15.4 radio driver. The Radio
+ * Scheduler, the timer scheduler, the requests and the critical section are
+ * replaced by stubs, and the test plays the timeslots, the energy detection
+ * results and the frames. The statistics must only be updated in the critical
+ * section, which must be left balanced by every call.
+ */
+
+#include "nrf_802154_const.h"
+#include "nrf_802154_critical_section.h"
+#include "nrf_802154_procedures_duration.h"
+#include "nrf_802154_request.h"
+#include "mac_features/nrf_802154_wor.h"
+#include "rsch/nrf_802154_rsch.h"
+#include "timer_scheduler/nrf_802154_timer_sched.h"
+#include "host_test.h"
+
+#define INTERVAL    100000
+#define SAMPLE_TIME 500
+#define HOLD_TIME   20000
+#define THRESHOLD   50
+#define T_START     1000
+#define MARGIN      1000
+#define RX_TIME     nrf_802154_rx_duration_get(MAX_PACKET_SIZE, true)
+
+static uint32_t             m_now;
+static nrf_802154_timer_t * mp_timer;
+static uint32_t             m_cs_depth;
+static uint32_t             m_cs_count;
+static uint32_t             m_rsch_fail;
+static uint32_t             m_rsch_requests;
+static uint32_t             m_rsch_cancels;
+static uint32_t             m_rsch_t0;
+static uint32_t             m_rsch_dt;
+static bool                 m_sleep_result;
+static uint32_t             m_sleep_requests;
+static bool                 m_ed_result;
+static uint32_t             m_ed_requests;
+
+uint32_t nrf_802154_timer_sched_time_get(void)
+{
+    return m_now;
+}
+
+bool nrf_802154_timer_sched_time_is_in_future(uint32_t now, uint32_t t0, uint32_t dt)
+{
+    return (int32_t)(t0 + dt - now) > 0;
+}
+
+void nrf_802154_timer_sched_add(nrf_802154_timer_t * p_timer, bool round_up)
+{
+    (void)round_up;
+    TEST_ASSERT(p_timer->callback != NULL);
+    mp_timer = p_timer;
+}
+
+void nrf_802154_timer_sched_remove(nrf_802154_timer_t * p_timer, bool * p_was_running)
+{
+    if (p_was_running != NULL)
+    {
+        *p_was_running = (mp_timer == p_timer);
+    }
+    if (mp_timer == p_timer)
+    {
+        mp_timer = NULL;
+    }
+}
+
+void nrf_802154_critical_section_forcefully_enter(void)
+{
+    m_cs_depth++;
+    m_cs_count++;
+}
+
+void nrf_802154_critical_section_exit(void)
+{
+    TEST_ASSERT(m_cs_depth > 0);
+    m_cs_depth--;
+}
+
+bool nrf_802154_rsch_delayed_timeslot_request(uint32_t         t0,
+                                              uint32_t         dt,
+                                              uint32_t         length,
+                                              rsch_prio_t      prio,
+                                              rsch_dly_ts_id_t dly_ts)
+{
+    TEST_ASSERT_EQUAL(SAMPLE_TIME, length);
+    TEST_ASSERT_EQUAL(RSCH_PRIO_DETECT, prio);
+    TEST_ASSERT_EQUAL(RSCH_DLY_WOR, dly_ts);
+    if (m_rsch_fail > 0)
+    {
+        m_rsch_fail--;
+        return false;
+    }
+    m_rsch_requests++;
+    m_rsch_t0 = t0;
+    m_rsch_dt = dt;
+    return true;
+}
+
+bool nrf_802154_rsch_delayed_timeslot_cancel(rsch_dly_ts_id_t dly_ts_id)
+{
+    TEST_ASSERT_EQUAL(RSCH_DLY_WOR, dly_ts_id);
+    m_rsch_cancels++;
+    return true;
+}
+
+bool nrf_802154_request_sleep(nrf_802154_term_t term_lvl)
+{
+    TEST_ASSERT_EQUAL(NRF_802154_TERM_NONE, term_lvl);
+    m_sleep_requests++;
+    return m_sleep_result;
+}
+
+bool nrf_802154_request_energy_detection(nrf_802154_term_t term_lvl, uint32_t time_us)
+{
+    TEST_ASSERT_EQUAL(NRF_802154_TERM_NONE, term_lvl);
+    TEST_ASSERT_EQUAL(SAMPLE_TIME, time_us);
+    m_ed_requests++;
+    return m_ed_result;
+}
+
+/* Checks the timer armed by the module and fires it at its expiry. */
+static void timer_expect_and_fire(uint32_t t0, uint32_t dt)
+{
+    nrf_802154_timer_t * p_timer = mp_timer;
+
+    TEST_ASSERT(p_timer != NULL);
+    TEST_ASSERT_EQUAL(t0, p_timer->t0);
+    TEST_ASSERT_EQUAL(dt, p_timer->dt);
+    mp_timer = NULL;
+    m_now    = t0 + dt;
+    p_timer->callback(p_timer->p_context);
+    TEST_ASSERT_EQUAL(0, m_cs_depth);
+}
+
+/* Checks the timeslot requested for the next sample and starts it. */
+static void timeslot_expect_and_start(uint32_t t0)
+{
+    TEST_ASSERT_EQUAL(t0, m_rsch_t0);
+    TEST_ASSERT_EQUAL(INTERVAL, m_rsch_dt);
+    m_now = t0 + INTERVAL;
+    nrf_802154_wor_timeslot_started();
+    TEST_ASSERT_EQUAL(0, m_cs_depth);
+}
+
+static void sample_end(uint32_t dt, uint8_t result)
+{
+    m_now += dt;
+    TEST_ASSERT(nrf_802154_wor_energy_detected_hook(result));
+    TEST_ASSERT_EQUAL(0, m_cs_depth);
+}
+
+static void stats_expect(uint32_t samples,
+                         uint32_t skipped,
+                         uint32_t wakeups,
+                         uint32_t missed,
+                         uint32_t frames,
+                         uint64_t time_on,
+                         uint64_t time_total)
+{
+    nrf_802154_wor_stats_t stats;
+
+    nrf_802154_wor_stats_get(&stats);
+    TEST_ASSERT_EQUAL(0, m_cs_depth);
+    TEST_ASSERT_EQUAL(samples, stats.samples);
+    TEST_ASSERT_EQUAL(skipped, stats.samples_skipped);
+    TEST_ASSERT_EQUAL(wakeups, stats.wakeups);
+    TEST_ASSERT_EQUAL(missed, stats.wakeups_missed);
+    TEST_ASSERT_EQUAL(frames, stats.frames);
+    TEST_ASSERT_EQUAL(time_on, stats.time_on);
+    TEST_ASSERT_EQUAL(time_total, stats.time_total);
+}
+
+/* Starts the listen at T_START, with the radio going to sleep right away. */
+static void wor_start(void)
+{
+    mp_timer         = NULL;
+    m_cs_depth       = 0;
+    m_cs_count       = 0;
+    m_rsch_fail      = 0;
+    m_rsch_requests  = 0;
+    m_rsch_cancels   = 0;
+    m_sleep_result   = true;
+    m_sleep_requests = 0;
+    m_ed_result      = true;
+    m_ed_requests    = 0;
+    m_now            = T_START;
+
+    nrf_802154_wor_init();
+    TEST_ASSERT(nrf_802154_wor_start(INTERVAL, SAMPLE_TIME, HOLD_TIME, THRESHOLD));
+    TEST_ASSERT(nrf_802154_wor_is_active());
+    TEST_ASSERT_EQUAL(1, m_sleep_requests);
+    TEST_ASSERT_EQUAL(1, m_rsch_requests);
+    TEST_ASSERT_EQUAL(0, m_cs_depth);
+}
+
+static void test_start_parameters(void)
+{
+    nrf_802154_wor_init();
+    TEST_ASSERT(!nrf_802154_wor_start(INTERVAL, 0, HOLD_TIME, THRESHOLD));
+    TEST_ASSERT(!nrf_802154_wor_start(SAMPLE_TIME, SAMPLE_TIME, HOLD_TIME, THRESHOLD));
+    TEST_ASSERT(!nrf_802154_wor_is_active());
+
+    wor_start();
+    TEST_ASSERT(!nrf_802154_wor_start(INTERVAL, SAMPLE_TIME, HOLD_TIME, THRESHOLD));
+    nrf_802154_wor_stop();
+}
+
+static void test_sample_below_threshold(void)
+{
+    wor_start();
+    timeslot_expect_and_start(T_START);
+    TEST_ASSERT_EQUAL(1, m_ed_requests);
+    TEST_ASSERT(mp_timer != NULL);
+    TEST_ASSERT_EQUAL(SAMPLE_TIME + MARGIN, mp_timer->dt);
+
+    // The radio goes back to sleep, and the next sample stays aligned to the interval.
+    sample_end(SAMPLE_TIME, THRESHOLD - 1);
+    TEST_ASSERT(mp_timer == NULL);
+    TEST_ASSERT_EQUAL(2, m_sleep_requests);
+    TEST_ASSERT_EQUAL(2, m_rsch_requests);
+    stats_expect(1, 0, 0, 0, 0, SAMPLE_TIME, INTERVAL + SAMPLE_TIME);
+
+    timeslot_expect_and_start(T_START + INTERVAL);
+    sample_end(SAMPLE_TIME, 0);
+    TEST_ASSERT_EQUAL(T_START + 2 * INTERVAL, m_rsch_t0);
+    stats_expect(2, 0, 0, 0, 0, 2 * SAMPLE_TIME, 2 * INTERVAL + SAMPLE_TIME);
+
+    // Energy detection requested by the higher layer is not consumed.
+    TEST_ASSERT(!nrf_802154_wor_energy_detected_hook(THRESHOLD));
+    nrf_802154_wor_stop();
+}
+
+static void test_wakeup(void)
+{
+    uint32_t t_sample;
+    uint32_t t_frame;
+    uint64_t time_on;
+
+    wor_start();
+    timeslot_expect_and_start(T_START);
+    t_sample = m_now;
+
+    // The radio is held awake, and every frame start extends the hold time.
+    sample_end(SAMPLE_TIME, THRESHOLD);
+    TEST_ASSERT_EQUAL(1, m_sleep_requests);
+    m_now  += HOLD_TIME / 2;
+    t_frame = m_now;
+    nrf_802154_wor_rx_started_hook(NULL);
+    timer_expect_and_fire(t_sample + SAMPLE_TIME, HOLD_TIME);
+    TEST_ASSERT_EQUAL(1, m_sleep_requests);
+    timer_expect_and_fire(t_frame, HOLD_TIME);
+    TEST_ASSERT_EQUAL(2, m_sleep_requests);
+    stats_expect(1, 0, 1, 0, 1,
+                 t_frame + HOLD_TIME - t_sample, t_frame + HOLD_TIME - T_START);
+
+    // The next sample stays aligned to the interval.
+    timeslot_expect_and_start(T_START + INTERVAL);
+
+    // A wakeup without any frame is counted as missed.
+    time_on  = t_frame + HOLD_TIME - t_sample;
+    t_sample = m_now;
+    sample_end(SAMPLE_TIME, UINT8_MAX);
+    timer_expect_and_fire(t_sample + SAMPLE_TIME, HOLD_TIME);
+    stats_expect(2, 0, 2, 1, 1, time_on + SAMPLE_TIME + HOLD_TIME, m_now - T_START);
+    nrf_802154_wor_stop();
+}
+
+static void test_busy_radio(void)
+{
+    uint32_t t0;
+
+    // The radio cannot go to sleep when the listen starts, so it is retried after a frame.
+    wor_start();
+    nrf_802154_wor_stop();
+    m_sleep_result = false;
+    m_now          = T_START;
+    TEST_ASSERT(nrf_802154_wor_start(INTERVAL, SAMPLE_TIME, HOLD_TIME, THRESHOLD));
+    TEST_ASSERT_EQUAL(2, m_sleep_requests);
+    TEST_ASSERT_EQUAL(1, m_rsch_requests);
+    timer_expect_and_fire(T_START, RX_TIME);
+    TEST_ASSERT_EQUAL(3, m_sleep_requests);
+    m_sleep_result = true;
+    timer_expect_and_fire(T_START + RX_TIME, RX_TIME);
+    TEST_ASSERT_EQUAL(4, m_sleep_requests);
+    TEST_ASSERT_EQUAL(2, m_rsch_requests);
+    stats_expect(0, 0, 0, 0, 0, 2 * RX_TIME, 2 * RX_TIME);
+
+    // The radio is busy when the timeslot starts, so it goes to sleep after a frame.
+    t0          = m_rsch_t0;
+    m_ed_result = false;
+    timeslot_expect_and_start(t0);
+    TEST_ASSERT(mp_timer != NULL);
+    m_ed_result = true;
+    timer_expect_and_fire(t0 + INTERVAL, RX_TIME);
+    TEST_ASSERT_EQUAL(5, m_sleep_requests);
+    TEST_ASSERT_EQUAL(3, m_rsch_requests);
+    stats_expect(0, 1, 0, 0, 0, 3 * RX_TIME, m_now - T_START);
+
+    // The sample is aborted by a request of the higher layer and never ends.
+    t0 = m_rsch_t0;
+    timeslot_expect_and_start(t0);
+    timer_expect_and_fire(t0 + INTERVAL, SAMPLE_TIME + MARGIN);
+    TEST_ASSERT_EQUAL(6, m_sleep_requests);
+    stats_expect(0, 2, 0, 0, 0, 3 * RX_TIME + SAMPLE_TIME + MARGIN, m_now - T_START);
+
+    // The timeslot cannot be requested at the aligned time, then not at all.
+    m_rsch_fail = 1;
+    t0          = m_rsch_t0;
+    timeslot_expect_and_start(t0);
+    sample_end(SAMPLE_TIME, 0);
+    TEST_ASSERT_EQUAL(m_now, m_rsch_t0);
+    TEST_ASSERT(nrf_802154_wor_is_active());
+    m_rsch_fail = 2;
+    timeslot_expect_and_start(m_rsch_t0);
+    sample_end(SAMPLE_TIME, 0);
+    TEST_ASSERT(!nrf_802154_wor_is_active());
+}
+
+static void test_stop(void)
+{
+    nrf_802154_wor_stats_t stats;
+    uint32_t               cancels;
+
+    // Asleep: only the total time is counted.
+    wor_start();
+    m_now += INTERVAL / 2;
+    nrf_802154_wor_stop();
+    TEST_ASSERT(!nrf_802154_wor_is_active());
+    TEST_ASSERT_EQUAL(1, m_rsch_cancels);
+    stats_expect(0, 0, 0, 0, 0, 0, INTERVAL / 2);
+
+    // Stopped: nothing changes, the next timeslot is ignored.
+    m_now += INTERVAL;
+    nrf_802154_wor_stop();
+    stats_expect(0, 0, 0, 0, 0, 0, INTERVAL / 2);
+    nrf_802154_wor_timeslot_started();
+    TEST_ASSERT_EQUAL(0, m_ed_requests);
+
+    // Sampling: the sample is not taken into account anymore.
+    wor_start();
+    timeslot_expect_and_start(T_START);
+    m_now += SAMPLE_TIME / 2;
+    nrf_802154_wor_stop();
+    TEST_ASSERT(mp_timer == NULL);
+    TEST_ASSERT(!nrf_802154_wor_energy_detected_hook(THRESHOLD));
+    stats_expect(0, 0, 0, 0, 0, SAMPLE_TIME / 2, INTERVAL + SAMPLE_TIME / 2);
+
+    // Held awake: the radio is left receiving.
+    wor_start();
+    timeslot_expect_and_start(T_START);
+    sample_end(SAMPLE_TIME, THRESHOLD);
+    m_now  += HOLD_TIME / 2;
+    cancels = m_rsch_cancels;
+    nrf_802154_wor_stop();
+    TEST_ASSERT(mp_timer == NULL);
+    TEST_ASSERT_EQUAL(cancels + 1, m_rsch_cancels);
+    TEST_ASSERT_EQUAL(1, m_sleep_requests);
+    nrf_802154_wor_rx_started_hook(NULL);
+    stats_expect(1, 0, 1, 0, 0, SAMPLE_TIME + HOLD_TIME / 2, INTERVAL + SAMPLE_TIME + HOLD_TIME / 2);
+
+    // The statistics are kept until the listen starts again.
+    m_now += INTERVAL;
+    nrf_802154_wor_stats_get(&stats);
+    TEST_ASSERT_EQUAL(INTERVAL + SAMPLE_TIME + HOLD_TIME / 2, stats.time_total);
+}
+
+static void test_stats_accounting(void)
+{
+    wor_start();
+
+    // The total time runs while the radio sleeps, the time on only while it is awake.
+    m_now += INTERVAL / 4;
+    stats_expect(0, 0, 0, 0, 0, 0, INTERVAL / 4);
+    timeslot_expect_and_start(T_START);
+    m_now += SAMPLE_TIME / 2;
+    stats_expect(0, 0, 0, 0, 0, 0, INTERVAL + SAMPLE_TIME / 2);
+    sample_end(SAMPLE_TIME / 2, 0);
+    stats_expect(1, 0, 0, 0, 0, SAMPLE_TIME, INTERVAL + SAMPLE_TIME);
+
+    // The time counts across the wrap-around of the timer.
+    nrf_802154_wor_stop();
+    m_now = UINT32_MAX - INTERVAL / 2;
+    TEST_ASSERT(nrf_802154_wor_start(INTERVAL, SAMPLE_TIME, HOLD_TIME, THRESHOLD));
+    timeslot_expect_and_start(m_now);
+    sample_end(SAMPLE_TIME, 0);
+    nrf_802154_wor_stop();
+    stats_expect(2, 0, 0, 0, 0, 2 * SAMPLE_TIME, 2 * (INTERVAL + SAMPLE_TIME));
+    TEST_ASSERT(m_cs_count > 0);
+}
+
+int main(void)
+{
+    TEST_RUN(test_start_parameters);
+    TEST_RUN(test_sample_below_threshold);
+    TEST_RUN(test_wakeup);
+    TEST_RUN(test_busy_radio);
+    TEST_RUN(test_stop);
+    TEST_RUN(test_stats_accounting);
+    return 0;
+}